@@ -16,6 +16,17 @@
 #ifndef CONFIG_H
 #define CONFIG_H
 
+/**
+ * Large heap mode
+ *
+ * In the mode the engine's heap is reserved in the process' address space with mmap,
+ * instead of being statically allocated, and is large enough for memory-hungry workloads.
+ *
+ * Compressed pointers are widened correspondingly (see also: CONFIG_MEM_HEAP_OFFSET_LOG),
+ * so ECMA Object Model's data types become larger (see also: CONFIG_MEM_POOL_CHUNK_SIZE).
+ */
+// #define CONFIG_MEM_LARGE_HEAP
+
 /**
  * Limit of data (system heap, engine's data except engine's own heap)
  */
@@ -36,7 +47,18 @@
  *
  * Should not be less than size of any of ECMA Object Model's data types.
  */
-#define CONFIG_MEM_POOL_CHUNK_SIZE (8)
+#ifndef CONFIG_MEM_LARGE_HEAP
+# define CONFIG_MEM_POOL_CHUNK_SIZE (8)
+#else /* CONFIG_MEM_LARGE_HEAP */
+# define CONFIG_MEM_POOL_CHUNK_SIZE (16)
+#endif /* CONFIG_MEM_LARGE_HEAP */
+
+/**
+ * Number of pool chunk size classes
+ *
+ * Chunks of i-th size class are CONFIG_MEM_POOL_CHUNK_SIZE * 2 ^ i bytes long.
+ */
+#define CONFIG_MEM_POOL_SIZE_CLASSES_NUMBER (4)
 
 /**
  * Minimum number of chunks in a pool allocated by pools' manager.
@@ -52,7 +74,11 @@
  * Size of heap
  */
 #ifndef CONFIG_MEM_HEAP_AREA_SIZE
-# define CONFIG_MEM_HEAP_AREA_SIZE (256 * 1024)
+# ifndef CONFIG_MEM_LARGE_HEAP
+#  define CONFIG_MEM_HEAP_AREA_SIZE (256 * 1024)
+# else /* CONFIG_MEM_LARGE_HEAP */
+#  define CONFIG_MEM_HEAP_AREA_SIZE (64 * 1024 * 1024)
+# endif /* CONFIG_MEM_LARGE_HEAP */
 #endif /* !CONFIG_MEM_HEAP_AREA_SIZE */
 
 /**
@@ -70,7 +96,11 @@
  *
  * On the other hand, value 2 ^ CONFIG_MEM_HEAP_OFFSET_LOG should not be less than CONFIG_MEM_HEAP_AREA_SIZE.
  */
-#define CONFIG_MEM_HEAP_OFFSET_LOG (18)
+#ifndef CONFIG_MEM_LARGE_HEAP
+# define CONFIG_MEM_HEAP_OFFSET_LOG (18)
+#else /* CONFIG_MEM_LARGE_HEAP */
+# define CONFIG_MEM_HEAP_OFFSET_LOG (26)
+#endif /* CONFIG_MEM_LARGE_HEAP */
 
 /**
  * Number of lower bits in key of literal hash table.
@@ -128,15 +158,69 @@
 #endif /* CONFIG_ECMA_CHAR_ENCODING */
 
 /**
- * Number of ecma-values inlined into stack frame
+ * Minimal number of value slots in ecma-stack's array
+ *
+ * The array grows twice when it is full, and shrinks twice when no more than quarter of it is used.
+ */
+#define CONFIG_ECMA_STACK_MIN_VALUES_NUMBER (64)
+
+/**
+ * Number of entries in garbage collector's worklist of gray objects
+ *
+ * If the worklist overflows, marking falls back to rescanning the list of all objects.
+ */
+#define CONFIG_ECMA_GC_WORKLIST_SIZE (256)
+
+/**
+ * Number of object allocations between automatic steps of incremental garbage collector
+ */
+#define CONFIG_ECMA_GC_INCREMENTAL_STEP_ALLOCATIONS (32)
+
+/**
+ * Work budget of an automatic step of incremental garbage collector (number of objects to process)
+ */
+#define CONFIG_ECMA_GC_INCREMENTAL_STEP_BUDGET (256)
+
+/**
+ * Growth factor of heap usage (in percents of the heap usage that remained after last garbage collection),
+ * upon reaching which garbage collection is triggered by the proactive trigger policy
+ */
+#define CONFIG_ECMA_GC_PROACTIVE_GROWTH_PERCENT (200)
+
+/**
+ * Minimal growth of heap usage (in bytes) since last garbage collection,
+ * required for garbage collection to be triggered by the proactive trigger policy
+ */
+#define CONFIG_ECMA_GC_PROACTIVE_MIN_GROWTH (CONFIG_MEM_HEAP_DESIRED_LIMIT)
+
+/**
+ * Number of objects in garbage collector's nursery (young generation), upon reaching which
+ * minor collection is performed
  */
-#define CONFIG_ECMA_STACK_FRAME_INLINED_VALUES_NUMBER (16)
+#define CONFIG_ECMA_GC_NURSERY_SIZE (256)
+
+/**
+ * Number of entries in garbage collector's remembered set (old objects that may reference nursery objects)
+ *
+ * If the remembered set overflows, full garbage collection is performed instead of next minor collection.
+ */
+#define CONFIG_ECMA_GC_REMEMBERED_SET_SIZE (64)
 
 /**
  * Disable ECMA lookup cache
  */
 // #define CONFIG_ECMA_LCACHE_DISABLE
 
+/**
+ * Disable hashed index of properties of objects with many properties
+ */
+// #define CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
+
+/**
+ * Number of named properties of an object, upon reaching which the properties are indexed by a hashmap
+ */
+#define CONFIG_ECMA_PROPERTY_HASHMAP_MIN_PROPERTIES (16)
+
 /**
  * Link Global Environment to an empty declarative lexical environment
  * instead of lexical environment bound to Global Object.
@@ -165,4 +249,30 @@
  */
 // #define CONFIG_VM_RUN_GC_AFTER_EACH_OPCODE
 
+/**
+ * Disable threaded dispatch of opcodes in the interpreter loop (GNU C computed goto),
+ * so opcode handlers are invoked through table of the handlers
+ */
+// #define CONFIG_VM_COMPUTED_GOTO_DISABLE
+
+/**
+ * Disable per-instruction inline caches of property getter / setter opcodes
+ */
+// #define CONFIG_VM_INLINE_CACHE_DISABLE
+
+/**
+ * Logarithm of number of entries in the table of inline caches
+ */
+#define CONFIG_VM_INLINE_CACHE_ENTRIES_NUMBER_LOG (8)
+
+/**
+ * Disable cache of global object's properties, accessed as variables
+ */
+// #define CONFIG_VM_GLOBAL_CACHE_DISABLE
+
+/**
+ * Logarithm of number of entries in the global variables' cache
+ */
+#define CONFIG_VM_GLOBAL_CACHE_ENTRIES_NUMBER_LOG (7)
+
 #endif /* !CONFIG_H */
@@ -18,20 +18,22 @@
 #include "ecma-gc.h"
 #include "ecma-lcache.h"
 #include "jrt.h"
+#include "mem-heap.h"
 #include "mem-poolman.h"
 
-JERRY_STATIC_ASSERT (sizeof (ecma_property_t) <= sizeof (uint64_t));
+JERRY_STATIC_ASSERT (sizeof (ecma_property_t) <= MEM_POOL_CHUNK_SIZE);
 
-JERRY_STATIC_ASSERT (sizeof (ecma_object_t) <= sizeof (uint64_t));
-JERRY_STATIC_ASSERT (ECMA_OBJECT_OBJ_TYPE_SIZE <= sizeof (uint64_t) * JERRY_BITSINBYTE);
-JERRY_STATIC_ASSERT (ECMA_OBJECT_LEX_ENV_TYPE_SIZE <= sizeof (uint64_t) * JERRY_BITSINBYTE);
+JERRY_STATIC_ASSERT (sizeof (ecma_object_t) <= MEM_POOL_CHUNK_SIZE);
+JERRY_STATIC_ASSERT (ECMA_OBJECT_OBJ_TYPE_SIZE <= sizeof (ecma_object_t) * JERRY_BITSINBYTE);
+JERRY_STATIC_ASSERT (ECMA_OBJECT_LEX_ENV_TYPE_SIZE <= sizeof (ecma_object_t) * JERRY_BITSINBYTE);
 
-JERRY_STATIC_ASSERT (sizeof (ecma_collection_header_t) == sizeof (uint64_t));
-JERRY_STATIC_ASSERT (sizeof (ecma_collection_chunk_t) == sizeof (uint64_t));
-JERRY_STATIC_ASSERT (sizeof (ecma_string_t) == sizeof (uint64_t));
+JERRY_STATIC_ASSERT (sizeof (ecma_collection_header_t) == MEM_POOL_CHUNK_SIZE);
+JERRY_STATIC_ASSERT (sizeof (ecma_collection_chunk_t) == MEM_POOL_CHUNK_SIZE);
+JERRY_STATIC_ASSERT (sizeof (ecma_string_t) <= MEM_POOL_CHUNK_SIZE);
 JERRY_STATIC_ASSERT (sizeof (ecma_completion_value_t) == sizeof (uint32_t));
-JERRY_STATIC_ASSERT (sizeof (ecma_label_descriptor_t) == sizeof (uint64_t));
-JERRY_STATIC_ASSERT (sizeof (ecma_getter_setter_pointers_t) <= sizeof (uint64_t));
+JERRY_STATIC_ASSERT (sizeof (ecma_label_descriptor_t) <= MEM_POOL_CHUNK_SIZE);
+JERRY_STATIC_ASSERT (sizeof (ecma_getter_setter_pointers_t) <= MEM_POOL_CHUNK_SIZE);
+JERRY_STATIC_ASSERT (sizeof (ecma_number_box_t) <= MEM_POOL_MAX_CHUNK_SIZE);
 
 /** \addtogroup ecma ECMA
  * @{
@@ -83,7 +85,6 @@ JERRY_STATIC_ASSERT (sizeof (ecma_getter_setter_pointers_t) <= sizeof (uint64_t)
 
 DECLARE_ROUTINES_FOR (object)
 DECLARE_ROUTINES_FOR (property)
-DECLARE_ROUTINES_FOR (number)
 DECLARE_ROUTINES_FOR (collection_header)
 DECLARE_ROUTINES_FOR (collection_chunk)
 DECLARE_ROUTINES_FOR (string)
@@ -91,6 +92,80 @@ DECLARE_ROUTINES_FOR (label_descriptor)
 DECLARE_ROUTINES_FOR (getter_setter_pointers)
 DECLARE_ROUTINES_FOR (external_pointer)
 
+/**
+ * Allocate memory for ecma-number
+ *
+ * Note:
+ *      the number is placed in a number box, that is not shared (see also: ecma_number_box_t).
+ *
+ * @return pointer to the number field of allocated number box
+ */
+ecma_number_t*
+ecma_alloc_number (void)
+{
+  ecma_number_box_t *box_p = (ecma_number_box_t *) mem_pools_alloc_sized (sizeof (ecma_number_box_t));
+
+  JERRY_ASSERT (box_p != NULL);
+
+  box_p->refs = 0;
+
+  return &box_p->value;
+} /* ecma_alloc_number */
+
+/**
+ * Dealloc memory from an ecma-number
+ */
+void
+ecma_dealloc_number (ecma_number_t *number_p) /**< number, allocated with ecma_alloc_number */
+{
+  mem_pools_free ((uint8_t*) number_p);
+} /* ecma_dealloc_number */
+
+/**
+ * Allocate memory for a buffer of the specified size
+ *
+ * Note:
+ *      buffers that are not larger than MEM_POOL_MAX_CHUNK_SIZE are allocated
+ *      in chunk of the fitting pool size class, larger buffers - on the heap.
+ *
+ * @return pointer to allocated memory
+ */
+void*
+ecma_alloc_buffer (size_t size) /**< size of the buffer */
+{
+  void *buffer_p;
+
+  if (size <= MEM_POOL_MAX_CHUNK_SIZE)
+  {
+    buffer_p = mem_pools_alloc_sized (size);
+  }
+  else
+  {
+    buffer_p = mem_heap_alloc_block (size, MEM_HEAP_ALLOC_SHORT_TERM);
+  }
+
+  JERRY_ASSERT (buffer_p != NULL);
+
+  return buffer_p;
+} /* ecma_alloc_buffer */
+
+/**
+ * Dealloc memory from a buffer, allocated with ecma_alloc_buffer
+ */
+void
+ecma_dealloc_buffer (void *buffer_p, /**< buffer */
+                     size_t size) /**< size of the buffer, passed to ecma_alloc_buffer */
+{
+  if (size <= MEM_POOL_MAX_CHUNK_SIZE)
+  {
+    mem_pools_free ((uint8_t*) buffer_p);
+  }
+  else
+  {
+    mem_heap_free_block (buffer_p);
+  }
+} /* ecma_dealloc_buffer */
+
 /**
  * @}
  * @}
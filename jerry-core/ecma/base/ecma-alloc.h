@@ -133,6 +133,18 @@ extern ecma_external_pointer_t *ecma_alloc_external_pointer (void);
 */
 extern void ecma_dealloc_external_pointer (ecma_external_pointer_t *external_pointer_p);
 
+/**
+ * Allocate memory for a buffer of the specified size
+ *
+ * @return pointer to allocated memory
+ */
+extern void *ecma_alloc_buffer (size_t size);
+
+/**
+ * Dealloc memory from a buffer
+ */
+extern void ecma_dealloc_buffer (void *buffer_p, size_t size);
+
 
 #endif /* JERRY_ECMA_ALLOC_H */
 
@@ -0,0 +1,428 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-fast-array.h"
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "jrt-libc-includes.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmafastarray Arrays in fast form
+ * @{
+ *
+ * Arrays, created by array initialisers and Array constructor (see also: ecma_op_create_array_object),
+ * are created in fast form, if they have no holes: values of their elements are stored in dense vector
+ * (ecma_fast_array_elements_t), indexed by numbers, so the elements can be accessed without creating
+ * strings of the indices and looking up property descriptors.
+ *
+ * Upon any operation, that requires a property descriptor (ecma_property_t) of one of the elements,
+ * or would create a hole, or an element with non-default attributes, or would make the array's 'length'
+ * non-writable, the array is converted to the usual form (see also: ecma_fast_array_convert_to_property_list).
+ * Arrays are never switched back to fast form.
+ */
+
+/**
+ * Flag, indicating that an array index property was created in a built-in object
+ *
+ * Prototypes of arrays are built-in objects (Array.prototype and Object.prototype), that usually have
+ * no array index properties, so, while the flag is not set, an element can be appended to an array
+ * in fast form without [[Put]]'s lookup of the index in the prototype chain (ECMA-262 v5, 8.12.4).
+ */
+static bool ecma_fast_arrays_is_builtin_index_created = false;
+
+/**
+ * Initialize state of fast arrays' support
+ */
+void
+ecma_fast_arrays_init (void)
+{
+  ecma_fast_arrays_is_builtin_index_created = false;
+} /* ecma_fast_arrays_init */
+
+/**
+ * Get number of values to allocate the vector for, so that it could hold the specified number of elements
+ *
+ * The number is chosen so that the vector fills the allocated chunk (see also: ecma_alloc_buffer);
+ * as the chunk size is a power of two, appending elements one-by-one doubles the vector upon reallocation.
+ *
+ * @return number of values
+ */
+static uint32_t
+ecma_fast_array_get_capacity (uint32_t length) /**< number of elements */
+{
+  size_t size = MEM_POOL_CHUNK_SIZE;
+
+  while (size < sizeof (ecma_fast_array_elements_t) + (size_t) length * sizeof (ecma_value_t))
+  {
+    size *= 2;
+  }
+
+  return (uint32_t) ((size - sizeof (ecma_fast_array_elements_t)) / sizeof (ecma_value_t));
+} /* ecma_fast_array_get_capacity */
+
+/**
+ * Get size of vector with specified capacity
+ *
+ * @return size in bytes
+ */
+static size_t
+ecma_fast_array_get_size (uint32_t capacity) /**< number of values */
+{
+  return sizeof (ecma_fast_array_elements_t) + (size_t) capacity * sizeof (ecma_value_t);
+} /* ecma_fast_array_get_size */
+
+/**
+ * Reallocate vector of an array in fast form with specified capacity
+ *
+ * @return pointer to the new vector
+ */
+static ecma_fast_array_elements_t*
+ecma_fast_array_reallocate (ecma_object_t *obj_p, /**< array in fast form */
+                            uint32_t new_capacity) /**< number of values */
+{
+  ecma_fast_array_elements_t *elements_p = ecma_get_object_fast_elements (obj_p);
+  JERRY_ASSERT (elements_p != NULL && elements_p->length <= new_capacity);
+
+  ecma_fast_array_elements_t *new_elements_p;
+  new_elements_p = (ecma_fast_array_elements_t *) ecma_alloc_buffer (ecma_fast_array_get_size (new_capacity));
+
+  new_elements_p->length = elements_p->length;
+  new_elements_p->capacity = new_capacity;
+
+  memcpy (ECMA_FAST_ARRAY_ELEMENTS_GET_VALUES (new_elements_p),
+          ECMA_FAST_ARRAY_ELEMENTS_GET_VALUES (elements_p),
+          elements_p->length * sizeof (ecma_value_t));
+
+  ecma_set_object_fast_elements (obj_p, new_elements_p);
+
+  ecma_dealloc_buffer (elements_p, ecma_fast_array_get_size (elements_p->capacity));
+
+  return new_elements_p;
+} /* ecma_fast_array_reallocate */
+
+/**
+ * Update value of 'length' property of an array in fast form according to the vector's length
+ */
+static void
+ecma_fast_array_update_length_property (ecma_object_t *obj_p) /**< array in fast form */
+{
+  const uint32_t length = ecma_get_object_fast_elements (obj_p)->length;
+
+  ecma_string_t length_magic_string;
+  ecma_new_ecma_string_on_stack_from_magic_string_id (&length_magic_string, LIT_MAGIC_STRING_LENGTH);
+
+  ecma_property_t *length_prop_p = ecma_find_named_property (obj_p, &length_magic_string);
+  JERRY_ASSERT (length_prop_p != NULL && ecma_is_property_writable (length_prop_p));
+
+  ecma_value_t length_value;
+
+  if (length <= (uint32_t) ECMA_INTEGER_NUMBER_MAX)
+  {
+    length_value = ecma_make_integer_value ((ecma_integer_value_t) length);
+  }
+  else
+  {
+    ecma_number_t *length_num_p = ecma_alloc_number ();
+    *length_num_p = ecma_uint32_to_number (length);
+
+    length_value = ecma_make_number_value (length_num_p);
+  }
+
+  ecma_named_data_property_assign_value (obj_p, length_prop_p, length_value);
+
+  ecma_free_value (length_value, false);
+} /* ecma_fast_array_update_length_property */
+
+/**
+ * Switch newly created array without elements to fast form, filling it with the specified values
+ *
+ * Note:
+ *      value of the array's 'length' property should be equal to the number of the values
+ */
+void
+ecma_fast_array_init (ecma_object_t *obj_p, /**< array object */
+                      const ecma_value_t *values_p, /**< values of elements */
+                      uint32_t values_number) /**< number of the values */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_ARRAY);
+  JERRY_ASSERT (ecma_get_object_fast_elements (obj_p) == NULL);
+
+  const uint32_t capacity = ecma_fast_array_get_capacity (values_number);
+
+  ecma_fast_array_elements_t *elements_p;
+  elements_p = (ecma_fast_array_elements_t *) ecma_alloc_buffer (ecma_fast_array_get_size (capacity));
+
+  elements_p->length = values_number;
+  elements_p->capacity = capacity;
+
+  ecma_value_t *elements_values_p = ECMA_FAST_ARRAY_ELEMENTS_GET_VALUES (elements_p);
+
+  for (uint32_t index = 0; index < values_number; index++)
+  {
+    elements_values_p[index] = ecma_copy_value (values_p[index], false);
+  }
+
+  ecma_set_object_fast_elements (obj_p, elements_p);
+
+  for (uint32_t index = 0; index < values_number; index++)
+  {
+    if (ecma_is_value_object (elements_values_p[index]))
+    {
+      ecma_gc_write_barrier (obj_p, ecma_get_object_from_value (elements_values_p[index]));
+    }
+  }
+} /* ecma_fast_array_init */
+
+/**
+ * Check whether [[Put]] of element with index, equal to length of an array in fast form,
+ * can be performed by appending the element to the vector
+ *
+ * @return true - if the array is extensible and its prototypes can't have array index properties,
+ *         false - otherwise (the generic [[Put]] should be performed).
+ */
+bool
+ecma_fast_array_can_append (ecma_object_t *obj_p) /**< array in fast form */
+{
+  JERRY_ASSERT (ecma_get_object_fast_elements (obj_p) != NULL);
+
+  if (!ecma_get_object_extensible (obj_p)
+      || ecma_fast_arrays_is_builtin_index_created)
+  {
+    return false;
+  }
+
+  for (ecma_object_t *proto_p = ecma_get_object_prototype (obj_p);
+       proto_p != NULL;
+       proto_p = ecma_get_object_prototype (proto_p))
+  {
+    if (!ecma_get_object_is_builtin (proto_p))
+    {
+      return false;
+    }
+  }
+
+  return true;
+} /* ecma_fast_array_can_append */
+
+/**
+ * Append element to an array in fast form, increasing the array's length
+ */
+void
+ecma_fast_array_append (ecma_object_t *obj_p, /**< array in fast form */
+                        ecma_value_t value) /**< value of the element */
+{
+  ecma_fast_array_elements_t *elements_p = ecma_get_object_fast_elements (obj_p);
+  JERRY_ASSERT (elements_p != NULL);
+  JERRY_ASSERT (elements_p->length < ECMA_MAX_VALUE_OF_VALID_ARRAY_INDEX);
+
+  if (elements_p->length == elements_p->capacity)
+  {
+    elements_p = ecma_fast_array_reallocate (obj_p, ecma_fast_array_get_capacity (elements_p->length + 1));
+  }
+
+  ECMA_FAST_ARRAY_ELEMENTS_GET_VALUES (elements_p)[elements_p->length++] = ecma_copy_value (value, false);
+
+  if (ecma_is_value_object (value))
+  {
+    ecma_gc_write_barrier (obj_p, ecma_get_object_from_value (value));
+  }
+
+  ecma_fast_array_update_length_property (obj_p);
+} /* ecma_fast_array_append */
+
+/**
+ * Assign value to an element of an array in fast form
+ *
+ * Note:
+ *      value previously stored in the element is freed
+ */
+void
+ecma_fast_array_assign_value (ecma_object_t *obj_p, /**< array in fast form */
+                              uint32_t index, /**< index of the element */
+                              ecma_value_t value) /**< value to assign */
+{
+  ecma_fast_array_elements_t *elements_p = ecma_get_object_fast_elements (obj_p);
+  JERRY_ASSERT (elements_p != NULL && index < elements_p->length);
+
+  ecma_value_t *value_p = ECMA_FAST_ARRAY_ELEMENTS_GET_VALUES (elements_p) + index;
+
+  if (ecma_is_value_number (value)
+      && ecma_is_value_number (*value_p))
+  {
+    *value_p = ecma_update_number_value (*value_p, value);
+  }
+  else
+  {
+    ecma_free_value (*value_p, false);
+
+    *value_p = ecma_copy_value (value, false);
+
+    if (ecma_is_value_object (value))
+    {
+      ecma_gc_write_barrier (obj_p, ecma_get_object_from_value (value));
+    }
+  }
+} /* ecma_fast_array_assign_value */
+
+/**
+ * Remove elements of an array in fast form, starting from the specified index,
+ * and set the array's length to the index
+ */
+void
+ecma_fast_array_truncate (ecma_object_t *obj_p, /**< array in fast form */
+                          uint32_t new_length) /**< new length */
+{
+  ecma_fast_array_elements_t *elements_p = ecma_get_object_fast_elements (obj_p);
+  JERRY_ASSERT (elements_p != NULL && new_length <= elements_p->length);
+
+  ecma_value_t *values_p = ECMA_FAST_ARRAY_ELEMENTS_GET_VALUES (elements_p);
+
+  while (elements_p->length > new_length)
+  {
+    ecma_free_value (values_p[--elements_p->length], false);
+  }
+
+  const uint32_t new_capacity = ecma_fast_array_get_capacity (new_length);
+
+  if (new_capacity < elements_p->capacity / 4)
+  {
+    /* the vector is shrunk, leaving space for the array to grow back twice */
+    ecma_fast_array_reallocate (obj_p, ecma_fast_array_get_capacity (new_length * 2));
+  }
+
+  ecma_fast_array_update_length_property (obj_p);
+} /* ecma_fast_array_truncate */
+
+/**
+ * Prepare an object to creation of named property in its property list
+ *
+ * If the object is an array in fast form, and the property is an array index, the array is converted
+ * to the usual form. If the object is built-in, and the property is an array index, appending elements
+ * to arrays in fast form is switched to the generic [[Put]], as the object can be prototype of arrays.
+ */
+void
+ecma_fast_array_prepare_named_property (ecma_object_t *obj_p, /**< object */
+                                        ecma_string_t *name_p) /**< name of the property to create */
+{
+  JERRY_ASSERT (!ecma_is_lexical_environment (obj_p));
+
+  const bool is_fast_array = (ecma_get_object_fast_elements (obj_p) != NULL);
+
+  if (!is_fast_array
+      && (!ecma_get_object_is_builtin (obj_p) || ecma_fast_arrays_is_builtin_index_created))
+  {
+    return;
+  }
+
+  uint32_t index;
+
+  if (!ecma_string_get_array_index (name_p, &index))
+  {
+    return;
+  }
+
+  if (is_fast_array)
+  {
+    ecma_fast_array_convert_to_property_list (obj_p);
+  }
+  else
+  {
+    ecma_fast_arrays_is_builtin_index_created = true;
+  }
+} /* ecma_fast_array_prepare_named_property */
+
+/**
+ * Convert an array in fast form to the usual form, creating named data properties for the elements
+ *
+ * The properties are created in order of the indices, so they are listed in same order,
+ * as if they were created in the usual form.
+ */
+void
+ecma_fast_array_convert_to_property_list (ecma_object_t *obj_p) /**< array in fast form */
+{
+  ecma_fast_array_elements_t *elements_p = ecma_get_object_fast_elements (obj_p);
+  JERRY_ASSERT (elements_p != NULL);
+
+  ecma_set_object_fast_elements (obj_p, NULL);
+
+  const uint32_t length = elements_p->length;
+  ecma_value_t *values_p = ECMA_FAST_ARRAY_ELEMENTS_GET_VALUES (elements_p);
+
+  /*
+   * The vector is detached from the array, so garbage collection, that can be run upon allocation
+   * of the properties, doesn't traverse it; objects, referenced from the vector, are kept alive
+   * with explicit references until they are moved to the properties.
+   */
+  for (uint32_t index = 0; index < length; index++)
+  {
+    if (ecma_is_value_object (values_p[index]))
+    {
+      ecma_ref_object (ecma_get_object_from_value (values_p[index]));
+    }
+  }
+
+  for (uint32_t index = 0; index < length; index++)
+  {
+    ecma_string_t *index_string_p = ecma_new_ecma_string_from_uint32 (index);
+
+    ecma_property_t *prop_p = ecma_create_named_data_property (obj_p, index_string_p, true, true, true);
+    ecma_set_named_data_property_value (obj_p, prop_p, values_p[index]);
+
+    ecma_deref_ecma_string (index_string_p);
+  }
+
+  for (uint32_t index = 0; index < length; index++)
+  {
+    if (ecma_is_value_object (values_p[index]))
+    {
+      ecma_deref_object (ecma_get_object_from_value (values_p[index]));
+    }
+  }
+
+  ecma_dealloc_buffer (elements_p, ecma_fast_array_get_size (elements_p->capacity));
+} /* ecma_fast_array_convert_to_property_list */
+
+/**
+ * Free vector of an array in fast form and values it holds
+ *
+ * Note:
+ *      the array is switched to the usual form, so its property list can be freed after that
+ */
+void
+ecma_fast_array_free_elements (ecma_object_t *obj_p) /**< array in fast form */
+{
+  ecma_fast_array_elements_t *elements_p = ecma_get_object_fast_elements (obj_p);
+  JERRY_ASSERT (elements_p != NULL);
+
+  ecma_value_t *values_p = ECMA_FAST_ARRAY_ELEMENTS_GET_VALUES (elements_p);
+
+  for (uint32_t index = 0; index < elements_p->length; index++)
+  {
+    ecma_free_value (values_p[index], false);
+  }
+
+  ecma_set_object_fast_elements (obj_p, NULL);
+
+  ecma_dealloc_buffer (elements_p, ecma_fast_array_get_size (elements_p->capacity));
+} /* ecma_fast_array_free_elements */
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,44 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_FAST_ARRAY_H
+#define ECMA_FAST_ARRAY_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmafastarray Arrays in fast form
+ * @{
+ */
+
+extern void ecma_fast_arrays_init (void);
+
+extern void ecma_fast_array_init (ecma_object_t *obj_p, const ecma_value_t *values_p, uint32_t values_number);
+extern bool ecma_fast_array_can_append (ecma_object_t *obj_p);
+extern void ecma_fast_array_append (ecma_object_t *obj_p, ecma_value_t value);
+extern void ecma_fast_array_assign_value (ecma_object_t *obj_p, uint32_t index, ecma_value_t value);
+extern void ecma_fast_array_truncate (ecma_object_t *obj_p, uint32_t new_length);
+extern void ecma_fast_array_prepare_named_property (ecma_object_t *obj_p, ecma_string_t *name_p);
+extern void ecma_fast_array_convert_to_property_list (ecma_object_t *obj_p);
+extern void ecma_fast_array_free_elements (ecma_object_t *obj_p);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* ECMA_FAST_ARRAY_H */
@@ -25,14 +25,21 @@
  */
 
 #include "ecma-alloc.h"
+#include "ecma-fast-array.h"
 #include "ecma-globals.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
 #include "ecma-lcache.h"
+#include "ecma-shapes.h"
 #include "ecma-stack.h"
 #include "jrt.h"
 #include "jrt-libc-includes.h"
 #include "jrt-bit-fields.h"
+#include "mem-heap.h"
+
+#ifdef MEM_STATS
+# include <sys/time.h>
+#endif /* MEM_STATS */
 
 #define JERRY_INTERNAL
 #include "jerry-internal.h"
@@ -41,9 +48,27 @@
  * An object's GC color
  *
  * Tri-color marking:
- *   WHITE_GRAY, unvisited -> WHITE // not referenced by a live object or the reference not found yet
- *   WHITE_GRAY, visited   -> GRAY  // referenced by some live object
- *   BLACK                 -> BLACK // all referenced objects are gray or black
+ *   unvisited                                 -> WHITE // not referenced by a live object or the reference
+ *                                                         not found yet
+ *   visited, in the worklist (or overflowed)  -> GRAY  // referenced by some live object
+ *   visited, references are traversed         -> BLACK // all referenced objects are gray or black
+ *
+ * During marking all objects are in the WHITE_GRAY list; the BLACK list is used during sweep
+ * to collect objects that remain alive.
+ *
+ * Marking and sweep can be performed incrementally, interleaved with execution of the program
+ * (see also: ecma_gc_step). While objects are being marked, the following invariant is maintained
+ * by a write barrier (see also: ecma_gc_write_barrier): a visited object never gets a reference
+ * to an unvisited object. So, the barrier visits any object, reference to which is stored
+ * to a property, a lexical environment or a newly created object, and any object, which reference
+ * counter is increased. Objects that are created during a garbage collection cycle are allocated visited.
+ * Register variables are not covered by the barrier, so they are scanned at the end of marking.
+ *
+ * In generational mode objects, allocated outside of garbage collection cycle, are placed into the nursery
+ * (young generation), and are collected with minor collections (see also: ecma_gc_run_minor) that traverse
+ * only nursery objects. An old object that gets a reference to a nursery object is put into the remembered set
+ * by the write barrier, and is considered root during minor collection. Objects that survive two minor collections
+ * become old; a garbage collection cycle makes all objects old.
  */
 typedef enum
 {
@@ -67,8 +92,196 @@ static ecma_object_t *ecma_gc_objects_lists[ECMA_GC_COLOR__COUNT];
  */
 static bool ecma_gc_visited_flip_flag = false;
 
+/**
+ * Worklist of gray objects (compressed pointers to objects that are visited,
+ * but which references are not traversed yet)
+ */
+static mem_cpointer_t ecma_gc_worklist[CONFIG_ECMA_GC_WORKLIST_SIZE];
+
+/**
+ * Number of objects in the worklist
+ */
+static uint32_t ecma_gc_worklist_length = 0;
+
+/**
+ * Flag indicating that a gray object was not put to the worklist, because the worklist was full
+ */
+static bool ecma_gc_worklist_overflowed = false;
+
+/**
+ * Phase of garbage collection cycle
+ */
+typedef enum
+{
+  ECMA_GC_PHASE_IDLE, /**< garbage collection is not in progress */
+  ECMA_GC_PHASE_MARK_ROOTS, /**< objects, referenced from stack or globals, are being found */
+  ECMA_GC_PHASE_MARK, /**< references of gray objects are being traversed */
+  ECMA_GC_PHASE_MARK_RESCAN, /**< references of all visited objects are being traversed
+                              *   (after the worklist overflowed) */
+  ECMA_GC_PHASE_SWEEP /**< unmarked objects are being freed */
+} ecma_gc_phase_t;
+
+/**
+ * Current phase of garbage collection cycle
+ */
+static ecma_gc_phase_t ecma_gc_phase = ECMA_GC_PHASE_IDLE;
+
+/**
+ * Next object to process in the WHITE_GRAY list during ECMA_GC_PHASE_MARK_ROOTS
+ * and ECMA_GC_PHASE_MARK_RESCAN phases
+ */
+static ecma_object_t *ecma_gc_cursor_p = NULL;
+
+/**
+ * Flag indicating that garbage collector performs incremental steps upon object allocations
+ */
+static bool ecma_gc_is_incremental = false;
+
+/**
+ * Flag indicating that garbage collection is triggered upon growth of heap usage by a factor,
+ * relative to heap usage after previous garbage collection (see also: ecma_gc_set_proactive_limit)
+ */
+static bool ecma_gc_is_proactive = false;
+
+/**
+ * Flag indicating that objects are allocated into the nursery and minor collections are performed
+ */
+static bool ecma_gc_is_generational = false;
+
+/**
+ * Flag indicating that minor collection is being performed
+ */
+static bool ecma_gc_is_minor_collection = false;
+
+/**
+ * Flag indicating that a nursery object was found, while references of an old object
+ * were traversed during minor collection (see also: ecma_gc_mark_old_object)
+ */
+static bool ecma_gc_is_nursery_object_referenced = false;
+
+/**
+ * List of nursery objects, allocated since last minor collection
+ */
+static ecma_object_t *ecma_gc_nursery_list_p = NULL;
+
+/**
+ * Number of nursery objects, allocated since last minor collection
+ */
+static uint32_t ecma_gc_nursery_objects_number = 0;
+
+/**
+ * List of nursery objects that survived one minor collection
+ */
+static ecma_object_t *ecma_gc_survivors_list_p = NULL;
+
+/**
+ * Number of nursery objects that survived one minor collection
+ */
+static uint32_t ecma_gc_survivors_number = 0;
+
+/**
+ * Number of objects that remained alive after last garbage collection cycle
+ */
+static uint32_t ecma_gc_old_objects_after_cycle = 0;
+
+/**
+ * Remembered set (compressed pointers to old objects that may reference nursery objects)
+ */
+static mem_cpointer_t ecma_gc_remembered_set[CONFIG_ECMA_GC_REMEMBERED_SET_SIZE];
+
+/**
+ * Number of objects in the remembered set
+ */
+static uint32_t ecma_gc_remembered_set_length = 0;
+
+/**
+ * Flag indicating that an object was not put to the remembered set, because the set was full
+ */
+static bool ecma_gc_remembered_set_overflowed = false;
+
+/**
+ * Flag indicating that garbage collector is currently performing some work
+ * (for example, object's free callback is being invoked during sweep)
+ */
+static bool ecma_gc_is_working = false;
+
+/**
+ * Number of allocated objects
+ */
+static uint32_t ecma_gc_objects_number = 0;
+
+/**
+ * Number of objects allocated since end of the last garbage collection cycle
+ */
+static uint32_t ecma_gc_new_objects_number = 0;
+
+/**
+ * Number of object allocations remaining till next automatic incremental step
+ */
+static uint32_t ecma_gc_allocations_till_step = CONFIG_ECMA_GC_INCREMENTAL_STEP_ALLOCATIONS;
+
+#ifdef MEM_STATS
+/**
+ * Number of buckets in histogram of garbage collection pauses
+ *
+ * Pauses shorter than 4 microseconds are accounted exactly, longer pauses - in four buckets
+ * per each power of two, so a bucket's bounds differ from a pause by at most 25%.
+ */
+#define ECMA_GC_STAT_PAUSE_BUCKETS_NUMBER (32 * 4)
+
+/**
+ * Garbage collector's statistics
+ */
+typedef struct
+{
+  size_t full_collections; /**< number of non-incremental garbage collections */
+  size_t incremental_steps; /**< number of incremental steps */
+  size_t incremental_cycles; /**< number of garbage collection cycles completed by incremental steps */
+  size_t minor_collections; /**< number of minor collections */
+  size_t promoted_objects; /**< number of objects that survived minor collections */
+  size_t remembered_set_overflows; /**< number of minor collections, replaced with full collections
+                                    *   due to overflow of the remembered set */
+  size_t pauses; /**< number of pauses (full collections and incremental steps) */
+  uint64_t max_pause_us; /**< longest pause, in microseconds */
+  uint64_t total_pause_us; /**< total time of pauses, in microseconds */
+  size_t pauses_histogram[ECMA_GC_STAT_PAUSE_BUCKETS_NUMBER]; /**< histogram of pauses */
+  size_t low_severity_requests; /**< number of low severity requests to give memory back
+                                 *   (heap usage limit is reached, or allocation failed) */
+  size_t critical_severity_requests; /**< number of critical severity requests to give memory back */
+  size_t live_bytes; /**< heap usage after last garbage collection cycle */
+  size_t peak_live_bytes; /**< peak heap usage after a garbage collection cycle */
+  size_t limit_bytes; /**< heap usage limit after last garbage collection cycle */
+} ecma_gc_stats_t;
+
+/**
+ * Garbage collector's statistics
+ */
+static ecma_gc_stats_t ecma_gc_stats;
+
+/**
+ * Start time of current pause, in microseconds
+ */
+static uint64_t ecma_gc_stat_pause_start_us;
+
+static void ecma_gc_stat_pause_begin (void);
+static void ecma_gc_stat_pause_end (void);
+static void ecma_gc_stat_finish_cycle (void);
+
+#  define ECMA_GC_STAT_PAUSE_BEGIN() ecma_gc_stat_pause_begin ()
+#  define ECMA_GC_STAT_PAUSE_END() ecma_gc_stat_pause_end ()
+#  define ECMA_GC_STAT_FINISH_CYCLE() ecma_gc_stat_finish_cycle ()
+#  define ECMA_GC_STAT_COUNT(counter) ecma_gc_stats.counter++
+#else /* !MEM_STATS */
+#  define ECMA_GC_STAT_PAUSE_BEGIN()
+#  define ECMA_GC_STAT_PAUSE_END()
+#  define ECMA_GC_STAT_FINISH_CYCLE()
+#  define ECMA_GC_STAT_COUNT(counter)
+#endif /* !MEM_STATS */
+
 static void ecma_gc_mark (ecma_object_t *object_p);
 static void ecma_gc_sweep (ecma_object_t *object_p);
+static void ecma_gc_visit_registers (void);
+static void ecma_gc_run_minor (void);
 
 /**
  * Get GC reference counter of the object.
@@ -78,7 +291,7 @@ ecma_gc_get_object_refs (ecma_object_t *object_p) /**< object */
 {
   JERRY_ASSERT (object_p != NULL);
 
-  return (uint32_t) jrt_extract_bit_field (object_p->container,
+  return (uint32_t) ECMA_OBJECT_GET_FIELD (object_p,
                                            ECMA_OBJECT_GC_REFS_POS,
                                            ECMA_OBJECT_GC_REFS_WIDTH);
 } /* ecma_gc_get_object_refs */
@@ -92,10 +305,10 @@ ecma_gc_set_object_refs (ecma_object_t *object_p, /**< object */
 {
   JERRY_ASSERT (object_p != NULL);
 
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 refs,
-                                                 ECMA_OBJECT_GC_REFS_POS,
-                                                 ECMA_OBJECT_GC_REFS_WIDTH);
+  ECMA_OBJECT_SET_FIELD (object_p,
+                         refs,
+                         ECMA_OBJECT_GC_REFS_POS,
+                         ECMA_OBJECT_GC_REFS_WIDTH);
 } /* ecma_gc_set_object_refs */
 
 /**
@@ -107,7 +320,7 @@ ecma_gc_get_object_next (ecma_object_t *object_p) /**< object */
   JERRY_ASSERT (object_p != NULL);
 
   JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= ECMA_OBJECT_GC_NEXT_CP_WIDTH);
-  uintptr_t next_cp = (uintptr_t) jrt_extract_bit_field (object_p->container,
+  uintptr_t next_cp = (uintptr_t) ECMA_OBJECT_GET_FIELD (object_p,
                                                          ECMA_OBJECT_GC_NEXT_CP_POS,
                                                          ECMA_OBJECT_GC_NEXT_CP_WIDTH);
 
@@ -128,10 +341,10 @@ ecma_gc_set_object_next (ecma_object_t *object_p, /**< object */
   ECMA_SET_POINTER (next_cp, next_object_p);
 
   JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= ECMA_OBJECT_GC_NEXT_CP_WIDTH);
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 next_cp,
-                                                 ECMA_OBJECT_GC_NEXT_CP_POS,
-                                                 ECMA_OBJECT_GC_NEXT_CP_WIDTH);
+  ECMA_OBJECT_SET_FIELD (object_p,
+                         next_cp,
+                         ECMA_OBJECT_GC_NEXT_CP_POS,
+                         ECMA_OBJECT_GC_NEXT_CP_WIDTH);
 } /* ecma_gc_set_object_next */
 
 /**
@@ -142,7 +355,7 @@ ecma_gc_is_object_visited (ecma_object_t *object_p) /**< object */
 {
   JERRY_ASSERT (object_p != NULL);
 
-  bool flag_value = (bool) jrt_extract_bit_field (object_p->container,
+  bool flag_value = (bool) ECMA_OBJECT_GET_FIELD (object_p,
                                                   ECMA_OBJECT_GC_VISITED_POS,
                                                   ECMA_OBJECT_GC_VISITED_WIDTH);
 
@@ -163,27 +376,240 @@ ecma_gc_set_object_visited (ecma_object_t *object_p, /**< object */
     is_visited = !is_visited;
   }
 
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 is_visited,
-                                                 ECMA_OBJECT_GC_VISITED_POS,
-                                                 ECMA_OBJECT_GC_VISITED_WIDTH);
+  ECMA_OBJECT_SET_FIELD (object_p,
+                         is_visited,
+                         ECMA_OBJECT_GC_VISITED_POS,
+                         ECMA_OBJECT_GC_VISITED_WIDTH);
 } /* ecma_gc_set_object_visited */
 
+/**
+ * Get nursery flag of the object.
+ */
+static bool
+ecma_gc_is_object_in_nursery (ecma_object_t *object_p) /**< object */
+{
+  JERRY_ASSERT (object_p != NULL);
+
+  return (bool) ECMA_OBJECT_GET_FIELD (object_p,
+                                       ECMA_OBJECT_GC_NURSERY_POS,
+                                       ECMA_OBJECT_GC_NURSERY_WIDTH);
+} /* ecma_gc_is_object_in_nursery */
+
+/**
+ * Set nursery flag of the object.
+ */
+static void
+ecma_gc_set_object_in_nursery (ecma_object_t *object_p, /**< object */
+                               bool is_in_nursery) /**< flag value */
+{
+  JERRY_ASSERT (object_p != NULL);
+
+  ECMA_OBJECT_SET_FIELD (object_p,
+                         is_in_nursery,
+                         ECMA_OBJECT_GC_NURSERY_POS,
+                         ECMA_OBJECT_GC_NURSERY_WIDTH);
+} /* ecma_gc_set_object_in_nursery */
+
+/**
+ * Mark the object as visited (gray), if it is not visited yet, and put it to the worklist
+ *
+ * Note:
+ *      during minor collection only nursery objects are visited
+ */
+static void
+ecma_gc_visit_object (ecma_object_t *object_p) /**< object */
+{
+  if (unlikely (ecma_gc_is_minor_collection))
+  {
+    if (!ecma_gc_is_object_in_nursery (object_p))
+    {
+      return;
+    }
+
+    ecma_gc_is_nursery_object_referenced = true;
+  }
+
+  if (ecma_gc_is_object_visited (object_p))
+  {
+    return;
+  }
+
+  ecma_gc_set_object_visited (object_p, true);
+
+  if (likely (ecma_gc_worklist_length < CONFIG_ECMA_GC_WORKLIST_SIZE))
+  {
+    ECMA_SET_NON_NULL_POINTER (ecma_gc_worklist[ecma_gc_worklist_length], object_p);
+    ecma_gc_worklist_length++;
+  }
+  else
+  {
+    /* the object would be found during rescan of visited objects (see also: ecma_gc_advance) */
+    ecma_gc_worklist_overflowed = true;
+  }
+} /* ecma_gc_visit_object */
+
+/**
+ * Check whether objects are being marked during current phase of garbage collection cycle
+ *
+ * @return true - if marking is in progress,
+ *         false - otherwise.
+ */
+static bool
+ecma_gc_is_marking (void)
+{
+  return (ecma_gc_phase == ECMA_GC_PHASE_MARK_ROOTS
+          || ecma_gc_phase == ECMA_GC_PHASE_MARK
+          || ecma_gc_phase == ECMA_GC_PHASE_MARK_RESCAN);
+} /* ecma_gc_is_marking */
+
+/**
+ * Perform incremental garbage collection step, if it is time to do it
+ * according to number of allocated objects
+ *
+ * A new garbage collection cycle is started when number of objects, allocated
+ * since end of the previous cycle, reaches half of the number of objects that remained alive.
+ */
+static void
+ecma_gc_allocation_step (void)
+{
+  if (likely (!ecma_gc_is_incremental)
+      || ecma_gc_is_working)
+  {
+    return;
+  }
+
+  if (--ecma_gc_allocations_till_step != 0)
+  {
+    return;
+  }
+
+  ecma_gc_allocations_till_step = CONFIG_ECMA_GC_INCREMENTAL_STEP_ALLOCATIONS;
+
+  if (ecma_gc_phase == ECMA_GC_PHASE_IDLE
+      && ecma_gc_new_objects_number * 2 < ecma_gc_objects_number - ecma_gc_new_objects_number)
+  {
+    return;
+  }
+
+  ecma_gc_step (CONFIG_ECMA_GC_INCREMENTAL_STEP_BUDGET);
+} /* ecma_gc_allocation_step */
+
+/**
+ * Perform minor collection, if the nursery is full
+ */
+static void
+ecma_gc_allocation_minor_collection (void)
+{
+  if (likely (!ecma_gc_is_generational)
+      || ecma_gc_nursery_objects_number < CONFIG_ECMA_GC_NURSERY_SIZE
+      || ecma_gc_phase != ECMA_GC_PHASE_IDLE
+      || ecma_gc_is_working)
+  {
+    return;
+  }
+
+  if (unlikely (ecma_gc_remembered_set_overflowed))
+  {
+    /* not all references from old objects to nursery objects are known */
+    ECMA_GC_STAT_COUNT (remembered_set_overflows);
+
+    ecma_gc_run ();
+  }
+  else
+  {
+    ecma_gc_run_minor ();
+  }
+} /* ecma_gc_allocation_minor_collection */
+
 /**
  * Initialize GC information for the object
+ *
+ * Note:
+ *      during garbage collection cycle the object is considered visited
  */
 void
 ecma_init_gc_info (ecma_object_t *object_p) /**< object */
 {
+  /* the object is not linked to the lists yet, so the collections don't see it */
+  ecma_gc_allocation_step ();
+  ecma_gc_allocation_minor_collection ();
+
+  ecma_gc_objects_number++;
+  ecma_gc_new_objects_number++;
+
   ecma_gc_set_object_refs (object_p, 1);
 
-  ecma_gc_set_object_next (object_p, ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY]);
-  ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = object_p;
+  bool is_in_nursery = (ecma_gc_is_generational && ecma_gc_phase == ECMA_GC_PHASE_IDLE);
+
+  if (is_in_nursery)
+  {
+    ecma_gc_set_object_next (object_p, ecma_gc_nursery_list_p);
+    ecma_gc_nursery_list_p = object_p;
+    ecma_gc_nursery_objects_number++;
+  }
+  else
+  {
+    ecma_gc_color_t list_id = (ecma_gc_phase == ECMA_GC_PHASE_SWEEP ? ECMA_GC_COLOR_BLACK
+                                                                    : ECMA_GC_COLOR_WHITE_GRAY);
+
+    ecma_gc_set_object_next (object_p, ecma_gc_objects_lists[list_id]);
+    ecma_gc_objects_lists[list_id] = object_p;
+  }
 
-  /* Should be set to false at the beginning of garbage collection */
-  ecma_gc_set_object_visited (object_p, false);
+  ecma_gc_set_object_in_nursery (object_p, is_in_nursery);
+  ecma_gc_set_object_visited (object_p, ecma_gc_phase != ECMA_GC_PHASE_IDLE);
 } /* ecma_init_gc_info */
 
+/**
+ * Put the old object to the remembered set
+ */
+static void
+ecma_gc_remember_object (ecma_object_t *object_p) /**< object */
+{
+  JERRY_ASSERT (!ecma_gc_is_object_in_nursery (object_p));
+
+  if (likely (ecma_gc_remembered_set_length < CONFIG_ECMA_GC_REMEMBERED_SET_SIZE))
+  {
+    ECMA_SET_NON_NULL_POINTER (ecma_gc_remembered_set[ecma_gc_remembered_set_length], object_p);
+    ecma_gc_remembered_set_length++;
+
+    if (!ecma_gc_is_minor_collection)
+    {
+      /* during minor collection the flag is set after references of all objects are traversed
+       * (see also: ecma_gc_run_minor) */
+      ecma_gc_set_object_in_nursery (object_p, true);
+    }
+  }
+  else
+  {
+    /* full collection would be performed instead of next minor collection */
+    ecma_gc_remembered_set_overflowed = true;
+  }
+} /* ecma_gc_remember_object */
+
+/**
+ * Write barrier of incremental and generational garbage collector
+ *
+ * Should be called upon storing a reference to the object into another object
+ * (see also: tri-color marking description above).
+ */
+void
+ecma_gc_write_barrier (ecma_object_t *holder_p, /**< object, to which the reference is stored */
+                       ecma_object_t *object_p) /**< object, reference to which is stored */
+{
+  if (unlikely (ecma_gc_is_marking ()))
+  {
+    ecma_gc_visit_object (object_p);
+  }
+  else if (ecma_gc_is_object_in_nursery (object_p)
+           && !ecma_gc_is_object_in_nursery (holder_p))
+  {
+    /* the object is in the nursery, or is an old object in the remembered set,
+     * and the holder is an old object that is not in the remembered set yet */
+    ecma_gc_remember_object (holder_p);
+  }
+} /* ecma_gc_write_barrier */
+
 /**
  * Increase reference counter of an object
  */
@@ -191,6 +617,11 @@ void
 ecma_ref_object (ecma_object_t *object_p) /**< object */
 {
   ecma_gc_set_object_refs (object_p, ecma_gc_get_object_refs (object_p) + 1);
+
+  if (unlikely (ecma_gc_is_marking ()))
+  {
+    ecma_gc_visit_object (object_p);
+  }
 } /* ecma_ref_object */
 
 /**
@@ -203,18 +634,59 @@ ecma_deref_object (ecma_object_t *object_p) /**< object */
   ecma_gc_set_object_refs (object_p, ecma_gc_get_object_refs (object_p) - 1);
 } /* ecma_deref_object */
 
+/**
+ * Set limit of heap usage, upon reaching which next garbage collection is triggered,
+ * according to current heap usage (see also: CONFIG_ECMA_GC_PROACTIVE_*)
+ */
+static void
+ecma_gc_set_proactive_limit (void)
+{
+  JERRY_ASSERT (ecma_gc_is_proactive);
+
+  const size_t live_bytes = mem_heap_get_allocated_bytes ();
+
+  mem_heap_set_limit (JERRY_MAX (live_bytes / 100u * CONFIG_ECMA_GC_PROACTIVE_GROWTH_PERCENT,
+                                 live_bytes + CONFIG_ECMA_GC_PROACTIVE_MIN_GROWTH));
+} /* ecma_gc_set_proactive_limit */
+
 /**
  * Initialize garbage collector
  */
 void
-ecma_gc_init (void)
+ecma_gc_init (bool is_incremental, /**< perform incremental steps upon object allocations */
+              bool is_proactive, /**< trigger garbage collection upon growth of heap usage */
+              bool is_generational) /**< allocate objects into the nursery and perform minor collections */
 {
   ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = NULL;
   ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] = NULL;
+
+  ecma_gc_phase = ECMA_GC_PHASE_IDLE;
+  ecma_gc_is_incremental = is_incremental;
+  ecma_gc_is_proactive = is_proactive;
+  ecma_gc_is_generational = is_generational;
+  ecma_gc_nursery_list_p = NULL;
+  ecma_gc_nursery_objects_number = 0;
+  ecma_gc_survivors_list_p = NULL;
+  ecma_gc_survivors_number = 0;
+  ecma_gc_old_objects_after_cycle = 0;
+  ecma_gc_remembered_set_length = 0;
+  ecma_gc_remembered_set_overflowed = false;
+  ecma_gc_objects_number = 0;
+  ecma_gc_new_objects_number = 0;
+  ecma_gc_allocations_till_step = CONFIG_ECMA_GC_INCREMENTAL_STEP_ALLOCATIONS;
+
+#ifdef MEM_STATS
+  memset (&ecma_gc_stats, 0, sizeof (ecma_gc_stats));
+#endif /* MEM_STATS */
+
+  if (ecma_gc_is_proactive)
+  {
+    ecma_gc_set_proactive_limit ();
+  }
 } /* ecma_gc_init */
 
 /**
- * Mark objects as visited starting from specified object as root
+ * Mark objects referenced by the specified visited object as visited, putting them to the worklist
  */
 void
 ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
@@ -229,13 +701,31 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
     ecma_object_t *lex_env_p = ecma_get_lex_env_outer_reference (object_p);
     if (lex_env_p != NULL)
     {
-      ecma_gc_set_object_visited (lex_env_p, true);
+      ecma_gc_visit_object (lex_env_p);
     }
 
     if (ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND)
     {
       ecma_object_t *binding_object_p = ecma_get_lex_env_binding_object (object_p);
-      ecma_gc_set_object_visited (binding_object_p, true);
+      ecma_gc_visit_object (binding_object_p);
+
+      traverse_properties = false;
+    }
+    else if (ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS)
+    {
+      ecma_lex_env_slots_t *slots_p = ecma_get_lex_env_slots (object_p);
+
+      ecma_gc_visit_object (ECMA_GET_NON_NULL_POINTER (ecma_object_t, slots_p->func_obj_cp));
+
+      ecma_value_t *values_p = ECMA_LEX_ENV_SLOTS_GET_VALUES (slots_p);
+
+      for (ecma_length_t slot = 0; slot < slots_p->slots_number; slot++)
+      {
+        if (ecma_is_value_object (values_p[slot]))
+        {
+          ecma_gc_visit_object (ecma_get_object_from_value (values_p[slot]));
+        }
+      }
 
       traverse_properties = false;
     }
@@ -245,7 +735,40 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
     ecma_object_t *proto_p = ecma_get_object_prototype (object_p);
     if (proto_p != NULL)
     {
-      ecma_gc_set_object_visited (proto_p, true);
+      ecma_gc_visit_object (proto_p);
+    }
+
+    if (ecma_get_object_is_shaped (object_p))
+    {
+      ecma_length_t values_number;
+      ecma_value_t *values_p = ecma_shaped_object_get_values (object_p, &values_number);
+
+      for (ecma_length_t slot = 0; slot < values_number; slot++)
+      {
+        if (ecma_is_value_object (values_p[slot]))
+        {
+          ecma_gc_visit_object (ecma_get_object_from_value (values_p[slot]));
+        }
+      }
+
+      traverse_properties = false;
+    }
+    else
+    {
+      const ecma_fast_array_elements_t *elements_p = ecma_get_object_fast_elements (object_p);
+
+      if (elements_p != NULL)
+      {
+        const ecma_value_t *values_p = ECMA_FAST_ARRAY_ELEMENTS_GET_VALUES (elements_p);
+
+        for (uint32_t index = 0; index < elements_p->length; index++)
+        {
+          if (ecma_is_value_object (values_p[index]))
+          {
+            ecma_gc_visit_object (ecma_get_object_from_value (values_p[index]));
+          }
+        }
+      }
     }
   }
 
@@ -268,7 +791,7 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
           {
             ecma_object_t *value_obj_p = ecma_get_object_from_value (value);
 
-            ecma_gc_set_object_visited (value_obj_p, true);
+            ecma_gc_visit_object (value_obj_p);
           }
 
           break;
@@ -281,12 +804,12 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
 
           if (getter_obj_p != NULL)
           {
-            ecma_gc_set_object_visited (getter_obj_p, true);
+            ecma_gc_visit_object (getter_obj_p);
           }
 
           if (setter_obj_p != NULL)
           {
-            ecma_gc_set_object_visited (setter_obj_p, true);
+            ecma_gc_visit_object (setter_obj_p);
           }
 
           break;
@@ -331,6 +854,8 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
             case ECMA_INTERNAL_PROPERTY_NON_INSTANTIATED_BUILT_IN_MASK_0_31: /* an integer (bit-mask) */
             case ECMA_INTERNAL_PROPERTY_NON_INSTANTIATED_BUILT_IN_MASK_32_63: /* an integer (bit-mask) */
             case ECMA_INTERNAL_PROPERTY_REGEXP_BYTECODE:
+            case ECMA_INTERNAL_PROPERTY_LEX_ENV_SLOT_NAMES: /* a table of strings */
+            case ECMA_INTERNAL_PROPERTY_HASHMAP: /* a table of the object's own properties */
             {
               break;
             }
@@ -340,7 +865,31 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
             {
               ecma_object_t *obj_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, property_value);
 
-              ecma_gc_set_object_visited (obj_p, true);
+              ecma_gc_visit_object (obj_p);
+
+              break;
+            }
+
+            case ECMA_INTERNAL_PROPERTY_ARGUMENTS_VALUES: /* values of arguments, held by Arguments object */
+            {
+              ecma_arguments_values_t *args_values_p = ECMA_GET_NON_NULL_POINTER (ecma_arguments_values_t,
+                                                                                  property_value);
+              ecma_object_t *callee_p = ECMA_GET_POINTER (ecma_object_t, args_values_p->callee_cp);
+
+              if (callee_p != NULL)
+              {
+                ecma_gc_visit_object (callee_p);
+              }
+
+              ecma_value_t *values_p = ECMA_ARGUMENTS_VALUES_GET_VALUES (args_values_p);
+
+              for (ecma_length_t i = 0; i < args_values_p->length; i++)
+              {
+                if (ecma_is_value_object (values_p[i]))
+                {
+                  ecma_gc_visit_object (ecma_get_object_from_value (values_p[i]));
+                }
+              }
 
               break;
             }
@@ -384,9 +933,26 @@ ecma_gc_sweep (ecma_object_t *object_p) /**< object to free */
     }
   }
 
-  if (!ecma_is_lexical_environment (object_p) ||
-      ecma_get_lex_env_type (object_p) != ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND)
+  if (ecma_is_lexical_environment (object_p)
+      && ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS)
+  {
+    ecma_free_lex_env_slots (object_p);
+  }
+  else if (!ecma_is_lexical_environment (object_p)
+           && ecma_get_object_is_shaped (object_p))
+  {
+    ecma_shaped_object_free_values (object_p);
+  }
+  else if (!ecma_is_lexical_environment (object_p) ||
+           ecma_get_lex_env_type (object_p) != ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND)
   {
+    if (!ecma_is_lexical_environment (object_p)
+        && ecma_get_object_fast_elements (object_p) != NULL)
+    {
+      /* the property list is moved back to the object */
+      ecma_fast_array_free_elements (object_p);
+    }
+
     for (ecma_property_t *property = ecma_get_property_list (object_p), *next_property_p;
          property != NULL;
          property = next_property_p)
@@ -398,108 +964,580 @@ ecma_gc_sweep (ecma_object_t *object_p) /**< object to free */
     }
   }
 
+  JERRY_ASSERT (ecma_gc_objects_number > 0);
+  ecma_gc_objects_number--;
+
   ecma_dealloc_object (object_p);
 } /* ecma_gc_sweep */
 
 /**
- * Run garbage collecting
+ * Visit objects that are referenced from register variables and other values on ecma-stack
+ *
+ * Values of all stack frames are held in one array, so they are visited with single linear scan.
  */
-void
-ecma_gc_run (void)
+static void
+ecma_gc_visit_registers (void)
 {
-  JERRY_ASSERT (ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] == NULL);
+  uint32_t values_number;
+  const ecma_value_t *values_p = ecma_stack_get_values (&values_number);
+
+  for (uint32_t index = 0; index < values_number; index++)
+  {
+    if (ecma_is_value_object (values_p[index]))
+    {
+      ecma_gc_visit_object (ecma_get_object_from_value (values_p[index]));
+    }
+  }
+} /* ecma_gc_visit_registers */
+
+/**
+ * Clear the remembered set
+ */
+static void
+ecma_gc_clear_remembered_set (void)
+{
+  for (uint32_t index = 0; index < ecma_gc_remembered_set_length; index++)
+  {
+    ecma_object_t *obj_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, ecma_gc_remembered_set[index]);
+
+    ecma_gc_set_object_in_nursery (obj_p, false);
+  }
+
+  ecma_gc_remembered_set_length = 0;
+  ecma_gc_remembered_set_overflowed = false;
+} /* ecma_gc_clear_remembered_set */
+
+/**
+ * Make the object old, moving it to the WHITE_GRAY list
+ */
+static void
+ecma_gc_promote_object (ecma_object_t *object_p) /**< nursery object */
+{
+  JERRY_ASSERT (ecma_gc_is_object_in_nursery (object_p));
+
+  ecma_gc_set_object_in_nursery (object_p, false);
+
+  ecma_gc_set_object_next (object_p, ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY]);
+  ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = object_p;
+} /* ecma_gc_promote_object */
+
+/**
+ * Make all nursery objects old
+ */
+static void
+ecma_gc_promote_nursery (void)
+{
+  for (ecma_object_t *obj_iter_p = ecma_gc_nursery_list_p, *obj_next_p;
+       obj_iter_p != NULL;
+       obj_iter_p = obj_next_p)
+  {
+    obj_next_p = ecma_gc_get_object_next (obj_iter_p);
 
-  /* if some object is referenced from stack or globals (i.e. it is root), mark it */
-  for (ecma_object_t *obj_iter_p = ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY];
+    ecma_gc_promote_object (obj_iter_p);
+  }
+
+  for (ecma_object_t *obj_iter_p = ecma_gc_survivors_list_p, *obj_next_p;
        obj_iter_p != NULL;
-       obj_iter_p = ecma_gc_get_object_next (obj_iter_p))
+       obj_iter_p = obj_next_p)
   {
-    JERRY_ASSERT (!ecma_gc_is_object_visited (obj_iter_p));
+    obj_next_p = ecma_gc_get_object_next (obj_iter_p);
 
+    ecma_gc_promote_object (obj_iter_p);
+  }
+
+  ecma_gc_nursery_list_p = NULL;
+  ecma_gc_nursery_objects_number = 0;
+  ecma_gc_survivors_list_p = NULL;
+  ecma_gc_survivors_number = 0;
+} /* ecma_gc_promote_nursery */
+
+/**
+ * Visit nursery objects of the list that are referenced from stack or globals
+ */
+static void
+ecma_gc_visit_referenced_objects (ecma_object_t *list_p) /**< list of objects */
+{
+  for (ecma_object_t *obj_iter_p = list_p;
+       obj_iter_p != NULL;
+       obj_iter_p = ecma_gc_get_object_next (obj_iter_p))
+  {
     if (ecma_gc_get_object_refs (obj_iter_p) > 0)
     {
-      ecma_gc_set_object_visited (obj_iter_p, true);
+      ecma_gc_visit_object (obj_iter_p);
     }
   }
+} /* ecma_gc_visit_referenced_objects */
 
-  /* if some object is referenced from a register variable (i.e. it is root),
-   * start recursive marking traverse from the object */
-  for (ecma_stack_frame_t *frame_iter_p = ecma_stack_get_top_frame ();
-       frame_iter_p != NULL;
-       frame_iter_p = frame_iter_p->prev_frame_p)
+/**
+ * Traverse references of visited objects of the list
+ */
+static void
+ecma_gc_mark_visited_objects (ecma_object_t *list_p) /**< list of objects */
+{
+  for (ecma_object_t *obj_iter_p = list_p;
+       obj_iter_p != NULL;
+       obj_iter_p = ecma_gc_get_object_next (obj_iter_p))
   {
-    for (int32_t reg_index = 0; reg_index < frame_iter_p->regs_number; reg_index++)
+    if (ecma_gc_is_object_visited (obj_iter_p))
     {
-      ecma_value_t reg_value = ecma_stack_frame_get_reg_value (frame_iter_p, reg_index);
+      ecma_gc_mark (obj_iter_p);
+    }
+  }
+} /* ecma_gc_mark_visited_objects */
 
-      if (ecma_is_value_object (reg_value))
-      {
-        ecma_object_t *obj_p = ecma_get_object_from_value (reg_value);
+/**
+ * Traverse references of the old object during minor collection
+ *
+ * @return true - if the object references a nursery object,
+ *         false - otherwise.
+ */
+static bool
+ecma_gc_mark_old_object (ecma_object_t *object_p) /**< old object */
+{
+  JERRY_ASSERT (ecma_gc_is_minor_collection);
+  JERRY_ASSERT (!ecma_gc_is_object_in_nursery (object_p));
+
+  bool is_visited = ecma_gc_is_object_visited (object_p);
+
+  ecma_gc_is_nursery_object_referenced = false;
+
+  ecma_gc_set_object_visited (object_p, true);
+  ecma_gc_mark (object_p);
+  ecma_gc_set_object_visited (object_p, is_visited);
+
+  return ecma_gc_is_nursery_object_referenced;
+} /* ecma_gc_mark_old_object */
+
+/**
+ * Perform minor collection, freeing unreachable nursery objects
+ *
+ * Reachable objects, allocated since last minor collection, are kept in the nursery as survivors,
+ * and reachable survivors become old.
+ *
+ * Roots of minor collection are nursery objects that are referenced from stack or globals,
+ * nursery objects that are referenced from registers, and objects of the remembered set.
+ */
+static void
+ecma_gc_run_minor (void)
+{
+  JERRY_ASSERT (ecma_gc_phase == ECMA_GC_PHASE_IDLE);
+  JERRY_ASSERT (!ecma_gc_remembered_set_overflowed);
+  JERRY_ASSERT (ecma_gc_worklist_length == 0 && !ecma_gc_worklist_overflowed);
+
+  /* references from LCache entries should not make nursery objects reachable (see also: ecma_gc_start_cycle) */
+  ecma_lcache_invalidate_entries ();
+
+  ECMA_GC_STAT_PAUSE_BEGIN ();
+
+  bool is_working_before = ecma_gc_is_working;
+  ecma_gc_is_working = true;
+  ecma_gc_is_minor_collection = true;
+
+  /* objects of the remembered set are old, so they are not visited, but their references are traversed */
+  const uint32_t remembered_objects_number = ecma_gc_remembered_set_length;
+  ecma_gc_remembered_set_length = 0;
+
+  for (uint32_t index = 0; index < remembered_objects_number; index++)
+  {
+    ecma_object_t *obj_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, ecma_gc_remembered_set[index]);
+
+    ecma_gc_set_object_in_nursery (obj_p, false);
+  }
 
-        ecma_gc_set_object_visited (obj_p, true);
+  for (uint32_t index = 0; index < remembered_objects_number; index++)
+  {
+    ecma_gc_mark_old_object (ECMA_GET_NON_NULL_POINTER (ecma_object_t, ecma_gc_remembered_set[index]));
+  }
+
+  ecma_gc_visit_referenced_objects (ecma_gc_nursery_list_p);
+  ecma_gc_visit_referenced_objects (ecma_gc_survivors_list_p);
+  ecma_gc_visit_registers ();
+
+  while (true)
+  {
+    while (ecma_gc_worklist_length != 0)
+    {
+      ecma_gc_worklist_length--;
+
+      ecma_gc_mark (ECMA_GET_NON_NULL_POINTER (ecma_object_t, ecma_gc_worklist[ecma_gc_worklist_length]));
+    }
+
+    if (likely (!ecma_gc_worklist_overflowed))
+    {
+      break;
+    }
+
+    /* some gray objects are not in the worklist, so references of all visited objects are traversed again */
+    ecma_gc_worklist_overflowed = false;
+
+    ecma_gc_mark_visited_objects (ecma_gc_nursery_list_p);
+    ecma_gc_mark_visited_objects (ecma_gc_survivors_list_p);
+  }
+
+  /*
+   * Old objects that reference objects, remaining in the nursery, should be in the remembered set:
+   *  - objects of the remembered set remain there, if they still reference nursery objects;
+   *  - reachable survivors become old, and are put to the remembered set, if they reference new survivors.
+   *
+   * The set is compacted in place, as an object's new index is not greater than its previous index.
+   */
+  for (uint32_t index = 0; index < remembered_objects_number; index++)
+  {
+    ecma_object_t *obj_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, ecma_gc_remembered_set[index]);
+
+    if (ecma_gc_mark_old_object (obj_p))
+    {
+      ecma_gc_remember_object (obj_p);
+    }
+  }
+
+  ecma_object_t *unreachable_survivors_list_p = NULL;
+
+  for (ecma_object_t *obj_iter_p = ecma_gc_survivors_list_p, *obj_next_p;
+       obj_iter_p != NULL;
+       obj_iter_p = obj_next_p)
+  {
+    obj_next_p = ecma_gc_get_object_next (obj_iter_p);
+
+    if (ecma_gc_is_object_visited (obj_iter_p))
+    {
+      ecma_gc_set_object_visited (obj_iter_p, false);
+      ecma_gc_promote_object (obj_iter_p);
+
+      if (ecma_gc_mark_old_object (obj_iter_p))
+      {
+        ecma_gc_remember_object (obj_iter_p);
       }
+
+      ECMA_GC_STAT_COUNT (promoted_objects);
+    }
+    else
+    {
+      ecma_gc_set_object_next (obj_iter_p, unreachable_survivors_list_p);
+      unreachable_survivors_list_p = obj_iter_p;
     }
   }
 
-  bool marked_anything_during_current_iteration = false;
+  JERRY_ASSERT (ecma_gc_worklist_length == 0 && !ecma_gc_worklist_overflowed);
+
+  ecma_gc_is_minor_collection = false;
+
+  for (uint32_t index = 0; index < ecma_gc_remembered_set_length; index++)
+  {
+    ecma_object_t *obj_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, ecma_gc_remembered_set[index]);
+
+    ecma_gc_set_object_in_nursery (obj_p, true);
+  }
+
+  /* objects, allocated during sweep (by free callbacks), are put into a new nursery */
+  ecma_object_t *nursery_list_p = ecma_gc_nursery_list_p;
+  ecma_gc_nursery_list_p = NULL;
+  ecma_gc_nursery_objects_number = 0;
+  ecma_gc_survivors_list_p = NULL;
+  ecma_gc_survivors_number = 0;
+
+  for (ecma_object_t *obj_iter_p = unreachable_survivors_list_p, *obj_next_p;
+       obj_iter_p != NULL;
+       obj_iter_p = obj_next_p)
+  {
+    obj_next_p = ecma_gc_get_object_next (obj_iter_p);
+
+    ecma_gc_sweep (obj_iter_p);
+  }
 
-  do
+  for (ecma_object_t *obj_iter_p = nursery_list_p, *obj_next_p;
+       obj_iter_p != NULL;
+       obj_iter_p = obj_next_p)
   {
-    marked_anything_during_current_iteration = false;
+    obj_next_p = ecma_gc_get_object_next (obj_iter_p);
 
-    for (ecma_object_t *obj_iter_p = ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY], *obj_prev_p = NULL, *obj_next_p;
-         obj_iter_p != NULL;
-         obj_iter_p = obj_next_p)
+    if (ecma_gc_is_object_visited (obj_iter_p))
     {
-      obj_next_p = ecma_gc_get_object_next (obj_iter_p);
+      ecma_gc_set_object_visited (obj_iter_p, false);
+
+      ecma_gc_set_object_next (obj_iter_p, ecma_gc_survivors_list_p);
+      ecma_gc_survivors_list_p = obj_iter_p;
+      ecma_gc_survivors_number++;
+    }
+    else
+    {
+      ecma_gc_sweep (obj_iter_p);
+    }
+  }
+
+  ecma_gc_is_working = is_working_before;
+
+  ECMA_GC_STAT_COUNT (minor_collections);
+  ECMA_GC_STAT_PAUSE_END ();
+} /* ecma_gc_run_minor */
+
+/**
+ * Start garbage collection cycle
+ *
+ * Note:
+ *      all nursery objects become old, and LCache is invalidated
+ */
+static void
+ecma_gc_start_cycle (void)
+{
+  JERRY_ASSERT (ecma_gc_phase == ECMA_GC_PHASE_IDLE);
+  JERRY_ASSERT (ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] == NULL);
+  JERRY_ASSERT (ecma_gc_worklist_length == 0 && !ecma_gc_worklist_overflowed);
+
+  /* LCache entries hold references, so objects that are reachable only from LCache would be kept alive */
+  ecma_lcache_invalidate_entries ();
 
-      if (ecma_gc_is_object_visited (obj_iter_p))
+  ecma_gc_clear_remembered_set ();
+  ecma_gc_promote_nursery ();
+
+  ecma_gc_phase = ECMA_GC_PHASE_MARK_ROOTS;
+  ecma_gc_cursor_p = ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY];
+} /* ecma_gc_start_cycle */
+
+/**
+ * Finish garbage collection cycle, unmarking all objects
+ */
+static void
+ecma_gc_finish_cycle (void)
+{
+  JERRY_ASSERT (ecma_gc_phase == ECMA_GC_PHASE_SWEEP);
+  JERRY_ASSERT (ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] == NULL);
+
+  ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK];
+  ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] = NULL;
+
+  ecma_gc_visited_flip_flag = !ecma_gc_visited_flip_flag;
+
+  ecma_gc_new_objects_number = 0;
+  ecma_gc_old_objects_after_cycle = ecma_gc_objects_number;
+  ecma_gc_phase = ECMA_GC_PHASE_IDLE;
+
+  if (ecma_gc_is_proactive)
+  {
+    ecma_gc_set_proactive_limit ();
+  }
+
+  ECMA_GC_STAT_FINISH_CYCLE ();
+} /* ecma_gc_finish_cycle */
+
+/**
+ * Perform work of current garbage collection cycle
+ *
+ * Each unit of the budget corresponds to processing of one object.
+ *
+ * @return true - if the cycle was finished,
+ *         false - otherwise.
+ */
+static bool
+ecma_gc_advance (uint32_t budget) /**< maximum number of objects to process */
+{
+  JERRY_ASSERT (ecma_gc_phase != ECMA_GC_PHASE_IDLE);
+
+  bool is_working_before = ecma_gc_is_working;
+  ecma_gc_is_working = true;
+
+  while (budget != 0 && ecma_gc_phase != ECMA_GC_PHASE_IDLE)
+  {
+    budget--;
+
+    if (ecma_gc_worklist_length != 0)
+    {
+      ecma_gc_worklist_length--;
+
+      ecma_gc_mark (ECMA_GET_NON_NULL_POINTER (ecma_object_t, ecma_gc_worklist[ecma_gc_worklist_length]));
+
+      continue;
+    }
+
+    switch (ecma_gc_phase)
+    {
+      case ECMA_GC_PHASE_MARK_ROOTS:
       {
-        /* Moving the object to list of marked objects */
-        ecma_gc_set_object_next (obj_iter_p, ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK]);
-        ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] = obj_iter_p;
+        if (ecma_gc_cursor_p == NULL)
+        {
+          ecma_gc_phase = ECMA_GC_PHASE_MARK;
+        }
+        else
+        {
+          /* if some object is referenced from stack or globals (i.e. it is root), mark it */
+          if (ecma_gc_get_object_refs (ecma_gc_cursor_p) > 0)
+          {
+            ecma_gc_visit_object (ecma_gc_cursor_p);
+          }
+
+          ecma_gc_cursor_p = ecma_gc_get_object_next (ecma_gc_cursor_p);
+        }
+
+        break;
+      }
 
-        if (likely (obj_prev_p != NULL))
+      case ECMA_GC_PHASE_MARK:
+      {
+        if (unlikely (ecma_gc_worklist_overflowed))
         {
-          JERRY_ASSERT (ecma_gc_get_object_next (obj_prev_p) == obj_iter_p);
+          /* some gray objects are not in the worklist,
+           * so references of all visited objects should be traversed again */
+          ecma_gc_worklist_overflowed = false;
+
+          ecma_gc_phase = ECMA_GC_PHASE_MARK_RESCAN;
+          ecma_gc_cursor_p = ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY];
+
+          break;
+        }
+
+        /* if some object is referenced from a register variable (i.e. it is root), mark it */
+        ecma_gc_visit_registers ();
+
+        if (ecma_gc_worklist_length == 0
+            && !ecma_gc_worklist_overflowed)
+        {
+          /* all reachable objects are marked */
+          ecma_gc_phase = ECMA_GC_PHASE_SWEEP;
+        }
+
+        break;
+      }
+
+      case ECMA_GC_PHASE_MARK_RESCAN:
+      {
+        if (ecma_gc_cursor_p == NULL)
+        {
+          ecma_gc_phase = ECMA_GC_PHASE_MARK;
+        }
+        else
+        {
+          if (ecma_gc_is_object_visited (ecma_gc_cursor_p))
+          {
+            ecma_gc_mark (ecma_gc_cursor_p);
+          }
+
+          ecma_gc_cursor_p = ecma_gc_get_object_next (ecma_gc_cursor_p);
+        }
 
-          ecma_gc_set_object_next (obj_prev_p, obj_next_p);
+        break;
+      }
+
+      case ECMA_GC_PHASE_SWEEP:
+      {
+        ecma_object_t *obj_p = ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY];
+
+        if (obj_p == NULL)
+        {
+          ecma_gc_finish_cycle ();
         }
         else
         {
-          ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = obj_next_p;
+          ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = ecma_gc_get_object_next (obj_p);
+
+          if (ecma_gc_is_object_visited (obj_p))
+          {
+            /* Moving the object to list of marked objects */
+            ecma_gc_set_object_next (obj_p, ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK]);
+            ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] = obj_p;
+          }
+          else
+          {
+            ecma_gc_sweep (obj_p);
+          }
         }
 
-        ecma_gc_mark (obj_iter_p);
-        marked_anything_during_current_iteration = true;
+        break;
       }
-      else
+
+      case ECMA_GC_PHASE_IDLE:
       {
-        obj_prev_p = obj_iter_p;
+        JERRY_UNREACHABLE ();
       }
     }
   }
-  while (marked_anything_during_current_iteration);
 
-  /* Sweeping objects that are currently unmarked */
-  for (ecma_object_t *obj_iter_p = ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY], *obj_next_p;
-       obj_iter_p != NULL;
-       obj_iter_p = obj_next_p)
-  {
-    obj_next_p = ecma_gc_get_object_next (obj_iter_p);
+  ecma_gc_is_working = is_working_before;
 
-    JERRY_ASSERT (!ecma_gc_is_object_visited (obj_iter_p));
+  return (ecma_gc_phase == ECMA_GC_PHASE_IDLE);
+} /* ecma_gc_advance */
 
-    ecma_gc_sweep (obj_iter_p);
+/**
+ * Run garbage collecting
+ *
+ * Note:
+ *      if incremental garbage collection cycle is in progress, it is finished first,
+ *      and then all unreachable objects are freed with a new cycle
+ */
+void
+ecma_gc_run (void)
+{
+  ECMA_GC_STAT_PAUSE_BEGIN ();
+
+  if (ecma_gc_phase != ECMA_GC_PHASE_IDLE)
+  {
+    ecma_gc_advance (UINT32_MAX);
   }
 
-  /* Unmarking all objects */
-  ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK];
-  ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] = NULL;
+  ecma_gc_start_cycle ();
+  ecma_gc_advance (UINT32_MAX);
 
-  ecma_gc_visited_flip_flag = !ecma_gc_visited_flip_flag;
+  JERRY_ASSERT (ecma_gc_phase == ECMA_GC_PHASE_IDLE);
+
+  ECMA_GC_STAT_COUNT (full_collections);
+  ECMA_GC_STAT_PAUSE_END ();
 } /* ecma_gc_run */
 
+/**
+ * Perform incremental garbage collection step, starting new garbage collection cycle, if necessary
+ *
+ * @return true - if garbage collection cycle was finished during the step,
+ *         false - otherwise.
+ */
+bool
+ecma_gc_step (uint32_t budget) /**< maximum number of objects to process */
+{
+  ECMA_GC_STAT_PAUSE_BEGIN ();
+
+  if (ecma_gc_phase == ECMA_GC_PHASE_IDLE)
+  {
+    ecma_gc_start_cycle ();
+  }
+
+  bool is_finished = ecma_gc_advance (budget);
+
+  ECMA_GC_STAT_COUNT (incremental_steps);
+  if (is_finished)
+  {
+    ECMA_GC_STAT_COUNT (incremental_cycles);
+  }
+  ECMA_GC_STAT_PAUSE_END ();
+
+  return is_finished;
+} /* ecma_gc_step */
+
+/**
+ * Check whether minor collection is sufficient to free memory upon low severity request
+ *
+ * Minor collection is preferred while number of old objects is less than twice the number of objects
+ * that remained alive after last garbage collection cycle.
+ *
+ * @return true - if minor collection can be performed, and old objects don't need to be collected yet,
+ *         false - otherwise.
+ */
+static bool
+ecma_gc_is_minor_collection_sufficient (void)
+{
+  if (!ecma_gc_is_generational
+      || ecma_gc_phase != ECMA_GC_PHASE_IDLE
+      || ecma_gc_is_working
+      || ecma_gc_remembered_set_overflowed
+      || ecma_gc_nursery_objects_number == 0)
+  {
+    return false;
+  }
+
+  uint32_t old_objects_number = (ecma_gc_objects_number
+                                 - ecma_gc_nursery_objects_number
+                                 - ecma_gc_survivors_number);
+
+  return (old_objects_number < ecma_gc_old_objects_after_cycle * 2 + CONFIG_ECMA_GC_NURSERY_SIZE);
+} /* ecma_gc_is_minor_collection_sufficient */
+
 /**
  * Try to free some memory (depending on severity).
  */
@@ -509,17 +1547,41 @@ ecma_try_to_give_back_some_memory (mem_try_give_memory_back_severity_t severity)
 {
   if (severity == MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_LOW)
   {
-    ecma_gc_run ();
+    ECMA_GC_STAT_COUNT (low_severity_requests);
+
+    if (ecma_gc_is_minor_collection_sufficient ())
+    {
+      ecma_gc_run_minor ();
+    }
+    else if (ecma_gc_is_incremental)
+    {
+      /* the pause is bounded, and if memory is still not enough, full GC is performed with critical severity */
+      ecma_gc_step (CONFIG_ECMA_GC_INCREMENTAL_STEP_BUDGET);
+    }
+    else
+    {
+      ecma_gc_run ();
+    }
+  }
+  else if (severity == MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_MEDIUM)
+  {
+    if (ecma_gc_is_generational
+        && !ecma_gc_is_incremental)
+    {
+      /* low severity request could be satisfied with minor collection only */
+      ecma_gc_run ();
+    }
   }
-  else if (severity == MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_MEDIUM
-           || severity == MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_HIGH)
+  else if (severity == MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_HIGH)
   {
-    /* we have already done simple GC as requests come in ascending severity order */
+    /* we have already done simple GC (or incremental step) as requests come in ascending severity order */
   }
   else
   {
     JERRY_ASSERT (severity == MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_CRITICAL);
 
+    ECMA_GC_STAT_COUNT (critical_severity_requests);
+
     /* Freeing as much memory as we currently can */
     ecma_lcache_invalidate_all ();
 
@@ -527,6 +1589,166 @@ ecma_try_to_give_back_some_memory (mem_try_give_memory_back_severity_t severity)
   }
 } /* ecma_try_to_give_back_some_memory */
 
+#ifdef MEM_STATS
+/**
+ * Get current time in microseconds
+ *
+ * @return current time
+ */
+static uint64_t
+ecma_gc_stat_get_time_us (void)
+{
+  struct timeval tv;
+
+  gettimeofday (&tv, NULL);
+
+  return (uint64_t) tv.tv_sec * 1000000ull + (uint64_t) tv.tv_usec;
+} /* ecma_gc_stat_get_time_us */
+
+/**
+ * Get index of pauses histogram's bucket, corresponding to the pause
+ *
+ * @return bucket index
+ */
+static size_t
+ecma_gc_stat_get_pause_bucket (uint64_t pause_us) /**< pause, in microseconds */
+{
+  if (pause_us < 4)
+  {
+    return (size_t) pause_us;
+  }
+
+  size_t log = 0;
+  while ((pause_us >> (log + 1)) != 0)
+  {
+    log++;
+  }
+
+  size_t bucket = (log - 1) * 4 + (size_t) ((pause_us >> (log - 2)) & 3u);
+
+  return JERRY_MIN (bucket, ECMA_GC_STAT_PAUSE_BUCKETS_NUMBER - 1);
+} /* ecma_gc_stat_get_pause_bucket */
+
+/**
+ * Get upper bound of pauses, accounted in the pauses histogram's bucket
+ *
+ * @return upper bound of the bucket, in microseconds
+ */
+static uint64_t
+ecma_gc_stat_get_bucket_upper_bound (size_t bucket) /**< bucket index */
+{
+  if (bucket < 4)
+  {
+    return bucket;
+  }
+
+  size_t log = bucket / 4 + 1;
+  uint64_t lower_bound = (uint64_t) (4 + bucket % 4) << (log - 2);
+
+  return lower_bound + (1ull << (log - 2)) - 1;
+} /* ecma_gc_stat_get_bucket_upper_bound */
+
+/**
+ * Account beginning of garbage collection pause
+ */
+static void
+ecma_gc_stat_pause_begin (void)
+{
+  ecma_gc_stat_pause_start_us = ecma_gc_stat_get_time_us ();
+} /* ecma_gc_stat_pause_begin */
+
+/**
+ * Account end of garbage collection pause
+ */
+static void
+ecma_gc_stat_pause_end (void)
+{
+  uint64_t pause_us = ecma_gc_stat_get_time_us () - ecma_gc_stat_pause_start_us;
+
+  ecma_gc_stats.pauses++;
+  ecma_gc_stats.total_pause_us += pause_us;
+  ecma_gc_stats.pauses_histogram[ecma_gc_stat_get_pause_bucket (pause_us)]++;
+
+  if (pause_us > ecma_gc_stats.max_pause_us)
+  {
+    ecma_gc_stats.max_pause_us = pause_us;
+  }
+} /* ecma_gc_stat_pause_end */
+
+/**
+ * Account end of garbage collection cycle
+ */
+static void
+ecma_gc_stat_finish_cycle (void)
+{
+  ecma_gc_stats.live_bytes = mem_heap_get_allocated_bytes ();
+  ecma_gc_stats.limit_bytes = mem_heap_get_limit ();
+
+  if (ecma_gc_stats.live_bytes > ecma_gc_stats.peak_live_bytes)
+  {
+    ecma_gc_stats.peak_live_bytes = ecma_gc_stats.live_bytes;
+  }
+} /* ecma_gc_stat_finish_cycle */
+
+/**
+ * Print garbage collector's statistics
+ */
+void
+ecma_gc_stats_print (void)
+{
+  /* upper bound of the bucket, containing 99th percentile of pauses */
+  uint64_t p99_pause_us = 0;
+
+  if (ecma_gc_stats.pauses != 0)
+  {
+    size_t pauses_till_p99 = ecma_gc_stats.pauses - ecma_gc_stats.pauses / 100;
+    size_t bucket = 0;
+
+    while (ecma_gc_stats.pauses_histogram[bucket] < pauses_till_p99)
+    {
+      pauses_till_p99 -= ecma_gc_stats.pauses_histogram[bucket];
+      bucket++;
+    }
+
+    p99_pause_us = JERRY_MIN (ecma_gc_stat_get_bucket_upper_bound (bucket), ecma_gc_stats.max_pause_us);
+  }
+
+  printf ("GC stats:\n");
+  printf ("  Full collections = %zu\n"
+          "  Incremental steps = %zu\n"
+          "  Incremental cycles = %zu\n"
+          "  Minor collections = %zu\n"
+          "  Promoted objects = %zu\n"
+          "  Remembered set overflows = %zu\n"
+          "  Pauses = %zu\n"
+          "  Total pauses time = %zu us\n"
+          "  Max pause = %zu us\n"
+          "  99th percentile pause <= %zu us\n"
+          "  Trigger policy = %s\n"
+          "  Low severity requests = %zu\n"
+          "  Critical severity requests = %zu\n"
+          "  Heap usage after last cycle = %zu bytes\n"
+          "  Peak heap usage after a cycle = %zu bytes\n"
+          "  Heap usage limit after last cycle = %zu bytes\n",
+          ecma_gc_stats.full_collections,
+          ecma_gc_stats.incremental_steps,
+          ecma_gc_stats.incremental_cycles,
+          ecma_gc_stats.minor_collections,
+          ecma_gc_stats.promoted_objects,
+          ecma_gc_stats.remembered_set_overflows,
+          ecma_gc_stats.pauses,
+          (size_t) ecma_gc_stats.total_pause_us,
+          (size_t) ecma_gc_stats.max_pause_us,
+          (size_t) p99_pause_us,
+          ecma_gc_is_proactive ? "proactive" : "default",
+          ecma_gc_stats.low_severity_requests,
+          ecma_gc_stats.critical_severity_requests,
+          ecma_gc_stats.live_bytes,
+          ecma_gc_stats.peak_live_bytes,
+          ecma_gc_stats.limit_bytes);
+} /* ecma_gc_stats_print */
+#endif /* MEM_STATS */
+
 /**
  * @}
  * @}
@@ -26,13 +26,19 @@
 #include "ecma-globals.h"
 #include "mem-allocator.h"
 
-extern void ecma_gc_init (void);
+extern void ecma_gc_init (bool is_incremental, bool is_proactive, bool is_generational);
 extern void ecma_init_gc_info (ecma_object_t *object_p);
+extern void ecma_gc_write_barrier (ecma_object_t *holder_p, ecma_object_t *object_p);
 extern void ecma_ref_object (ecma_object_t *object_p);
 extern void ecma_deref_object (ecma_object_t *object_p);
 extern void ecma_gc_run (void);
+extern bool ecma_gc_step (uint32_t budget);
 extern void ecma_try_to_give_back_some_memory (mem_try_give_memory_back_severity_t severity);
 
+#ifdef MEM_STATS
+extern void ecma_gc_stats_print (void);
+#endif /* MEM_STATS */
+
 #endif /* !ECMA_GC_H */
 
 /**
@@ -58,7 +58,7 @@
 typedef enum
 {
   ECMA_TYPE_SIMPLE, /**< simple value */
-  ECMA_TYPE_NUMBER, /**< 64-bit integer */
+  ECMA_TYPE_NUMBER, /**< integer number or pointer to ecma-number */
   ECMA_TYPE_STRING, /**< pointer to description of a string */
   ECMA_TYPE_OBJECT /**< pointer to description of an object */
 } ecma_type_t;
@@ -129,7 +129,9 @@ typedef enum
 /**
  * Description of an ecma-value
  *
- * Bit-field structure: type (2) | value (ECMA_POINTER_FIELD_WIDTH)
+ * Bit-field structure: type (2) | value (ECMA_VALUE_VALUE_WIDTH)
+ *
+ * Value field of a number value: is integer flag (1) | integer or compressed pointer to ecma-number
  */
 typedef uint32_t ecma_value_t;
 
@@ -140,11 +142,44 @@ typedef uint32_t ecma_value_t;
 #define ECMA_VALUE_TYPE_WIDTH (2)
 
 /**
- * Simple value (ecma_simple_value_t) or compressed pointer to value (depending on value_type)
+ * Simple value (ecma_simple_value_t), compressed pointer to value or integer number (depending on value_type)
+ *
+ * Note:
+ *      the field is wider than compressed pointer, so that small integer numbers could be stored
+ *      directly in number values, without allocation of ecma-number
  */
 #define ECMA_VALUE_VALUE_POS (ECMA_VALUE_TYPE_POS + \
                               ECMA_VALUE_TYPE_WIDTH)
-#define ECMA_VALUE_VALUE_WIDTH (ECMA_POINTER_FIELD_WIDTH)
+#ifndef CONFIG_MEM_LARGE_HEAP
+# define ECMA_VALUE_VALUE_WIDTH (23)
+#else /* CONFIG_MEM_LARGE_HEAP */
+# define ECMA_VALUE_VALUE_WIDTH (26)
+#endif /* CONFIG_MEM_LARGE_HEAP */
+
+/**
+ * Flag of number value, indicating that the value contains integer number itself,
+ * instead of compressed pointer to ecma-number
+ */
+#define ECMA_VALUE_NUMBER_IS_INTEGER_POS (ECMA_VALUE_VALUE_POS)
+#define ECMA_VALUE_NUMBER_IS_INTEGER_WIDTH (1)
+
+/**
+ * Integer number (in two's complement form) or compressed pointer to ecma-number
+ */
+#define ECMA_VALUE_NUMBER_VALUE_POS (ECMA_VALUE_NUMBER_IS_INTEGER_POS + \
+                                     ECMA_VALUE_NUMBER_IS_INTEGER_WIDTH)
+#define ECMA_VALUE_NUMBER_VALUE_WIDTH (ECMA_VALUE_VALUE_WIDTH - ECMA_VALUE_NUMBER_IS_INTEGER_WIDTH)
+
+/**
+ * Type of integer numbers that are stored directly in number values
+ */
+typedef int32_t ecma_integer_value_t;
+
+/**
+ * Range of integer numbers that are stored directly in number values
+ */
+#define ECMA_INTEGER_NUMBER_MAX ((ecma_integer_value_t) ((1u << (ECMA_VALUE_NUMBER_VALUE_WIDTH - 1)) - 1))
+#define ECMA_INTEGER_NUMBER_MIN ((ecma_integer_value_t) (-ECMA_INTEGER_NUMBER_MAX - 1))
 
 /**
  * Size of ecma value description, in bits
@@ -156,9 +191,9 @@ typedef uint32_t ecma_value_t;
  *
  * See also: ECMA-262 v5, 8.9.
  *
- *                                               value (16)
- * Bit-field structure: type (8) | padding (8) <
- *                                               break / continue target
+ *                                  value (ECMA_VALUE_SIZE)
+ * Bit-field structure: type (4) <
+ *                                  break / continue target
  */
 typedef uint32_t ecma_completion_value_t;
 
@@ -178,14 +213,15 @@ typedef uint32_t ecma_completion_value_t;
 
 /**
  * Type (ecma_completion_type_t)
+ *
+ * Note:
+ *      the type field is not byte-aligned, to fit into ecma_completion_value_t together with the value field.
  */
-#define ECMA_COMPLETION_VALUE_TYPE_POS (JERRY_MAX (JERRY_ALIGNUP (ECMA_COMPLETION_VALUE_VALUE_POS + \
-                                                                  ECMA_COMPLETION_VALUE_VALUE_WIDTH, \
-                                                                  JERRY_BITSINBYTE), \
-                                                   JERRY_ALIGNUP (ECMA_COMPLETION_VALUE_TARGET_POS + \
-                                                                  ECMA_COMPLETION_VALUE_TARGET_WIDTH, \
-                                                                  JERRY_BITSINBYTE)))
-#define ECMA_COMPLETION_VALUE_TYPE_WIDTH (8)
+#define ECMA_COMPLETION_VALUE_TYPE_POS (JERRY_MAX (ECMA_COMPLETION_VALUE_VALUE_POS + \
+                                                  ECMA_COMPLETION_VALUE_VALUE_WIDTH, \
+                                                  ECMA_COMPLETION_VALUE_TARGET_POS + \
+                                                  ECMA_COMPLETION_VALUE_TARGET_WIDTH))
+#define ECMA_COMPLETION_VALUE_TYPE_WIDTH (4)
 
 /**
  * Size of ecma completion value description, in bits
@@ -260,6 +296,23 @@ typedef enum
    */
   ECMA_INTERNAL_PROPERTY_REGEXP_BYTECODE,
 
+  /**
+   * Values of arguments, held by Arguments object in compact form (ecma_arguments_values_t)
+   */
+  ECMA_INTERNAL_PROPERTY_ARGUMENTS_VALUES,
+
+  /**
+   * Names of bindings of function's local lexical environment, if the environment
+   * stores the bindings in array of slots (ecma_lex_env_slot_names_t)
+   */
+  ECMA_INTERNAL_PROPERTY_LEX_ENV_SLOT_NAMES,
+
+  /**
+   * Hashed index of named properties of an object with many properties (ecma_property_hashmap_t);
+   * if present, the property is always the first one in the object's property list
+   */
+  ECMA_INTERNAL_PROPERTY_HASHMAP,
+
   /**
    * Number of internal properties' types
    */
@@ -318,6 +371,26 @@ typedef struct __attr_packed___ ecma_property_t
   /** Compressed pointer to next property */
   mem_cpointer_t next_property_p : ECMA_POINTER_FIELD_WIDTH;
 
+  /** Flag indicating whether the property is registered in LCache (named data and named accessor properties) */
+  unsigned int is_lcached : 1;
+
+  /** Flag indicating whether the property may be registered in inline caches of the interpreter
+   *  (named data properties, see also: vm_inline_cache_lookup) */
+  unsigned int is_inline_cached : 1;
+
+  /** Flag indicating whether the property may be registered in cache of global variables
+   *  (named data properties, see also: vm_global_cache_get_value) */
+  unsigned int is_global_cached : 1;
+
+  /** Attribute 'Writable' (ecma_property_writable_value_t, named data properties) */
+  unsigned int writable : 1;
+
+  /** Attribute 'Enumerable' (ecma_property_enumerable_value_t, named data and named accessor properties) */
+  unsigned int enumerable : 1;
+
+  /** Attribute 'Configurable' (ecma_property_configurable_value_t, named data and named accessor properties) */
+  unsigned int configurable : 1;
+
   /** Property's details (depending on Type) */
   union
   {
@@ -329,18 +402,6 @@ typedef struct __attr_packed___ ecma_property_t
 
       /** Compressed pointer to property's name (pointer to String) */
       mem_cpointer_t name_p : ECMA_POINTER_FIELD_WIDTH;
-
-      /** Flag indicating whether the property is registered in LCache */
-      unsigned int is_lcached : 1;
-
-      /** Attribute 'Writable' (ecma_property_writable_value_t) */
-      unsigned int writable : 1;
-
-      /** Attribute 'Enumerable' (ecma_property_enumerable_value_t) */
-      unsigned int enumerable : 1;
-
-      /** Attribute 'Configurable' (ecma_property_configurable_value_t) */
-      unsigned int configurable : 1;
     } named_data_property;
 
     /** Description of named accessor property */
@@ -349,15 +410,6 @@ typedef struct __attr_packed___ ecma_property_t
       /** Compressed pointer to property's name (pointer to String) */
       mem_cpointer_t name_p : ECMA_POINTER_FIELD_WIDTH;
 
-      /** Attribute 'Enumerable' (ecma_property_enumerable_value_t) */
-      unsigned int enumerable : 1;
-
-      /** Attribute 'Configurable' (ecma_property_configurable_value_t) */
-      unsigned int configurable : 1;
-
-      /** Flag indicating whether the property is registered in LCache */
-      unsigned int is_lcached : 1;
-
       /** Compressed pointer to pair of pointers - to property's getter and setter */
       mem_cpointer_t getter_setter_pair_cp : ECMA_POINTER_FIELD_WIDTH;
     } named_accessor_property;
@@ -380,7 +432,9 @@ typedef struct __attr_packed___ ecma_property_t
 typedef enum
 {
   ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE, /**< declarative lexical environment */
-  ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND /**< object-bound lexical environment */
+  ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND, /**< object-bound lexical environment */
+  ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS /**< declarative lexical environment with fixed set of bindings,
+                                              *   stored in array of slots (see also: ecma_lex_env_slots_t) */
 } ecma_lexical_environment_type_t;
 
 /**
@@ -405,9 +459,16 @@ typedef enum
   // ECMA_OBJECT_TYPE_HOST /**< Host object */
 } ecma_object_type_t;
 
+/**
+ * Width of a word of ecma_object_t's container, in bits
+ */
+#define ECMA_OBJECT_CONTAINER_WORD_WIDTH (64)
+
 /**
  * Description of ECMA-object or lexical environment
  * (depending on is_lexical_environment).
+ *
+ * Fields are packed into 64-bit words of the container; a field should not cross a word's boundary.
  */
 typedef struct ecma_object_t
 {
@@ -449,14 +510,22 @@ typedef struct ecma_object_t
                                     ECMA_OBJECT_GC_NEXT_CP_WIDTH)
 #define ECMA_OBJECT_GC_VISITED_WIDTH (1)
 
+/**
+ * Marker that is set if the object is in the nursery (young generation),
+ * or if the object is an old object that is in the remembered set.
+ */
+#define ECMA_OBJECT_GC_NURSERY_POS (ECMA_OBJECT_GC_VISITED_POS + \
+                                    ECMA_OBJECT_GC_VISITED_WIDTH)
+#define ECMA_OBJECT_GC_NURSERY_WIDTH (1)
+
 
 /* Objects' only part */
 
 /**
  * Attribute 'Extensible'
  */
-#define ECMA_OBJECT_OBJ_EXTENSIBLE_POS (ECMA_OBJECT_GC_VISITED_POS + \
-                                        ECMA_OBJECT_GC_VISITED_WIDTH)
+#define ECMA_OBJECT_OBJ_EXTENSIBLE_POS (ECMA_OBJECT_GC_NURSERY_POS + \
+                                        ECMA_OBJECT_GC_NURSERY_WIDTH)
 #define ECMA_OBJECT_OBJ_EXTENSIBLE_WIDTH (1)
 
 /**
@@ -464,13 +533,33 @@ typedef struct ecma_object_t
  */
 #define ECMA_OBJECT_OBJ_TYPE_POS (ECMA_OBJECT_OBJ_EXTENSIBLE_POS + \
                                   ECMA_OBJECT_OBJ_EXTENSIBLE_WIDTH)
-#define ECMA_OBJECT_OBJ_TYPE_WIDTH (4)
+#define ECMA_OBJECT_OBJ_TYPE_WIDTH (3)
 
 /**
- * Compressed pointer to prototype object (ecma_object_t)
+ * Flag indicating whether the object stores its named properties in array of slots, described by a shape
+ * (see also: ecma_shaped_values_t), instead of property list
+ *
+ * Note:
+ *      array objects are never in shaped form, so for them the flag indicates that the array
+ *      stores its elements in a dense vector (see also: ecma_fast_array_elements_t)
  */
-#define ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_POS (ECMA_OBJECT_OBJ_TYPE_POS + \
-                                                 ECMA_OBJECT_OBJ_TYPE_WIDTH)
+#define ECMA_OBJECT_OBJ_IS_SHAPED_POS (ECMA_OBJECT_OBJ_TYPE_POS + \
+                                       ECMA_OBJECT_OBJ_TYPE_WIDTH)
+#define ECMA_OBJECT_OBJ_IS_SHAPED_WIDTH (1)
+
+/**
+ * Compressed pointer to prototype object (ecma_object_t)
+ *
+ * Note:
+ *      in large heap mode the field doesn't fit into the rest of the container's first word,
+ *      so it is placed at beginning of the second word.
+ */
+#ifndef CONFIG_MEM_LARGE_HEAP
+# define ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_POS (ECMA_OBJECT_OBJ_IS_SHAPED_POS + \
+                                                  ECMA_OBJECT_OBJ_IS_SHAPED_WIDTH)
+#else /* CONFIG_MEM_LARGE_HEAP */
+# define ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_POS (ECMA_OBJECT_CONTAINER_WORD_WIDTH)
+#endif /* CONFIG_MEM_LARGE_HEAP */
 #define ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_WIDTH (ECMA_POINTER_FIELD_WIDTH)
 
 /**
@@ -492,15 +581,23 @@ typedef struct ecma_object_t
 /**
  * Type of lexical environment (ecma_lexical_environment_type_t).
  */
-#define ECMA_OBJECT_LEX_ENV_TYPE_POS (ECMA_OBJECT_GC_VISITED_POS + \
-                                        ECMA_OBJECT_GC_VISITED_WIDTH)
-#define ECMA_OBJECT_LEX_ENV_TYPE_WIDTH (1)
+#define ECMA_OBJECT_LEX_ENV_TYPE_POS (ECMA_OBJECT_GC_NURSERY_POS + \
+                                        ECMA_OBJECT_GC_NURSERY_WIDTH)
+#define ECMA_OBJECT_LEX_ENV_TYPE_WIDTH (2)
 
 /**
  * Compressed pointer to outer lexical environment
- */
-#define ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_POS (ECMA_OBJECT_LEX_ENV_TYPE_POS + \
-                                                    ECMA_OBJECT_LEX_ENV_TYPE_WIDTH)
+ *
+ * Note:
+ *      in large heap mode the field doesn't fit into the rest of the container's first word,
+ *      so it is placed at beginning of the second word.
+ */
+#ifndef CONFIG_MEM_LARGE_HEAP
+# define ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_POS (ECMA_OBJECT_LEX_ENV_TYPE_POS + \
+                                                     ECMA_OBJECT_LEX_ENV_TYPE_WIDTH)
+#else /* CONFIG_MEM_LARGE_HEAP */
+# define ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_POS (ECMA_OBJECT_CONTAINER_WORD_WIDTH)
+#endif /* CONFIG_MEM_LARGE_HEAP */
 #define ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_WIDTH (ECMA_POINTER_FIELD_WIDTH)
 
 /**
@@ -516,9 +613,38 @@ typedef struct ecma_object_t
 #define ECMA_OBJECT_LEX_ENV_TYPE_SIZE (ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_POS + \
                                        ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_WIDTH)
 
-  uint64_t container; /**< container for fields described above */
+/**
+ * Number of words in the container
+ */
+#define ECMA_OBJECT_CONTAINER_WORDS_NUMBER (JERRY_ALIGNUP (JERRY_MAX (ECMA_OBJECT_OBJ_TYPE_SIZE, \
+                                                                      ECMA_OBJECT_LEX_ENV_TYPE_SIZE), \
+                                                           ECMA_OBJECT_CONTAINER_WORD_WIDTH) / \
+                                            ECMA_OBJECT_CONTAINER_WORD_WIDTH)
+
+  uint64_t container[ECMA_OBJECT_CONTAINER_WORDS_NUMBER]; /**< container for fields described above */
 } ecma_object_t;
 
+/**
+ * Get value of ecma_object_t's field with specified position and width
+ */
+#define ECMA_OBJECT_GET_FIELD(object_p, field_pos, field_width) \
+  jrt_extract_bit_field ((object_p)->container[(field_pos) / ECMA_OBJECT_CONTAINER_WORD_WIDTH], \
+                         (field_pos) % ECMA_OBJECT_CONTAINER_WORD_WIDTH, \
+                         (field_width))
+
+/**
+ * Set value of ecma_object_t's field with specified position and width
+ */
+#define ECMA_OBJECT_SET_FIELD(object_p, value, field_pos, field_width) \
+  do \
+  { \
+    uint64_t *word_p = &(object_p)->container[(field_pos) / ECMA_OBJECT_CONTAINER_WORD_WIDTH]; \
+    *word_p = jrt_set_bit_field_value (*word_p, \
+                                       (value), \
+                                       (field_pos) % ECMA_OBJECT_CONTAINER_WORD_WIDTH, \
+                                       (field_width)); \
+  } while (0)
+
 
 /**
  * Description of ECMA property descriptor
@@ -592,6 +718,21 @@ typedef double ecma_number_t;
 #define ECMA_NUMBER_MAX_DIGITS  (18)
 #endif /* CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64 */
 
+/**
+ * Description of a heap-allocated ecma-number (number box)
+ *
+ * Boxes are allocated with ecma_alloc_number, which returns pointer to the number field,
+ * so pointer to a box's number can be cast to pointer to the box.
+ *
+ * A box is either owned by its allocator (the reference counter is zero, and the owner can modify the number),
+ * or is immutable and shared between number values, that reference it (the counter is non-zero).
+ */
+typedef struct
+{
+  ecma_number_t value; /**< the number */
+  uint16_t refs; /**< reference counter, or 0 - if the box is not shared */
+} ecma_number_box_t;
+
 /**
  * Value '0' of ecma_number_t
  */
@@ -703,9 +844,230 @@ typedef struct
   mem_cpointer_t next_chunk_cp;
 
   /** Place for the collection's data */
-  uint8_t data[ sizeof (uint64_t) - sizeof (mem_cpointer_t) - sizeof (ecma_length_t) ];
+  uint8_t data[ MEM_POOL_CHUNK_SIZE - sizeof (mem_cpointer_t) - sizeof (ecma_length_t) ];
 } ecma_collection_header_t;
 
+/**
+ * Description of arguments' values, held by Arguments object in compact form
+ *
+ * The header is followed by array of the arguments' values (ecma_value_t), and, if the arguments are mapped,
+ * by array of references to bindings of formal parameters, that correspond to the indices (ECMA_NULL_POINTER -
+ * for unmapped indices; values of unmapped arguments are held in the first array). A reference is compressed
+ * pointer to named data property of the function's lexical environment, or, if the environment is
+ * ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS, index of the binding's slot, increased by one.
+ *
+ * See also:
+ *          ecma_op_create_arguments_object
+ */
+typedef struct
+{
+  /** Number of arguments */
+  ecma_length_t length;
+
+  /** Number of elements in the array of mapped bindings (0 - if the arguments are not mapped) */
+  ecma_length_t mapped_bindings_number;
+
+  /** Compressed pointer to callee function object (ECMA_NULL_POINTER - in strict mode) */
+  mem_cpointer_t callee_cp;
+
+  /** Compressed pointer to the function's lexical environment (ECMA_NULL_POINTER - if the arguments are not mapped) */
+  mem_cpointer_t lex_env_cp;
+} ecma_arguments_values_t;
+
+/**
+ * Get pointer to array of arguments' values, following the ecma_arguments_values_t header
+ */
+#define ECMA_ARGUMENTS_VALUES_GET_VALUES(args_values_p) ((ecma_value_t *) ((args_values_p) + 1))
+
+/**
+ * Get pointer to array of mapped formal parameters' bindings, following the arguments' values
+ */
+#define ECMA_ARGUMENTS_VALUES_GET_MAPPED_BINDINGS(args_values_p) \
+  ((mem_cpointer_t *) (ECMA_ARGUMENTS_VALUES_GET_VALUES (args_values_p) + (args_values_p)->length))
+
+/**
+ * Value of slot index, indicating that there is no slot for a binding
+ */
+#define ECMA_LEX_ENV_NO_SLOT ((ecma_length_t) -1)
+
+/**
+ * Maximum number of slots in a lexical environment
+ *
+ * Note:
+ *      local environments of functions with more bindings are represented with property lists;
+ *      the limit also keeps slot indices, increased by one, representable with mem_cpointer_t
+ *      (see also: ecma_arguments_values_t).
+ */
+#define ECMA_LEX_ENV_MAX_SLOTS ((ecma_length_t) 1024)
+
+/**
+ * Names of bindings of a function's local lexical environment, that stores the bindings in slots
+ *
+ * The table is built upon first call of the function, and is shared between all lexical environments,
+ * created for calls of the function. The header is followed by array of compressed pointers
+ * to the names (ecma_string_t), in the following order:
+ *  - formal parameters, in the order of ECMA_INTERNAL_PROPERTY_FORMAL_PARAMETERS collection;
+ *  - variables, in the order of the function's 'var_decl' instructions;
+ *  - functions, declared in the function, in the order of their declarations;
+ *  - 'arguments', if an Arguments object is instantiated for the function.
+ * Each name is listed once, at its first occurence. The parser uses the same order to calculate
+ * slot indices of variable references (see also: scopes_tree_resolve_identifiers).
+ */
+typedef struct
+{
+  /** Number of the names */
+  ecma_length_t names_number;
+
+  /** Number of the formal parameters' names (they are placed at beginning of the table) */
+  ecma_length_t params_number;
+
+  /** Slot of 'arguments' binding, initialized with Arguments object (ECMA_LEX_ENV_NO_SLOT - if there is no such) */
+  ecma_length_t arguments_slot;
+} ecma_lex_env_slot_names_t;
+
+/**
+ * Get pointer to array of compressed pointers to names, following the ecma_lex_env_slot_names_t header
+ */
+#define ECMA_LEX_ENV_SLOT_NAMES_GET_NAMES(slot_names_p) ((mem_cpointer_t *) ((slot_names_p) + 1))
+
+/**
+ * Description of slots of ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS lexical environment
+ *
+ * The header is followed by array of the bindings' values (ecma_value_t). All the bindings are created
+ * together with the environment, and are mutable, except the binding in 'immutable_slot'.
+ */
+typedef struct
+{
+  /** Number of the slots */
+  ecma_length_t slots_number;
+
+  /** Slot of immutable binding (ECMA_LEX_ENV_NO_SLOT - if all bindings are mutable) */
+  ecma_length_t immutable_slot;
+
+  /** Compressed pointer to the function, the environment is created for (holds the names table) */
+  mem_cpointer_t func_obj_cp;
+
+  /** Compressed pointer to names of the bindings (ecma_lex_env_slot_names_t) */
+  mem_cpointer_t names_cp;
+} ecma_lex_env_slots_t;
+
+/**
+ * Get pointer to array of values, following the ecma_lex_env_slots_t header
+ */
+#define ECMA_LEX_ENV_SLOTS_GET_VALUES(slots_p) ((ecma_value_t *) ((slots_p) + 1))
+
+/**
+ * Value of slot index, indicating that a shape doesn't describe a property with the specified name
+ */
+#define ECMA_SHAPE_NO_SLOT ((ecma_length_t) -1)
+
+/**
+ * Maximum number of properties, stored in slots of an object
+ *
+ * Note:
+ *      objects that get more properties are converted to property list form
+ */
+#define ECMA_SHAPE_MAX_PROPERTIES ((ecma_length_t) 64)
+
+/**
+ * Shape (hidden class) of objects, that store their named properties in array of slots
+ *
+ * Shapes form a tree of transitions, shared between all objects: a shape describes properties of its parent,
+ * followed by one more property, stored in slot with index 'props_number - 1'; the root shape describes
+ * empty set of properties. So, objects that get same properties in same order (for example, objects created
+ * by same constructor or object literal) share the shape.
+ *
+ * All properties, described by shapes, are named data properties with 'Writable', 'Enumerable' and 'Configurable'
+ * attributes set to true.
+ */
+typedef struct
+{
+  /** Number of references to the shape from objects, child shapes and inline caches */
+  uint32_t refs;
+
+  /** Compressed pointer to parent shape (ECMA_NULL_POINTER - for the root shape) */
+  mem_cpointer_t parent_cp;
+
+  /** Compressed pointer to name of the last property (ECMA_NULL_POINTER - for the root shape) */
+  mem_cpointer_t name_cp;
+
+  /** Compressed pointer to first of the shapes, that are transitioned from the shape */
+  mem_cpointer_t first_child_cp;
+
+  /** Compressed pointer to next shape, transitioned from the same parent */
+  mem_cpointer_t next_sibling_cp;
+
+  /** Number of the properties, described by the shape */
+  uint16_t props_number;
+} ecma_shape_t;
+
+/**
+ * Description of slots of an object, that stores its named properties according to a shape
+ *
+ * The header is followed by array of 'capacity' values (ecma_value_t), first 'props_number'
+ * of which are values of the shape's properties.
+ */
+typedef struct
+{
+  /** Compressed pointer to the object's shape */
+  mem_cpointer_t shape_cp;
+
+  /** Number of the slots, the array is allocated for */
+  uint16_t capacity;
+} ecma_shaped_values_t;
+
+/**
+ * Get pointer to array of values, following the ecma_shaped_values_t header
+ */
+#define ECMA_SHAPED_VALUES_GET_VALUES(shaped_values_p) ((ecma_value_t *) ((shaped_values_p) + 1))
+
+/**
+ * Dense vector of elements of an array object in fast form
+ *
+ * The header is followed by array of 'capacity' values (ecma_value_t), first 'length' of which are values
+ * of the array's elements with indices from 0 to 'length - 1'. The elements are named data properties
+ * with 'Writable', 'Enumerable' and 'Configurable' attributes set to true, and the array has no holes,
+ * so value of its 'length' property is always equal to 'length' of the vector.
+ *
+ * The object's property list field points to the vector, and the list itself is referenced from 'props_cp'.
+ */
+typedef struct
+{
+  /** Compressed pointer to the array's property list */
+  mem_cpointer_t props_cp;
+
+  /** Number of the elements */
+  uint32_t length;
+
+  /** Number of the values, the vector is allocated for */
+  uint32_t capacity;
+} ecma_fast_array_elements_t;
+
+/**
+ * Get pointer to array of values, following the ecma_fast_array_elements_t header
+ */
+#define ECMA_FAST_ARRAY_ELEMENTS_GET_VALUES(elements_p) ((ecma_value_t *) ((elements_p) + 1))
+
+/**
+ * Hashed index of named properties of an object
+ *
+ * The header is followed by open-addressed table of 'capacity' compressed pointers to the properties
+ * (ECMA_NULL_POINTER marks empty entry), placed according to hashes of the properties' names.
+ */
+typedef struct
+{
+  /** Number of entries in the table (power of two) */
+  uint32_t capacity;
+
+  /** Number of the indexed properties */
+  uint32_t count;
+} ecma_property_hashmap_t;
+
+/**
+ * Get pointer to the table, following the ecma_property_hashmap_t header
+ */
+#define ECMA_PROPERTY_HASHMAP_GET_TABLE(hashmap_p) ((mem_cpointer_t *) ((hashmap_p) + 1))
+
 /**
  * Description of non-first chunk in a collection's chain of chunks
  */
@@ -715,7 +1077,7 @@ typedef struct
   mem_cpointer_t next_chunk_cp;
 
   /** Characters */
-  lit_utf8_byte_t data[ sizeof (uint64_t) - sizeof (mem_cpointer_t) ];
+  lit_utf8_byte_t data[ MEM_POOL_CHUNK_SIZE - sizeof (mem_cpointer_t) ];
 } ecma_collection_chunk_t;
 
 /**
@@ -736,6 +1098,18 @@ typedef enum
 
 FIXME (Move to library that should define the type (literal.h /* ? */))
 
+/**
+ * Type of ecma_string_t's field, covering all of the descriptor's representations of actual data
+ *
+ * Note:
+ *      in large heap mode concatenation of two compressed pointers doesn't fit into 32 bits.
+ */
+#ifndef CONFIG_MEM_LARGE_HEAP
+typedef uint32_t ecma_string_common_field_t;
+#else /* CONFIG_MEM_LARGE_HEAP */
+typedef uint64_t ecma_string_common_field_t;
+#endif /* CONFIG_MEM_LARGE_HEAP */
+
 /**
  * Literal and compressed pointer to literal
  */
@@ -755,10 +1129,14 @@ typedef struct ecma_string_t
   unsigned int is_stack_var : 1;
 
   /** Where the string's data is placed (ecma_string_container_t) */
-  uint8_t container;
+  unsigned int container : 3;
+
+  /** Flag indicating whether the 'hash' field is set
+    * (hashes of concatenations are calculated upon first request, see also: ecma_string_hash) */
+  unsigned int is_hash_computed : 1;
 
-  /** Hash of the string (calculated from two last characters of the string) */
-  lit_string_hash_t hash;
+  /** Hash of the string (calculated from all characters of the string) */
+  unsigned int hash : LIT_STRING_HASH_BITS;
 
   /**
    * Actual data or identifier of it's place in container (depending on 'container' field)
@@ -791,7 +1169,7 @@ typedef struct ecma_string_t
     lit_magic_string_ex_id_t magic_string_ex_id;
 
     /** For zeroing and comparison in some cases */
-    uint32_t common_field;
+    ecma_string_common_field_t common_field;
   } u;
 } ecma_string_t;
 
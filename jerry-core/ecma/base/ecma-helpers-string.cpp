@@ -349,6 +349,7 @@ ecma_init_ecma_string_from_lit_cp (ecma_string_t *string_p, /**< descriptor to i
   string_p->refs = 1;
   string_p->is_stack_var = (is_stack_var != 0);
   string_p->container = ECMA_STRING_CONTAINER_LIT_TABLE;
+  string_p->is_hash_computed = true;
   string_p->hash = lit_charset_literal_get_hash (lit);
 
   string_p->u.common_field = 0;
@@ -372,8 +373,8 @@ ecma_init_ecma_string_from_magic_string_id (ecma_string_t *string_p, /**< descri
   string_p->refs = 1;
   string_p->is_stack_var = (is_stack_var != 0);
   string_p->container = ECMA_STRING_CONTAINER_MAGIC_STRING;
-  string_p->hash = lit_utf8_string_calc_hash_last_bytes (lit_get_magic_string_utf8 (magic_string_id),
-                                                         lit_get_magic_string_size (magic_string_id));
+  string_p->is_hash_computed = true;
+  string_p->hash = lit_get_magic_string_hash (magic_string_id);
 
   string_p->u.common_field = 0;
   string_p->u.magic_string_id = magic_string_id;
@@ -396,8 +397,9 @@ ecma_init_ecma_string_from_magic_string_ex_id (ecma_string_t *string_p, /**< des
   string_p->refs = 1;
   string_p->is_stack_var = (is_stack_var != 0);
   string_p->container = ECMA_STRING_CONTAINER_MAGIC_STRING_EX;
-  string_p->hash = lit_utf8_string_calc_hash_last_bytes (lit_get_magic_string_ex_utf8 (magic_string_ex_id),
-                                                         lit_get_magic_string_ex_size (magic_string_ex_id));
+  string_p->is_hash_computed = true;
+  string_p->hash = lit_utf8_string_calc_hash (lit_get_magic_string_ex_utf8 (magic_string_ex_id),
+                                              lit_get_magic_string_ex_size (magic_string_ex_id));
 
   string_p->u.common_field = 0;
   string_p->u.magic_string_ex_id = magic_string_ex_id;
@@ -433,7 +435,8 @@ ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *string_p, /**< utf-8 stri
   string_desc_p->refs = 1;
   string_desc_p->is_stack_var = false;
   string_desc_p->container = ECMA_STRING_CONTAINER_HEAP_CHUNKS;
-  string_desc_p->hash = lit_utf8_string_calc_hash_last_bytes (string_p, string_size);
+  string_desc_p->is_hash_computed = true;
+  string_desc_p->hash = lit_utf8_string_calc_hash (string_p, string_size);
 
   string_desc_p->u.common_field = 0;
   ecma_collection_header_t *collection_p = ecma_new_chars_collection (string_p, string_size);
@@ -469,22 +472,22 @@ ecma_new_ecma_string_from_uint32 (uint32_t uint32_number) /**< UInt32-represente
   string_desc_p->is_stack_var = false;
   string_desc_p->container = ECMA_STRING_CONTAINER_UINT32_IN_DESC;
 
-  uint32_t last_two_digits = uint32_number % 100;
-  uint32_t digit_pl = last_two_digits / 10;
-  uint32_t digit_l = last_two_digits % 10;
+  /* digits are written from the end of the buffer, so the number is not moved to the buffer's start */
+  lit_utf8_byte_t digits_buf[ECMA_MAX_CHARS_IN_STRINGIFIED_UINT32];
+  lit_utf8_byte_t *digits_p = digits_buf + ECMA_MAX_CHARS_IN_STRINGIFIED_UINT32;
+  uint32_t value = uint32_number;
 
-  FIXME (/* Use digit to char conversion routine */);
-  const lit_utf8_byte_t digits[10] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9' };
-  const bool is_one_char_or_more = (uint32_number >= 10);
-  const lit_utf8_byte_t last_chars[LIT_STRING_HASH_LAST_BYTES_COUNT] =
+  do
   {
-    is_one_char_or_more ? digits[digit_pl] : digits[digit_l],
-    is_one_char_or_more ? digits[digit_l] : (lit_utf8_byte_t) '\0'
-  };
+    *(--digits_p) = (lit_utf8_byte_t) (LIT_CHAR_0 + value % 10);
+    value /= 10;
+  }
+  while (value != 0);
+
+  const lit_utf8_size_t digits_size = (lit_utf8_size_t) (digits_buf + ECMA_MAX_CHARS_IN_STRINGIFIED_UINT32 - digits_p);
 
-  /* Only last two chars are really used for hash calculation */
-  string_desc_p->hash = lit_utf8_string_calc_hash_last_bytes (last_chars,
-                                                              is_one_char_or_more ? 2 : 1);
+  string_desc_p->is_hash_computed = true;
+  string_desc_p->hash = lit_utf8_string_calc_hash (digits_p, digits_size);
 
 #ifndef JERRY_NDEBUG
   lit_utf8_byte_t byte_buf[ECMA_MAX_CHARS_IN_STRINGIFIED_UINT32];
@@ -493,8 +496,7 @@ ecma_new_ecma_string_from_uint32 (uint32_t uint32_number) /**< UInt32-represente
                                                      ECMA_MAX_CHARS_IN_STRINGIFIED_UINT32);
   JERRY_ASSERT ((ssize_t) ((lit_utf8_size_t) bytes_copied) == bytes_copied);
 
-  JERRY_ASSERT (string_desc_p->hash == lit_utf8_string_calc_hash_last_bytes (byte_buf,
-                                                                             (lit_utf8_size_t) bytes_copied));
+  JERRY_ASSERT (string_desc_p->hash == lit_utf8_string_calc_hash (byte_buf, (lit_utf8_size_t) bytes_copied));
 #endif /* !JERRY_NDEBUG */
 
   string_desc_p->u.common_field = 0;
@@ -536,7 +538,8 @@ ecma_new_ecma_string_from_number (ecma_number_t num) /**< ecma-number */
   string_desc_p->refs = 1;
   string_desc_p->is_stack_var = false;
   string_desc_p->container = ECMA_STRING_CONTAINER_HEAP_NUMBER;
-  string_desc_p->hash = lit_utf8_string_calc_hash_last_bytes (str_buf, str_size);
+  string_desc_p->is_hash_computed = true;
+  string_desc_p->hash = lit_utf8_string_calc_hash (str_buf, str_size);
 
   string_desc_p->u.common_field = 0;
   ecma_number_t *num_p = ecma_alloc_number ();
@@ -653,6 +656,10 @@ ecma_concat_ecma_strings (ecma_string_t *string1_p, /**< first ecma-string */
   string_desc_p->is_stack_var = false;
   string_desc_p->container = ECMA_STRING_CONTAINER_CONCATENATION;
 
+  /* hash of the concatenation depends on all characters of the both strings, so it is calculated on demand */
+  string_desc_p->is_hash_computed = false;
+  string_desc_p->hash = 0;
+
   string_desc_p->u.common_field = 0;
 
   string1_p = ecma_copy_or_ref_ecma_string (string1_p);
@@ -661,24 +668,6 @@ ecma_concat_ecma_strings (ecma_string_t *string1_p, /**< first ecma-string */
   ECMA_SET_NON_NULL_POINTER (string_desc_p->u.concatenation.string1_cp, string1_p);
   ECMA_SET_NON_NULL_POINTER (string_desc_p->u.concatenation.string2_cp, string2_p);
 
-  if (str2_size >= LIT_STRING_HASH_LAST_BYTES_COUNT)
-  {
-    string_desc_p->hash = string2_p->hash;
-  }
-  else
-  {
-    JERRY_STATIC_ASSERT (LIT_STRING_HASH_LAST_BYTES_COUNT == 2);
-    JERRY_ASSERT (str2_size == 1);
-
-    lit_utf8_byte_t bytes_buf[LIT_STRING_HASH_LAST_BYTES_COUNT] =
-    {
-      ecma_string_get_byte_at_pos (string1_p, str1_size - 1u),
-      ecma_string_get_byte_at_pos (string2_p, 0)
-    };
-
-    string_desc_p->hash = lit_utf8_string_calc_hash_last_bytes (bytes_buf, LIT_STRING_HASH_LAST_BYTES_COUNT);
-  }
-
   return string_desc_p;
 } /* ecma_concat_ecma_strings */
 
@@ -961,6 +950,81 @@ ecma_string_to_number (const ecma_string_t *str_p) /**< ecma-string */
   JERRY_UNREACHABLE ();
 } /* ecma_string_to_number */
 
+/**
+ * Check whether the ecma-string is an array index (ECMA-262 v5, 15.4), i.e. it is canonical
+ * string representation of an integer number in range [0, 2 ^ 32 - 2]
+ *
+ * @return true - if the string is an array index (out_index_p is set to the index),
+ *         false - otherwise.
+ */
+bool
+ecma_string_get_array_index (const ecma_string_t *str_p, /**< ecma-string */
+                             uint32_t *out_index_p) /**< out: index */
+{
+  JERRY_ASSERT (str_p != NULL);
+
+  switch ((ecma_string_container_t) str_p->container)
+  {
+    case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
+    {
+      *out_index_p = str_p->u.uint32_number;
+
+      return (str_p->u.uint32_number != ECMA_MAX_VALUE_OF_VALID_ARRAY_INDEX);
+    }
+
+    case ECMA_STRING_CONTAINER_HEAP_NUMBER:
+    case ECMA_STRING_CONTAINER_MAGIC_STRING:
+    {
+      /* numbers, that are representable as uint32, are stored in UINT32_IN_DESC container,
+       * and there are no magic strings, that represent numbers */
+      return false;
+    }
+
+    case ECMA_STRING_CONTAINER_LIT_TABLE:
+    case ECMA_STRING_CONTAINER_HEAP_CHUNKS:
+    case ECMA_STRING_CONTAINER_CONCATENATION:
+    case ECMA_STRING_CONTAINER_MAGIC_STRING_EX:
+    {
+      lit_utf8_byte_t str_buffer[ECMA_MAX_CHARS_IN_STRINGIFIED_UINT32];
+
+      ssize_t bytes_copied = ecma_string_to_utf8_string (str_p,
+                                                         str_buffer,
+                                                         (ssize_t) sizeof (str_buffer));
+
+      if (bytes_copied <= 0
+          || (bytes_copied > 1 && str_buffer[0] == LIT_CHAR_0))
+      {
+        /* the string is empty, is too long, or has leading zeros */
+        return false;
+      }
+
+      uint64_t index = 0;
+
+      for (ssize_t i = 0; i < bytes_copied; i++)
+      {
+        if (str_buffer[i] < LIT_CHAR_0
+            || str_buffer[i] > LIT_CHAR_9)
+        {
+          return false;
+        }
+
+        index = index * 10 + (uint64_t) (str_buffer[i] - LIT_CHAR_0);
+
+        if (index >= ECMA_MAX_VALUE_OF_VALID_ARRAY_INDEX)
+        {
+          return false;
+        }
+      }
+
+      *out_index_p = (uint32_t) index;
+
+      return true;
+    }
+  }
+
+  JERRY_UNREACHABLE ();
+} /* ecma_string_get_array_index */
+
 /**
  * Convert ecma-string's contents to a utf-8 string and put it to the buffer.
  *
@@ -1221,7 +1285,7 @@ bool
 ecma_compare_ecma_strings_equal_hashes (const ecma_string_t *string1_p, /* ecma-string */
                                         const ecma_string_t *string2_p) /* ecma-string */
 {
-  JERRY_ASSERT (string1_p->hash == string2_p->hash);
+  JERRY_ASSERT (ecma_string_hash (string1_p) == ecma_string_hash (string2_p));
 
   if (string1_p->container == string2_p->container
       && string1_p->u.common_field == string2_p->u.common_field)
@@ -1246,19 +1310,21 @@ ecma_compare_ecma_strings (const ecma_string_t *string1_p, /* ecma-string */
 {
   JERRY_ASSERT (string1_p != NULL && string2_p != NULL);
 
-  const bool is_equal_hashes = (string1_p->hash == string2_p->hash);
-
-  if (!is_equal_hashes)
-  {
-    return false;
-  }
   const bool is_equal_containers = (string1_p->container == string2_p->container);
   const bool is_equal_fields = (string1_p->u.common_field == string2_p->u.common_field);
 
+  /* descriptors with same data are checked first, as their hashes can be not calculated yet (concatenations) */
   if (is_equal_containers && is_equal_fields)
   {
     return true;
   }
+
+  const bool is_equal_hashes = (ecma_string_hash (string1_p) == ecma_string_hash (string2_p));
+
+  if (!is_equal_hashes)
+  {
+    return false;
+  }
   else
   {
     return ecma_compare_ecma_strings_longpath (string1_p, string2_p);
@@ -1296,13 +1362,12 @@ ecma_compare_ecma_strings_relational (const ecma_string_t *string1_p, /**< ecma-
 
   if (req_size < 0)
   {
-    lit_utf8_byte_t *heap_buffer_p = (lit_utf8_byte_t *) mem_heap_alloc_block ((size_t) -req_size,
-                                                                               MEM_HEAP_ALLOC_SHORT_TERM);
+    lit_utf8_byte_t *heap_buffer_p = (lit_utf8_byte_t *) ecma_alloc_buffer ((size_t) -req_size);
 
     ssize_t bytes_copied = ecma_string_to_utf8_string (string1_p, heap_buffer_p, -req_size);
     utf8_string1_size = (lit_utf8_size_t) bytes_copied;
 
-    JERRY_ASSERT (bytes_copied > 0);
+    JERRY_ASSERT (bytes_copied > 0 && bytes_copied == -req_size);
 
     utf8_string1_p = heap_buffer_p;
     is_utf8_string1_on_heap = true;
@@ -1317,13 +1382,12 @@ ecma_compare_ecma_strings_relational (const ecma_string_t *string1_p, /**< ecma-
 
   if (req_size < 0)
   {
-    lit_utf8_byte_t *heap_buffer_p = (lit_utf8_byte_t *) mem_heap_alloc_block ((size_t) -req_size,
-                                                                               MEM_HEAP_ALLOC_SHORT_TERM);
+    lit_utf8_byte_t *heap_buffer_p = (lit_utf8_byte_t *) ecma_alloc_buffer ((size_t) -req_size);
 
     ssize_t bytes_copied = ecma_string_to_utf8_string (string2_p, heap_buffer_p, -req_size);
     utf8_string2_size = (lit_utf8_size_t) bytes_copied;
 
-    JERRY_ASSERT (bytes_copied > 0);
+    JERRY_ASSERT (bytes_copied > 0 && bytes_copied == -req_size);
 
     utf8_string2_p = heap_buffer_p;
     is_utf8_string2_on_heap = true;
@@ -1341,12 +1405,12 @@ ecma_compare_ecma_strings_relational (const ecma_string_t *string1_p, /**< ecma-
 
   if (is_utf8_string1_on_heap)
   {
-    mem_heap_free_block ((void*) utf8_string1_p);
+    ecma_dealloc_buffer ((void*) utf8_string1_p, utf8_string1_size);
   }
 
   if (is_utf8_string2_on_heap)
   {
-    mem_heap_free_block ((void*) utf8_string2_p);
+    ecma_dealloc_buffer ((void*) utf8_string2_p, utf8_string2_size);
   }
 
   return is_first_less_than_second;
@@ -1717,16 +1781,47 @@ ecma_is_ex_string_magic (const ecma_string_t *string_p, /**< ecma-string */
 } /* ecma_is_ex_string_magic */
 
 /**
- * Try to calculate hash of the ecma-string
+ * Calculate hash of concatenation and store it to the string's descriptor
  *
  * @return calculated hash
  */
+static lit_string_hash_t __attr_noinline___
+ecma_string_calc_concatenation_hash (ecma_string_t *string_p) /**< concatenation */
+{
+  JERRY_ASSERT (string_p->container == ECMA_STRING_CONTAINER_CONCATENATION
+                && !string_p->is_hash_computed);
+
+  const lit_utf8_size_t string_size = ecma_string_get_size (string_p);
+
+  MEM_DEFINE_LOCAL_ARRAY (string_buf_p, string_size, lit_utf8_byte_t);
+
+  ssize_t bytes_copied = ecma_string_to_utf8_string (string_p, string_buf_p, (ssize_t) string_size);
+  JERRY_ASSERT (bytes_copied == (ssize_t) string_size);
+
+  string_p->hash = lit_utf8_string_calc_hash (string_buf_p, string_size);
+  string_p->is_hash_computed = true;
+
+  MEM_FINALIZE_LOCAL_ARRAY (string_buf_p);
+
+  return (lit_string_hash_t) string_p->hash;
+} /* ecma_string_calc_concatenation_hash */
+
+/**
+ * Get hash of the ecma-string
+ *
+ * @return hash, calculated from all characters of the string
+ */
 lit_string_hash_t
 ecma_string_hash (const ecma_string_t *string_p) /**< ecma-string to calculate hash for */
-
 {
-  return (string_p->hash);
-} /* ecma_string_try_hash */
+  if (unlikely (!string_p->is_hash_computed))
+  {
+    /* only hashes of concatenations, which are always placed in the heap, are calculated on demand */
+    return ecma_string_calc_concatenation_hash ((ecma_string_t *) string_p);
+  }
+
+  return (lit_string_hash_t) string_p->hash;
+} /* ecma_string_hash */
 
 /**
  * Create a substring from an ecma string
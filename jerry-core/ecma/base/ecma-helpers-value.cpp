@@ -29,6 +29,8 @@
 
 JERRY_STATIC_ASSERT (sizeof (ecma_value_t) * JERRY_BITSINBYTE >= ECMA_VALUE_SIZE);
 JERRY_STATIC_ASSERT (sizeof (ecma_completion_value_t) * JERRY_BITSINBYTE >= ECMA_COMPLETION_VALUE_SIZE);
+JERRY_STATIC_ASSERT (ECMA_VALUE_VALUE_WIDTH >= ECMA_POINTER_FIELD_WIDTH);
+JERRY_STATIC_ASSERT (ECMA_VALUE_NUMBER_VALUE_WIDTH >= ECMA_POINTER_FIELD_WIDTH);
 
 /**
  * Get type field of ecma-value
@@ -86,6 +88,20 @@ ecma_set_value_value_field (ecma_value_t value, /**< ecma-value to set field in
                                                  ECMA_VALUE_VALUE_WIDTH);
 } /* ecma_set_value_value_field */
 
+/**
+ * Check if the number value contains integer number itself (see also: ECMA_VALUE_NUMBER_IS_INTEGER_POS)
+ *
+ * @return true - if the value is integer number value,
+ *         false - if the value contains compressed pointer to ecma-number.
+ */
+static bool __attr_pure___
+ecma_get_value_number_is_integer_field (ecma_value_t value) /**< number value */
+{
+  return (jrt_extract_bit_field (value,
+                                 ECMA_VALUE_NUMBER_IS_INTEGER_POS,
+                                 ECMA_VALUE_NUMBER_IS_INTEGER_WIDTH) != 0);
+} /* ecma_get_value_number_is_integer_field */
+
 /**
  * Check if the value is empty.
  *
@@ -167,6 +183,19 @@ ecma_is_value_number (ecma_value_t value) /**< ecma-value */
   return (ecma_get_value_type_field (value) == ECMA_TYPE_NUMBER);
 } /* ecma_is_value_number */
 
+/**
+ * Check if the value is integer number, that is stored directly in the value.
+ *
+ * @return true - if the value contains integer number,
+ *         false - otherwise (the value is not a number or contains compressed pointer to ecma-number).
+ */
+bool __attr_pure___ __attr_always_inline___
+ecma_is_value_integer_number (ecma_value_t value) /**< ecma-value */
+{
+  return (ecma_get_value_type_field (value) == ECMA_TYPE_NUMBER
+          && ecma_get_value_number_is_integer_field (value));
+} /* ecma_is_value_integer_number */
+
 /**
  * Check if the value is ecma-string.
  *
@@ -234,11 +263,76 @@ ecma_make_number_value (const ecma_number_t* num_p) /**< number to reference in
   ecma_value_t ret_value = 0;
 
   ret_value = ecma_set_value_type_field (ret_value, ECMA_TYPE_NUMBER);
-  ret_value = ecma_set_value_value_field (ret_value, num_cp);
+  ret_value = (ecma_value_t) jrt_set_bit_field_value (ret_value,
+                                                      num_cp,
+                                                      ECMA_VALUE_NUMBER_VALUE_POS,
+                                                      ECMA_VALUE_NUMBER_VALUE_WIDTH);
 
   return ret_value;
 } /* ecma_make_number_value */
 
+/**
+ * Integer number value constructor
+ *
+ * Note:
+ *      the number is stored directly in the value, so the value doesn't hold any memory.
+ */
+ecma_value_t __attr_const___ __attr_always_inline___
+ecma_make_integer_value (ecma_integer_value_t integer_value) /**< integer number,
+                                                              *   in range [ECMA_INTEGER_NUMBER_MIN;
+                                                              *             ECMA_INTEGER_NUMBER_MAX] */
+{
+  JERRY_ASSERT (integer_value >= ECMA_INTEGER_NUMBER_MIN
+                && integer_value <= ECMA_INTEGER_NUMBER_MAX);
+
+  const uint32_t integer_field = ((uint32_t) integer_value) & ((1u << ECMA_VALUE_NUMBER_VALUE_WIDTH) - 1u);
+
+  ecma_value_t ret_value = 0;
+
+  ret_value = ecma_set_value_type_field (ret_value, ECMA_TYPE_NUMBER);
+  ret_value = (ecma_value_t) jrt_set_bit_field_value (ret_value,
+                                                      1u,
+                                                      ECMA_VALUE_NUMBER_IS_INTEGER_POS,
+                                                      ECMA_VALUE_NUMBER_IS_INTEGER_WIDTH);
+  ret_value = (ecma_value_t) jrt_set_bit_field_value (ret_value,
+                                                      integer_field,
+                                                      ECMA_VALUE_NUMBER_VALUE_POS,
+                                                      ECMA_VALUE_NUMBER_VALUE_WIDTH);
+
+  return ret_value;
+} /* ecma_make_integer_value */
+
+/**
+ * Check if the number can be represented with integer number value
+ * (i.e. the number is integer in range [ECMA_INTEGER_NUMBER_MIN; ECMA_INTEGER_NUMBER_MAX], and is not -0)
+ *
+ * @return true - if the number fits into integer number value (out_integer_p is set to the integer),
+ *         false - otherwise.
+ */
+bool
+ecma_number_is_integer_value (ecma_number_t num, /**< ecma-number */
+                              ecma_integer_value_t *out_integer_p) /**< out: integer number */
+{
+  /* the comparisons are false for NaN */
+  if (!(num >= (ecma_number_t) ECMA_INTEGER_NUMBER_MIN
+        && num <= (ecma_number_t) ECMA_INTEGER_NUMBER_MAX))
+  {
+    return false;
+  }
+
+  const ecma_integer_value_t integer_value = (ecma_integer_value_t) num;
+
+  if ((ecma_number_t) integer_value != num
+      || (integer_value == 0 && ecma_number_is_negative (num)))
+  {
+    return false;
+  }
+
+  *out_integer_p = integer_value;
+
+  return true;
+} /* ecma_number_is_integer_value */
+
 /**
  * String value constructor
  */
@@ -278,17 +372,69 @@ ecma_make_object_value (const ecma_object_t* object_p) /**< object to reference
 } /* ecma_make_object_value */
 
 /**
- * Get pointer to ecma-number from ecma-value
+ * Get pointer to ecma-number from number value, that doesn't contain integer number
  *
  * @return the pointer
  */
-ecma_number_t* __attr_pure___
+static ecma_number_t* __attr_pure___
+ecma_get_pointer_to_number_from_value (ecma_value_t value) /**< ecma-value */
+{
+  JERRY_ASSERT (ecma_get_value_type_field (value) == ECMA_TYPE_NUMBER
+                && !ecma_get_value_number_is_integer_field (value));
+
+  return ECMA_GET_NON_NULL_POINTER (ecma_number_t,
+                                    jrt_extract_bit_field (value,
+                                                           ECMA_VALUE_NUMBER_VALUE_POS,
+                                                           ECMA_VALUE_NUMBER_VALUE_WIDTH));
+} /* ecma_get_pointer_to_number_from_value */
+
+/**
+ * Get number box from number value, that doesn't contain integer number
+ *
+ * @return pointer to the number box
+ */
+static ecma_number_box_t* __attr_pure___
+ecma_get_number_box_from_value (ecma_value_t value) /**< ecma-value */
+{
+  /* ecma-numbers are allocated as number field of number boxes (see also: ecma_alloc_number) */
+  return (ecma_number_box_t *) ecma_get_pointer_to_number_from_value (value);
+} /* ecma_get_number_box_from_value */
+
+/**
+ * Get integer number from integer number value
+ *
+ * @return the integer
+ */
+ecma_integer_value_t __attr_const___ __attr_always_inline___
+ecma_get_integer_from_value (ecma_value_t value) /**< ecma-value */
+{
+  JERRY_ASSERT (ecma_is_value_integer_number (value));
+
+  /* shift the field to the most significant bits, and then back, to extend the sign */
+  const uint32_t value_field_msb_shift = (uint32_t) sizeof (ecma_value_t) * JERRY_BITSINBYTE - ECMA_VALUE_SIZE;
+  const uint32_t integer_shift = (uint32_t) sizeof (ecma_value_t) * JERRY_BITSINBYTE - ECMA_VALUE_NUMBER_VALUE_WIDTH;
+
+  return ((ecma_integer_value_t) (value << value_field_msb_shift)) >> integer_shift;
+} /* ecma_get_integer_from_value */
+
+/**
+ * Get ecma-number from number value
+ *
+ * @return the number
+ */
+ecma_number_t __attr_pure___
 ecma_get_number_from_value (ecma_value_t value) /**< ecma-value */
 {
   JERRY_ASSERT (ecma_get_value_type_field (value) == ECMA_TYPE_NUMBER);
 
-  return ECMA_GET_NON_NULL_POINTER (ecma_number_t,
-                                    ecma_get_value_value_field (value));
+  if (ecma_get_value_number_is_integer_field (value))
+  {
+    return (ecma_number_t) ecma_get_integer_from_value (value);
+  }
+  else
+  {
+    return *ecma_get_pointer_to_number_from_value (value);
+  }
 } /* ecma_get_number_from_value */
 
 /**
@@ -328,7 +474,11 @@ ecma_get_object_from_value (ecma_value_t value) /**< ecma-value */
  *    case simple:
  *      simply return the value as it was passed;
  *    case number:
- *      copy the number
+ *      if the number is integer number value, or could be represented with one,
+ *      return the integer number value,
+ *      if the number is in a shared number box, increase reference counter of the box
+ *      and return the value as it was passed,
+ *      otherwise, copy the number to a new shared number box
  *      and return new ecma-value
  *      pointing to copy of the number;
  *    case string:
@@ -357,12 +507,47 @@ ecma_copy_value (ecma_value_t value, /**< ecma-value */
     }
     case ECMA_TYPE_NUMBER:
     {
-      ecma_number_t *num_p = ecma_get_number_from_value (value);
+      if (ecma_get_value_number_is_integer_field (value))
+      {
+        value_copy = value;
 
-      ecma_number_t *number_copy_p = ecma_alloc_number ();
-      *number_copy_p = *num_p;
+        break;
+      }
+
+      ecma_number_box_t *box_p = ecma_get_number_box_from_value (value);
+
+      if (box_p->refs != 0)
+      {
+        box_p->refs++;
 
-      value_copy = ecma_make_number_value (number_copy_p);
+        if (likely (box_p->refs != 0))
+        {
+          value_copy = value;
+
+          break;
+        }
+
+        /* reference counter has overflowed, copying the number */
+        box_p->refs--;
+      }
+
+      ecma_number_t num = box_p->value;
+      ecma_integer_value_t integer_value;
+
+      if (ecma_number_is_integer_value (num, &integer_value))
+      {
+        value_copy = ecma_make_integer_value (integer_value);
+      }
+      else
+      {
+        ecma_number_t *number_copy_p = ecma_alloc_number ();
+        *number_copy_p = num;
+
+        value_copy = ecma_make_number_value (number_copy_p);
+
+        /* the copy is immutable, so it can be shared by further copies */
+        ecma_get_number_box_from_value (value_copy)->refs = 1;
+      }
 
       break;
     }
@@ -394,6 +579,44 @@ ecma_copy_value (ecma_value_t value, /**< ecma-value */
   return value_copy;
 } /* ecma_copy_value */
 
+/**
+ * Assign number to a number value, that holds a number
+ *
+ * Note:
+ *      ecma-number of the destination value is reused, if both the destination value and the new number
+ *      are not representable with integer number value, and the destination's number box is not shared
+ *      with other values, otherwise the destination value is freed.
+ *
+ * @return number value, containing copy of the new number
+ */
+ecma_value_t
+ecma_update_number_value (ecma_value_t dst_value, /**< number value to update */
+                          ecma_value_t num_value) /**< number value to assign */
+{
+  JERRY_ASSERT (ecma_is_value_number (dst_value)
+                && ecma_is_value_number (num_value));
+
+  if (!ecma_get_value_number_is_integer_field (dst_value)
+      && !ecma_get_value_number_is_integer_field (num_value))
+  {
+    ecma_number_box_t *dst_box_p = ecma_get_number_box_from_value (dst_value);
+    ecma_number_t num = *ecma_get_pointer_to_number_from_value (num_value);
+    ecma_integer_value_t integer_value;
+
+    if (dst_box_p->refs <= 1
+        && !ecma_number_is_integer_value (num, &integer_value))
+    {
+      dst_box_p->value = num;
+
+      return dst_value;
+    }
+  }
+
+  ecma_free_value (dst_value, false);
+
+  return ecma_copy_value (num_value, false);
+} /* ecma_update_number_value */
+
 /**
  * Free the ecma-value
  */
@@ -412,8 +635,19 @@ ecma_free_value (ecma_value_t value, /**< value description */
 
     case ECMA_TYPE_NUMBER:
     {
-      ecma_number_t *number_p = ecma_get_number_from_value (value);
-      ecma_dealloc_number (number_p);
+      if (!ecma_get_value_number_is_integer_field (value))
+      {
+        ecma_number_box_t *box_p = ecma_get_number_box_from_value (value);
+
+        if (box_p->refs <= 1)
+        {
+          ecma_dealloc_number (&box_p->value);
+        }
+        else
+        {
+          box_p->refs--;
+        }
+      }
       break;
     }
 
@@ -677,11 +911,11 @@ ecma_get_completion_value_value (ecma_completion_value_t completion_value) /**<
 } /* ecma_get_completion_value_value */
 
 /**
- * Get pointer to ecma-number from completion value
+ * Get ecma-number from completion value
  *
- * @return pointer
+ * @return the number
  */
-ecma_number_t* __attr_const___
+ecma_number_t __attr_const___
 ecma_get_number_from_completion_value (ecma_completion_value_t completion_value) /**< completion value */
 {
   return ecma_get_number_from_value (ecma_get_completion_value_value (completion_value));
@@ -21,11 +21,16 @@
  */
 
 #include "ecma-alloc.h"
+#include "ecma-fast-array.h"
 #include "ecma-gc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-lcache.h"
+#include "ecma-property-hashmap.h"
+#include "ecma-shapes.h"
 #include "jrt-bit-fields.h"
+#include "vm-global-cache.h"
+#include "vm-inline-cache.h"
 
 /**
  * Create an object with specified prototype object
@@ -45,30 +50,39 @@ ecma_create_object (ecma_object_t *prototype_object_p, /**< pointer to prototybe
 
   ecma_init_gc_info (object_p);
 
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 ECMA_NULL_POINTER,
-                                                 ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
-                                                 ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 false,
-                                                 ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_POS,
-                                                 ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_WIDTH);
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 is_extensible,
-                                                 ECMA_OBJECT_OBJ_EXTENSIBLE_POS,
-                                                 ECMA_OBJECT_OBJ_EXTENSIBLE_WIDTH);
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 type,
-                                                 ECMA_OBJECT_OBJ_TYPE_POS,
-                                                 ECMA_OBJECT_OBJ_TYPE_WIDTH);
+  ECMA_OBJECT_SET_FIELD (object_p,
+                         ECMA_NULL_POINTER,
+                         ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
+                         ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
+  ECMA_OBJECT_SET_FIELD (object_p,
+                         false,
+                         ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_POS,
+                         ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_WIDTH);
+  ECMA_OBJECT_SET_FIELD (object_p,
+                         is_extensible,
+                         ECMA_OBJECT_OBJ_EXTENSIBLE_POS,
+                         ECMA_OBJECT_OBJ_EXTENSIBLE_WIDTH);
+  ECMA_OBJECT_SET_FIELD (object_p,
+                         type,
+                         ECMA_OBJECT_OBJ_TYPE_POS,
+                         ECMA_OBJECT_OBJ_TYPE_WIDTH);
+  ECMA_OBJECT_SET_FIELD (object_p,
+                         false,
+                         ECMA_OBJECT_OBJ_IS_SHAPED_POS,
+                         ECMA_OBJECT_OBJ_IS_SHAPED_WIDTH);
 
   uint64_t prototype_object_cp;
   ECMA_SET_POINTER (prototype_object_cp, prototype_object_p);
 
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 prototype_object_cp,
-                                                 ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_POS,
-                                                 ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_WIDTH);
+  ECMA_OBJECT_SET_FIELD (object_p,
+                         prototype_object_cp,
+                         ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_POS,
+                         ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_WIDTH);
+
+  if (prototype_object_p != NULL)
+  {
+    ecma_gc_write_barrier (object_p, prototype_object_p);
+  }
 
   ecma_set_object_is_builtin (object_p, false);
 
@@ -92,35 +106,40 @@ ecma_create_decl_lex_env (ecma_object_t *outer_lexical_environment_p) /**< outer
 
   ecma_init_gc_info (new_lexical_environment_p);
 
-  new_lexical_environment_p->container = jrt_set_bit_field_value (new_lexical_environment_p->container,
-                                                                  ECMA_NULL_POINTER,
-                                                                  ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
-                                                                  ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
-  new_lexical_environment_p->container = jrt_set_bit_field_value (new_lexical_environment_p->container,
-                                                                  true,
-                                                                  ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_POS,
-                                                                  ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_WIDTH);
+  ECMA_OBJECT_SET_FIELD (new_lexical_environment_p,
+                         ECMA_NULL_POINTER,
+                         ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
+                         ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
+  ECMA_OBJECT_SET_FIELD (new_lexical_environment_p,
+                         true,
+                         ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_POS,
+                         ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_WIDTH);
 
-  new_lexical_environment_p->container = jrt_set_bit_field_value (new_lexical_environment_p->container,
-                                                                  ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE,
-                                                                  ECMA_OBJECT_LEX_ENV_TYPE_POS,
-                                                                  ECMA_OBJECT_LEX_ENV_TYPE_WIDTH);
+  ECMA_OBJECT_SET_FIELD (new_lexical_environment_p,
+                         ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE,
+                         ECMA_OBJECT_LEX_ENV_TYPE_POS,
+                         ECMA_OBJECT_LEX_ENV_TYPE_WIDTH);
 
   uint64_t outer_reference_cp;
   ECMA_SET_POINTER (outer_reference_cp, outer_lexical_environment_p);
-  new_lexical_environment_p->container = jrt_set_bit_field_value (new_lexical_environment_p->container,
-                                                                  outer_reference_cp,
-                                                                  ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_POS,
-                                                                  ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_WIDTH);
+  ECMA_OBJECT_SET_FIELD (new_lexical_environment_p,
+                         outer_reference_cp,
+                         ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_POS,
+                         ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_WIDTH);
+
+  if (outer_lexical_environment_p != NULL)
+  {
+    ecma_gc_write_barrier (new_lexical_environment_p, outer_lexical_environment_p);
+  }
 
   /*
    * Declarative lexical environments do not really have the flag,
    * but to not leave the value initialized, setting the flag to false.
    */
-  new_lexical_environment_p->container = jrt_set_bit_field_value (new_lexical_environment_p->container,
-                                                                  false,
-                                                                  ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_POS,
-                                                                  ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_WIDTH);
+  ECMA_OBJECT_SET_FIELD (new_lexical_environment_p,
+                         false,
+                         ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_POS,
+                         ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_WIDTH);
 
   return new_lexical_environment_p;
 } /* ecma_create_decl_lex_env */
@@ -147,38 +166,109 @@ ecma_create_object_lex_env (ecma_object_t *outer_lexical_environment_p, /**< out
 
   ecma_init_gc_info (new_lexical_environment_p);
 
-  new_lexical_environment_p->container = jrt_set_bit_field_value (new_lexical_environment_p->container,
-                                                                  true,
-                                                                  ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_POS,
-                                                                  ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_WIDTH);
+  ECMA_OBJECT_SET_FIELD (new_lexical_environment_p,
+                         true,
+                         ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_POS,
+                         ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_WIDTH);
 
-  new_lexical_environment_p->container = jrt_set_bit_field_value (new_lexical_environment_p->container,
-                                                                  ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND,
-                                                                  ECMA_OBJECT_LEX_ENV_TYPE_POS,
-                                                                  ECMA_OBJECT_LEX_ENV_TYPE_WIDTH);
+  ECMA_OBJECT_SET_FIELD (new_lexical_environment_p,
+                         ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND,
+                         ECMA_OBJECT_LEX_ENV_TYPE_POS,
+                         ECMA_OBJECT_LEX_ENV_TYPE_WIDTH);
 
   uint64_t outer_reference_cp;
   ECMA_SET_POINTER (outer_reference_cp, outer_lexical_environment_p);
-  new_lexical_environment_p->container = jrt_set_bit_field_value (new_lexical_environment_p->container,
-                                                                  outer_reference_cp,
-                                                                  ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_POS,
-                                                                  ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_WIDTH);
+  ECMA_OBJECT_SET_FIELD (new_lexical_environment_p,
+                         outer_reference_cp,
+                         ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_POS,
+                         ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_WIDTH);
 
-  new_lexical_environment_p->container = jrt_set_bit_field_value (new_lexical_environment_p->container,
-                                                                  provide_this,
-                                                                  ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_POS,
-                                                                  ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_WIDTH);
+  ECMA_OBJECT_SET_FIELD (new_lexical_environment_p,
+                         provide_this,
+                         ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_POS,
+                         ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_WIDTH);
 
   uint64_t bound_object_cp;
   ECMA_SET_NON_NULL_POINTER (bound_object_cp, binding_obj_p);
-  new_lexical_environment_p->container = jrt_set_bit_field_value (new_lexical_environment_p->container,
-                                                                  bound_object_cp,
-                                                                  ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
-                                                                  ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
+  ECMA_OBJECT_SET_FIELD (new_lexical_environment_p,
+                         bound_object_cp,
+                         ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
+                         ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
+
+  if (outer_lexical_environment_p != NULL)
+  {
+    ecma_gc_write_barrier (new_lexical_environment_p, outer_lexical_environment_p);
+  }
+
+  ecma_gc_write_barrier (new_lexical_environment_p, binding_obj_p);
 
   return new_lexical_environment_p;
 } /* ecma_create_object_lex_env */
 
+/**
+ * Create a declarative lexical environment, bindings of which are stored in array of slots
+ * (see also: ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS).
+ *
+ * All bindings, listed in the names table, are created mutable and initialized to undefined.
+ *
+ * Reference counter's value will be set to one.
+ *
+ * @return pointer to the descriptor of lexical environment
+ */
+ecma_object_t*
+ecma_create_decl_slots_lex_env (ecma_object_t *outer_lexical_environment_p, /**< outer lexical environment */
+                                ecma_object_t *func_obj_p, /**< function, the environment is created for */
+                                ecma_lex_env_slot_names_t *slot_names_p) /**< names of the bindings
+                                                                          *   (held by the function object) */
+{
+  JERRY_ASSERT (func_obj_p != NULL
+                && !ecma_is_lexical_environment (func_obj_p));
+  JERRY_ASSERT (slot_names_p != NULL
+                && slot_names_p->names_number <= ECMA_LEX_ENV_MAX_SLOTS);
+
+  const ecma_length_t slots_number = slot_names_p->names_number;
+
+  ecma_lex_env_slots_t *slots_p;
+  slots_p = (ecma_lex_env_slots_t *) mem_heap_alloc_block (sizeof (ecma_lex_env_slots_t)
+                                                           + slots_number * sizeof (ecma_value_t),
+                                                           MEM_HEAP_ALLOC_SHORT_TERM);
+
+  slots_p->slots_number = slots_number;
+  slots_p->immutable_slot = ECMA_LEX_ENV_NO_SLOT;
+  ECMA_SET_NON_NULL_POINTER (slots_p->func_obj_cp, func_obj_p);
+  ECMA_SET_NON_NULL_POINTER (slots_p->names_cp, slot_names_p);
+
+  ecma_value_t *values_p = ECMA_LEX_ENV_SLOTS_GET_VALUES (slots_p);
+
+  for (ecma_length_t slot = 0; slot < slots_number; slot++)
+  {
+    values_p[slot] = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+  }
+
+  /*
+   * The environment is created after the slots block is allocated, as the allocation can run garbage collection,
+   * that shouldn't observe a slots environment without the block.
+   */
+  ecma_object_t *new_lexical_environment_p = ecma_create_decl_lex_env (outer_lexical_environment_p);
+
+  ECMA_OBJECT_SET_FIELD (new_lexical_environment_p,
+                         ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS,
+                         ECMA_OBJECT_LEX_ENV_TYPE_POS,
+                         ECMA_OBJECT_LEX_ENV_TYPE_WIDTH);
+
+  uint64_t slots_cp;
+  ECMA_SET_NON_NULL_POINTER (slots_cp, slots_p);
+  ECMA_OBJECT_SET_FIELD (new_lexical_environment_p,
+                         slots_cp,
+                         ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
+                         ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
+
+  /* the environment refers to the function object, to keep the names table alive */
+  ecma_gc_write_barrier (new_lexical_environment_p, func_obj_p);
+
+  return new_lexical_environment_p;
+} /* ecma_create_decl_slots_lex_env */
+
 /**
  * Check if the object is lexical environment.
  */
@@ -187,7 +277,7 @@ ecma_is_lexical_environment (const ecma_object_t *object_p) /**< object or lexic
 {
   JERRY_ASSERT (object_p != NULL);
 
-  return (bool) jrt_extract_bit_field (object_p->container,
+  return (bool) ECMA_OBJECT_GET_FIELD (object_p,
                                        ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_POS,
                                        ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_WIDTH);
 } /* ecma_is_lexical_environment */
@@ -201,7 +291,7 @@ ecma_get_object_extensible (const ecma_object_t *object_p) /**< object */
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
 
-  return (bool) jrt_extract_bit_field (object_p->container,
+  return (bool) ECMA_OBJECT_GET_FIELD (object_p,
                                        ECMA_OBJECT_OBJ_EXTENSIBLE_POS,
                                        ECMA_OBJECT_OBJ_EXTENSIBLE_WIDTH);
 } /* ecma_get_object_extensible */
@@ -216,10 +306,10 @@ ecma_set_object_extensible (ecma_object_t *object_p, /**< object */
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
 
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 is_extensible,
-                                                 ECMA_OBJECT_OBJ_EXTENSIBLE_POS,
-                                                 ECMA_OBJECT_OBJ_EXTENSIBLE_WIDTH);
+  ECMA_OBJECT_SET_FIELD (object_p,
+                         is_extensible,
+                         ECMA_OBJECT_OBJ_EXTENSIBLE_POS,
+                         ECMA_OBJECT_OBJ_EXTENSIBLE_WIDTH);
 } /* ecma_set_object_extensible */
 
 /**
@@ -231,7 +321,7 @@ ecma_get_object_type (const ecma_object_t *object_p) /**< object */
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
 
-  return (ecma_object_type_t) jrt_extract_bit_field (object_p->container,
+  return (ecma_object_type_t) ECMA_OBJECT_GET_FIELD (object_p,
                                                      ECMA_OBJECT_OBJ_TYPE_POS,
                                                      ECMA_OBJECT_OBJ_TYPE_WIDTH);
 } /* ecma_get_object_type */
@@ -246,10 +336,10 @@ ecma_set_object_type (ecma_object_t *object_p, /**< object */
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
 
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 type,
-                                                 ECMA_OBJECT_OBJ_TYPE_POS,
-                                                 ECMA_OBJECT_OBJ_TYPE_WIDTH);
+  ECMA_OBJECT_SET_FIELD (object_p,
+                         type,
+                         ECMA_OBJECT_OBJ_TYPE_POS,
+                         ECMA_OBJECT_OBJ_TYPE_WIDTH);
 } /* ecma_set_object_type */
 
 /**
@@ -262,7 +352,7 @@ ecma_get_object_prototype (const ecma_object_t *object_p) /**< object */
   JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
 
   JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_WIDTH);
-  uintptr_t prototype_object_cp = (uintptr_t) jrt_extract_bit_field (object_p->container,
+  uintptr_t prototype_object_cp = (uintptr_t) ECMA_OBJECT_GET_FIELD (object_p,
                                                                      ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_POS,
                                                                      ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_WIDTH);
   return ECMA_GET_POINTER (ecma_object_t,
@@ -285,7 +375,7 @@ ecma_get_object_is_builtin (const ecma_object_t *object_p) /**< object */
 
   JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= width);
 
-  uintptr_t flag_value = (uintptr_t) jrt_extract_bit_field (object_p->container,
+  uintptr_t flag_value = (uintptr_t) ECMA_OBJECT_GET_FIELD (object_p,
                                                             offset,
                                                             width);
 
@@ -305,12 +395,165 @@ ecma_set_object_is_builtin (ecma_object_t *object_p, /**< object */
   const uint32_t offset = ECMA_OBJECT_OBJ_IS_BUILTIN_POS;
   const uint32_t width = ECMA_OBJECT_OBJ_IS_BUILTIN_WIDTH;
 
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 (uintptr_t) is_builtin,
-                                                 offset,
-                                                 width);
+  ECMA_OBJECT_SET_FIELD (object_p,
+                         (uintptr_t) is_builtin,
+                         offset,
+                         width);
 } /* ecma_set_object_is_builtin */
 
+/**
+ * Check if the object stores its named properties in array of slots, described by a shape
+ *
+ * @return true / false
+ */
+bool __attr_pure___
+ecma_get_object_is_shaped (const ecma_object_t *object_p) /**< object */
+{
+  JERRY_ASSERT (object_p != NULL);
+  JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
+
+  /* for array objects the flag indicates fast form of the array (see also: ecma_get_object_fast_elements) */
+  return ((bool) ECMA_OBJECT_GET_FIELD (object_p,
+                                        ECMA_OBJECT_OBJ_IS_SHAPED_POS,
+                                        ECMA_OBJECT_OBJ_IS_SHAPED_WIDTH)
+          && ecma_get_object_type (object_p) != ECMA_OBJECT_TYPE_ARRAY);
+} /* ecma_get_object_is_shaped */
+
+/**
+ * Set flag indicating whether the object stores its named properties in array of slots
+ *
+ * Note:
+ *      the object should have neither properties, nor slots
+ */
+void
+ecma_set_object_is_shaped (ecma_object_t *object_p, /**< object */
+                           bool is_shaped) /**< value of flag */
+{
+  JERRY_ASSERT (object_p != NULL);
+  JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
+  JERRY_ASSERT (ecma_get_object_type (object_p) != ECMA_OBJECT_TYPE_ARRAY);
+  JERRY_ASSERT (ECMA_OBJECT_GET_FIELD (object_p,
+                                       ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
+                                       ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH) == ECMA_NULL_POINTER);
+
+  ECMA_OBJECT_SET_FIELD (object_p,
+                         is_shaped,
+                         ECMA_OBJECT_OBJ_IS_SHAPED_POS,
+                         ECMA_OBJECT_OBJ_IS_SHAPED_WIDTH);
+} /* ecma_set_object_is_shaped */
+
+/**
+ * Get slots of an object, that stores its named properties in array of slots
+ *
+ * @return pointer to the slots' header,
+ *         NULL - if the object has no properties
+ */
+ecma_shaped_values_t* __attr_pure___
+ecma_get_object_shaped_values (const ecma_object_t *object_p) /**< shaped object */
+{
+  JERRY_ASSERT (ecma_get_object_is_shaped (object_p));
+
+  JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
+  uintptr_t shaped_values_cp = (uintptr_t) ECMA_OBJECT_GET_FIELD (object_p,
+                                                                  ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
+                                                                  ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
+  return ECMA_GET_POINTER (ecma_shaped_values_t, shaped_values_cp);
+} /* ecma_get_object_shaped_values */
+
+/**
+ * Set slots of an object, that stores its named properties in array of slots
+ */
+void
+ecma_set_object_shaped_values (ecma_object_t *object_p, /**< shaped object */
+                               ecma_shaped_values_t *shaped_values_p) /**< slots (or NULL) */
+{
+  JERRY_ASSERT (ecma_get_object_is_shaped (object_p));
+
+  uint64_t shaped_values_cp;
+  ECMA_SET_POINTER (shaped_values_cp, shaped_values_p);
+
+  ECMA_OBJECT_SET_FIELD (object_p,
+                         shaped_values_cp,
+                         ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
+                         ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
+} /* ecma_set_object_shaped_values */
+
+/**
+ * Get dense vector of elements of an array object in fast form
+ *
+ * @return pointer to the vector's header,
+ *         NULL - if the object is not an array in fast form
+ */
+ecma_fast_array_elements_t* __attr_pure___
+ecma_get_object_fast_elements (const ecma_object_t *object_p) /**< object */
+{
+  JERRY_ASSERT (object_p != NULL);
+  JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
+
+  if (!ECMA_OBJECT_GET_FIELD (object_p, ECMA_OBJECT_OBJ_IS_SHAPED_POS, ECMA_OBJECT_OBJ_IS_SHAPED_WIDTH)
+      || ecma_get_object_type (object_p) != ECMA_OBJECT_TYPE_ARRAY)
+  {
+    return NULL;
+  }
+
+  JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
+  uintptr_t elements_cp = (uintptr_t) ECMA_OBJECT_GET_FIELD (object_p,
+                                                             ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
+                                                             ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
+  return ECMA_GET_NON_NULL_POINTER (ecma_fast_array_elements_t, elements_cp);
+} /* ecma_get_object_fast_elements */
+
+/**
+ * Set dense vector of elements of an array object
+ *
+ * If the vector is not NULL, the array is switched to (or kept in) fast form and the property list
+ * is referenced from the vector's header; otherwise, the array is switched to the usual form
+ * and the property list is moved back from the header of the current vector.
+ *
+ * Note:
+ *      the previous vector is not freed
+ */
+void
+ecma_set_object_fast_elements (ecma_object_t *object_p, /**< array object */
+                               ecma_fast_array_elements_t *elements_p) /**< vector (or NULL) */
+{
+  JERRY_ASSERT (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_ARRAY);
+
+  ecma_fast_array_elements_t *old_elements_p = ecma_get_object_fast_elements (object_p);
+  uint64_t field_value;
+
+  if (elements_p != NULL)
+  {
+    if (old_elements_p != NULL)
+    {
+      elements_p->props_cp = old_elements_p->props_cp;
+    }
+    else
+    {
+      elements_p->props_cp = (mem_cpointer_t) ECMA_OBJECT_GET_FIELD (object_p,
+                                                                     ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
+                                                                     ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
+    }
+
+    ECMA_SET_NON_NULL_POINTER (field_value, elements_p);
+  }
+  else
+  {
+    JERRY_ASSERT (old_elements_p != NULL);
+
+    field_value = old_elements_p->props_cp;
+  }
+
+  ECMA_OBJECT_SET_FIELD (object_p,
+                         field_value,
+                         ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
+                         ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
+  ECMA_OBJECT_SET_FIELD (object_p,
+                         elements_p != NULL,
+                         ECMA_OBJECT_OBJ_IS_SHAPED_POS,
+                         ECMA_OBJECT_OBJ_IS_SHAPED_WIDTH);
+} /* ecma_set_object_fast_elements */
+
 /**
  * Get type of lexical environment.
  */
@@ -320,7 +563,7 @@ ecma_get_lex_env_type (const ecma_object_t *object_p) /**< lexical environment *
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (ecma_is_lexical_environment (object_p));
 
-  return (ecma_lexical_environment_type_t) jrt_extract_bit_field (object_p->container,
+  return (ecma_lexical_environment_type_t) ECMA_OBJECT_GET_FIELD (object_p,
                                                                   ECMA_OBJECT_LEX_ENV_TYPE_POS,
                                                                   ECMA_OBJECT_LEX_ENV_TYPE_WIDTH);
 } /* ecma_get_lex_env_type */
@@ -335,7 +578,7 @@ ecma_get_lex_env_outer_reference (const ecma_object_t *object_p) /**< lexical en
   JERRY_ASSERT (ecma_is_lexical_environment (object_p));
 
   JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_WIDTH);
-  uintptr_t outer_reference_cp = (uintptr_t) jrt_extract_bit_field (object_p->container,
+  uintptr_t outer_reference_cp = (uintptr_t) ECMA_OBJECT_GET_FIELD (object_p,
                                                                     ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_POS,
                                                                     ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_WIDTH);
   return ECMA_GET_POINTER (ecma_object_t,
@@ -351,9 +594,20 @@ ecma_get_property_list (const ecma_object_t *object_p) /**< object or lexical en
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (!ecma_is_lexical_environment (object_p) ||
                 ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE);
+  JERRY_ASSERT (ecma_is_lexical_environment (object_p) || !ecma_get_object_is_shaped (object_p));
+
+  if (!ecma_is_lexical_environment (object_p))
+  {
+    const ecma_fast_array_elements_t *elements_p = ecma_get_object_fast_elements (object_p);
+
+    if (elements_p != NULL)
+    {
+      return ECMA_GET_POINTER (ecma_property_t, elements_p->props_cp);
+    }
+  }
 
   JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
-  uintptr_t properties_cp = (uintptr_t) jrt_extract_bit_field (object_p->container,
+  uintptr_t properties_cp = (uintptr_t) ECMA_OBJECT_GET_FIELD (object_p,
                                                                ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
                                                                ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
   return ECMA_GET_POINTER (ecma_property_t,
@@ -370,14 +624,26 @@ ecma_set_property_list (ecma_object_t *object_p, /**< object or lexical environm
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (!ecma_is_lexical_environment (object_p) ||
                 ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE);
+  JERRY_ASSERT (ecma_is_lexical_environment (object_p) || !ecma_get_object_is_shaped (object_p));
+
+  if (!ecma_is_lexical_environment (object_p))
+  {
+    ecma_fast_array_elements_t *elements_p = ecma_get_object_fast_elements (object_p);
+
+    if (elements_p != NULL)
+    {
+      ECMA_SET_POINTER (elements_p->props_cp, property_list_p);
+      return;
+    }
+  }
 
   uint64_t properties_cp;
   ECMA_SET_POINTER (properties_cp, property_list_p);
 
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 properties_cp,
-                                                 ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
-                                                 ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
+  ECMA_OBJECT_SET_FIELD (object_p,
+                         properties_cp,
+                         ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
+                         ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
 } /* ecma_set_property_list */
 
 /**
@@ -391,7 +657,7 @@ ecma_get_lex_env_provide_this (const ecma_object_t *object_p) /**< object-bound
                 ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND);
 
   JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
-  bool provide_this = (jrt_extract_bit_field (object_p->container,
+  bool provide_this = (ECMA_OBJECT_GET_FIELD (object_p,
                                               ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_POS,
                                               ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_WIDTH) != 0);
 
@@ -409,12 +675,162 @@ ecma_get_lex_env_binding_object (const ecma_object_t *object_p) /**< object-boun
                 ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND);
 
   JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
-  uintptr_t object_cp = (uintptr_t) jrt_extract_bit_field (object_p->container,
+  uintptr_t object_cp = (uintptr_t) ECMA_OBJECT_GET_FIELD (object_p,
                                                            ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
                                                            ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
   return ECMA_GET_NON_NULL_POINTER (ecma_object_t, object_cp);
 } /* ecma_get_lex_env_binding_object */
 
+/**
+ * Get slots of lexical environment, that stores its bindings in array of slots
+ *
+ * @return pointer to the slots' header
+ */
+ecma_lex_env_slots_t* __attr_pure___
+ecma_get_lex_env_slots (const ecma_object_t *object_p) /**< slots lexical environment */
+{
+  JERRY_ASSERT (object_p != NULL);
+  JERRY_ASSERT (ecma_is_lexical_environment (object_p) &&
+                ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS);
+
+  uintptr_t slots_cp = (uintptr_t) ECMA_OBJECT_GET_FIELD (object_p,
+                                                          ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
+                                                          ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
+  return ECMA_GET_NON_NULL_POINTER (ecma_lex_env_slots_t, slots_cp);
+} /* ecma_get_lex_env_slots */
+
+/**
+ * Find slot of the binding with specified name in lexical environment, that stores its bindings in slots
+ *
+ * @return index of the slot - if the environment contains the binding,
+ *         ECMA_LEX_ENV_NO_SLOT - otherwise.
+ */
+ecma_length_t
+ecma_find_lex_env_slot (const ecma_object_t *lex_env_p, /**< slots lexical environment */
+                        ecma_string_t *name_p) /**< name of the binding */
+{
+  const ecma_lex_env_slots_t *slots_p = ecma_get_lex_env_slots (lex_env_p);
+  const ecma_lex_env_slot_names_t *slot_names_p = ECMA_GET_NON_NULL_POINTER (ecma_lex_env_slot_names_t,
+                                                                            slots_p->names_cp);
+  const mem_cpointer_t *names_p = ECMA_LEX_ENV_SLOT_NAMES_GET_NAMES (slot_names_p);
+
+  for (ecma_length_t slot = 0; slot < slots_p->slots_number; slot++)
+  {
+    if (ecma_compare_ecma_strings (name_p, ECMA_GET_NON_NULL_POINTER (ecma_string_t, names_p[slot])))
+    {
+      return slot;
+    }
+  }
+
+  return ECMA_LEX_ENV_NO_SLOT;
+} /* ecma_find_lex_env_slot */
+
+/**
+ * Get name of the binding, stored in specified slot of lexical environment
+ *
+ * @return pointer to ecma-string (not referenced)
+ */
+ecma_string_t*
+ecma_get_lex_env_slot_name (const ecma_object_t *lex_env_p, /**< slots lexical environment */
+                            ecma_length_t slot) /**< index of the slot */
+{
+  const ecma_lex_env_slots_t *slots_p = ecma_get_lex_env_slots (lex_env_p);
+  JERRY_ASSERT (slot < slots_p->slots_number);
+
+  const ecma_lex_env_slot_names_t *slot_names_p = ECMA_GET_NON_NULL_POINTER (ecma_lex_env_slot_names_t,
+                                                                            slots_p->names_cp);
+
+  return ECMA_GET_NON_NULL_POINTER (ecma_string_t, ECMA_LEX_ENV_SLOT_NAMES_GET_NAMES (slot_names_p)[slot]);
+} /* ecma_get_lex_env_slot_name */
+
+/**
+ * Get value of the binding, stored in specified slot of lexical environment
+ *
+ * @return ecma-value (not copied)
+ */
+ecma_value_t
+ecma_get_lex_env_slot_value (const ecma_object_t *lex_env_p, /**< slots lexical environment */
+                             ecma_length_t slot) /**< index of the slot */
+{
+  const ecma_lex_env_slots_t *slots_p = ecma_get_lex_env_slots (lex_env_p);
+  JERRY_ASSERT (slot < slots_p->slots_number);
+
+  return ECMA_LEX_ENV_SLOTS_GET_VALUES (slots_p)[slot];
+} /* ecma_get_lex_env_slot_value */
+
+/**
+ * Assign value to the binding, stored in specified slot of lexical environment
+ *
+ * Note:
+ *      value previously stored in the slot is freed
+ */
+void
+ecma_assign_lex_env_slot_value (ecma_object_t *lex_env_p, /**< slots lexical environment */
+                                ecma_length_t slot, /**< index of the slot */
+                                ecma_value_t value) /**< value to assign */
+{
+  ecma_lex_env_slots_t *slots_p = ecma_get_lex_env_slots (lex_env_p);
+  JERRY_ASSERT (slot < slots_p->slots_number);
+
+  ecma_value_t *value_p = ECMA_LEX_ENV_SLOTS_GET_VALUES (slots_p) + slot;
+
+  if (ecma_is_value_number (value)
+      && ecma_is_value_number (*value_p))
+  {
+    *value_p = ecma_update_number_value (*value_p, value);
+  }
+  else
+  {
+    ecma_free_value (*value_p, false);
+
+    *value_p = ecma_copy_value (value, false);
+
+    if (ecma_is_value_object (value))
+    {
+      ecma_gc_write_barrier (lex_env_p, ecma_get_object_from_value (value));
+    }
+  }
+} /* ecma_assign_lex_env_slot_value */
+
+/**
+ * Free slots of lexical environment, that stores its bindings in array of slots, and values they hold
+ */
+void
+ecma_free_lex_env_slots (ecma_object_t *lex_env_p) /**< slots lexical environment */
+{
+  ecma_lex_env_slots_t *slots_p = ecma_get_lex_env_slots (lex_env_p);
+  ecma_value_t *values_p = ECMA_LEX_ENV_SLOTS_GET_VALUES (slots_p);
+
+  for (ecma_length_t slot = 0; slot < slots_p->slots_number; slot++)
+  {
+    ecma_free_value (values_p[slot], false);
+  }
+
+  mem_heap_free_block (slots_p);
+} /* ecma_free_lex_env_slots */
+
+/**
+ * Link the property into the object's properties' linked-list (at start of the list,
+ * or right after the property hashmap, that should remain the first property)
+ */
+static void
+ecma_link_property (ecma_object_t *object_p, /**< object or lexical environment */
+                    ecma_property_t *property_p) /**< property to link */
+{
+  ecma_property_t *list_head_p = ecma_get_property_list (object_p);
+
+  if (ecma_property_hashmap_get (object_p) != NULL)
+  {
+    property_p->next_property_p = list_head_p->next_property_p;
+    ECMA_SET_NON_NULL_POINTER (list_head_p->next_property_p, property_p);
+  }
+  else
+  {
+    ECMA_SET_POINTER (property_p->next_property_p, list_head_p);
+    ecma_set_property_list (object_p, property_p);
+  }
+} /* ecma_link_property */
+
 /**
  * Create internal property in an object and link it into
  * the object's properties' linked-list (at start of the list).
@@ -427,13 +843,17 @@ ecma_create_internal_property (ecma_object_t *object_p, /**< the object */
 {
   JERRY_ASSERT (ecma_find_internal_property (object_p, property_id) == NULL);
 
+  if (!ecma_is_lexical_environment (object_p)
+      && ecma_get_object_is_shaped (object_p))
+  {
+    ecma_shaped_object_convert_to_property_list (object_p);
+  }
+
   ecma_property_t *new_property_p = ecma_alloc_property ();
 
   new_property_p->type = ECMA_PROPERTY_INTERNAL;
 
-  ecma_property_t *list_head_p = ecma_get_property_list (object_p);
-  ECMA_SET_POINTER (new_property_p->next_property_p, list_head_p);
-  ecma_set_property_list (object_p, new_property_p);
+  ecma_link_property (object_p, new_property_p);
 
   JERRY_STATIC_ASSERT (ECMA_INTERNAL_PROPERTY__COUNT <= (1ull << ECMA_PROPERTY_INTERNAL_PROPERTY_TYPE_WIDTH));
   JERRY_ASSERT (property_id < ECMA_INTERNAL_PROPERTY__COUNT);
@@ -459,6 +879,13 @@ ecma_find_internal_property (ecma_object_t *object_p, /**< object descriptor */
   JERRY_ASSERT (property_id != ECMA_INTERNAL_PROPERTY_PROTOTYPE
                 && property_id != ECMA_INTERNAL_PROPERTY_EXTENSIBLE);
 
+  if (!ecma_is_lexical_environment (object_p)
+      && ecma_get_object_is_shaped (object_p))
+  {
+    /* objects in shaped form don't have internal properties */
+    return NULL;
+  }
+
   for (ecma_property_t *property_p = ecma_get_property_list (object_p);
        property_p != NULL;
        property_p = ECMA_GET_POINTER (ecma_property_t, property_p->next_property_p))
@@ -508,6 +935,18 @@ ecma_create_named_data_property (ecma_object_t *obj_p, /**< object */
                                  bool is_configurable) /**< 'Configurable' attribute */
 {
   JERRY_ASSERT (obj_p != NULL && name_p != NULL);
+
+  if (!ecma_is_lexical_environment (obj_p))
+  {
+    if (ecma_get_object_is_shaped (obj_p))
+    {
+      ecma_shaped_object_convert_to_property_list (obj_p);
+    }
+    else
+    {
+      ecma_fast_array_prepare_named_property (obj_p, name_p);
+    }
+  }
   JERRY_ASSERT (ecma_find_named_property (obj_p, name_p) == NULL);
 
   ecma_property_t *prop_p = ecma_alloc_property ();
@@ -517,18 +956,18 @@ ecma_create_named_data_property (ecma_object_t *obj_p, /**< object */
 
   ECMA_SET_NON_NULL_POINTER (prop_p->u.named_data_property.name_p, name_p);
 
-  prop_p->u.named_data_property.writable = is_writable ? ECMA_PROPERTY_WRITABLE : ECMA_PROPERTY_NOT_WRITABLE;
-  prop_p->u.named_data_property.enumerable = is_enumerable ? ECMA_PROPERTY_ENUMERABLE : ECMA_PROPERTY_NOT_ENUMERABLE;
-  prop_p->u.named_data_property.configurable = (is_configurable ?
-                                                ECMA_PROPERTY_CONFIGURABLE : ECMA_PROPERTY_NOT_CONFIGURABLE);
+  prop_p->writable = is_writable ? ECMA_PROPERTY_WRITABLE : ECMA_PROPERTY_NOT_WRITABLE;
+  prop_p->enumerable = is_enumerable ? ECMA_PROPERTY_ENUMERABLE : ECMA_PROPERTY_NOT_ENUMERABLE;
+  prop_p->configurable = is_configurable ? ECMA_PROPERTY_CONFIGURABLE : ECMA_PROPERTY_NOT_CONFIGURABLE;
 
-  prop_p->u.named_data_property.is_lcached = false;
+  prop_p->is_lcached = false;
+  prop_p->is_inline_cached = false;
+  prop_p->is_global_cached = false;
 
-  ecma_set_named_data_property_value (prop_p, ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED));
+  ecma_set_named_data_property_value (obj_p, prop_p, ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED));
 
-  ecma_property_t *list_head_p = ecma_get_property_list (obj_p);
-  ECMA_SET_POINTER (prop_p->next_property_p, list_head_p);
-  ecma_set_property_list (obj_p, prop_p);
+  ecma_link_property (obj_p, prop_p);
+  ecma_property_hashmap_insert (obj_p, prop_p);
 
   ecma_lcache_invalidate (obj_p, name_p, NULL);
 
@@ -549,6 +988,18 @@ ecma_create_named_accessor_property (ecma_object_t *obj_p, /**< object */
                                      bool is_configurable) /**< 'configurable' attribute */
 {
   JERRY_ASSERT (obj_p != NULL && name_p != NULL);
+
+  if (!ecma_is_lexical_environment (obj_p))
+  {
+    if (ecma_get_object_is_shaped (obj_p))
+    {
+      ecma_shaped_object_convert_to_property_list (obj_p);
+    }
+    else
+    {
+      ecma_fast_array_prepare_named_property (obj_p, name_p);
+    }
+  }
   JERRY_ASSERT (ecma_find_named_property (obj_p, name_p) == NULL);
 
   ecma_property_t *prop_p = ecma_alloc_property ();
@@ -559,18 +1010,17 @@ ecma_create_named_accessor_property (ecma_object_t *obj_p, /**< object */
 
   ECMA_SET_NON_NULL_POINTER (prop_p->u.named_accessor_property.name_p, name_p);
 
-  prop_p->u.named_accessor_property.enumerable = (is_enumerable ?
-                                                  ECMA_PROPERTY_ENUMERABLE : ECMA_PROPERTY_NOT_ENUMERABLE);
-  prop_p->u.named_accessor_property.configurable = (is_configurable ?
-                                                    ECMA_PROPERTY_CONFIGURABLE : ECMA_PROPERTY_NOT_CONFIGURABLE);
+  prop_p->writable = ECMA_PROPERTY_NOT_WRITABLE;
+  prop_p->enumerable = is_enumerable ? ECMA_PROPERTY_ENUMERABLE : ECMA_PROPERTY_NOT_ENUMERABLE;
+  prop_p->configurable = is_configurable ? ECMA_PROPERTY_CONFIGURABLE : ECMA_PROPERTY_NOT_CONFIGURABLE;
 
-  prop_p->u.named_accessor_property.is_lcached = false;
+  prop_p->is_lcached = false;
+  prop_p->is_inline_cached = false;
+  prop_p->is_global_cached = false;
 
   ECMA_SET_NON_NULL_POINTER (prop_p->u.named_accessor_property.getter_setter_pair_cp, getter_setter_pointers_p);
 
-  ecma_property_t *list_head_p = ecma_get_property_list (obj_p);
-  ECMA_SET_POINTER (prop_p->next_property_p, list_head_p);
-  ecma_set_property_list (obj_p, prop_p);
+  ecma_link_property (obj_p, prop_p);
 
   /*
    * Should be performed after linking the property into object's property list, because the setters assert that.
@@ -578,6 +1028,8 @@ ecma_create_named_accessor_property (ecma_object_t *obj_p, /**< object */
   ecma_set_named_accessor_property_getter (obj_p, prop_p, get_p);
   ecma_set_named_accessor_property_setter (obj_p, prop_p, set_p);
 
+  ecma_property_hashmap_insert (obj_p, prop_p);
+
   ecma_lcache_invalidate (obj_p, name_p, NULL);
 
   return prop_p;
@@ -598,37 +1050,75 @@ ecma_find_named_property (ecma_object_t *obj_p, /**< object to find property in
 
   ecma_property_t *property_p;
 
-  if (ecma_lcache_lookup (obj_p, name_p, &property_p))
+  if (!ecma_is_lexical_environment (obj_p)
+      && ecma_get_object_is_shaped (obj_p))
   {
-    return property_p;
-  }
+    if (ecma_shaped_object_find_slot (obj_p, name_p) == ECMA_SHAPE_NO_SLOT)
+    {
+      return NULL;
+    }
 
-  for (property_p = ecma_get_property_list (obj_p);
-       property_p != NULL;
-       property_p = ECMA_GET_POINTER (ecma_property_t, property_p->next_property_p))
+    /* a property descriptor is requested, so the object is switched to property list form */
+    ecma_shaped_object_convert_to_property_list (obj_p);
+  }
+  else if (!ecma_is_lexical_environment (obj_p)
+           && ecma_get_object_fast_elements (obj_p) != NULL)
   {
-    ecma_string_t *property_name_p;
+    uint32_t index;
 
-    if (property_p->type == ECMA_PROPERTY_NAMEDDATA)
-    {
-      property_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t,
-                                                   property_p->u.named_data_property.name_p);
-    }
-    else if (property_p->type == ECMA_PROPERTY_NAMEDACCESSOR)
+    /* elements of arrays in fast form are not looked up in LCache */
+    if (ecma_string_get_array_index (name_p, &index))
     {
-      property_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t,
-                                                   property_p->u.named_accessor_property.name_p);
-    }
-    else
-    {
-      continue;
+      if (index >= ecma_get_object_fast_elements (obj_p)->length)
+      {
+        return NULL;
+      }
+
+      /* a property descriptor of an element is requested, so the array is switched to the usual form */
+      ecma_fast_array_convert_to_property_list (obj_p);
     }
+  }
+
+  if (ecma_lcache_lookup (obj_p, name_p, &property_p))
+  {
+    return property_p;
+  }
 
-    JERRY_ASSERT (property_name_p != NULL);
+  ecma_property_hashmap_t *hashmap_p = ecma_property_hashmap_get (obj_p);
 
-    if (ecma_compare_ecma_strings (name_p, property_name_p))
+  if (hashmap_p != NULL)
+  {
+    property_p = ecma_property_hashmap_find (hashmap_p, name_p);
+  }
+  else
+  {
+    for (property_p = ecma_get_property_list (obj_p);
+         property_p != NULL;
+         property_p = ECMA_GET_POINTER (ecma_property_t, property_p->next_property_p))
     {
-      break;
+      ecma_string_t *property_name_p;
+
+      if (property_p->type == ECMA_PROPERTY_NAMEDDATA)
+      {
+        property_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t,
+                                                     property_p->u.named_data_property.name_p);
+      }
+      else if (property_p->type == ECMA_PROPERTY_NAMEDACCESSOR)
+      {
+        property_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t,
+                                                     property_p->u.named_accessor_property.name_p);
+      }
+      else
+      {
+        continue;
+      }
+
+      JERRY_ASSERT (property_name_p != NULL);
+
+      if (ecma_compare_ecma_strings (name_p, property_name_p))
+      {
+        break;
+      }
     }
   }
 
@@ -760,6 +1250,24 @@ ecma_free_internal_property (ecma_property_t *property_p) /**< the property */
       break;
     }
 
+    case ECMA_INTERNAL_PROPERTY_LEX_ENV_SLOT_NAMES: /* a names table */
+    {
+      if (property_value != ECMA_NULL_POINTER)
+      {
+        ecma_lex_env_slot_names_t *slot_names_p = ECMA_GET_NON_NULL_POINTER (ecma_lex_env_slot_names_t,
+                                                                            property_value);
+        mem_cpointer_t *names_p = ECMA_LEX_ENV_SLOT_NAMES_GET_NAMES (slot_names_p);
+
+        for (ecma_length_t i = 0; i < slot_names_p->names_number; i++)
+        {
+          ecma_deref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, names_p[i]));
+        }
+
+        mem_heap_free_block (slot_names_p);
+      }
+      break;
+    }
+
     case ECMA_INTERNAL_PROPERTY_PRIMITIVE_STRING_VALUE: /* compressed pointer to a ecma_string_t */
     {
       ecma_string_t *str_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t,
@@ -813,6 +1321,31 @@ ecma_free_internal_property (ecma_property_t *property_p) /**< the property */
     {
       void *bytecode_p = ECMA_GET_NON_NULL_POINTER (void, property_value);
       mem_heap_free_block (bytecode_p);
+
+      break;
+    }
+
+    case ECMA_INTERNAL_PROPERTY_HASHMAP: /* hashed index of named properties */
+    {
+      ecma_property_hashmap_free (ECMA_GET_NON_NULL_POINTER (ecma_property_hashmap_t, property_value));
+
+      break;
+    }
+
+    case ECMA_INTERNAL_PROPERTY_ARGUMENTS_VALUES: /* arguments' values, followed by mapped bindings */
+    {
+      ecma_arguments_values_t *args_values_p = ECMA_GET_NON_NULL_POINTER (ecma_arguments_values_t,
+                                                                          property_value);
+      ecma_value_t *values_p = ECMA_ARGUMENTS_VALUES_GET_VALUES (args_values_p);
+
+      for (ecma_length_t i = 0; i < args_values_p->length; i++)
+      {
+        ecma_free_value (values_p[i], false);
+      }
+
+      mem_heap_free_block (args_values_p);
+
+      break;
     }
   }
 
@@ -869,6 +1402,27 @@ ecma_delete_property (ecma_object_t *obj_p, /**< object */
 
     if (cur_prop_p == prop_p)
     {
+      /*
+       * Inline caches keep the objects they refer to alive, so only properties of live objects
+       * (i.e. explicitly deleted ones) can be referenced by the caches upon being freed.
+       */
+      if (prop_p->type == ECMA_PROPERTY_NAMEDDATA
+          && ecma_is_property_inline_cached (prop_p))
+      {
+        vm_inline_cache_invalidate_property (prop_p);
+      }
+
+      if (prop_p->type == ECMA_PROPERTY_NAMEDDATA
+          && ecma_is_property_global_cached (prop_p))
+      {
+        vm_global_cache_invalidate_property (prop_p);
+      }
+
+      if (prop_p->type != ECMA_PROPERTY_INTERNAL)
+      {
+        ecma_property_hashmap_delete (obj_p, prop_p);
+      }
+
       ecma_free_property (obj_p, prop_p);
 
       if (prev_prop_p == NULL)
@@ -930,11 +1484,17 @@ ecma_get_named_data_property_value (const ecma_property_t *prop_p) /**< property
  * Set value field of named data property
  */
 void
-ecma_set_named_data_property_value (ecma_property_t *prop_p, /**< property */
+ecma_set_named_data_property_value (ecma_object_t *obj_p, /**< the property's container */
+                                    ecma_property_t *prop_p, /**< property */
                                     ecma_value_t value) /**< value to set */
 {
   JERRY_ASSERT (prop_p->type == ECMA_PROPERTY_NAMEDDATA);
 
+  if (ecma_is_value_object (value))
+  {
+    ecma_gc_write_barrier (obj_p, ecma_get_object_from_value (value));
+  }
+
   prop_p->u.named_data_property.value = value & ((1ull << ECMA_VALUE_SIZE) - 1);
 } /* ecma_set_named_data_property_value */
 
@@ -955,17 +1515,16 @@ ecma_named_data_property_assign_value (ecma_object_t *obj_p, /**< object */
   if (ecma_is_value_number (value)
       && ecma_is_value_number (ecma_get_named_data_property_value (prop_p)))
   {
-    const ecma_number_t *num_src_p = ecma_get_number_from_value (value);
-    ecma_number_t *num_dst_p = ecma_get_number_from_value (ecma_get_named_data_property_value (prop_p));
+    ecma_value_t v = ecma_get_named_data_property_value (prop_p);
 
-    *num_dst_p = *num_src_p;
+    ecma_set_named_data_property_value (obj_p, prop_p, ecma_update_number_value (v, value));
   }
   else
   {
     ecma_value_t v = ecma_get_named_data_property_value (prop_p);
     ecma_free_value (v, false);
 
-    ecma_set_named_data_property_value (prop_p, ecma_copy_value (value, false));
+    ecma_set_named_data_property_value (obj_p, prop_p, ecma_copy_value (value, false));
   }
 } /* ecma_named_data_property_assign_value */
 
@@ -1019,6 +1578,11 @@ ecma_set_named_accessor_property_getter (ecma_object_t* object_p, /**< the prope
                                                prop_p->u.named_accessor_property.getter_setter_pair_cp);
 
   ECMA_SET_POINTER (getter_setter_pointers_p->getter_p, getter_p);
+
+  if (getter_p != NULL)
+  {
+    ecma_gc_write_barrier (object_p, getter_p);
+  }
 } /* ecma_named_accessor_property_set_getter */
 
 /**
@@ -1037,6 +1601,11 @@ ecma_set_named_accessor_property_setter (ecma_object_t* object_p, /**< the prope
                                                prop_p->u.named_accessor_property.getter_setter_pair_cp);
 
   ECMA_SET_POINTER (getter_setter_pointers_p->setter_p, setter_p);
+
+  if (setter_p != NULL)
+  {
+    ecma_gc_write_barrier (object_p, setter_p);
+  }
 } /* ecma_named_accessor_property_set_setter */
 
 /**
@@ -1050,7 +1619,7 @@ ecma_is_property_writable (ecma_property_t* prop_p) /**< property */
 {
   JERRY_ASSERT (prop_p->type == ECMA_PROPERTY_NAMEDDATA);
 
-  return (prop_p->u.named_data_property.writable == ECMA_PROPERTY_WRITABLE);
+  return (prop_p->writable == ECMA_PROPERTY_WRITABLE);
 } /* ecma_is_property_writable */
 
 /**
@@ -1063,7 +1632,7 @@ ecma_set_property_writable_attr (ecma_property_t* prop_p, /**< property */
 {
   JERRY_ASSERT (prop_p->type == ECMA_PROPERTY_NAMEDDATA);
 
-  prop_p->u.named_data_property.writable = is_writable ? ECMA_PROPERTY_WRITABLE : ECMA_PROPERTY_NOT_WRITABLE;
+  prop_p->writable = is_writable ? ECMA_PROPERTY_WRITABLE : ECMA_PROPERTY_NOT_WRITABLE;
 } /* ecma_set_property_writable_attr */
 
 /**
@@ -1075,16 +1644,10 @@ ecma_set_property_writable_attr (ecma_property_t* prop_p, /**< property */
 bool
 ecma_is_property_enumerable (ecma_property_t* prop_p) /**< property */
 {
-  if (prop_p->type == ECMA_PROPERTY_NAMEDDATA)
-  {
-    return (prop_p->u.named_data_property.enumerable == ECMA_PROPERTY_ENUMERABLE);
-  }
-  else
-  {
-    JERRY_ASSERT (prop_p->type == ECMA_PROPERTY_NAMEDACCESSOR);
+  JERRY_ASSERT (prop_p->type == ECMA_PROPERTY_NAMEDDATA
+                || prop_p->type == ECMA_PROPERTY_NAMEDACCESSOR);
 
-    return (prop_p->u.named_accessor_property.enumerable == ECMA_PROPERTY_ENUMERABLE);
-  }
+  return (prop_p->enumerable == ECMA_PROPERTY_ENUMERABLE);
 } /* ecma_is_property_enumerable */
 
 /**
@@ -1095,18 +1658,10 @@ ecma_set_property_enumerable_attr (ecma_property_t* prop_p, /**< property */
                                    bool is_enumerable) /**< should the property
                                                         *  be enumerable? */
 {
-  if (prop_p->type == ECMA_PROPERTY_NAMEDDATA)
-  {
-    prop_p->u.named_data_property.enumerable = (is_enumerable ?
-                                                ECMA_PROPERTY_ENUMERABLE : ECMA_PROPERTY_NOT_ENUMERABLE);
-  }
-  else
-  {
-    JERRY_ASSERT (prop_p->type == ECMA_PROPERTY_NAMEDACCESSOR);
+  JERRY_ASSERT (prop_p->type == ECMA_PROPERTY_NAMEDDATA
+                || prop_p->type == ECMA_PROPERTY_NAMEDACCESSOR);
 
-    prop_p->u.named_accessor_property.enumerable = (is_enumerable ?
-                                                    ECMA_PROPERTY_ENUMERABLE : ECMA_PROPERTY_NOT_ENUMERABLE);
-  }
+  prop_p->enumerable = is_enumerable ? ECMA_PROPERTY_ENUMERABLE : ECMA_PROPERTY_NOT_ENUMERABLE;
 } /* ecma_set_property_enumerable_attr */
 
 /**
@@ -1118,16 +1673,10 @@ ecma_set_property_enumerable_attr (ecma_property_t* prop_p, /**< property */
 bool
 ecma_is_property_configurable (ecma_property_t* prop_p) /**< property */
 {
-  if (prop_p->type == ECMA_PROPERTY_NAMEDDATA)
-  {
-    return (prop_p->u.named_data_property.configurable == ECMA_PROPERTY_CONFIGURABLE);
-  }
-  else
-  {
-    JERRY_ASSERT (prop_p->type == ECMA_PROPERTY_NAMEDACCESSOR);
+  JERRY_ASSERT (prop_p->type == ECMA_PROPERTY_NAMEDDATA
+                || prop_p->type == ECMA_PROPERTY_NAMEDACCESSOR);
 
-    return (prop_p->u.named_accessor_property.configurable == ECMA_PROPERTY_CONFIGURABLE);
-  }
+  return (prop_p->configurable == ECMA_PROPERTY_CONFIGURABLE);
 } /* ecma_is_property_configurable */
 
 /**
@@ -1138,18 +1687,10 @@ ecma_set_property_configurable_attr (ecma_property_t* prop_p, /**< property */
                                      bool is_configurable) /**< should the property
                                                             *  be configurable? */
 {
-  if (prop_p->type == ECMA_PROPERTY_NAMEDDATA)
-  {
-    prop_p->u.named_data_property.configurable = (is_configurable ?
-                                                  ECMA_PROPERTY_CONFIGURABLE : ECMA_PROPERTY_NOT_CONFIGURABLE);
-  }
-  else
-  {
-    JERRY_ASSERT (prop_p->type == ECMA_PROPERTY_NAMEDACCESSOR);
+  JERRY_ASSERT (prop_p->type == ECMA_PROPERTY_NAMEDDATA
+                || prop_p->type == ECMA_PROPERTY_NAMEDACCESSOR);
 
-    prop_p->u.named_accessor_property.configurable = (is_configurable ?
-                                                      ECMA_PROPERTY_CONFIGURABLE : ECMA_PROPERTY_NOT_CONFIGURABLE);
-  }
+  prop_p->configurable = is_configurable ? ECMA_PROPERTY_CONFIGURABLE : ECMA_PROPERTY_NOT_CONFIGURABLE;
 } /* ecma_set_property_configurable_attr */
 
 /**
@@ -1163,14 +1704,7 @@ ecma_is_property_lcached (ecma_property_t *prop_p) /**< property */
   JERRY_ASSERT (prop_p->type == ECMA_PROPERTY_NAMEDDATA
                 || prop_p->type == ECMA_PROPERTY_NAMEDACCESSOR);
 
-  if (prop_p->type == ECMA_PROPERTY_NAMEDDATA)
-  {
-    return prop_p->u.named_data_property.is_lcached;
-  }
-  else
-  {
-    return prop_p->u.named_accessor_property.is_lcached;
-  }
+  return prop_p->is_lcached;
 } /* ecma_is_property_lcached */
 
 /**
@@ -1183,16 +1717,59 @@ ecma_set_property_lcached (ecma_property_t *prop_p, /**< property */
   JERRY_ASSERT (prop_p->type == ECMA_PROPERTY_NAMEDDATA
                 || prop_p->type == ECMA_PROPERTY_NAMEDACCESSOR);
 
-  if (prop_p->type == ECMA_PROPERTY_NAMEDDATA)
-  {
-    prop_p->u.named_data_property.is_lcached = (is_lcached != 0);
-  }
-  else
-  {
-    prop_p->u.named_accessor_property.is_lcached = (is_lcached != 0);
-  }
+  prop_p->is_lcached = (is_lcached != 0);
 } /* ecma_set_property_lcached */
 
+/**
+ * Check whether the property may be registered in inline caches of the interpreter
+ *
+ * @return true / false
+ */
+bool
+ecma_is_property_inline_cached (ecma_property_t *prop_p) /**< named data property */
+{
+  JERRY_ASSERT (prop_p->type == ECMA_PROPERTY_NAMEDDATA);
+
+  return prop_p->is_inline_cached;
+} /* ecma_is_property_inline_cached */
+
+/**
+ * Set value of flag indicating whether the property may be registered in inline caches of the interpreter
+ */
+void
+ecma_set_property_inline_cached (ecma_property_t *prop_p, /**< named data property */
+                                 bool is_inline_cached) /**< may be contained (true) or not (false) */
+{
+  JERRY_ASSERT (prop_p->type == ECMA_PROPERTY_NAMEDDATA);
+
+  prop_p->is_inline_cached = (is_inline_cached != 0);
+} /* ecma_set_property_inline_cached */
+
+/**
+ * Check whether the property may be registered in cache of global variables
+ *
+ * @return true / false
+ */
+bool
+ecma_is_property_global_cached (ecma_property_t *prop_p) /**< named data property */
+{
+  JERRY_ASSERT (prop_p->type == ECMA_PROPERTY_NAMEDDATA);
+
+  return prop_p->is_global_cached;
+} /* ecma_is_property_global_cached */
+
+/**
+ * Set value of flag indicating whether the property may be registered in cache of global variables
+ */
+void
+ecma_set_property_global_cached (ecma_property_t *prop_p, /**< named data property */
+                                 bool is_global_cached) /**< may be contained (true) or not (false) */
+{
+  JERRY_ASSERT (prop_p->type == ECMA_PROPERTY_NAMEDDATA);
+
+  prop_p->is_global_cached = (is_global_cached != 0);
+} /* ecma_set_property_global_cached */
+
 /**
  * Construct empty property descriptor, i.e.:
  *  property descriptor with all is_defined flags set to false and the rest - to default value.
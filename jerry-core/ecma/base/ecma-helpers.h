@@ -60,6 +60,7 @@ extern bool ecma_is_value_boolean (ecma_value_t value);
 extern bool ecma_is_value_true (ecma_value_t value);
 
 extern bool ecma_is_value_number (ecma_value_t value);
+extern bool ecma_is_value_integer_number (ecma_value_t value);
 extern bool ecma_is_value_string (ecma_value_t value);
 extern bool ecma_is_value_object (ecma_value_t value);
 
@@ -67,12 +68,16 @@ extern void ecma_check_value_type_is_spec_defined (ecma_value_t value);
 
 extern ecma_value_t ecma_make_simple_value (const ecma_simple_value_t value);
 extern ecma_value_t ecma_make_number_value (const ecma_number_t* num_p);
+extern ecma_value_t ecma_make_integer_value (ecma_integer_value_t integer_value);
+extern bool ecma_number_is_integer_value (ecma_number_t num, ecma_integer_value_t *out_integer_p);
 extern ecma_value_t ecma_make_string_value (const ecma_string_t* ecma_string_p);
 extern ecma_value_t ecma_make_object_value (const ecma_object_t* object_p);
-extern ecma_number_t* __attr_pure___ ecma_get_number_from_value (ecma_value_t value);
+extern ecma_integer_value_t __attr_const___ ecma_get_integer_from_value (ecma_value_t value);
+extern ecma_number_t __attr_pure___ ecma_get_number_from_value (ecma_value_t value);
 extern ecma_string_t* __attr_pure___ ecma_get_string_from_value (ecma_value_t value);
 extern ecma_object_t* __attr_pure___ ecma_get_object_from_value (ecma_value_t value);
 extern ecma_value_t ecma_copy_value (ecma_value_t value, bool do_ref_if_object);
+extern ecma_value_t ecma_update_number_value (ecma_value_t dst_value, ecma_value_t num_value);
 extern void ecma_free_value (ecma_value_t value, bool do_deref_if_object);
 
 extern ecma_completion_value_t ecma_make_completion_value (ecma_completion_type_t type,
@@ -86,7 +91,7 @@ extern ecma_completion_value_t ecma_make_return_completion_value (ecma_value_t v
 extern ecma_completion_value_t ecma_make_meta_completion_value (void);
 extern ecma_completion_value_t ecma_make_jump_completion_value (opcode_counter_t target);
 extern ecma_value_t ecma_get_completion_value_value (ecma_completion_value_t completion_value);
-extern ecma_number_t* __attr_const___
+extern ecma_number_t __attr_const___
 ecma_get_number_from_completion_value (ecma_completion_value_t completion_value);
 extern ecma_string_t* __attr_const___
 ecma_get_string_from_completion_value (ecma_completion_value_t completion_value);
@@ -125,6 +130,7 @@ extern ecma_string_t* ecma_copy_or_ref_ecma_string (ecma_string_t *string_desc_p
 extern void ecma_deref_ecma_string (ecma_string_t *string_p);
 extern void ecma_check_that_ecma_string_need_not_be_freed (const ecma_string_t *string_p);
 extern ecma_number_t ecma_string_to_number (const ecma_string_t *str_p);
+extern bool ecma_string_get_array_index (const ecma_string_t *str_p, uint32_t *out_index_p);
 extern ssize_t ecma_string_to_utf8_string (const ecma_string_t *string_desc_p,
                                            lit_utf8_byte_t *buffer_p,
                                            ssize_t buffer_size);
@@ -221,6 +227,9 @@ extern ecma_object_t* ecma_create_decl_lex_env (ecma_object_t *outer_lexical_env
 extern ecma_object_t* ecma_create_object_lex_env (ecma_object_t *outer_lexical_environment_p,
                                                   ecma_object_t *binding_obj_p,
                                                   bool provide_this);
+extern ecma_object_t* ecma_create_decl_slots_lex_env (ecma_object_t *outer_lexical_environment_p,
+                                                      ecma_object_t *func_obj_p,
+                                                      ecma_lex_env_slot_names_t *slot_names_p);
 extern bool __attr_pure___ ecma_is_lexical_environment (const ecma_object_t *object_p);
 extern bool __attr_pure___ ecma_get_object_extensible (const ecma_object_t *object_p);
 extern void ecma_set_object_extensible (ecma_object_t *object_p, bool is_extensible);
@@ -230,11 +239,23 @@ extern ecma_object_t* __attr_pure___ ecma_get_object_prototype (const ecma_objec
 extern bool __attr_pure___ ecma_get_object_is_builtin (const ecma_object_t *object_p);
 extern void ecma_set_object_is_builtin (ecma_object_t *object_p,
                                         bool is_builtin);
+extern bool __attr_pure___ ecma_get_object_is_shaped (const ecma_object_t *object_p);
+extern void ecma_set_object_is_shaped (ecma_object_t *object_p, bool is_shaped);
+extern ecma_shaped_values_t* __attr_pure___ ecma_get_object_shaped_values (const ecma_object_t *object_p);
+extern void ecma_set_object_shaped_values (ecma_object_t *object_p, ecma_shaped_values_t *shaped_values_p);
+extern ecma_fast_array_elements_t* __attr_pure___ ecma_get_object_fast_elements (const ecma_object_t *object_p);
+extern void ecma_set_object_fast_elements (ecma_object_t *object_p, ecma_fast_array_elements_t *elements_p);
 extern ecma_lexical_environment_type_t __attr_pure___ ecma_get_lex_env_type (const ecma_object_t *object_p);
 extern ecma_object_t* __attr_pure___ ecma_get_lex_env_outer_reference (const ecma_object_t *object_p);
 extern ecma_property_t* __attr_pure___ ecma_get_property_list (const ecma_object_t *object_p);
 extern ecma_object_t* __attr_pure___ ecma_get_lex_env_binding_object (const ecma_object_t *object_p);
 extern bool __attr_pure___ ecma_get_lex_env_provide_this (const ecma_object_t *object_p);
+extern ecma_lex_env_slots_t* __attr_pure___ ecma_get_lex_env_slots (const ecma_object_t *object_p);
+extern ecma_length_t ecma_find_lex_env_slot (const ecma_object_t *lex_env_p, ecma_string_t *name_p);
+extern ecma_string_t* ecma_get_lex_env_slot_name (const ecma_object_t *lex_env_p, ecma_length_t slot);
+extern ecma_value_t ecma_get_lex_env_slot_value (const ecma_object_t *lex_env_p, ecma_length_t slot);
+extern void ecma_assign_lex_env_slot_value (ecma_object_t *lex_env_p, ecma_length_t slot, ecma_value_t value);
+extern void ecma_free_lex_env_slots (ecma_object_t *lex_env_p);
 
 extern ecma_property_t* ecma_create_internal_property (ecma_object_t *object_p,
                                                        ecma_internal_property_id_t property_id);
@@ -266,7 +287,7 @@ extern void ecma_free_property (ecma_object_t *obj_p, ecma_property_t *prop_p);
 extern void ecma_delete_property (ecma_object_t *obj_p, ecma_property_t *prop_p);
 
 extern ecma_value_t ecma_get_named_data_property_value (const ecma_property_t *prop_p);
-extern void ecma_set_named_data_property_value (ecma_property_t *prop_p, ecma_value_t value);
+extern void ecma_set_named_data_property_value (ecma_object_t *obj_p, ecma_property_t *prop_p, ecma_value_t value);
 extern void ecma_named_data_property_assign_value (ecma_object_t *obj_p,
                                                    ecma_property_t *prop_p,
                                                    ecma_value_t value);
@@ -289,6 +310,12 @@ extern void ecma_set_property_configurable_attr (ecma_property_t* prop_p, bool i
 extern bool ecma_is_property_lcached (ecma_property_t *prop_p);
 extern void ecma_set_property_lcached (ecma_property_t *prop_p,
                                        bool is_lcached);
+extern bool ecma_is_property_inline_cached (ecma_property_t *prop_p);
+extern void ecma_set_property_inline_cached (ecma_property_t *prop_p,
+                                             bool is_inline_cached);
+extern bool ecma_is_property_global_cached (ecma_property_t *prop_p);
+extern void ecma_set_property_global_cached (ecma_property_t *prop_p,
+                                             bool is_global_cached);
 
 extern ecma_property_descriptor_t ecma_make_empty_property_descriptor (void);
 extern void ecma_free_property_descriptor (ecma_property_descriptor_t *prop_desc_p);
@@ -14,11 +14,13 @@
  */
 
 #include "ecma-builtins.h"
+#include "ecma-fast-array.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
 #include "ecma-init-finalize.h"
 #include "ecma-lcache.h"
 #include "ecma-lex-env.h"
+#include "ecma-shapes.h"
 #include "ecma-stack.h"
 #include "mem-allocator.h"
 
@@ -33,8 +35,13 @@
  * Initialize ECMA components
  */
 void
-ecma_init (void)
+ecma_init (bool is_incremental_gc, /**< perform incremental garbage collection steps upon allocations */
+           bool is_proactive_gc, /**< trigger garbage collection upon growth of heap usage */
+           bool is_generational_gc) /**< allocate objects into the nursery and perform minor collections */
 {
+  ecma_gc_init (is_incremental_gc, is_proactive_gc, is_generational_gc);
+  ecma_shapes_init ();
+  ecma_fast_arrays_init ();
   ecma_init_builtins ();
   ecma_lcache_init ();
   ecma_stack_init ();
@@ -56,6 +63,7 @@ ecma_finalize (void)
   ecma_finalize_builtins ();
   ecma_lcache_invalidate_all ();
   ecma_gc_run ();
+  ecma_shapes_finalize ();
 } /* ecma_finalize */
 
 /**
@@ -25,7 +25,7 @@
  * @{
  */
 
-extern void ecma_init (void);
+extern void ecma_init (bool is_incremental_gc, bool is_proactive_gc, bool is_generational_gc);
 extern void ecma_finalize (void);
 
 /**
@@ -18,6 +18,8 @@
 #include "ecma-helpers.h"
 #include "ecma-lcache.h"
 #include "jrt-libc-includes.h"
+#include "vm-global-cache.h"
+#include "vm-inline-cache.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -41,16 +43,19 @@ typedef struct
   /** Compressed pointer to a property of the object */
   mem_cpointer_t prop_cp;
 
-  /** Padding structure to 8 bytes size */
-  uint16_t padding;
+  /** Padding structure to size of four compressed pointers */
+  mem_cpointer_t padding;
 } ecma_lcache_hash_entry_t;
 
-JERRY_STATIC_ASSERT (sizeof (ecma_lcache_hash_entry_t) == sizeof (uint64_t));
+JERRY_STATIC_ASSERT (sizeof (ecma_lcache_hash_entry_t) == 4 * sizeof (mem_cpointer_t));
 
 /**
- * LCache hash value length, in bits
+ * Number of low bits of property name's hash that are used as LCache's row index
+ *
+ * Note:
+ *      8 bits, the LCache table is kept at 256 rows (string hashes are wider, see also: LIT_STRING_HASH_BITS)
  */
-#define ECMA_LCACHE_HASH_BITS (sizeof (lit_string_hash_t) * JERRY_BITSINBYTE)
+#define ECMA_LCACHE_HASH_BITS (8)
 
 /**
  * Number of rows in LCache's hash table
@@ -66,6 +71,23 @@ JERRY_STATIC_ASSERT (sizeof (ecma_lcache_hash_entry_t) == sizeof (uint64_t));
  * LCache's hash table
  */
 static ecma_lcache_hash_entry_t ecma_lcache_hash_table[ ECMA_LCACHE_HASH_ROWS_COUNT ][ ECMA_LCACHE_HASH_ROW_LENGTH ];
+
+/**
+ * Get index of LCache's row for the property name
+ *
+ * Note:
+ *      the index depends only on the name, so entries for same name in different objects evict each other;
+ *      this bounds the number of objects that are referenced from LCache by number of distinct names in use.
+ *
+ * @return row index
+ */
+static inline uint32_t __attr_always_inline___
+ecma_lcache_row_index (lit_string_hash_t name_hash) /**< hash of the property's name */
+{
+  JERRY_STATIC_ASSERT (ECMA_LCACHE_HASH_BITS <= LIT_STRING_HASH_BITS);
+
+  return (uint32_t) name_hash & (ECMA_LCACHE_HASH_ROWS_COUNT - 1u);
+} /* ecma_lcache_row_index */
 #endif /* !CONFIG_ECMA_LCACHE_DISABLE */
 
 /**
@@ -106,10 +128,25 @@ ecma_lcache_invalidate_entry (ecma_lcache_hash_entry_t *entry_p) /**< entry to i
 #endif /* !CONFIG_ECMA_LCACHE_DISABLE */
 
 /**
- * Invalidate all entries in LCache
+ * Invalidate all entries in LCache, and in inline caches and global variables' cache of the interpreter
  */
 void
 ecma_lcache_invalidate_all (void)
+{
+  vm_inline_cache_invalidate_all ();
+  vm_global_cache_invalidate_all ();
+
+  ecma_lcache_invalidate_entries ();
+} /* ecma_lcache_invalidate_all */
+
+/**
+ * Invalidate all entries in LCache
+ *
+ * Note:
+ *      inline caches and global variables' cache of the interpreter are not affected
+ */
+void
+ecma_lcache_invalidate_entries (void)
 {
 #ifndef CONFIG_ECMA_LCACHE_DISABLE
   for (uint32_t row_index = 0; row_index < ECMA_LCACHE_HASH_ROWS_COUNT; row_index++)
@@ -123,7 +160,7 @@ ecma_lcache_invalidate_all (void)
     }
   }
 #endif /* !CONFIG_ECMA_LCACHE_DISABLE */
-} /* ecma_lcache_invalidate_all */
+} /* ecma_lcache_invalidate_entries */
 
 #ifndef CONFIG_ECMA_LCACHE_DISABLE
 /**
@@ -164,7 +201,7 @@ ecma_lcache_insert (ecma_object_t *object_p, /**< object */
 #ifndef CONFIG_ECMA_LCACHE_DISABLE
   prop_name_p = ecma_copy_or_ref_ecma_string (prop_name_p);
 
-  lit_string_hash_t hash_key = ecma_string_hash (prop_name_p);
+  uint32_t hash_key = ecma_lcache_row_index (ecma_string_hash (prop_name_p));
 
   if (prop_p != NULL)
   {
@@ -243,11 +280,13 @@ ecma_lcache_lookup (ecma_object_t *object_p, /**< object */
                                                  *         then the output parameter is not set */
 {
 #ifndef CONFIG_ECMA_LCACHE_DISABLE
-  lit_string_hash_t hash_key = ecma_string_hash (prop_name_p);
+  const lit_string_hash_t name_hash = ecma_string_hash (prop_name_p);
 
   unsigned int object_cp;
   ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
 
+  uint32_t hash_key = ecma_lcache_row_index (name_hash);
+
   for (uint32_t i = 0; i < ECMA_LCACHE_HASH_ROW_LENGTH; i++)
   {
     if (ecma_lcache_hash_table[hash_key][i].object_cp == object_cp)
@@ -255,7 +294,8 @@ ecma_lcache_lookup (ecma_object_t *object_p, /**< object */
       ecma_string_t *entry_prop_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t,
                                                                     ecma_lcache_hash_table[hash_key][i].prop_name_cp);
 
-      if (ecma_compare_ecma_strings_equal_hashes (prop_name_p, entry_prop_name_p))
+      if (ecma_string_hash (entry_prop_name_p) == name_hash
+          && ecma_compare_ecma_strings_equal_hashes (prop_name_p, entry_prop_name_p))
       {
         ecma_property_t *prop_p = ECMA_GET_POINTER (ecma_property_t, ecma_lcache_hash_table[hash_key][i].prop_cp);
         JERRY_ASSERT (prop_p == NULL || ecma_is_property_lcached (prop_p));
@@ -333,7 +373,7 @@ ecma_lcache_invalidate (ecma_object_t *object_p, /**< object */
   ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
   ECMA_SET_POINTER (prop_cp, prop_p);
 
-  lit_string_hash_t hash_key = ecma_string_hash (prop_name_p);
+  uint32_t hash_key = ecma_lcache_row_index (ecma_string_hash (prop_name_p));
 
   /* Property's name has was computed.
    * Given (object, property name) pair should be in the row corresponding to computed hash.
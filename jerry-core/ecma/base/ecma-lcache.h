@@ -25,6 +25,7 @@
 
 extern void ecma_lcache_init (void);
 extern void ecma_lcache_invalidate_all (void);
+extern void ecma_lcache_invalidate_entries (void);
 extern void ecma_lcache_insert (ecma_object_t *object_p, ecma_string_t *prop_name_p, ecma_property_t *prop_p);
 extern bool ecma_lcache_lookup (ecma_object_t *object_p, const ecma_string_t *prop_name_p, ecma_property_t **prop_p_p);
 extern void ecma_lcache_invalidate (ecma_object_t *object_p, ecma_string_t *prop_name_arg_p, ecma_property_t *prop_p);
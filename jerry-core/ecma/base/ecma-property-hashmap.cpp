@@ -0,0 +1,405 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-property-hashmap.h"
+#include "jrt-libc-includes.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmapropertyhashmap Property hashmap
+ * @{
+ *
+ * Upon getting CONFIG_ECMA_PROPERTY_HASHMAP_MIN_PROPERTIES named properties, an object (or a declarative lexical
+ * environment) gets hashed index of the properties, held by ECMA_INTERNAL_PROPERTY_HASHMAP internal property,
+ * that is kept at start of the property list, so lookups (see also: ecma_find_named_property) don't walk the list.
+ *
+ * The index is an open-addressed table with linear probing, in which the properties are placed according
+ * to hashes of their names; the property list itself is not changed, so order of enumeration is kept,
+ * and LCache continues to cache results of the lookups.
+ */
+
+#ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
+/**
+ * Minimum number of entries in a hashmap's table
+ */
+#define ECMA_PROPERTY_HASHMAP_MIN_CAPACITY (32u)
+
+/**
+ * Get name of named data or named accessor property
+ *
+ * @return pointer to the name
+ */
+static ecma_string_t*
+ecma_property_hashmap_get_name (const ecma_property_t *property_p) /**< named property */
+{
+  if (property_p->type == ECMA_PROPERTY_NAMEDDATA)
+  {
+    return ECMA_GET_NON_NULL_POINTER (ecma_string_t, property_p->u.named_data_property.name_p);
+  }
+  else
+  {
+    JERRY_ASSERT (property_p->type == ECMA_PROPERTY_NAMEDACCESSOR);
+
+    return ECMA_GET_NON_NULL_POINTER (ecma_string_t, property_p->u.named_accessor_property.name_p);
+  }
+} /* ecma_property_hashmap_get_name */
+
+/**
+ * Get index of the entry, probing for a name with the specified hash starts from
+ *
+ * Note:
+ *      the hash is scaled to the table's size, so entries are selected by all bits of the hash
+ *
+ * @return entry index
+ */
+static uint32_t
+ecma_property_hashmap_get_start_index (lit_string_hash_t hash, /**< hash of the name */
+                                       uint32_t capacity) /**< number of entries in the table */
+{
+  return (uint32_t) (((uint64_t) hash * capacity) >> LIT_STRING_HASH_BITS);
+} /* ecma_property_hashmap_get_start_index */
+
+/**
+ * Get size of hashmap with specified number of entries
+ *
+ * @return size in bytes
+ */
+static size_t
+ecma_property_hashmap_get_size (uint32_t capacity) /**< number of entries in the table */
+{
+  return sizeof (ecma_property_hashmap_t) + capacity * sizeof (mem_cpointer_t);
+} /* ecma_property_hashmap_get_size */
+
+/**
+ * Allocate empty hashmap
+ *
+ * @return pointer to the hashmap
+ */
+static ecma_property_hashmap_t*
+ecma_property_hashmap_alloc (uint32_t capacity) /**< number of entries in the table (power of two) */
+{
+  JERRY_ASSERT (capacity >= ECMA_PROPERTY_HASHMAP_MIN_CAPACITY
+                && (capacity & (capacity - 1)) == 0);
+
+  ecma_property_hashmap_t *hashmap_p;
+  hashmap_p = (ecma_property_hashmap_t *) ecma_alloc_buffer (ecma_property_hashmap_get_size (capacity));
+
+  hashmap_p->capacity = capacity;
+  hashmap_p->count = 0;
+
+  mem_cpointer_t *table_p = ECMA_PROPERTY_HASHMAP_GET_TABLE (hashmap_p);
+
+  for (uint32_t i = 0; i < capacity; i++)
+  {
+    table_p[i] = ECMA_NULL_POINTER;
+  }
+
+  return hashmap_p;
+} /* ecma_property_hashmap_alloc */
+
+/**
+ * Put the property to the hashmap's table
+ *
+ * Note:
+ *      the table should have free entries
+ */
+static void
+ecma_property_hashmap_add (ecma_property_hashmap_t *hashmap_p, /**< hashmap */
+                           ecma_property_t *property_p) /**< named property */
+{
+  JERRY_ASSERT (hashmap_p->count < hashmap_p->capacity);
+
+  const uint32_t mask = hashmap_p->capacity - 1;
+  mem_cpointer_t *table_p = ECMA_PROPERTY_HASHMAP_GET_TABLE (hashmap_p);
+
+  lit_string_hash_t hash = ecma_string_hash (ecma_property_hashmap_get_name (property_p));
+  uint32_t index = ecma_property_hashmap_get_start_index (hash, hashmap_p->capacity);
+
+  while (table_p[index] != ECMA_NULL_POINTER)
+  {
+    index = (index + 1) & mask;
+  }
+
+  ECMA_SET_NON_NULL_POINTER (table_p[index], property_p);
+  hashmap_p->count++;
+} /* ecma_property_hashmap_add */
+
+/**
+ * Create hashmap, indexing all named properties of the object
+ */
+static void
+ecma_property_hashmap_create (ecma_object_t *object_p) /**< object or lexical environment */
+{
+  uint32_t named_props_number = 0;
+
+  for (ecma_property_t *property_p = ecma_get_property_list (object_p);
+       property_p != NULL;
+       property_p = ECMA_GET_POINTER (ecma_property_t, property_p->next_property_p))
+  {
+    if (property_p->type != ECMA_PROPERTY_INTERNAL)
+    {
+      named_props_number++;
+    }
+  }
+
+  uint32_t capacity = ECMA_PROPERTY_HASHMAP_MIN_CAPACITY;
+
+  while (capacity < named_props_number * 2)
+  {
+    capacity *= 2;
+  }
+
+  ecma_property_hashmap_t *hashmap_p = ecma_property_hashmap_alloc (capacity);
+
+  for (ecma_property_t *property_p = ecma_get_property_list (object_p);
+       property_p != NULL;
+       property_p = ECMA_GET_POINTER (ecma_property_t, property_p->next_property_p))
+  {
+    if (property_p->type != ECMA_PROPERTY_INTERNAL)
+    {
+      ecma_property_hashmap_add (hashmap_p, property_p);
+    }
+  }
+
+  /* the object doesn't have a hashmap yet, so the internal property is linked at start of the list */
+  ecma_property_t *hashmap_prop_p = ecma_create_internal_property (object_p, ECMA_INTERNAL_PROPERTY_HASHMAP);
+  ECMA_SET_NON_NULL_POINTER (hashmap_prop_p->u.internal_property.value, hashmap_p);
+
+  JERRY_ASSERT (ecma_property_hashmap_get (object_p) == hashmap_p);
+} /* ecma_property_hashmap_create */
+#endif /* !CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+
+/**
+ * Get hashmap of the object's named properties
+ *
+ * @return pointer to the hashmap - if the object's properties are indexed,
+ *         NULL - otherwise.
+ */
+ecma_property_hashmap_t*
+ecma_property_hashmap_get (const ecma_object_t *object_p) /**< object or lexical environment */
+{
+#ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
+  ecma_property_t *first_property_p = ecma_get_property_list (object_p);
+
+  if (first_property_p != NULL
+      && first_property_p->type == ECMA_PROPERTY_INTERNAL
+      && first_property_p->u.internal_property.type == ECMA_INTERNAL_PROPERTY_HASHMAP)
+  {
+    return ECMA_GET_NON_NULL_POINTER (ecma_property_hashmap_t, first_property_p->u.internal_property.value);
+  }
+#else /* CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+  (void) object_p;
+#endif /* CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+
+  return NULL;
+} /* ecma_property_hashmap_get */
+
+/**
+ * Find named property with specified name in the hashmap
+ *
+ * @return pointer to the property - if it is found,
+ *         NULL - otherwise.
+ */
+ecma_property_t*
+ecma_property_hashmap_find (ecma_property_hashmap_t *hashmap_p, /**< hashmap */
+                            ecma_string_t *name_p) /**< property name */
+{
+#ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
+  const uint32_t mask = hashmap_p->capacity - 1;
+  mem_cpointer_t *table_p = ECMA_PROPERTY_HASHMAP_GET_TABLE (hashmap_p);
+
+  uint32_t index = ecma_property_hashmap_get_start_index (ecma_string_hash (name_p), hashmap_p->capacity);
+
+  while (table_p[index] != ECMA_NULL_POINTER)
+  {
+    ecma_property_t *property_p = ECMA_GET_NON_NULL_POINTER (ecma_property_t, table_p[index]);
+
+    if (ecma_compare_ecma_strings (name_p, ecma_property_hashmap_get_name (property_p)))
+    {
+      return property_p;
+    }
+
+    index = (index + 1) & mask;
+  }
+#else /* CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+  (void) hashmap_p;
+  (void) name_p;
+
+  JERRY_UNREACHABLE ();
+#endif /* CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+
+  return NULL;
+} /* ecma_property_hashmap_find */
+
+/**
+ * Register newly created named property in the object's hashmap, creating the hashmap,
+ * if the object got enough properties to be indexed
+ */
+void
+ecma_property_hashmap_insert (ecma_object_t *object_p, /**< object or lexical environment */
+                              ecma_property_t *property_p) /**< named property, linked to the object's list */
+{
+#ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
+  JERRY_ASSERT (property_p->type != ECMA_PROPERTY_INTERNAL);
+
+  ecma_property_hashmap_t *hashmap_p = ecma_property_hashmap_get (object_p);
+
+  if (hashmap_p == NULL)
+  {
+    uint32_t named_props_number = 0;
+
+    for (ecma_property_t *iter_p = ecma_get_property_list (object_p);
+         iter_p != NULL && named_props_number < CONFIG_ECMA_PROPERTY_HASHMAP_MIN_PROPERTIES;
+         iter_p = ECMA_GET_POINTER (ecma_property_t, iter_p->next_property_p))
+    {
+      if (iter_p->type != ECMA_PROPERTY_INTERNAL)
+      {
+        named_props_number++;
+      }
+    }
+
+    if (named_props_number == CONFIG_ECMA_PROPERTY_HASHMAP_MIN_PROPERTIES)
+    {
+      ecma_property_hashmap_create (object_p);
+    }
+
+    return;
+  }
+
+  /* the table is kept at most three quarters full */
+  if ((hashmap_p->count + 1) * 4 > hashmap_p->capacity * 3)
+  {
+    ecma_property_hashmap_t *new_hashmap_p = ecma_property_hashmap_alloc (hashmap_p->capacity * 2);
+
+    mem_cpointer_t *table_p = ECMA_PROPERTY_HASHMAP_GET_TABLE (hashmap_p);
+
+    for (uint32_t i = 0; i < hashmap_p->capacity; i++)
+    {
+      if (table_p[i] != ECMA_NULL_POINTER)
+      {
+        ecma_property_hashmap_add (new_hashmap_p, ECMA_GET_NON_NULL_POINTER (ecma_property_t, table_p[i]));
+      }
+    }
+
+    ecma_property_t *hashmap_prop_p = ecma_get_property_list (object_p);
+    ECMA_SET_NON_NULL_POINTER (hashmap_prop_p->u.internal_property.value, new_hashmap_p);
+
+    ecma_property_hashmap_free (hashmap_p);
+
+    hashmap_p = new_hashmap_p;
+  }
+
+  ecma_property_hashmap_add (hashmap_p, property_p);
+#else /* CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+  (void) object_p;
+  (void) property_p;
+#endif /* CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+} /* ecma_property_hashmap_insert */
+
+/**
+ * Remove named property, that is being deleted, from the object's hashmap (if the object has one)
+ */
+void
+ecma_property_hashmap_delete (ecma_object_t *object_p, /**< object or lexical environment */
+                              ecma_property_t *property_p) /**< named property */
+{
+#ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
+  JERRY_ASSERT (property_p->type != ECMA_PROPERTY_INTERNAL);
+
+  ecma_property_hashmap_t *hashmap_p = ecma_property_hashmap_get (object_p);
+
+  if (hashmap_p == NULL)
+  {
+    return;
+  }
+
+  const uint32_t capacity = hashmap_p->capacity;
+  const uint32_t mask = capacity - 1;
+  mem_cpointer_t *table_p = ECMA_PROPERTY_HASHMAP_GET_TABLE (hashmap_p);
+
+  mem_cpointer_t property_cp;
+  ECMA_SET_NON_NULL_POINTER (property_cp, property_p);
+
+  lit_string_hash_t hash = ecma_string_hash (ecma_property_hashmap_get_name (property_p));
+  uint32_t index = ecma_property_hashmap_get_start_index (hash, capacity);
+
+  while (table_p[index] != property_cp)
+  {
+    JERRY_ASSERT (table_p[index] != ECMA_NULL_POINTER);
+
+    index = (index + 1) & mask;
+  }
+
+  /*
+   * Entries following the freed one are shifted back, if their probing starts at or before the freed entry,
+   * so that probing sequences are not broken, and no deleted entry markers are needed.
+   */
+  for (uint32_t next_index = (index + 1) & mask;
+       table_p[next_index] != ECMA_NULL_POINTER;
+       next_index = (next_index + 1) & mask)
+  {
+    ecma_property_t *next_property_p = ECMA_GET_NON_NULL_POINTER (ecma_property_t, table_p[next_index]);
+    lit_string_hash_t next_hash = ecma_string_hash (ecma_property_hashmap_get_name (next_property_p));
+    uint32_t start_index = ecma_property_hashmap_get_start_index (next_hash, capacity);
+
+    bool is_start_between;
+
+    if (index <= next_index)
+    {
+      is_start_between = (index < start_index && start_index <= next_index);
+    }
+    else
+    {
+      is_start_between = (index < start_index || start_index <= next_index);
+    }
+
+    if (!is_start_between)
+    {
+      table_p[index] = table_p[next_index];
+      index = next_index;
+    }
+  }
+
+  table_p[index] = ECMA_NULL_POINTER;
+  hashmap_p->count--;
+#else /* CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+  (void) object_p;
+  (void) property_p;
+#endif /* CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+} /* ecma_property_hashmap_delete */
+
+/**
+ * Free the hashmap (upon freeing ECMA_INTERNAL_PROPERTY_HASHMAP internal property)
+ */
+void
+ecma_property_hashmap_free (ecma_property_hashmap_t *hashmap_p) /**< hashmap */
+{
+#ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
+  ecma_dealloc_buffer (hashmap_p, ecma_property_hashmap_get_size (hashmap_p->capacity));
+#else /* CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+  (void) hashmap_p;
+
+  JERRY_UNREACHABLE ();
+#endif /* CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+} /* ecma_property_hashmap_free */
+
+/**
+ * @}
+ * @}
+ */
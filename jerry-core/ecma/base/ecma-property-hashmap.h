@@ -0,0 +1,39 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_PROPERTY_HASHMAP_H
+#define ECMA_PROPERTY_HASHMAP_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmapropertyhashmap Property hashmap
+ * @{
+ */
+
+extern ecma_property_hashmap_t *ecma_property_hashmap_get (const ecma_object_t *object_p);
+extern ecma_property_t *ecma_property_hashmap_find (ecma_property_hashmap_t *hashmap_p, ecma_string_t *name_p);
+extern void ecma_property_hashmap_insert (ecma_object_t *object_p, ecma_property_t *property_p);
+extern void ecma_property_hashmap_delete (ecma_object_t *object_p, ecma_property_t *property_p);
+extern void ecma_property_hashmap_free (ecma_property_hashmap_t *hashmap_p);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* ECMA_PROPERTY_HASHMAP_H */
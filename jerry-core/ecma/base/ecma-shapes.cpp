@@ -0,0 +1,570 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-shapes.h"
+#include "jrt-libc-includes.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmashapes Shapes of objects
+ * @{
+ *
+ * Ordinary objects (see also: ecma_op_create_object_object_noarg_and_set_prototype, ecma_op_function_construct)
+ * are created in shaped form: their named data properties with default attributes are stored in array of slots
+ * (ecma_shaped_values_t), and names of the properties are described by the object's shape (ecma_shape_t),
+ * that is shared with other objects, which got same properties in same order.
+ *
+ * Upon any other operation, that requires a property descriptor (ecma_property_t) of one of the object's
+ * own properties, or adds a property with other attributes, or an internal property, the object is converted
+ * to property list form (see also: ecma_shaped_object_convert_to_property_list). Built-in objects, which
+ * instantiate their properties lazily (see also: ecma_builtin_try_to_instantiate_property), always use
+ * property lists.
+ */
+
+/**
+ * Root shape, describing empty set of properties
+ */
+static ecma_shape_t *ecma_shapes_root_p = NULL;
+
+/**
+ * Initialize the shapes' tree
+ */
+void
+ecma_shapes_init (void)
+{
+  JERRY_ASSERT (ecma_shapes_root_p == NULL);
+
+  ecma_shapes_root_p = (ecma_shape_t *) ecma_alloc_buffer (sizeof (ecma_shape_t));
+
+  /* the root shape is referenced by the shapes' tree itself, and so is never freed before finalization */
+  ecma_shapes_root_p->refs = 1;
+  ecma_shapes_root_p->parent_cp = ECMA_NULL_POINTER;
+  ecma_shapes_root_p->name_cp = ECMA_NULL_POINTER;
+  ecma_shapes_root_p->first_child_cp = ECMA_NULL_POINTER;
+  ecma_shapes_root_p->next_sibling_cp = ECMA_NULL_POINTER;
+  ecma_shapes_root_p->props_number = 0;
+} /* ecma_shapes_init */
+
+/**
+ * Finalize the shapes' tree
+ *
+ * Note:
+ *      all objects and inline caches should already be freed, so that the root shape has no descendants
+ */
+void
+ecma_shapes_finalize (void)
+{
+  JERRY_ASSERT (ecma_shapes_root_p != NULL);
+  JERRY_ASSERT (ecma_shapes_root_p->refs == 1
+                && ecma_shapes_root_p->first_child_cp == ECMA_NULL_POINTER);
+
+  ecma_dealloc_buffer (ecma_shapes_root_p, sizeof (ecma_shape_t));
+
+  ecma_shapes_root_p = NULL;
+} /* ecma_shapes_finalize */
+
+/**
+ * Increase reference counter of a shape
+ */
+void
+ecma_ref_shape (ecma_shape_t *shape_p) /**< shape */
+{
+  JERRY_ASSERT (shape_p->refs < UINT32_MAX);
+
+  shape_p->refs++;
+} /* ecma_ref_shape */
+
+/**
+ * Decrease reference counter of a shape, and free the shape, if it is not referenced anymore
+ *
+ * Note:
+ *      freed shape releases its reference to the parent shape
+ */
+void
+ecma_deref_shape (ecma_shape_t *shape_p) /**< shape */
+{
+  while (true)
+  {
+    JERRY_ASSERT (shape_p->refs > 0);
+
+    if (--shape_p->refs != 0)
+    {
+      return;
+    }
+
+    /* child shapes reference their parents, and the root shape is never freed */
+    JERRY_ASSERT (shape_p->first_child_cp == ECMA_NULL_POINTER);
+    JERRY_ASSERT (shape_p->parent_cp != ECMA_NULL_POINTER);
+
+    ecma_shape_t *parent_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shape_p->parent_cp);
+
+    mem_cpointer_t shape_cp;
+    ECMA_SET_NON_NULL_POINTER (shape_cp, shape_p);
+
+    if (parent_p->first_child_cp == shape_cp)
+    {
+      parent_p->first_child_cp = shape_p->next_sibling_cp;
+    }
+    else
+    {
+      ecma_shape_t *sibling_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, parent_p->first_child_cp);
+
+      while (sibling_p->next_sibling_cp != shape_cp)
+      {
+        sibling_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, sibling_p->next_sibling_cp);
+      }
+
+      sibling_p->next_sibling_cp = shape_p->next_sibling_cp;
+    }
+
+    ecma_deref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, shape_p->name_cp));
+
+    ecma_dealloc_buffer (shape_p, sizeof (ecma_shape_t));
+
+    shape_p = parent_p;
+  }
+} /* ecma_deref_shape */
+
+/**
+ * Find the property with specified name among the properties, described by the shape
+ *
+ * @return pointer to the shape (the specified one, or one of its ancestors), that added the property,
+ *         NULL - if the shape doesn't describe a property with the name.
+ */
+ecma_shape_t*
+ecma_shape_find_property (ecma_shape_t *shape_p, /**< shape */
+                          ecma_string_t *name_p) /**< property name */
+{
+  while (shape_p->parent_cp != ECMA_NULL_POINTER)
+  {
+    if (ecma_compare_ecma_strings (name_p, ECMA_GET_NON_NULL_POINTER (ecma_string_t, shape_p->name_cp)))
+    {
+      return shape_p;
+    }
+
+    shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shape_p->parent_cp);
+  }
+
+  return NULL;
+} /* ecma_shape_find_property */
+
+/**
+ * Get index of slot, storing value of the property, that was added by the shape
+ *
+ * @return slot index
+ */
+ecma_length_t
+ecma_shape_get_slot (const ecma_shape_t *shape_p) /**< non-root shape */
+{
+  JERRY_ASSERT (shape_p->props_number > 0);
+
+  return (ecma_length_t) (shape_p->props_number - 1u);
+} /* ecma_shape_get_slot */
+
+/**
+ * Get shape, transitioned from the specified one by adding a property with specified name,
+ * creating the shape if there is no such transition yet
+ *
+ * @return pointer to the shape (referenced, should be dereferenced with ecma_deref_shape)
+ */
+static ecma_shape_t*
+ecma_shape_get_transition (ecma_shape_t *shape_p, /**< shape */
+                           ecma_string_t *name_p) /**< name of the property to add */
+{
+  JERRY_ASSERT (ecma_shape_find_property (shape_p, name_p) == NULL);
+
+  for (ecma_shape_t *child_p = ECMA_GET_POINTER (ecma_shape_t, shape_p->first_child_cp);
+       child_p != NULL;
+       child_p = ECMA_GET_POINTER (ecma_shape_t, child_p->next_sibling_cp))
+  {
+    if (ecma_compare_ecma_strings (name_p, ECMA_GET_NON_NULL_POINTER (ecma_string_t, child_p->name_cp)))
+    {
+      ecma_ref_shape (child_p);
+
+      return child_p;
+    }
+  }
+
+  name_p = ecma_copy_or_ref_ecma_string (name_p);
+
+  ecma_shape_t *new_shape_p = (ecma_shape_t *) ecma_alloc_buffer (sizeof (ecma_shape_t));
+
+  new_shape_p->refs = 1;
+  ECMA_SET_NON_NULL_POINTER (new_shape_p->parent_cp, shape_p);
+  ECMA_SET_NON_NULL_POINTER (new_shape_p->name_cp, name_p);
+  new_shape_p->first_child_cp = ECMA_NULL_POINTER;
+  new_shape_p->next_sibling_cp = shape_p->first_child_cp;
+  new_shape_p->props_number = (uint16_t) (shape_p->props_number + 1u);
+
+  ECMA_SET_NON_NULL_POINTER (shape_p->first_child_cp, new_shape_p);
+  ecma_ref_shape (shape_p);
+
+  return new_shape_p;
+} /* ecma_shape_get_transition */
+
+/**
+ * Get number of slots to allocate for the specified number of properties
+ *
+ * The number is chosen so that the array of slots fills the allocated chunk (see also: ecma_alloc_buffer).
+ *
+ * @return number of slots
+ */
+static ecma_length_t
+ecma_shaped_values_get_capacity (ecma_length_t props_number) /**< number of properties */
+{
+  JERRY_ASSERT (props_number > 0 && props_number <= ECMA_SHAPE_MAX_PROPERTIES);
+
+  size_t size = MEM_POOL_CHUNK_SIZE;
+
+  while (size < sizeof (ecma_shaped_values_t) + props_number * sizeof (ecma_value_t))
+  {
+    size *= 2;
+  }
+
+  size_t capacity = (size - sizeof (ecma_shaped_values_t)) / sizeof (ecma_value_t);
+
+  return (ecma_length_t) JERRY_MIN (capacity, ECMA_SHAPE_MAX_PROPERTIES);
+} /* ecma_shaped_values_get_capacity */
+
+/**
+ * Get size of array of slots with specified capacity
+ *
+ * @return size in bytes
+ */
+static size_t
+ecma_shaped_values_get_size (ecma_length_t capacity) /**< number of slots */
+{
+  return sizeof (ecma_shaped_values_t) + capacity * sizeof (ecma_value_t);
+} /* ecma_shaped_values_get_size */
+
+/**
+ * Switch newly created object without properties to shaped form
+ */
+void
+ecma_shaped_object_init (ecma_object_t *obj_p) /**< object */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_GENERAL
+                && !ecma_get_object_is_builtin (obj_p));
+  JERRY_ASSERT (ecma_get_property_list (obj_p) == NULL);
+
+  ecma_set_object_is_shaped (obj_p, true);
+} /* ecma_shaped_object_init */
+
+/**
+ * Get shape of an object in shaped form
+ *
+ * @return pointer to the shape (not referenced)
+ */
+ecma_shape_t*
+ecma_shaped_object_get_shape (const ecma_object_t *obj_p) /**< shaped object */
+{
+  const ecma_shaped_values_t *shaped_values_p = ecma_get_object_shaped_values (obj_p);
+
+  /* objects without properties don't allocate slots */
+  if (shaped_values_p == NULL)
+  {
+    return ecma_shapes_root_p;
+  }
+
+  return ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shaped_values_p->shape_cp);
+} /* ecma_shaped_object_get_shape */
+
+/**
+ * Find slot of the property with specified name in an object in shaped form
+ *
+ * @return slot index - if the object has the property,
+ *         ECMA_SHAPE_NO_SLOT - otherwise.
+ */
+ecma_length_t
+ecma_shaped_object_find_slot (ecma_object_t *obj_p, /**< shaped object */
+                              ecma_string_t *name_p) /**< property name */
+{
+  if (ecma_get_object_shaped_values (obj_p) == NULL)
+  {
+    return ECMA_SHAPE_NO_SLOT;
+  }
+
+  ecma_shape_t *prop_shape_p = ecma_shape_find_property (ecma_shaped_object_get_shape (obj_p), name_p);
+
+  if (prop_shape_p == NULL)
+  {
+    return ECMA_SHAPE_NO_SLOT;
+  }
+
+  return ecma_shape_get_slot (prop_shape_p);
+} /* ecma_shaped_object_find_slot */
+
+/**
+ * Get values of properties of an object in shaped form
+ *
+ * @return pointer to array of the values, in order of the properties' slots
+ */
+ecma_value_t*
+ecma_shaped_object_get_values (const ecma_object_t *obj_p, /**< shaped object */
+                               ecma_length_t *out_values_number_p) /**< out: number of the values */
+{
+  ecma_shaped_values_t *shaped_values_p = ecma_get_object_shaped_values (obj_p);
+
+  if (shaped_values_p == NULL)
+  {
+    *out_values_number_p = 0;
+
+    return NULL;
+  }
+
+  *out_values_number_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shaped_values_p->shape_cp)->props_number;
+
+  return ECMA_SHAPED_VALUES_GET_VALUES (shaped_values_p);
+} /* ecma_shaped_object_get_values */
+
+/**
+ * Get value of the property, stored in specified slot of an object in shaped form
+ *
+ * @return ecma-value (not copied)
+ */
+ecma_value_t
+ecma_shaped_object_get_value (const ecma_object_t *obj_p, /**< shaped object */
+                              ecma_length_t slot) /**< index of the slot */
+{
+  const ecma_shaped_values_t *shaped_values_p = ecma_get_object_shaped_values (obj_p);
+  JERRY_ASSERT (shaped_values_p != NULL
+                && slot < ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shaped_values_p->shape_cp)->props_number);
+
+  return ECMA_SHAPED_VALUES_GET_VALUES (shaped_values_p)[slot];
+} /* ecma_shaped_object_get_value */
+
+/**
+ * Assign value to the property, stored in specified slot of an object in shaped form
+ *
+ * Note:
+ *      value previously stored in the slot is freed
+ */
+void
+ecma_shaped_object_assign_value (ecma_object_t *obj_p, /**< shaped object */
+                                 ecma_length_t slot, /**< index of the slot */
+                                 ecma_value_t value) /**< value to assign */
+{
+  ecma_shaped_values_t *shaped_values_p = ecma_get_object_shaped_values (obj_p);
+  JERRY_ASSERT (shaped_values_p != NULL
+                && slot < ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shaped_values_p->shape_cp)->props_number);
+
+  ecma_value_t *value_p = ECMA_SHAPED_VALUES_GET_VALUES (shaped_values_p) + slot;
+
+  if (ecma_is_value_number (value)
+      && ecma_is_value_number (*value_p))
+  {
+    *value_p = ecma_update_number_value (*value_p, value);
+  }
+  else
+  {
+    ecma_free_value (*value_p, false);
+
+    *value_p = ecma_copy_value (value, false);
+
+    if (ecma_is_value_object (value))
+    {
+      ecma_gc_write_barrier (obj_p, ecma_get_object_from_value (value));
+    }
+  }
+} /* ecma_shaped_object_assign_value */
+
+/**
+ * Add named data property with 'Writable', 'Enumerable' and 'Configurable' attributes set to true
+ * to an object in shaped form, transitioning the object to the corresponding shape
+ *
+ * @return true - if the property was added,
+ *         false - if the object already has maximum number of properties, that can be stored in slots
+ *                 (the object should be converted to property list form to add the property).
+ */
+bool
+ecma_shaped_object_add_property (ecma_object_t *obj_p, /**< shaped object */
+                                 ecma_string_t *name_p, /**< property name */
+                                 ecma_value_t value) /**< value of the property */
+{
+  JERRY_ASSERT (ecma_get_object_is_shaped (obj_p));
+  JERRY_ASSERT (ecma_shaped_object_find_slot (obj_p, name_p) == ECMA_SHAPE_NO_SLOT);
+
+  ecma_shape_t *shape_p = ecma_shaped_object_get_shape (obj_p);
+  const ecma_length_t slot = shape_p->props_number;
+
+  if (slot == ECMA_SHAPE_MAX_PROPERTIES)
+  {
+    return false;
+  }
+
+  /*
+   * The value is copied and the new shape is referenced before the slots are reallocated,
+   * as the allocation can run garbage collection, that flushes inline caches, which can hold the shape.
+   */
+  ecma_value_t value_copy = ecma_copy_value (value, false);
+  ecma_shape_t *new_shape_p = ecma_shape_get_transition (shape_p, name_p);
+
+  ecma_shaped_values_t *shaped_values_p = ecma_get_object_shaped_values (obj_p);
+
+  if (shaped_values_p == NULL
+      || slot == shaped_values_p->capacity)
+  {
+    const ecma_length_t new_capacity = ecma_shaped_values_get_capacity (slot + 1);
+
+    ecma_shaped_values_t *new_shaped_values_p;
+    new_shaped_values_p = (ecma_shaped_values_t *) ecma_alloc_buffer (ecma_shaped_values_get_size (new_capacity));
+
+    new_shaped_values_p->capacity = (uint16_t) new_capacity;
+
+    if (shaped_values_p == NULL)
+    {
+      ECMA_SET_NON_NULL_POINTER (new_shaped_values_p->shape_cp, shape_p);
+    }
+    else
+    {
+      new_shaped_values_p->shape_cp = shaped_values_p->shape_cp;
+
+      memcpy (ECMA_SHAPED_VALUES_GET_VALUES (new_shaped_values_p),
+              ECMA_SHAPED_VALUES_GET_VALUES (shaped_values_p),
+              slot * sizeof (ecma_value_t));
+
+      ecma_dealloc_buffer (shaped_values_p, ecma_shaped_values_get_size (shaped_values_p->capacity));
+    }
+
+    ecma_set_object_shaped_values (obj_p, new_shaped_values_p);
+
+    shaped_values_p = new_shaped_values_p;
+  }
+
+  ECMA_SHAPED_VALUES_GET_VALUES (shaped_values_p)[slot] = value_copy;
+  ECMA_SET_NON_NULL_POINTER (shaped_values_p->shape_cp, new_shape_p);
+
+  if (shape_p != ecma_shapes_root_p)
+  {
+    /* the shape is still referenced by the new shape */
+    ecma_deref_shape (shape_p);
+  }
+
+  if (ecma_is_value_object (value_copy))
+  {
+    ecma_gc_write_barrier (obj_p, ecma_get_object_from_value (value_copy));
+  }
+
+  return true;
+} /* ecma_shaped_object_add_property */
+
+/**
+ * Convert an object in shaped form to property list form
+ *
+ * Properties are created in order of their slots, so they are listed in same order,
+ * as if they were created in property list form.
+ */
+void
+ecma_shaped_object_convert_to_property_list (ecma_object_t *obj_p) /**< shaped object */
+{
+  JERRY_ASSERT (ecma_get_object_is_shaped (obj_p));
+
+  ecma_shaped_values_t *shaped_values_p = ecma_get_object_shaped_values (obj_p);
+
+  ecma_set_object_shaped_values (obj_p, NULL);
+  ecma_set_object_is_shaped (obj_p, false);
+
+  if (shaped_values_p == NULL)
+  {
+    return;
+  }
+
+  /* the shape is still referenced by the slots, and holds names of the properties */
+  ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shaped_values_p->shape_cp);
+  const ecma_length_t props_number = shape_p->props_number;
+  ecma_value_t *values_p = ECMA_SHAPED_VALUES_GET_VALUES (shaped_values_p);
+
+  mem_cpointer_t names_cp[ECMA_SHAPE_MAX_PROPERTIES];
+
+  for (ecma_shape_t *iter_p = shape_p;
+       iter_p->parent_cp != ECMA_NULL_POINTER;
+       iter_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, iter_p->parent_cp))
+  {
+    names_cp[ecma_shape_get_slot (iter_p)] = iter_p->name_cp;
+  }
+
+  /*
+   * The slots are detached from the object, so garbage collection, that can be run upon allocation
+   * of the properties, doesn't traverse them; objects, referenced from the slots, are kept alive
+   * with explicit references until they are moved to the properties.
+   */
+  for (ecma_length_t slot = 0; slot < props_number; slot++)
+  {
+    if (ecma_is_value_object (values_p[slot]))
+    {
+      ecma_ref_object (ecma_get_object_from_value (values_p[slot]));
+    }
+  }
+
+  for (ecma_length_t slot = 0; slot < props_number; slot++)
+  {
+    ecma_property_t *prop_p = ecma_create_named_data_property (obj_p,
+                                                               ECMA_GET_NON_NULL_POINTER (ecma_string_t,
+                                                                                          names_cp[slot]),
+                                                               true,
+                                                               true,
+                                                               true);
+
+    ecma_set_named_data_property_value (obj_p, prop_p, values_p[slot]);
+  }
+
+  for (ecma_length_t slot = 0; slot < props_number; slot++)
+  {
+    if (ecma_is_value_object (values_p[slot]))
+    {
+      ecma_deref_object (ecma_get_object_from_value (values_p[slot]));
+    }
+  }
+
+  ecma_dealloc_buffer (shaped_values_p, ecma_shaped_values_get_size (shaped_values_p->capacity));
+  ecma_deref_shape (shape_p);
+} /* ecma_shaped_object_convert_to_property_list */
+
+/**
+ * Free slots of an object in shaped form and values they hold
+ */
+void
+ecma_shaped_object_free_values (ecma_object_t *obj_p) /**< shaped object */
+{
+  ecma_shaped_values_t *shaped_values_p = ecma_get_object_shaped_values (obj_p);
+
+  if (shaped_values_p == NULL)
+  {
+    return;
+  }
+
+  ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shaped_values_p->shape_cp);
+  ecma_value_t *values_p = ECMA_SHAPED_VALUES_GET_VALUES (shaped_values_p);
+
+  for (ecma_length_t slot = 0; slot < shape_p->props_number; slot++)
+  {
+    ecma_free_value (values_p[slot], false);
+  }
+
+  ecma_set_object_shaped_values (obj_p, NULL);
+
+  ecma_dealloc_buffer (shaped_values_p, ecma_shaped_values_get_size (shaped_values_p->capacity));
+  ecma_deref_shape (shape_p);
+} /* ecma_shaped_object_free_values */
+
+/**
+ * @}
+ * @}
+ */
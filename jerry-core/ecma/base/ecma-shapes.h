@@ -0,0 +1,51 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_SHAPES_H
+#define ECMA_SHAPES_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmashapes Shapes of objects
+ * @{
+ */
+
+extern void ecma_shapes_init (void);
+extern void ecma_shapes_finalize (void);
+
+extern void ecma_ref_shape (ecma_shape_t *shape_p);
+extern void ecma_deref_shape (ecma_shape_t *shape_p);
+extern ecma_shape_t *ecma_shape_find_property (ecma_shape_t *shape_p, ecma_string_t *name_p);
+extern ecma_length_t ecma_shape_get_slot (const ecma_shape_t *shape_p);
+
+extern void ecma_shaped_object_init (ecma_object_t *obj_p);
+extern ecma_shape_t *ecma_shaped_object_get_shape (const ecma_object_t *obj_p);
+extern ecma_length_t ecma_shaped_object_find_slot (ecma_object_t *obj_p, ecma_string_t *name_p);
+extern ecma_value_t *ecma_shaped_object_get_values (const ecma_object_t *obj_p, ecma_length_t *out_values_number_p);
+extern ecma_value_t ecma_shaped_object_get_value (const ecma_object_t *obj_p, ecma_length_t slot);
+extern void ecma_shaped_object_assign_value (ecma_object_t *obj_p, ecma_length_t slot, ecma_value_t value);
+extern bool ecma_shaped_object_add_property (ecma_object_t *obj_p, ecma_string_t *name_p, ecma_value_t value);
+extern void ecma_shaped_object_convert_to_property_list (ecma_object_t *obj_p);
+extern void ecma_shaped_object_free_values (ecma_object_t *obj_p);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* ECMA_SHAPES_H */
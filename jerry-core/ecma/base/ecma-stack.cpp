@@ -24,21 +24,24 @@
  */
 
 /**
- * Size of a ecma-stack frame's dynamic chunk
+ * The top-most ecma-stack frame
  */
-#define ECMA_STACK_DYNAMIC_CHUNK_SIZE (mem_heap_recommend_allocation_size (sizeof (ecma_stack_chunk_header_t) + \
-                                                                           sizeof (ecma_value_t)))
+ecma_stack_frame_t* ecma_stack_top_frame_p;
 
 /**
- * Number of value slots in a ecma-stack frame's dynamic chunk
+ * Array of ecma-stack's value slots, holding register variables and pushed values of all frames
  */
-#define ECMA_STACK_SLOTS_IN_DYNAMIC_CHUNK ((ECMA_STACK_DYNAMIC_CHUNK_SIZE - sizeof (ecma_stack_chunk_header_t)) / \
-                                           sizeof (ecma_value_t))
+static ecma_value_t *ecma_stack_values_p;
 
 /**
- * The top-most ecma-stack frame
+ * Number of value slots in the ecma-stack's array
  */
-ecma_stack_frame_t* ecma_stack_top_frame_p;
+static uint32_t ecma_stack_values_size;
+
+/**
+ * Number of used value slots in the ecma-stack's array
+ */
+static uint32_t ecma_stack_values_number;
 
 /**
  * Initialize ecma-stack
@@ -47,6 +50,10 @@ void
 ecma_stack_init (void)
 {
   ecma_stack_top_frame_p = NULL;
+
+  ecma_stack_values_p = NULL;
+  ecma_stack_values_size = 0;
+  ecma_stack_values_number = 0;
 } /* ecma_stack_init */
 
 /**
@@ -56,6 +63,15 @@ void
 ecma_stack_finalize ()
 {
   JERRY_ASSERT (ecma_stack_top_frame_p == NULL);
+  JERRY_ASSERT (ecma_stack_values_number == 0);
+
+  if (ecma_stack_values_p != NULL)
+  {
+    mem_heap_free_block (ecma_stack_values_p);
+
+    ecma_stack_values_p = NULL;
+    ecma_stack_values_size = 0;
+  }
 } /* ecma_stack_finalize */
 
 /**
@@ -69,26 +85,88 @@ ecma_stack_get_top_frame (void)
   return ecma_stack_top_frame_p;
 } /* ecma_stack_get_top_frame */
 
+/**
+ * Move the ecma-stack's values to a newly allocated array of specified size
+ *
+ * Note:
+ *      register windows of the frames are moved along with the values
+ */
+static void __attr_noinline___
+ecma_stack_resize (uint32_t new_size) /**< new number of value slots */
+{
+  JERRY_ASSERT (new_size >= ecma_stack_values_number
+                && new_size >= ECMA_STACK_MIN_VALUES_NUMBER);
+
+  /*
+   * The allocation can run garbage collector, that scans the stack,
+   * so the stack is switched to the new array only after the values are copied.
+   */
+  ecma_value_t *new_values_p = (ecma_value_t *) mem_heap_alloc_block (new_size * sizeof (ecma_value_t),
+                                                                      MEM_HEAP_ALLOC_LONG_TERM);
+
+  if (ecma_stack_values_p != NULL)
+  {
+    memcpy (new_values_p, ecma_stack_values_p, ecma_stack_values_number * sizeof (ecma_value_t));
+
+    for (ecma_stack_frame_t *frame_iter_p = ecma_stack_top_frame_p;
+         frame_iter_p != NULL;
+         frame_iter_p = frame_iter_p->prev_frame_p)
+    {
+      frame_iter_p->regs_p = new_values_p + (frame_iter_p->regs_p - ecma_stack_values_p);
+    }
+
+    mem_heap_free_block (ecma_stack_values_p);
+  }
+
+  ecma_stack_values_p = new_values_p;
+  ecma_stack_values_size = new_size;
+} /* ecma_stack_resize */
+
+/**
+ * Make sure, that the ecma-stack's array has specified number of free value slots
+ */
+static void __attr_always_inline___
+ecma_stack_reserve (uint32_t number) /**< number of value slots */
+{
+  if (unlikely (ecma_stack_values_size - ecma_stack_values_number < number))
+  {
+    uint32_t new_size = JERRY_MAX (ecma_stack_values_size * 2u, (uint32_t) ECMA_STACK_MIN_VALUES_NUMBER);
+
+    while (new_size - ecma_stack_values_number < number)
+    {
+      new_size *= 2u;
+    }
+
+    ecma_stack_resize (new_size);
+  }
+} /* ecma_stack_reserve */
+
 /**
  * Add the frame to ecma-stack
+ *
+ * Registers of the frame are placed in the ecma-stack's array right after the previous frame's values
+ * and are initialized to empty values.
  */
 void
 ecma_stack_add_frame (ecma_stack_frame_t *frame_p, /**< frame to initialize */
-                      ecma_value_t *regs_p, /**< array of register variables' values */
                       int32_t regs_num) /**< number of register variables */
 {
+  JERRY_ASSERT (regs_num >= 0);
+
+  ecma_stack_reserve ((uint32_t) regs_num);
+
   frame_p->prev_frame_p = ecma_stack_top_frame_p;
   ecma_stack_top_frame_p = frame_p;
 
-  frame_p->top_chunk_p = NULL;
-  frame_p->dynamically_allocated_value_slots_p = frame_p->inlined_values;
-  frame_p->current_slot_index = 0;
-  frame_p->regs_p = regs_p;
+  frame_p->regs_p = ecma_stack_values_p + ecma_stack_values_number;
   frame_p->regs_number = regs_num;
+  frame_p->values_number = 0;
+
+  ecma_stack_values_number += (uint32_t) regs_num;
 
   for (int32_t i = 0; i < regs_num; i++)
   {
-    regs_p[i] = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+    frame_p->regs_p[i] = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
   }
 } /* ecma_stack_add_frame */
 
@@ -104,12 +182,7 @@ ecma_stack_free_frame (ecma_stack_frame_t *frame_p) /**< frame to initialize */
   /* the frame should be the top-most frame */
   JERRY_ASSERT (ecma_stack_top_frame_p == frame_p);
 
-  ecma_stack_top_frame_p = frame_p->prev_frame_p;
-
-  while (frame_p->top_chunk_p != NULL)
-  {
-    ecma_stack_pop (frame_p);
-  }
+  ecma_stack_pop_multiple (frame_p, frame_p->values_number);
 
   for (int32_t reg_index = 0;
        reg_index < frame_p->regs_number;
@@ -117,6 +190,17 @@ ecma_stack_free_frame (ecma_stack_frame_t *frame_p) /**< frame to initialize */
   {
     ecma_free_value (frame_p->regs_p[reg_index], false);
   }
+
+  JERRY_ASSERT (frame_p->regs_p + frame_p->regs_number == ecma_stack_values_p + ecma_stack_values_number);
+  ecma_stack_values_number -= (uint32_t) frame_p->regs_number;
+
+  ecma_stack_top_frame_p = frame_p->prev_frame_p;
+
+  if (unlikely (ecma_stack_values_number <= ecma_stack_values_size / 4u
+                && ecma_stack_values_size > ECMA_STACK_MIN_VALUES_NUMBER))
+  {
+    ecma_stack_resize (ecma_stack_values_size / 2u);
+  }
 } /* ecma_stack_free_frame */
 
 /**
@@ -146,60 +230,22 @@ ecma_stack_frame_set_reg_value (ecma_stack_frame_t *frame_p, /**< frame */
   frame_p->regs_p[reg_index] = value;
 } /* ecma_stack_frame_set_reg_value */
 
-/**
- * Calculate number of value slots in the top-most chunk of the frame
- *
- * @return number of value slots
- */
-static size_t
-ecma_stack_slots_in_top_chunk (ecma_stack_frame_t *frame_p) /**< ecma-stack frame */
-{
-  return ((frame_p->top_chunk_p == NULL) ? ECMA_STACK_FRAME_INLINED_VALUES_NUMBER : ECMA_STACK_SLOTS_IN_DYNAMIC_CHUNK);
-} /* ecma_stack_slots_in_top_chunk */
-
-/**
- * Longpath for ecma_stack_push_value (for case current chunk may be doesn't have free slots)
- */
-static void __attr_noinline___
-ecma_stack_push_value_longpath (ecma_stack_frame_t *frame_p) /**< ecma-stack frame */
-{
-  JERRY_ASSERT (frame_p->current_slot_index >= JERRY_MIN (ECMA_STACK_FRAME_INLINED_VALUES_NUMBER,
-                                                          ECMA_STACK_SLOTS_IN_DYNAMIC_CHUNK));
-
-  const size_t slots_in_top_chunk = ecma_stack_slots_in_top_chunk (frame_p);
-
-  if (frame_p->current_slot_index == slots_in_top_chunk)
-  {
-    ecma_stack_chunk_header_t *chunk_p;
-    chunk_p = (ecma_stack_chunk_header_t *) mem_heap_alloc_block (ECMA_STACK_DYNAMIC_CHUNK_SIZE,
-                                                                  MEM_HEAP_ALLOC_SHORT_TERM);
-
-    ECMA_SET_POINTER (chunk_p->prev_chunk_p, frame_p->top_chunk_p);
-
-    frame_p->top_chunk_p = chunk_p;
-    frame_p->dynamically_allocated_value_slots_p = (ecma_value_t*) (frame_p->top_chunk_p + 1);
-    frame_p->current_slot_index = 0;
-  }
-} /* ecma_stack_push_value_longpath */
-
 /**
  * Push ecma-value to ecma-stack
+ *
+ * Note:
+ *      the frame should be the top-most frame
  */
 void
 ecma_stack_push_value (ecma_stack_frame_t *frame_p, /**< ecma-stack frame */
                        ecma_value_t value) /**< ecma-value */
 {
-  frame_p->current_slot_index++;
-
-  if (frame_p->current_slot_index >= JERRY_MIN (ECMA_STACK_FRAME_INLINED_VALUES_NUMBER,
-                                                ECMA_STACK_SLOTS_IN_DYNAMIC_CHUNK))
-  {
-    ecma_stack_push_value_longpath (frame_p);
-  }
+  JERRY_ASSERT (ecma_stack_top_frame_p == frame_p);
 
-  JERRY_ASSERT (frame_p->current_slot_index < ecma_stack_slots_in_top_chunk (frame_p));
+  ecma_stack_reserve (1);
 
-  frame_p->dynamically_allocated_value_slots_p[frame_p->current_slot_index] = value;
+  ecma_stack_values_p[ecma_stack_values_number++] = value;
+  frame_p->values_number++;
 } /* ecma_stack_push_value */
 
 /**
@@ -208,58 +254,22 @@ ecma_stack_push_value (ecma_stack_frame_t *frame_p, /**< ecma-stack frame */
 ecma_value_t __attr_always_inline___
 ecma_stack_top_value (ecma_stack_frame_t *frame_p) /**< ecma-stack frame */
 {
-  const size_t slots_in_top_chunk = ecma_stack_slots_in_top_chunk (frame_p);
-
-  JERRY_ASSERT (frame_p->current_slot_index < slots_in_top_chunk);
+  JERRY_ASSERT (ecma_stack_top_frame_p == frame_p);
+  JERRY_ASSERT (frame_p->values_number != 0);
 
-  return frame_p->dynamically_allocated_value_slots_p[frame_p->current_slot_index];
+  return ecma_stack_values_p[ecma_stack_values_number - 1u];
 } /* ecma_stack_top_value */
 
-/**
- * Longpath for ecma_stack_pop (for case a dynamically allocated chunk needs to be deallocated)
- */
-static void __attr_noinline___
-ecma_stack_pop_longpath (ecma_stack_frame_t *frame_p) /**< ecma-stack frame */
-{
-  JERRY_ASSERT (frame_p->current_slot_index == 0 && frame_p->top_chunk_p != NULL);
-
-  ecma_stack_chunk_header_t *chunk_to_free_p = frame_p->top_chunk_p;
-  frame_p->top_chunk_p = ECMA_GET_POINTER (ecma_stack_chunk_header_t,
-                                           frame_p->top_chunk_p->prev_chunk_p);
-
-  if (frame_p->top_chunk_p != NULL)
-  {
-    frame_p->dynamically_allocated_value_slots_p = (ecma_value_t*) (frame_p->top_chunk_p + 1);
-    frame_p->current_slot_index = (uint32_t) (ECMA_STACK_SLOTS_IN_DYNAMIC_CHUNK - 1u);
-  }
-  else
-  {
-    frame_p->dynamically_allocated_value_slots_p = frame_p->inlined_values;
-    frame_p->current_slot_index = (uint32_t) (ECMA_STACK_FRAME_INLINED_VALUES_NUMBER - 1u);
-  }
-
-  mem_heap_free_block (chunk_to_free_p);
-} /* ecma_stack_pop_longpath */
-
 /**
  * Pop top value from ecma-stack and free it
  */
 void
 ecma_stack_pop (ecma_stack_frame_t *frame_p) /**< ecma-stack frame */
 {
-  JERRY_ASSERT (frame_p->current_slot_index < ecma_stack_slots_in_top_chunk (frame_p));
-
   ecma_value_t value = ecma_stack_top_value (frame_p);
 
-  if (unlikely (frame_p->current_slot_index == 0
-                && frame_p->top_chunk_p != NULL))
-  {
-    ecma_stack_pop_longpath (frame_p);
-  }
-  else
-  {
-    frame_p->current_slot_index--;
-  }
+  ecma_stack_values_number--;
+  frame_p->values_number--;
 
   ecma_free_value (value, true);
 } /* ecma_stack_pop */
@@ -277,6 +287,19 @@ ecma_stack_pop_multiple (ecma_stack_frame_t *frame_p, /**< ecma-stack frame */
   }
 } /* ecma_stack_pop_multiple */
 
+/**
+ * Get the ecma-stack's values, i.e. registers and pushed values of all frames
+ *
+ * @return pointer to the first value of the bottom-most frame
+ */
+ecma_value_t*
+ecma_stack_get_values (uint32_t *out_values_number_p) /**< out: number of values */
+{
+  *out_values_number_p = ecma_stack_values_number;
+
+  return ecma_stack_values_p;
+} /* ecma_stack_get_values */
+
 /**
  * @}
  * @}
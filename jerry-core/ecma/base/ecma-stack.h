@@ -27,33 +27,22 @@
  */
 
 /**
- * Number of ecma-values inlined into stack frame
+ * Minimal number of value slots in ecma-stack's array
  */
-#define ECMA_STACK_FRAME_INLINED_VALUES_NUMBER CONFIG_ECMA_STACK_FRAME_INLINED_VALUES_NUMBER
-
-/**
- * Header of a ECMA stack frame's chunk
- */
-typedef struct
-{
-  uint16_t prev_chunk_p; /**< previous chunk of same frame */
-} ecma_stack_chunk_header_t;
+#define ECMA_STACK_MIN_VALUES_NUMBER CONFIG_ECMA_STACK_MIN_VALUES_NUMBER
 
 /**
  * ECMA stack frame
+ *
+ * Register variables and values, pushed to a frame, are held in single array of ecma-stack:
+ * the frame's registers are followed by the frame's pushed values, which are followed by next frame's registers.
  */
 typedef struct ecma_stack_frame_t
 {
   struct ecma_stack_frame_t *prev_frame_p; /**< previous frame */
-  ecma_stack_chunk_header_t *top_chunk_p; /**< the top-most chunk of the frame */
-  ecma_value_t *dynamically_allocated_value_slots_p; /**< pointer to dynamically allocated value slots
-                                                      *   in the top-most chunk */
-  uint32_t current_slot_index; /**< index of first free slot in the top chunk */
-  ecma_value_t inlined_values[ECMA_STACK_FRAME_INLINED_VALUES_NUMBER]; /**< place for values inlined in stack frame
-                                                                        *   (instead of being dynamically allocated
-                                                                        *   on the heap) */
-  ecma_value_t *regs_p; /**< register variables */
+  ecma_value_t *regs_p; /**< register variables (the frame's window in the ecma-stack's array) */
   int32_t regs_number; /**< number of register variables */
+  uint32_t values_number; /**< number of values, pushed to the frame */
 } ecma_stack_frame_t;
 
 extern void ecma_stack_init (void);
@@ -62,7 +51,6 @@ extern ecma_stack_frame_t*
 ecma_stack_get_top_frame (void);
 extern void
 ecma_stack_add_frame (ecma_stack_frame_t *frame_p,
-                      ecma_value_t *regs_p,
                       int32_t regs_num);
 extern void ecma_stack_free_frame (ecma_stack_frame_t *frame_p);
 extern ecma_value_t ecma_stack_frame_get_reg_value (ecma_stack_frame_t *frame_p, int32_t reg_index);
@@ -71,6 +59,7 @@ extern void ecma_stack_push_value (ecma_stack_frame_t *frame_p, ecma_value_t val
 extern ecma_value_t ecma_stack_top_value (ecma_stack_frame_t *frame_p);
 extern void ecma_stack_pop (ecma_stack_frame_t *frame_p);
 extern void ecma_stack_pop_multiple (ecma_stack_frame_t *frame_p, uint32_t number);
+extern ecma_value_t *ecma_stack_get_values (uint32_t *out_values_number_p);
 
 /**
  * @}
@@ -22,6 +22,7 @@
 #include "ecma-comparison.h"
 #include "ecma-conversion.h"
 #include "ecma-exceptions.h"
+#include "ecma-fast-array.h"
 #include "ecma-function-object.h"
 #include "ecma-gc.h"
 #include "ecma-globals.h"
@@ -77,6 +78,90 @@ ecma_builtin_array_prototype_helper_set_length (ecma_object_t *object, /**< obje
   return ret_value;
 } /* ecma_builtin_array_prototype_helper_set_length */
 
+/**
+ * Helper function to get value of an object's element, if the element is present
+ * (steps 'If kPresent is true, then let kValue be the result of calling the [[Get]] internal method'
+ * of the array iteration routines)
+ *
+ * Elements of arrays in fast form are read from the vector, without creating the index string.
+ * As the callbacks of the routines can modify the array, the check is performed for each element.
+ *
+ * @return completion value (the element's value - if the element is present (out_is_present_p is set to true),
+ *                           undefined - if the element is not present (out_is_present_p is set to false))
+ *         Returned value must be freed with ecma_free_completion_value.
+ */
+static ecma_completion_value_t
+ecma_builtin_array_prototype_helper_get_element (ecma_object_t *obj_p, /**< object */
+                                                 uint32_t index, /**< index of the element */
+                                                 bool *out_is_present_p) /**< out: is the element present */
+{
+  ecma_fast_array_elements_t *elements_p = ecma_get_object_fast_elements (obj_p);
+
+  if (elements_p != NULL
+      && index < elements_p->length)
+  {
+    *out_is_present_p = true;
+
+    return ecma_make_normal_completion_value (ecma_copy_value (ECMA_FAST_ARRAY_ELEMENTS_GET_VALUES (elements_p)[index],
+                                                               true));
+  }
+
+  ecma_completion_value_t ret_value;
+  ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
+
+  if (ecma_op_object_has_property (obj_p, index_str_p))
+  {
+    *out_is_present_p = true;
+
+    ret_value = ecma_op_object_get (obj_p, index_str_p);
+  }
+  else
+  {
+    *out_is_present_p = false;
+
+    ret_value = ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+  }
+
+  ecma_deref_ecma_string (index_str_p);
+
+  return ret_value;
+} /* ecma_builtin_array_prototype_helper_get_element */
+
+/**
+ * Helper function to define an element of a newly created array (ECMA-262 v5, 15.4.4.19, step 8.c.iii
+ * and 15.4.4.20, step 9.c.iii)
+ *
+ * If the element is appended to an array in fast form, the value is stored in the vector directly.
+ */
+static void
+ecma_builtin_array_prototype_helper_define_element (ecma_object_t *array_p, /**< new array */
+                                                    uint32_t index, /**< index of the element */
+                                                    ecma_value_t value) /**< value of the element */
+{
+  ecma_fast_array_elements_t *elements_p = ecma_get_object_fast_elements (array_p);
+
+  if (elements_p != NULL
+      && index == elements_p->length
+      && ecma_fast_array_can_append (array_p))
+  {
+    ecma_fast_array_append (array_p, value);
+    return;
+  }
+
+  ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
+
+  /*
+   * By definition we should use [[DefineOwnProperty]] here, but since [[Put]] will create the
+   * same property that we need, we can use it for simplicity. No need for a try-catch block
+   * since it is called with is_throw = false.
+   */
+  ecma_completion_value_t put_comp_value = ecma_op_object_put (array_p, index_str_p, value, false);
+  JERRY_ASSERT (ecma_is_completion_value_normal_true (put_comp_value));
+  ecma_free_completion_value (put_comp_value);
+
+  ecma_deref_ecma_string (index_str_p);
+} /* ecma_builtin_array_prototype_helper_define_element */
+
 /**
  * The Array.prototype object's 'concat' routine
  *
@@ -158,8 +243,8 @@ ecma_builtin_array_prototype_object_concat (ecma_value_t this_arg, /**< this arg
         ecma_string_t *array_index_string_p = ecma_new_ecma_string_from_uint32 (array_index);
 
         /* 5.b.iii.2 */
-        if (ecma_op_object_get_property (ecma_get_object_from_value (args[arg_index]),
-                                         array_index_string_p) != NULL)
+        if (ecma_op_object_has_property (ecma_get_object_from_value (args[arg_index]),
+                                         array_index_string_p))
         {
           ecma_string_t *new_array_index_string_p = ecma_new_ecma_string_from_uint32 (new_array_index);
 
@@ -273,15 +358,15 @@ ecma_builtin_array_prototype_object_for_each (ecma_value_t this_arg, /**< this a
     /* Iterate over array and call callbackfn on every element */
     for (uint32_t index = 0; index < len && ecma_is_completion_value_empty (ret_value); index++)
     {
-      /* 7.a */
-      ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
+      /* 7.a, 7.b, 7.c.i */
+      bool is_present;
 
-      /* 7.b */
-      if (ecma_op_object_get_property (obj_p, index_str_p) != NULL)
-      {
-        /* 7.c.i */
-        ECMA_TRY_CATCH (current_value, ecma_op_object_get (obj_p, index_str_p), ret_value);
+      ECMA_TRY_CATCH (current_value,
+                      ecma_builtin_array_prototype_helper_get_element (obj_p, index, &is_present),
+                      ret_value);
 
+      if (is_present)
+      {
         *num_p = ecma_uint32_to_number (index);
         current_index = ecma_make_number_value (num_p);
 
@@ -290,10 +375,9 @@ ecma_builtin_array_prototype_object_for_each (ecma_value_t this_arg, /**< this a
         ECMA_TRY_CATCH (call_value, ecma_op_function_call (func_object_p, arg2, call_args, 3), ret_value);
 
         ECMA_FINALIZE (call_value);
-        ECMA_FINALIZE (current_value);
       }
 
-      ecma_deref_ecma_string (index_str_p);
+      ECMA_FINALIZE (current_value);
     }
 
     if (ecma_is_completion_value_empty (ret_value))
@@ -589,60 +673,83 @@ ecma_builtin_array_prototype_object_pop (ecma_value_t this_arg) /**< this argume
                   ret_value);
 
   ecma_object_t *obj_p = ecma_get_object_from_value (obj_this);
-  ecma_string_t *magic_string_length_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
-
-  /* 2. */
-  ECMA_TRY_CATCH (len_value,
-                  ecma_op_object_get (obj_p, magic_string_length_p),
-                  ret_value);
-
-  ECMA_OP_TO_NUMBER_TRY_CATCH (len_number, len_value, ret_value);
-
-  /* 3. */
-  uint32_t len = ecma_number_to_uint32 (len_number);
+  ecma_fast_array_elements_t *elements_p = ecma_get_object_fast_elements (obj_p);
 
-  /* 4. */
-  if (len == 0)
+  if (elements_p != NULL)
   {
-    /* 4.a */
-    ECMA_TRY_CATCH (set_length_value,
-                    ecma_builtin_array_prototype_helper_set_length (obj_p, 0),
-                    ret_value);
+    /* the last element of the array in fast form is removed, as [[Delete]] would do */
+    if (elements_p->length == 0)
+    {
+      ret_value = ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+    }
+    else
+    {
+      const uint32_t len = elements_p->length - 1;
+      ecma_value_t value = ecma_copy_value (ECMA_FAST_ARRAY_ELEMENTS_GET_VALUES (elements_p)[len], true);
 
-    /* 4.b */
-    ret_value = ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+      ecma_fast_array_truncate (obj_p, len);
 
-    ECMA_FINALIZE (set_length_value)
+      ret_value = ecma_make_normal_completion_value (value);
+    }
   }
   else
   {
-    len--;
-    /* 5.a */
-    ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (len);
+    ecma_string_t *magic_string_length_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
 
-    /* 5.b */
-    ECMA_TRY_CATCH (get_value, ecma_op_object_get (obj_p, index_str_p), ret_value);
+    /* 2. */
+    ECMA_TRY_CATCH (len_value,
+                    ecma_op_object_get (obj_p, magic_string_length_p),
+                    ret_value);
 
-    /* 5.c */
-    ECMA_TRY_CATCH (del_value, ecma_op_object_delete (obj_p, index_str_p, true), ret_value);
+    ECMA_OP_TO_NUMBER_TRY_CATCH (len_number, len_value, ret_value);
 
-    /* 5.d */
-    ECMA_TRY_CATCH (set_length_value,
-                    ecma_builtin_array_prototype_helper_set_length (obj_p, len),
-                    ret_value);
+    /* 3. */
+    uint32_t len = ecma_number_to_uint32 (len_number);
+
+    /* 4. */
+    if (len == 0)
+    {
+      /* 4.a */
+      ECMA_TRY_CATCH (set_length_value,
+                      ecma_builtin_array_prototype_helper_set_length (obj_p, 0),
+                      ret_value);
 
-    ret_value = ecma_make_normal_completion_value (ecma_copy_value (get_value, true));
+      /* 4.b */
+      ret_value = ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_UNDEFINED);
 
-    ECMA_FINALIZE (set_length_value);
-    ECMA_FINALIZE (del_value);
-    ECMA_FINALIZE (get_value);
+      ECMA_FINALIZE (set_length_value)
+    }
+    else
+    {
+      len--;
+      /* 5.a */
+      ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (len);
 
-    ecma_deref_ecma_string (index_str_p);
+      /* 5.b */
+      ECMA_TRY_CATCH (get_value, ecma_op_object_get (obj_p, index_str_p), ret_value);
+
+      /* 5.c */
+      ECMA_TRY_CATCH (del_value, ecma_op_object_delete (obj_p, index_str_p, true), ret_value);
+
+      /* 5.d */
+      ECMA_TRY_CATCH (set_length_value,
+                      ecma_builtin_array_prototype_helper_set_length (obj_p, len),
+                      ret_value);
+
+      ret_value = ecma_make_normal_completion_value (ecma_copy_value (get_value, true));
+
+      ECMA_FINALIZE (set_length_value);
+      ECMA_FINALIZE (del_value);
+      ECMA_FINALIZE (get_value);
+
+      ecma_deref_ecma_string (index_str_p);
+    }
+
+    ECMA_OP_TO_NUMBER_FINALIZE (len_number);
+    ECMA_FINALIZE (len_value);
+    ecma_deref_ecma_string (magic_string_length_p);
   }
 
-  ECMA_OP_TO_NUMBER_FINALIZE (len_number);
-  ECMA_FINALIZE (len_value);
-  ecma_deref_ecma_string (magic_string_length_p);
   ECMA_FINALIZE (obj_this);
 
   return ret_value;
@@ -671,76 +778,98 @@ ecma_builtin_array_prototype_object_push (ecma_value_t this_arg, /**< this argum
 
   ecma_object_t *obj_p = ecma_get_object_from_value (obj_this_value);
 
-  // 2.
-  ecma_string_t *length_str_p = ecma_new_ecma_string_from_magic_string_id (LIT_MAGIC_STRING_LENGTH);
-
-  ECMA_TRY_CATCH (length_value, ecma_op_object_get (obj_p, length_str_p), ret_value);
+  ecma_fast_array_elements_t *elements_p = ecma_get_object_fast_elements (obj_p);
 
-  // 3.
-  ECMA_OP_TO_NUMBER_TRY_CATCH (length_var, length_value, ret_value);
+  if (elements_p != NULL
+      && arguments_number < ECMA_MAX_VALUE_OF_VALID_ARRAY_INDEX - elements_p->length
+      && ecma_fast_array_can_append (obj_p))
+  {
+    /* the elements are appended to the array in fast form, as [[Put]] would do */
+    for (uint32_t index = 0;
+         index < arguments_number;
+         ++index)
+    {
+      ecma_fast_array_append (obj_p, argument_list_p[index]);
+    }
 
-  uint32_t n = ecma_number_to_uint32 (length_var);
+    ecma_number_t *num_length_p = ecma_alloc_number ();
+    *num_length_p = ecma_uint32_to_number (ecma_get_object_fast_elements (obj_p)->length);
 
-  // 5.
-  for (uint32_t index = 0;
-       index < arguments_number;
-       ++index, ++n)
+    ret_value = ecma_make_normal_completion_value (ecma_make_number_value (num_length_p));
+  }
+  else
   {
-    // a.
-    ecma_value_t e_value = argument_list_p[index];
+    // 2.
+    ecma_string_t *length_str_p = ecma_new_ecma_string_from_magic_string_id (LIT_MAGIC_STRING_LENGTH);
 
-    // b.
-    ecma_string_t *n_str_p = ecma_new_ecma_string_from_uint32 (n);
+    ECMA_TRY_CATCH (length_value, ecma_op_object_get (obj_p, length_str_p), ret_value);
 
-    ecma_completion_value_t completion = ecma_op_object_put (obj_p, n_str_p, e_value, true);
+    // 3.
+    ECMA_OP_TO_NUMBER_TRY_CATCH (length_var, length_value, ret_value);
 
-    ecma_deref_ecma_string (n_str_p);
+    uint32_t n = ecma_number_to_uint32 (length_var);
 
-    if (unlikely (ecma_is_completion_value_throw (completion)))
-    {
-      ret_value = completion;
-      break;
-    }
-    else
+    // 5.
+    for (uint32_t index = 0;
+         index < arguments_number;
+         ++index, ++n)
     {
-      JERRY_ASSERT (ecma_is_completion_value_normal (completion));
-      ecma_free_completion_value (completion);
-    }
-  }
-
-  // 6.
-  if (ecma_is_completion_value_empty (ret_value))
-  {
-    ecma_number_t *num_length_p = ecma_alloc_number ();
-    *num_length_p = ecma_uint32_to_number (n);
+      // a.
+      ecma_value_t e_value = argument_list_p[index];
 
-    ecma_value_t num_length_value = ecma_make_number_value (num_length_p);
+      // b.
+      ecma_string_t *n_str_p = ecma_new_ecma_string_from_uint32 (n);
 
-    ecma_completion_value_t completion = ecma_op_object_put (obj_p,
-                                                             length_str_p,
-                                                             num_length_value,
-                                                             true);
+      ecma_completion_value_t completion = ecma_op_object_put (obj_p, n_str_p, e_value, true);
 
-    if (unlikely (ecma_is_completion_value_throw (completion)))
-    {
-      ret_value = completion;
+      ecma_deref_ecma_string (n_str_p);
 
-      ecma_dealloc_number (num_length_p);
+      if (unlikely (ecma_is_completion_value_throw (completion)))
+      {
+        ret_value = completion;
+        break;
+      }
+      else
+      {
+        JERRY_ASSERT (ecma_is_completion_value_normal (completion));
+        ecma_free_completion_value (completion);
+      }
     }
-    else
+
+    // 6.
+    if (ecma_is_completion_value_empty (ret_value))
     {
-      JERRY_ASSERT (ecma_is_completion_value_normal (completion));
-      ecma_free_completion_value (completion);
+      ecma_number_t *num_length_p = ecma_alloc_number ();
+      *num_length_p = ecma_uint32_to_number (n);
+
+      ecma_value_t num_length_value = ecma_make_number_value (num_length_p);
+
+      ecma_completion_value_t completion = ecma_op_object_put (obj_p,
+                                                               length_str_p,
+                                                               num_length_value,
+                                                               true);
 
-      ret_value = ecma_make_normal_completion_value (num_length_value);
+      if (unlikely (ecma_is_completion_value_throw (completion)))
+      {
+        ret_value = completion;
+
+        ecma_dealloc_number (num_length_p);
+      }
+      else
+      {
+        JERRY_ASSERT (ecma_is_completion_value_normal (completion));
+        ecma_free_completion_value (completion);
+
+        ret_value = ecma_make_normal_completion_value (num_length_value);
+      }
     }
-  }
 
-  ECMA_OP_TO_NUMBER_FINALIZE (length_var);
+    ECMA_OP_TO_NUMBER_FINALIZE (length_var);
 
-  ECMA_FINALIZE (length_value);
+    ECMA_FINALIZE (length_value);
 
-  ecma_deref_ecma_string (length_str_p);
+    ecma_deref_ecma_string (length_str_p);
+  }
 
   ECMA_FINALIZE (obj_this_value);
 
@@ -796,8 +925,8 @@ ecma_builtin_array_prototype_object_reverse (ecma_value_t this_arg) /**< this ar
     ECMA_TRY_CATCH (upper_value, ecma_op_object_get (obj_p, upper_str_p), ret_value);
 
     /* 6.f and 6.g */
-    bool lower_exist = (ecma_op_object_get_property (obj_p, lower_str_p) != NULL);
-    bool upper_exist = (ecma_op_object_get_property (obj_p, upper_str_p) != NULL);
+    bool lower_exist = ecma_op_object_has_property (obj_p, lower_str_p);
+    bool upper_exist = ecma_op_object_has_property (obj_p, upper_str_p);
 
     /* 6.h */
     if (lower_exist && upper_exist)
@@ -902,26 +1031,47 @@ ecma_builtin_array_prototype_object_index_of (ecma_value_t this_arg, /**< this a
     {
       JERRY_ASSERT (from_idx < len);
 
-      for (; from_idx < len && *num_p < 0 && ecma_is_completion_value_empty (ret_value); from_idx++)
+      ecma_fast_array_elements_t *elements_p = ecma_get_object_fast_elements (obj_p);
+
+      if (elements_p != NULL
+          && elements_p->length == len)
       {
-        ecma_string_t *idx_str_p = ecma_new_ecma_string_from_uint32 (from_idx);
+        /* all elements of the array in fast form are present, and comparing them has no side effects */
+        const ecma_value_t *values_p = ECMA_FAST_ARRAY_ELEMENTS_GET_VALUES (elements_p);
 
-        /* 9.a */
-        if (ecma_op_object_get_property (obj_p, idx_str_p) != NULL)
+        for (; from_idx < len; from_idx++)
         {
-          /* 9.b.i */
-          ECMA_TRY_CATCH (get_value, ecma_op_object_get (obj_p, idx_str_p), ret_value);
-
           /* 9.b.ii */
-          if (ecma_op_strict_equality_compare (arg1, get_value))
+          if (ecma_op_strict_equality_compare (arg1, values_p[from_idx]))
           {
             *num_p = ecma_uint32_to_number (from_idx);
+            break;
           }
-
-          ECMA_FINALIZE (get_value);
         }
+      }
+      else
+      {
+        for (; from_idx < len && *num_p < 0 && ecma_is_completion_value_empty (ret_value); from_idx++)
+        {
+          ecma_string_t *idx_str_p = ecma_new_ecma_string_from_uint32 (from_idx);
 
-        ecma_deref_ecma_string (idx_str_p);
+          /* 9.a */
+          if (ecma_op_object_has_property (obj_p, idx_str_p))
+          {
+            /* 9.b.i */
+            ECMA_TRY_CATCH (get_value, ecma_op_object_get (obj_p, idx_str_p), ret_value);
+
+            /* 9.b.ii */
+            if (ecma_op_strict_equality_compare (arg1, get_value))
+            {
+              *num_p = ecma_uint32_to_number (from_idx);
+            }
+
+            ECMA_FINALIZE (get_value);
+          }
+
+          ecma_deref_ecma_string (idx_str_p);
+        }
       }
 
       if (ecma_is_completion_value_empty (ret_value))
@@ -1046,311 +1196,793 @@ ecma_builtin_array_prototype_object_last_index_of (ecma_value_t this_arg, /**< t
       }
       else
       {
-        from_idx = 0;
+        from_idx = 0;
+      }
+
+      ECMA_OP_TO_NUMBER_FINALIZE (arg_from_idx);
+    }
+
+    /* 8.
+     * We should break from the loop when from_idx < 0. We can still use an uint32_t for from_idx, and check
+     * for an underflow instead. This is safe, because from_idx will always start in [0, len - 1],
+     * and len is in [0, UINT_MAX], so from_idx >= len means we've had an underflow, and should stop.
+     */
+    for (; from_idx < len && *num_p < 0 && ecma_is_completion_value_empty (ret_value); from_idx--)
+    {
+      /* 8.a */
+      ecma_string_t *idx_str_p = ecma_new_ecma_string_from_uint32 (from_idx);
+
+      /* 8.a */
+      if (ecma_op_object_has_property (obj_p, idx_str_p))
+      {
+        /* 8.b.i */
+        ECMA_TRY_CATCH (get_value, ecma_op_object_get (obj_p, idx_str_p), ret_value);
+
+        /* 8.b.ii */
+        if (ecma_op_strict_equality_compare (arg1, get_value))
+        {
+          *num_p = ecma_uint32_to_number (from_idx);
+        }
+
+        ECMA_FINALIZE (get_value);
+      }
+
+      ecma_deref_ecma_string (idx_str_p);
+    }
+
+    if (ecma_is_completion_value_empty (ret_value))
+    {
+      ret_value = ecma_make_normal_completion_value (ecma_make_number_value (num_p));
+    }
+    else
+    {
+      ecma_dealloc_number (num_p);
+    }
+  }
+
+  ECMA_OP_TO_NUMBER_FINALIZE (len_number);
+  ECMA_FINALIZE (len_value);
+  ecma_deref_ecma_string (magic_string_length_p);
+  ECMA_FINALIZE (obj_this);
+
+  return ret_value;
+} /* ecma_builtin_array_prototype_object_last_index_of */
+
+/**
+ * Maximum number of pending runs in merge sort of Array.prototype.sort
+ *
+ * Lengths of pending runs grow at least as fast as Fibonacci numbers, so the number
+ * is enough for sorting any number of elements, representable with uint32_t.
+ */
+#define ECMA_BUILTIN_ARRAY_SORT_MAX_RUNS 64
+
+/**
+ * Minimum length of a run in merge sort of Array.prototype.sort
+ *
+ * Shorter arrays are sorted with binary insertion sort.
+ */
+#define ECMA_BUILTIN_ARRAY_SORT_MIN_MERGE 32
+
+/**
+ * Ways to compare elements in Array.prototype.sort
+ */
+typedef enum
+{
+  ECMA_BUILTIN_ARRAY_SORT_BY_COMPARE_FUNCTION, /**< elements are compared by the compare function */
+  ECMA_BUILTIN_ARRAY_SORT_BY_INTEGER_VALUE, /**< all elements are integer numbers, that are compared
+                                             *   as their string representations, without converting them */
+  ECMA_BUILTIN_ARRAY_SORT_BY_STRING_KEY /**< elements are compared by UTF-8 representations of their
+                                         *   string values, that are converted once per element */
+} ecma_builtin_array_sort_mode_t;
+
+/**
+ * State of Array.prototype.sort
+ */
+typedef struct
+{
+  ecma_builtin_array_sort_mode_t mode; /**< way to compare elements */
+  ecma_value_t comparefn; /**< compare function (ECMA_BUILTIN_ARRAY_SORT_BY_COMPARE_FUNCTION mode) */
+  const ecma_value_t *values_p; /**< values to sort */
+  const lit_utf8_byte_t *keys_p; /**< UTF-8 representations of the values' string values, stored one after another
+                                  *   (ECMA_BUILTIN_ARRAY_SORT_BY_STRING_KEY mode) */
+  const lit_utf8_size_t *key_offsets_p; /**< offsets of the values' keys (the last offset is offset
+                                         *   of the keys' end) */
+  uint32_t *order_p; /**< indices of the values, that are reordered by the sort */
+  uint32_t *merge_buffer_p; /**< buffer for merging runs, that holds half of the indices */
+  uint32_t runs_number; /**< number of pending runs */
+  uint32_t run_base[ECMA_BUILTIN_ARRAY_SORT_MAX_RUNS]; /**< start positions of pending runs */
+  uint32_t run_length[ECMA_BUILTIN_ARRAY_SORT_MAX_RUNS]; /**< lengths of pending runs */
+} ecma_array_sort_state_t;
+
+/**
+ * Compare string representations of two integer numbers without converting the numbers to strings
+ *
+ * @return true - if string representation of the left number is less than representation of the right one,
+ *         false - otherwise.
+ */
+static bool
+ecma_builtin_array_prototype_object_sort_is_integer_string_less (ecma_integer_value_t left, /**< left number */
+                                                                 ecma_integer_value_t right) /**< right number */
+{
+  if ((left < 0) != (right < 0))
+  {
+    /* '-' is less than any digit */
+    return (left < 0);
+  }
+
+  /* representations of negative numbers have same prefix, so the numbers' absolute values are compared */
+  uint64_t left_abs = (uint64_t) (left < 0 ? -(int64_t) left : left);
+  uint64_t right_abs = (uint64_t) (right < 0 ? -(int64_t) right : right);
+
+  uint64_t left_digits_limit = 10, right_digits_limit = 10;
+
+  while (left_abs >= left_digits_limit)
+  {
+    left_digits_limit *= 10;
+  }
+
+  while (right_abs >= right_digits_limit)
+  {
+    right_digits_limit *= 10;
+  }
+
+  /*
+   * The number with less digits is padded with zeroes to length of the other one, so the numbers
+   * compare in same way, as their representations, except for the case, when the shorter representation
+   * is prefix of the longer one, and is, so, less than the longer one.
+   */
+  if (left_digits_limit < right_digits_limit)
+  {
+    return (left_abs * (right_digits_limit / left_digits_limit) <= right_abs);
+  }
+  else
+  {
+    return (left_abs < right_abs * (left_digits_limit / right_digits_limit));
+  }
+} /* ecma_builtin_array_prototype_object_sort_is_integer_string_less */
+
+/**
+ * SortCompare abstract method for values, that are not undefined
+ *
+ * See also:
+ *          ECMA-262 v5, 15.4.4.11
+ *
+ * @return empty completion value - if the values are compared successfully (out_is_greater_p is set
+ *                                  to true, if the left value should be placed after the right one),
+ *         throw completion value - otherwise.
+ *         Returned value must be freed with ecma_free_completion_value.
+ */
+static ecma_completion_value_t
+ecma_builtin_array_prototype_object_sort_compare (const ecma_array_sort_state_t *state_p, /**< sort state */
+                                                  uint32_t left_index, /**< index of the left value */
+                                                  uint32_t right_index, /**< index of the right value */
+                                                  bool *out_is_greater_p) /**< out: comparison result */
+{
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  const ecma_value_t left_value = state_p->values_p[left_index];
+  const ecma_value_t right_value = state_p->values_p[right_index];
+
+  switch (state_p->mode)
+  {
+    case ECMA_BUILTIN_ARRAY_SORT_BY_INTEGER_VALUE:
+    {
+      const ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
+      const ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
+
+      *out_is_greater_p = ecma_builtin_array_prototype_object_sort_is_integer_string_less (right_integer,
+                                                                                            left_integer);
+      break;
+    }
+    case ECMA_BUILTIN_ARRAY_SORT_BY_STRING_KEY:
+    {
+      const lit_utf8_size_t *offsets_p = state_p->key_offsets_p;
+
+      *out_is_greater_p = lit_compare_utf8_strings_relational (state_p->keys_p + offsets_p[right_index],
+                                                               offsets_p[right_index + 1] - offsets_p[right_index],
+                                                               state_p->keys_p + offsets_p[left_index],
+                                                               offsets_p[left_index + 1] - offsets_p[left_index]);
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (state_p->mode == ECMA_BUILTIN_ARRAY_SORT_BY_COMPARE_FUNCTION);
+      JERRY_ASSERT (ecma_op_is_callable (state_p->comparefn));
+
+      ecma_value_t compare_args[] = { left_value, right_value };
+
+      ECMA_TRY_CATCH (call_value,
+                      ecma_op_function_call (ecma_get_object_from_value (state_p->comparefn),
+                                             ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED),
+                                             compare_args,
+                                             2),
+                      ret_value);
+
+      ECMA_OP_TO_NUMBER_TRY_CATCH (result_num, call_value, ret_value);
+
+      /* NaN is treated as +0 */
+      *out_is_greater_p = (result_num > ECMA_NUMBER_ZERO);
+
+      ECMA_OP_TO_NUMBER_FINALIZE (result_num);
+      ECMA_FINALIZE (call_value);
+      break;
+    }
+  }
+
+  return ret_value;
+} /* ecma_builtin_array_prototype_object_sort_compare */
+
+/**
+ * Sort part of the indices with binary insertion sort
+ *
+ * @return empty completion value - if the part is sorted,
+ *         throw completion value - otherwise.
+ *         Returned value must be freed with ecma_free_completion_value.
+ */
+static ecma_completion_value_t
+ecma_builtin_array_prototype_object_sort_insertion (const ecma_array_sort_state_t *state_p, /**< sort state */
+                                                    uint32_t start, /**< start of the part */
+                                                    uint32_t sorted_end, /**< end of the part's sorted prefix */
+                                                    uint32_t end) /**< end of the part */
+{
+  uint32_t *order_p = state_p->order_p;
+
+  for (uint32_t pos = sorted_end; pos < end; pos++)
+  {
+    const uint32_t pivot = order_p[pos];
+
+    /* the pivot is placed after all elements, that are not greater, so equal elements keep their order */
+    uint32_t left = start, right = pos;
+
+    while (left < right)
+    {
+      const uint32_t middle = left + (right - left) / 2;
+      bool is_greater;
+
+      ecma_completion_value_t compare_completion = ecma_builtin_array_prototype_object_sort_compare (state_p,
+                                                                                                    order_p[middle],
+                                                                                                    pivot,
+                                                                                                    &is_greater);
+
+      if (!ecma_is_completion_value_empty (compare_completion))
+      {
+        return compare_completion;
+      }
+
+      if (is_greater)
+      {
+        right = middle;
+      }
+      else
+      {
+        left = middle + 1;
+      }
+    }
+
+    memmove (order_p + left + 1, order_p + left, (pos - left) * sizeof (uint32_t));
+    order_p[left] = pivot;
+  }
+
+  return ecma_make_empty_completion_value ();
+} /* ecma_builtin_array_prototype_object_sort_insertion */
+
+/**
+ * Find length of the run, starting at the specified position; a strictly descending run is reversed,
+ * so that the run becomes ascending without breaking stability
+ *
+ * @return empty completion value - if the run is found (out_length_p is set to its length),
+ *         throw completion value - otherwise.
+ *         Returned value must be freed with ecma_free_completion_value.
+ */
+static ecma_completion_value_t
+ecma_builtin_array_prototype_object_sort_count_run (const ecma_array_sort_state_t *state_p, /**< sort state */
+                                                    uint32_t start, /**< start of the run */
+                                                    uint32_t end, /**< end of the indices */
+                                                    uint32_t *out_length_p) /**< out: length of the run */
+{
+  JERRY_ASSERT (start < end);
+
+  uint32_t *order_p = state_p->order_p;
+  uint32_t pos = start + 1;
+
+  if (pos == end)
+  {
+    *out_length_p = 1;
+    return ecma_make_empty_completion_value ();
+  }
+
+  bool is_greater;
+  ecma_completion_value_t compare_completion = ecma_builtin_array_prototype_object_sort_compare (state_p,
+                                                                                                order_p[start],
+                                                                                                order_p[pos],
+                                                                                                &is_greater);
+
+  if (!ecma_is_completion_value_empty (compare_completion))
+  {
+    return compare_completion;
+  }
+
+  const bool is_descending = is_greater;
+
+  for (pos++; pos < end; pos++)
+  {
+    compare_completion = ecma_builtin_array_prototype_object_sort_compare (state_p,
+                                                                           order_p[pos - 1],
+                                                                           order_p[pos],
+                                                                           &is_greater);
+
+    if (!ecma_is_completion_value_empty (compare_completion))
+    {
+      return compare_completion;
+    }
+
+    if (is_greater != is_descending)
+    {
+      break;
+    }
+  }
+
+  if (is_descending)
+  {
+    for (uint32_t left = start, right = pos - 1; left < right; left++, right--)
+    {
+      const uint32_t swap = order_p[left];
+      order_p[left] = order_p[right];
+      order_p[right] = swap;
+    }
+  }
+
+  *out_length_p = pos - start;
+
+  return ecma_make_empty_completion_value ();
+} /* ecma_builtin_array_prototype_object_sort_count_run */
+
+/**
+ * Merge two adjacent pending runs, with indices run_index and run_index + 1
+ *
+ * Elements of the first run, that are not greater than the second run's first element, and elements
+ * of the second run, that are not less than the first run's last element, are already in place,
+ * so only the rest is merged, through a buffer, holding the shorter of the remaining parts.
+ *
+ * @return empty completion value - if the runs are merged,
+ *         throw completion value - otherwise.
+ *         Returned value must be freed with ecma_free_completion_value.
+ */
+static ecma_completion_value_t
+ecma_builtin_array_prototype_object_sort_merge_runs (ecma_array_sort_state_t *state_p, /**< sort state */
+                                                     uint32_t run_index) /**< index of the first run */
+{
+  JERRY_ASSERT (run_index + 1 < state_p->runs_number);
+
+  uint32_t *order_p = state_p->order_p;
+  uint32_t *buffer_p = state_p->merge_buffer_p;
+
+  uint32_t base1 = state_p->run_base[run_index];
+  uint32_t length1 = state_p->run_length[run_index];
+  const uint32_t base2 = state_p->run_base[run_index + 1];
+  uint32_t length2 = state_p->run_length[run_index + 1];
+
+  JERRY_ASSERT (base1 + length1 == base2);
+
+  state_p->run_length[run_index] = length1 + length2;
+
+  for (uint32_t i = run_index + 1; i + 1 < state_p->runs_number; i++)
+  {
+    state_p->run_base[i] = state_p->run_base[i + 1];
+    state_p->run_length[i] = state_p->run_length[i + 1];
+  }
+
+  state_p->runs_number--;
+
+  ecma_completion_value_t compare_completion;
+  bool is_greater;
+
+  /* skip elements of the first run, that are not greater than the second run's first element */
+  uint32_t left = 0, right = length1;
+
+  while (left < right)
+  {
+    const uint32_t middle = left + (right - left) / 2;
+
+    compare_completion = ecma_builtin_array_prototype_object_sort_compare (state_p,
+                                                                           order_p[base1 + middle],
+                                                                           order_p[base2],
+                                                                           &is_greater);
+
+    if (!ecma_is_completion_value_empty (compare_completion))
+    {
+      return compare_completion;
+    }
+
+    if (is_greater)
+    {
+      right = middle;
+    }
+    else
+    {
+      left = middle + 1;
+    }
+  }
+
+  base1 += left;
+  length1 -= left;
+
+  if (length1 == 0)
+  {
+    return ecma_make_empty_completion_value ();
+  }
+
+  /* skip elements of the second run, that are not less than the first run's last element */
+  const uint32_t last1 = order_p[base1 + length1 - 1];
+
+  left = 0;
+  right = length2;
+
+  while (left < right)
+  {
+    const uint32_t middle = left + (right - left) / 2;
+
+    compare_completion = ecma_builtin_array_prototype_object_sort_compare (state_p,
+                                                                           last1,
+                                                                           order_p[base2 + middle],
+                                                                           &is_greater);
+
+    if (!ecma_is_completion_value_empty (compare_completion))
+    {
+      return compare_completion;
+    }
+
+    if (is_greater)
+    {
+      left = middle + 1;
+    }
+    else
+    {
+      right = middle;
+    }
+  }
+
+  length2 = left;
+
+  if (length2 == 0)
+  {
+    return ecma_make_empty_completion_value ();
+  }
+
+  /*
+   * Elements, that are taken from the buffer upon equality, are taken from the first run,
+   * so equal elements keep their order. Upon an exception, the sort is stopped, and the order
+   * of the indices is not used, so it is not restored.
+   */
+  if (length1 <= length2)
+  {
+    /* merge from the start, buffering the first run */
+    memcpy (buffer_p, order_p + base1, length1 * sizeof (uint32_t));
+
+    uint32_t dest = base1, pos1 = 0, pos2 = base2;
+    const uint32_t end2 = base2 + length2;
+
+    while (pos1 < length1 && pos2 < end2)
+    {
+      compare_completion = ecma_builtin_array_prototype_object_sort_compare (state_p,
+                                                                             buffer_p[pos1],
+                                                                             order_p[pos2],
+                                                                             &is_greater);
+
+      if (!ecma_is_completion_value_empty (compare_completion))
+      {
+        return compare_completion;
       }
 
-      ECMA_OP_TO_NUMBER_FINALIZE (arg_from_idx);
+      order_p[dest++] = (is_greater ? order_p[pos2++] : buffer_p[pos1++]);
     }
 
-    /* 8.
-     * We should break from the loop when from_idx < 0. We can still use an uint32_t for from_idx, and check
-     * for an underflow instead. This is safe, because from_idx will always start in [0, len - 1],
-     * and len is in [0, UINT_MAX], so from_idx >= len means we've had an underflow, and should stop.
-     */
-    for (; from_idx < len && *num_p < 0 && ecma_is_completion_value_empty (ret_value); from_idx--)
-    {
-      /* 8.a */
-      ecma_string_t *idx_str_p = ecma_new_ecma_string_from_uint32 (from_idx);
+    memcpy (order_p + dest, buffer_p + pos1, (length1 - pos1) * sizeof (uint32_t));
+  }
+  else
+  {
+    /* merge from the end, buffering the second run */
+    memcpy (buffer_p, order_p + base2, length2 * sizeof (uint32_t));
 
-      /* 8.a */
-      if (ecma_op_object_get_property (obj_p, idx_str_p) != NULL)
-      {
-        /* 8.b.i */
-        ECMA_TRY_CATCH (get_value, ecma_op_object_get (obj_p, idx_str_p), ret_value);
+    uint32_t dest = base2 + length2, pos1 = base2, pos2 = length2;
 
-        /* 8.b.ii */
-        if (ecma_op_strict_equality_compare (arg1, get_value))
-        {
-          *num_p = ecma_uint32_to_number (from_idx);
-        }
+    while (pos1 > base1 && pos2 > 0)
+    {
+      compare_completion = ecma_builtin_array_prototype_object_sort_compare (state_p,
+                                                                             order_p[pos1 - 1],
+                                                                             buffer_p[pos2 - 1],
+                                                                             &is_greater);
 
-        ECMA_FINALIZE (get_value);
+      if (!ecma_is_completion_value_empty (compare_completion))
+      {
+        return compare_completion;
       }
 
-      ecma_deref_ecma_string (idx_str_p);
+      order_p[--dest] = (is_greater ? order_p[--pos1] : buffer_p[--pos2]);
     }
 
-    if (ecma_is_completion_value_empty (ret_value))
+    memcpy (order_p + dest - pos2, buffer_p, pos2 * sizeof (uint32_t));
+  }
+
+  return ecma_make_empty_completion_value ();
+} /* ecma_builtin_array_prototype_object_sort_merge_runs */
+
+/**
+ * Merge pending runs, until their lengths satisfy the invariants:
+ *   run_length[i - 2] > run_length[i - 1] + run_length[i] and run_length[i - 1] > run_length[i],
+ * so that the merged runs have similar lengths; if is_force is true, all pending runs are merged
+ *
+ * @return empty completion value - if the runs are merged,
+ *         throw completion value - otherwise.
+ *         Returned value must be freed with ecma_free_completion_value.
+ */
+static ecma_completion_value_t
+ecma_builtin_array_prototype_object_sort_collapse_runs (ecma_array_sort_state_t *state_p, /**< sort state */
+                                                        bool is_force) /**< merge all runs */
+{
+  const uint32_t *run_length = state_p->run_length;
+
+  while (state_p->runs_number > 1)
+  {
+    uint32_t n = state_p->runs_number - 2;
+
+    if (is_force)
     {
-      ret_value = ecma_make_normal_completion_value (ecma_make_number_value (num_p));
+      if (n > 0 && run_length[n - 1] < run_length[n + 1])
+      {
+        n--;
+      }
     }
-    else
+    else if ((n > 0 && run_length[n - 1] <= run_length[n] + run_length[n + 1])
+             || (n > 1 && run_length[n - 2] <= run_length[n - 1] + run_length[n]))
     {
-      ecma_dealloc_number (num_p);
+      if (run_length[n - 1] < run_length[n + 1])
+      {
+        n--;
+      }
+    }
+    else if (run_length[n] > run_length[n + 1])
+    {
+      break;
     }
-  }
 
-  ECMA_OP_TO_NUMBER_FINALIZE (len_number);
-  ECMA_FINALIZE (len_value);
-  ecma_deref_ecma_string (magic_string_length_p);
-  ECMA_FINALIZE (obj_this);
+    ecma_completion_value_t merge_completion = ecma_builtin_array_prototype_object_sort_merge_runs (state_p, n);
 
-  return ret_value;
-} /* ecma_builtin_array_prototype_object_last_index_of */
+    if (!ecma_is_completion_value_empty (merge_completion))
+    {
+      return merge_completion;
+    }
+  }
+
+  return ecma_make_empty_completion_value ();
+} /* ecma_builtin_array_prototype_object_sort_collapse_runs */
 
 /**
- * SortCompare abstract method
+ * Sort the indices with stable adaptive merge sort
  *
- * See also:
- *          ECMA-262 v5, 15.4.4.11
+ * Already ordered (or reversely ordered) runs of elements are found and merged, so that partially sorted
+ * arrays are sorted with less comparisons; short runs are extended with binary insertion sort.
  *
- * @return completion value
+ * @return empty completion value - if the indices are sorted,
+ *         throw completion value - otherwise.
  *         Returned value must be freed with ecma_free_completion_value.
  */
 static ecma_completion_value_t
-ecma_builtin_array_prototype_object_sort_compare_helper (ecma_value_t j, /**< left value */
-                                                         ecma_value_t k, /**< right value */
-                                                         ecma_value_t comparefn) /**< compare function */
+ecma_builtin_array_prototype_object_sort_merge_sort (ecma_array_sort_state_t *state_p, /**< sort state */
+                                                     uint32_t number) /**< number of the indices */
 {
-  /*
-   * ECMA-262 v5, 15.4.4.11 NOTE1: Because non-existent property values always
-   * compare greater than undefined property values, and undefined always
-   * compares greater than any other value, undefined property values always
-   * sort to the end of the result, followed by non-existent property values.
-   */
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
-  ecma_number_t *result_p = ecma_alloc_number ();
 
-  bool j_is_undef = ecma_is_value_undefined (j);
-  bool k_is_undef = ecma_is_value_undefined (k);
+  /* minimum length of runs, so that the number of runs is equal to, or a bit less than, a power of two */
+  uint32_t min_run_length = number;
+  uint32_t is_remainder = 0;
 
-  if (j_is_undef)
+  while (min_run_length >= 2 * ECMA_BUILTIN_ARRAY_SORT_MIN_MERGE)
   {
-    if (k_is_undef)
-    {
-      *result_p = ecma_int32_to_number (0);
-    }
-    else
-    {
-      *result_p = ecma_int32_to_number (1);
-    }
+    is_remainder |= (min_run_length & 1u);
+    min_run_length >>= 1;
   }
-  else
+
+  min_run_length += is_remainder;
+
+  state_p->runs_number = 0;
+
+  for (uint32_t start = 0; start < number && ecma_is_completion_value_empty (ret_value); )
   {
-    if (k_is_undef)
+    uint32_t run_length = 0;
+
+    ret_value = ecma_builtin_array_prototype_object_sort_count_run (state_p, start, number, &run_length);
+
+    if (ecma_is_completion_value_empty (ret_value)
+        && run_length < min_run_length)
     {
-      *result_p = ecma_int32_to_number (-1);
+      const uint32_t extended_length = JERRY_MIN (min_run_length, number - start);
+
+      ret_value = ecma_builtin_array_prototype_object_sort_insertion (state_p,
+                                                                      start,
+                                                                      start + run_length,
+                                                                      start + extended_length);
+      run_length = extended_length;
     }
-    else
-    {
-      if (ecma_is_value_undefined (comparefn))
-      {
-        /* Default comparison when no comparefn is passed. */
-        ECMA_TRY_CATCH (j_value, ecma_op_to_string (j), ret_value);
-        ECMA_TRY_CATCH (k_value, ecma_op_to_string (k), ret_value);
-        ecma_string_t *j_str_p = ecma_get_string_from_value (j_value);
-        ecma_string_t *k_str_p = ecma_get_string_from_value (k_value);
 
-        if (ecma_compare_ecma_strings_relational (j_str_p, k_str_p))
-        {
-          *result_p = ecma_int32_to_number (-1);
-        }
-        else if (!ecma_compare_ecma_strings (j_str_p, k_str_p))
-        {
-          *result_p = ecma_int32_to_number (1);
-        }
-        else
-        {
-          *result_p = ecma_int32_to_number (0);
-        }
+    if (ecma_is_completion_value_empty (ret_value))
+    {
+      JERRY_ASSERT (state_p->runs_number < ECMA_BUILTIN_ARRAY_SORT_MAX_RUNS);
 
-        ECMA_FINALIZE (k_value);
-        ECMA_FINALIZE (j_value);
-      }
-      else
-      {
-        /*
-         * comparefn, if not undefined, will always contain a callable function object.
-         * We checked this previously, before this function was called.
-         */
-        JERRY_ASSERT (ecma_op_is_callable (comparefn));
-        ecma_object_t *comparefn_obj_p = ecma_get_object_from_value (comparefn);
-
-        ecma_value_t compare_args[] = {j, k};
-
-        ECMA_TRY_CATCH (call_value,
-                        ecma_op_function_call (comparefn_obj_p,
-                                               ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED),
-                                               compare_args,
-                                               2),
-                        ret_value);
+      state_p->run_base[state_p->runs_number] = start;
+      state_p->run_length[state_p->runs_number] = run_length;
+      state_p->runs_number++;
 
-        if (!ecma_is_value_number (call_value))
-        {
-          ECMA_OP_TO_NUMBER_TRY_CATCH (ret_num, call_value, ret_value);
-          *result_p = ret_num;
-          ECMA_OP_TO_NUMBER_FINALIZE (ret_num);
-        }
-        else
-        {
-          *result_p = *ecma_get_number_from_value (call_value);
-        }
+      ret_value = ecma_builtin_array_prototype_object_sort_collapse_runs (state_p, false);
 
-        ECMA_FINALIZE (call_value);
-      }
+      start += run_length;
     }
   }
 
   if (ecma_is_completion_value_empty (ret_value))
   {
-    ret_value = ecma_make_normal_completion_value (ecma_make_number_value (result_p));
-  }
-  else
-  {
-    ecma_dealloc_number (result_p);
+    ret_value = ecma_builtin_array_prototype_object_sort_collapse_runs (state_p, true);
   }
 
   return ret_value;
-} /* ecma_builtin_array_prototype_object_sort_compare_helper */
+} /* ecma_builtin_array_prototype_object_sort_merge_sort */
 
 /**
- * Function used to reconstruct the ordered binary tree.
- * Shifts 'index' down in the tree until it is in the correct position.
+ * Sort values, that are not undefined, in place
+ *
+ * If compare function is not specified, the values are compared by their string values, that are converted
+ * to UTF-8 once per value (integer numbers are compared without the conversion); otherwise, the compare
+ * function is called for the values.
  *
  * @return completion value
  *         Returned value must be freed with ecma_free_completion_value.
  */
 static ecma_completion_value_t
-ecma_builtin_array_prototype_object_array_to_heap_helper (ecma_value_t array[], /**< heap data array */
-                                                          int index, /**< current item index */
-                                                          int right, /**< right index is a maximum index */
-                                                          ecma_value_t comparefn) /**< compare function */
+ecma_builtin_array_prototype_object_sort_values (ecma_value_t *values_p, /**< values to sort */
+                                                 uint32_t number, /**< number of the values */
+                                                 ecma_value_t comparefn) /**< compare function */
 {
+  JERRY_ASSERT (number > 1);
+
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
 
-  /* Left child of the current index. */
-  int child = index * 2 + 1;
-  ecma_value_t swap = array[index];
-  bool should_break = false;
+  ecma_array_sort_state_t state;
+  state.mode = ECMA_BUILTIN_ARRAY_SORT_BY_COMPARE_FUNCTION;
+  state.comparefn = comparefn;
+  state.values_p = values_p;
+  state.keys_p = NULL;
+  state.key_offsets_p = NULL;
 
-  while (child <= right && ecma_is_completion_value_empty (ret_value) && !should_break)
+  if (ecma_is_value_undefined (comparefn))
   {
-    if (child < right)
-    {
-      /* Compare the two child nodes. */
-      ECMA_TRY_CATCH (child_compare_value,
-                      ecma_builtin_array_prototype_object_sort_compare_helper (array[child],
-                                                                               array[child + 1],
-                                                                               comparefn),
-                      ret_value);
-
-      JERRY_ASSERT (ecma_is_value_number (child_compare_value));
+    state.mode = ECMA_BUILTIN_ARRAY_SORT_BY_INTEGER_VALUE;
 
-      /* Use the child that is greater. */
-      if (*ecma_get_number_from_value (child_compare_value) < ECMA_NUMBER_ZERO)
+    for (uint32_t index = 0; index < number; index++)
+    {
+      if (!ecma_is_value_integer_number (values_p[index]))
       {
-        child++;
+        state.mode = ECMA_BUILTIN_ARRAY_SORT_BY_STRING_KEY;
+        break;
       }
+    }
+  }
+
+  MEM_DEFINE_LOCAL_ARRAY (key_offsets, state.mode == ECMA_BUILTIN_ARRAY_SORT_BY_STRING_KEY ? number + 1 : 0,
+                          lit_utf8_size_t);
+  lit_utf8_byte_t *keys_p = NULL;
+  lit_utf8_size_t keys_size = 0;
+
+  if (state.mode == ECMA_BUILTIN_ARRAY_SORT_BY_STRING_KEY)
+  {
+    /* ToString is performed once per value, and the strings are converted to UTF-8 at once */
+    MEM_DEFINE_LOCAL_ARRAY (key_strings, number, ecma_value_t);
+
+    uint32_t converted_number = 0;
+
+    for (uint32_t index = 0; index < number && ecma_is_completion_value_empty (ret_value); index++)
+    {
+      ECMA_TRY_CATCH (key_value, ecma_op_to_string (values_p[index]), ret_value);
+
+      key_strings[index] = ecma_copy_value (key_value, true);
+      converted_number++;
 
-      ECMA_FINALIZE (child_compare_value);
+      key_offsets[index] = keys_size;
+      keys_size += ecma_string_get_size (ecma_get_string_from_value (key_value));
+
+      ECMA_FINALIZE (key_value);
     }
 
     if (ecma_is_completion_value_empty (ret_value))
     {
-      JERRY_ASSERT (child <= right);
-
-      /* Compare current child node with the swap (tree top). */
-      ECMA_TRY_CATCH (swap_compare_value,
-                      ecma_builtin_array_prototype_object_sort_compare_helper (array[child],
-                                                                               swap,
-                                                                               comparefn),
-                      ret_value);
-      JERRY_ASSERT (ecma_is_value_number (swap_compare_value));
+      key_offsets[number] = keys_size;
 
-      if (*ecma_get_number_from_value (swap_compare_value) <= ECMA_NUMBER_ZERO)
+      if (keys_size != 0)
       {
-        /* Break from loop if current child is less than swap (tree top) */
-        should_break = true;
+        keys_p = (lit_utf8_byte_t *) mem_heap_alloc_block (keys_size, MEM_HEAP_ALLOC_SHORT_TERM);
       }
-      else
+
+      for (uint32_t index = 0; index < number; index++)
       {
-        /* We have to move 'swap' lower in the tree, so shift current child up in the hierarchy. */
-        int parent = (child - 1) / 2;
-        JERRY_ASSERT (parent >= 0 && parent <= right);
-        array[parent] = array[child];
+        const lit_utf8_size_t key_size = key_offsets[index + 1] - key_offsets[index];
 
-        /* Update child to be the left child of the current node. */
-        child = child * 2 + 1;
+        if (key_size != 0)
+        {
+          ssize_t bytes_copied = ecma_string_to_utf8_string (ecma_get_string_from_value (key_strings[index]),
+                                                             keys_p + key_offsets[index],
+                                                             (ssize_t) key_size);
+          JERRY_ASSERT (bytes_copied == (ssize_t) key_size);
+        }
       }
+    }
 
-      ECMA_FINALIZE (swap_compare_value);
+    for (uint32_t index = 0; index < converted_number; index++)
+    {
+      ecma_free_value (key_strings[index], true);
     }
+
+    MEM_FINALIZE_LOCAL_ARRAY (key_strings);
+
+    state.keys_p = keys_p;
+    state.key_offsets_p = key_offsets;
   }
 
   if (ecma_is_completion_value_empty (ret_value))
   {
-    /*
-     * Loop ended, either current child does not exist, or is less than swap.
-     * This means that 'swap' should be placed in the parent node.
-     */
-    int parent = (child - 1) / 2;
-    JERRY_ASSERT (parent >= 0 && parent <= right);
-    array[parent] = swap;
+    MEM_DEFINE_LOCAL_ARRAY (order, number, uint32_t);
+    MEM_DEFINE_LOCAL_ARRAY (merge_buffer, number / 2, uint32_t);
 
-    ret_value = ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_UNDEFINED);
-  }
+    for (uint32_t index = 0; index < number; index++)
+    {
+      order[index] = index;
+    }
 
-  return ret_value;
-} /* ecma_builtin_array_prototype_object_array_to_heap_helper */
+    state.order_p = order;
+    state.merge_buffer_p = merge_buffer;
 
-/**
- * Heapsort function
- *
- * @return completion value
- *         Returned value must be freed with ecma_free_completion_value.
- */
-static ecma_completion_value_t
-ecma_builtin_array_prototype_object_array_heap_sort_helper (ecma_value_t array[], /**< array to sort */
-                                                            int right, /**< right index */
-                                                            ecma_value_t comparefn) /**< compare function */
-{
-  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+    ret_value = ecma_builtin_array_prototype_object_sort_merge_sort (&state, number);
 
-  /* First, construct the ordered binary tree from the array. */
-  for (int i = right / 2; i >= 0 && ecma_is_completion_value_empty (ret_value); i--)
-  {
-    ECMA_TRY_CATCH (value,
-                    ecma_builtin_array_prototype_object_array_to_heap_helper (array,
-                                                                              i,
-                                                                              right,
-                                                                              comparefn),
-                    ret_value);
-    ECMA_FINALIZE (value);
+    if (ecma_is_completion_value_empty (ret_value))
+    {
+      /* the values are permuted in place, following cycles of the permutation */
+      for (uint32_t index = 0; index < number; index++)
+      {
+        if (order[index] == index)
+        {
+          continue;
+        }
+
+        const ecma_value_t first_value = values_p[index];
+        uint32_t pos = index;
+
+        while (order[pos] != index)
+        {
+          const uint32_t next_pos = order[pos];
+
+          values_p[pos] = values_p[next_pos];
+          order[pos] = pos;
+          pos = next_pos;
+        }
+
+        values_p[pos] = first_value;
+        order[pos] = pos;
+      }
+
+      ret_value = ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+    }
+
+    MEM_FINALIZE_LOCAL_ARRAY (merge_buffer);
+    MEM_FINALIZE_LOCAL_ARRAY (order);
   }
 
-  /* Sorting elements. */
-  for (int i = right; i > 0 && ecma_is_completion_value_empty (ret_value); i--)
+  if (keys_p != NULL)
   {
-    /*
-     * The top element will always contain the largest value.
-     * Move top to the end, and remove it from the tree.
-     */
-    ecma_value_t swap = array[0];
-    array[0] = array[i];
-    array[i] = swap;
-
-    /* Rebuild binary tree from the remaining elements. */
-    ECMA_TRY_CATCH (value,
-                    ecma_builtin_array_prototype_object_array_to_heap_helper (array,
-                                                                              0,
-                                                                              i - 1,
-                                                                              comparefn),
-                    ret_value);
-    ECMA_FINALIZE (value);
+    mem_heap_free_block (keys_p);
   }
 
+  MEM_FINALIZE_LOCAL_ARRAY (key_offsets);
+
   return ret_value;
-} /* ecma_builtin_array_prototype_object_array_heap_sort_helper */
+} /* ecma_builtin_array_prototype_object_sort_values */
 
 /**
  * The Array.prototype object's 'sort' routine
@@ -1390,35 +2022,70 @@ ecma_builtin_array_prototype_object_sort (ecma_value_t this_arg, /**< this argum
 
   MEM_DEFINE_LOCAL_ARRAY (values_buffer, len, ecma_value_t);
   uint32_t copied_num = 0;
+  uint32_t undefined_num = 0;
 
-  /* Copy unsorted array into a native c array. */
-  for (uint32_t index = 0; index < len && ecma_is_completion_value_empty (ret_value); index++)
+  /*
+   * Copy unsorted array into a native c array, leaving out undefined values,
+   * that always sort to the end of the result (ECMA-262 v5, 15.4.4.11 NOTE1).
+   */
+  ecma_fast_array_elements_t *elements_p = ecma_get_object_fast_elements (obj_p);
+
+  if (elements_p != NULL
+      && elements_p->length == len)
   {
-    ecma_string_t *index_string_p = ecma_new_ecma_string_from_uint32 (index);
-    ECMA_TRY_CATCH (index_value, ecma_op_object_get (obj_p, index_string_p), ret_value);
+    const ecma_value_t *elements_values_p = ECMA_FAST_ARRAY_ELEMENTS_GET_VALUES (elements_p);
+
+    for (uint32_t index = 0; index < len; index++)
+    {
+      if (ecma_is_value_undefined (elements_values_p[index]))
+      {
+        undefined_num++;
+      }
+      else
+      {
+        values_buffer[copied_num++] = ecma_copy_value (elements_values_p[index], true);
+      }
+    }
+  }
+  else
+  {
+    for (uint32_t index = 0; index < len && ecma_is_completion_value_empty (ret_value); index++)
+    {
+      ecma_string_t *index_string_p = ecma_new_ecma_string_from_uint32 (index);
+      ECMA_TRY_CATCH (index_value, ecma_op_object_get (obj_p, index_string_p), ret_value);
 
-    values_buffer[index] = ecma_copy_value (index_value, true);
-    copied_num++;
+      if (ecma_is_value_undefined (index_value))
+      {
+        undefined_num++;
+      }
+      else
+      {
+        values_buffer[copied_num++] = ecma_copy_value (index_value, true);
+      }
 
-    ECMA_FINALIZE (index_value);
-    ecma_deref_ecma_string (index_string_p);
+      ECMA_FINALIZE (index_value);
+      ecma_deref_ecma_string (index_string_p);
+    }
   }
 
-  JERRY_ASSERT (copied_num == len || !ecma_is_completion_value_empty (ret_value));
+  JERRY_ASSERT (copied_num + undefined_num == len || !ecma_is_completion_value_empty (ret_value));
 
   /* Sorting. */
-  if (len > 1 && ecma_is_completion_value_empty (ret_value))
+  if (copied_num > 1 && ecma_is_completion_value_empty (ret_value))
   {
     ECMA_TRY_CATCH (sort_value,
-                    ecma_builtin_array_prototype_object_array_heap_sort_helper (values_buffer,
-                                                                                (int)(len - 1),
-                                                                                arg1),
+                    ecma_builtin_array_prototype_object_sort_values (values_buffer, copied_num, arg1),
                     ret_value);
     ECMA_FINALIZE (sort_value);
   }
 
   if (ecma_is_completion_value_empty (ret_value))
   {
+    for (uint32_t index = copied_num; index < len; index++)
+    {
+      values_buffer[index] = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+    }
+
     /*
      * FIXME: Casting len to ecma_length_t may overflow, but since ecma_length_t is still at least
      * 16 bits long, with an array of that size, we would run out of memory way before this happens.
@@ -1503,7 +2170,7 @@ ecma_builtin_array_prototype_object_shift (ecma_value_t this_arg) /**< this argu
       ecma_string_t *to_str_p = ecma_new_ecma_string_from_uint32 (k - 1);
 
       /* 7.c */
-      if (ecma_op_object_get_property (obj_p, from_str_p) != NULL)
+      if (ecma_op_object_has_property (obj_p, from_str_p))
       {
         /* 7.d.i */
         ECMA_TRY_CATCH (curr_value, ecma_op_object_get (obj_p, from_str_p), ret_value);
@@ -1600,7 +2267,7 @@ ecma_builtin_array_prototype_object_unshift (ecma_value_t this_arg, /**< this ar
     ecma_string_t *to_str_p = ecma_new_ecma_string_from_uint32 (k + args_number - 1);
 
     /* 6.c */
-    if (ecma_op_object_get_property (obj_p, from_str_p) != NULL)
+    if (ecma_op_object_has_property (obj_p, from_str_p))
     {
       /* 6.d.i */
       ECMA_TRY_CATCH (get_value, ecma_op_object_get (obj_p, from_str_p), ret_value);
@@ -1708,15 +2375,15 @@ ecma_builtin_array_prototype_object_every (ecma_value_t this_arg, /**< this argu
     /* 7. */
     for (uint32_t index = 0; index < len && ecma_is_completion_value_empty (ret_value); index++)
     {
-      /* 7.a */
-      ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
+      /* 7.a, 7.c, 7.c.i */
+      bool is_present;
 
-      /* 7.c */
-      if (ecma_op_object_get_property (obj_p, index_str_p) != NULL)
-      {
-        /* 7.c.i */
-        ECMA_TRY_CATCH (get_value, ecma_op_object_get (obj_p, index_str_p), ret_value);
+      ECMA_TRY_CATCH (get_value,
+                      ecma_builtin_array_prototype_helper_get_element (obj_p, index, &is_present),
+                      ret_value);
 
+      if (is_present)
+      {
         *num_p = ecma_uint32_to_number (index);
         current_index = ecma_make_number_value (num_p);
 
@@ -1731,10 +2398,9 @@ ecma_builtin_array_prototype_object_every (ecma_value_t this_arg, /**< this argu
         }
 
         ECMA_FINALIZE (call_value);
-        ECMA_FINALIZE (get_value);
       }
 
-      ecma_deref_ecma_string (index_str_p);
+      ECMA_FINALIZE (get_value);
     }
 
     ecma_free_completion_value (to_object_comp);
@@ -1809,15 +2475,15 @@ ecma_builtin_array_prototype_object_some (ecma_value_t this_arg, /**< this argum
     /* 7. */
     for (uint32_t index = 0; index < len && ecma_is_completion_value_empty (ret_value); index++)
     {
-      /* 7.a */
-      ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
+      /* 7.a, 7.c, 7.c.i */
+      bool is_present;
 
-      /* 7.c */
-      if (ecma_op_object_get_property (obj_p, index_str_p) != NULL)
-      {
-        /* 7.c.i */
-        ECMA_TRY_CATCH (get_value, ecma_op_object_get (obj_p, index_str_p), ret_value);
+      ECMA_TRY_CATCH (get_value,
+                      ecma_builtin_array_prototype_helper_get_element (obj_p, index, &is_present),
+                      ret_value);
 
+      if (is_present)
+      {
         *num_p = ecma_uint32_to_number (index);
         current_index = ecma_make_number_value (num_p);
 
@@ -1832,10 +2498,9 @@ ecma_builtin_array_prototype_object_some (ecma_value_t this_arg, /**< this argum
         }
 
         ECMA_FINALIZE (call_value);
-        ECMA_FINALIZE (get_value);
       }
 
-      ecma_deref_ecma_string (index_str_p);
+      ECMA_FINALIZE (get_value);
     }
 
     ecma_free_completion_value (to_object_comp);
@@ -1916,15 +2581,15 @@ ecma_builtin_array_prototype_object_filter (ecma_value_t this_arg, /**< this arg
     /* 9. */
     for (uint32_t index = 0; index < len && ecma_is_completion_value_empty (ret_value); index++)
     {
-      /* 9.a */
-      ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
+      /* 9.a, 9.c, 9.c.i */
+      bool is_present;
 
-      /* 9.c */
-      if (ecma_op_object_get_property (obj_p, index_str_p) != NULL)
-      {
-        /* 9.c.i */
-        ECMA_TRY_CATCH (get_value, ecma_op_object_get (obj_p, index_str_p), ret_value);
+      ECMA_TRY_CATCH (get_value,
+                      ecma_builtin_array_prototype_helper_get_element (obj_p, index, &is_present),
+                      ret_value);
 
+      if (is_present)
+      {
         *num_p = ecma_uint32_to_number (index);
         current_index = ecma_make_number_value (num_p);
 
@@ -1935,28 +2600,14 @@ ecma_builtin_array_prototype_object_filter (ecma_value_t this_arg, /**< this arg
         /* 9.c.iii, ecma_op_to_boolean always returns a simple value, so no need to free. */
         if (ecma_is_completion_value_normal_true (ecma_op_to_boolean (call_value)))
         {
-          ecma_string_t* to_index_string_p = ecma_new_ecma_string_from_uint32 (new_array_index);
-          /*
-           * By definition we should use [[DefineOwnProperty]] here, but since [[Put]] will create the
-           * same property that we need, we can use it for simplicity. No need for a try-catch block
-           * since it is called with is_throw = false.
-          */
-          ecma_completion_value_t put_comp_value = ecma_op_object_put (new_array_p,
-                                                                       to_index_string_p,
-                                                                       get_value,
-                                                                       false);
-          JERRY_ASSERT (ecma_is_completion_value_normal_true (put_comp_value));
-          ecma_free_completion_value (put_comp_value);
-
-          ecma_deref_ecma_string (to_index_string_p);
+          ecma_builtin_array_prototype_helper_define_element (new_array_p, new_array_index, get_value);
           new_array_index++;
         }
 
         ECMA_FINALIZE (call_value);
-        ECMA_FINALIZE (get_value);
       }
 
-      ecma_deref_ecma_string (index_str_p);
+      ECMA_FINALIZE (get_value);
     }
 
     ecma_dealloc_number (num_p);
@@ -2053,7 +2704,7 @@ ecma_builtin_array_prototype_object_slice (ecma_value_t this_arg, /**< 'this' ar
     ecma_string_t *curr_idx_str_p = ecma_new_ecma_string_from_uint32 (k);
 
     /* 10.c */
-    if (ecma_op_object_get_property (obj_p, curr_idx_str_p) != NULL)
+    if (ecma_op_object_has_property (obj_p, curr_idx_str_p))
     {
       /* 10.c.i */
       ECMA_TRY_CATCH (get_value, ecma_op_object_get (obj_p, curr_idx_str_p), ret_value);
@@ -2194,7 +2845,7 @@ ecma_builtin_array_prototype_object_splice (ecma_value_t this_arg, /**< this arg
     ecma_string_t *idx_str_p = ecma_new_ecma_string_from_uint32 (del_item_idx);
 
     /* 9.b */
-    if (ecma_op_object_get_property (obj_p, idx_str_p) != NULL)
+    if (ecma_op_object_has_property (obj_p, idx_str_p))
     {
       /* 9.c.i */
       ECMA_TRY_CATCH (get_value,
@@ -2251,7 +2902,7 @@ ecma_builtin_array_prototype_object_splice (ecma_value_t this_arg, /**< this arg
         ecma_string_t *to_str_p = ecma_new_ecma_string_from_uint32 (to);
 
         /* 12.b.iii */
-        if (ecma_op_object_get_property (obj_p, from_str_p) != NULL)
+        if (ecma_op_object_has_property (obj_p, from_str_p))
         {
           /* 12.b.iv */
           ECMA_TRY_CATCH (get_value,
@@ -2304,7 +2955,7 @@ ecma_builtin_array_prototype_object_splice (ecma_value_t this_arg, /**< this arg
         ecma_string_t *to_str_p = ecma_new_ecma_string_from_uint32 (to);
 
         /* 13.b.iii */
-        if (ecma_op_object_get_property (obj_p, from_str_p) != NULL)
+        if (ecma_op_object_has_property (obj_p, from_str_p))
         {
           /* 13.b.iv */
           ECMA_TRY_CATCH (get_value,
@@ -2434,13 +3085,15 @@ ecma_builtin_array_prototype_object_map (ecma_value_t this_arg, /**< this argume
 
     for (uint32_t index = 0; index < len && ecma_is_completion_value_empty (ret_value); ++index)
     {
-      /* 8a */
-      ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
-      /* 8b */
-      if (ecma_op_object_get_property (obj_p, index_str_p) != NULL)
+      /* 8a, 8b, 8c-i */
+      bool is_present;
+
+      ECMA_TRY_CATCH (current_value,
+                      ecma_builtin_array_prototype_helper_get_element (obj_p, index, &is_present),
+                      ret_value);
+
+      if (is_present)
       {
-        /* 8c-i */
-        ECMA_TRY_CATCH (current_value, ecma_op_object_get (obj_p, index_str_p), ret_value);
         /* 8c-ii */
         *num_p = ecma_uint32_to_number (index);
         current_index = ecma_make_number_value (num_p);
@@ -2448,21 +3101,13 @@ ecma_builtin_array_prototype_object_map (ecma_value_t this_arg, /**< this argume
 
         ECMA_TRY_CATCH (mapped_value, ecma_op_function_call (func_object_p, arg2, call_args, 3), ret_value);
 
-        /* 8c-iii
-         * By definition we should use [[DefineOwnProperty]] here, but since [[Put]] will create the
-         * same property that we need, we can use it for simplicity. No need for a try-catch block
-         * since it is called with is_throw = false.
-         * ecma_op_to_boolean always returns a simple value, so no need to free.
-        */
-        ecma_completion_value_t put_comp_value = ecma_op_object_put (new_array_p, index_str_p, mapped_value, false);
-        JERRY_ASSERT (ecma_is_completion_value_normal_true (put_comp_value));
-        ecma_free_completion_value (put_comp_value);
+        /* 8c-iii */
+        ecma_builtin_array_prototype_helper_define_element (new_array_p, index, mapped_value);
 
         ECMA_FINALIZE (mapped_value);
-        ECMA_FINALIZE (current_value);
       }
 
-      ecma_deref_ecma_string (index_str_p);
+      ECMA_FINALIZE (current_value);
     }
 
     if (ecma_is_completion_value_empty (ret_value))
@@ -2555,20 +3200,20 @@ ecma_builtin_array_prototype_object_reduce (ecma_value_t this_arg, /**< this arg
         /* 8b */
         while (!k_present && index < len && ecma_is_completion_value_empty (ret_value))
         {
-          /* 8b-i */
-          ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
+          /* 8b-i, 8b-ii-iii */
+          ECMA_TRY_CATCH (current_value,
+                          ecma_builtin_array_prototype_helper_get_element (obj_p, index, &k_present),
+                          ret_value);
 
-          /* 8b-ii-iii */
-          if ((k_present = (ecma_op_object_get_property (obj_p, index_str_p) != NULL)))
+          if (k_present)
           {
-            ECMA_TRY_CATCH (current_value, ecma_op_object_get (obj_p, index_str_p), ret_value);
             accumulator = ecma_copy_value (current_value, true);
-            ECMA_FINALIZE (current_value);
           }
+
+          ECMA_FINALIZE (current_value);
+
           /* 8b-iv */
           index++;
-
-          ecma_deref_ecma_string (index_str_p);
         }
         /* 8c */
         if (!k_present)
@@ -2581,13 +3226,15 @@ ecma_builtin_array_prototype_object_reduce (ecma_value_t this_arg, /**< this arg
 
       for (; index < len && ecma_is_completion_value_empty (ret_value); ++index)
       {
-        /* 9a */
-        ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
-        /* 9b */
-        if (ecma_op_object_get_property (obj_p, index_str_p) != NULL)
+        /* 9a, 9b, 9c-i */
+        bool is_present;
+
+        ECMA_TRY_CATCH (current_value,
+                        ecma_builtin_array_prototype_helper_get_element (obj_p, index, &is_present),
+                        ret_value);
+
+        if (is_present)
         {
-          /* 9c-i */
-          ECMA_TRY_CATCH (current_value, ecma_op_object_get (obj_p, index_str_p), ret_value);
           /* 9c-ii */
           *num_p = ecma_uint32_to_number (index);
           current_index = ecma_make_number_value (num_p);
@@ -2604,9 +3251,9 @@ ecma_builtin_array_prototype_object_reduce (ecma_value_t this_arg, /**< this arg
           accumulator = ecma_copy_value (call_value, true);
 
           ECMA_FINALIZE (call_value);
-          ECMA_FINALIZE (current_value);
         }
-        ecma_deref_ecma_string (index_str_p);
+
+        ECMA_FINALIZE (current_value);
         /* 9d in for loop */
       }
 
@@ -2701,20 +3348,20 @@ ecma_builtin_array_prototype_object_reduce_right (ecma_value_t this_arg, /**< th
         /* 8b */
         while (!k_present && !zero_reached && ecma_is_completion_value_empty (ret_value))
         {
-          /* 8b-i */
-          ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
+          /* 8b-i, 8b-ii-iii */
+          ECMA_TRY_CATCH (current_value,
+                          ecma_builtin_array_prototype_helper_get_element (obj_p, index, &k_present),
+                          ret_value);
 
-          /* 8b-ii-iii */
-          if ((k_present = (ecma_op_object_get_property (obj_p, index_str_p) != NULL)))
+          if (k_present)
           {
-            ECMA_TRY_CATCH (current_value, ecma_op_object_get (obj_p, index_str_p), ret_value);
             accumulator = ecma_copy_value (current_value, true);
-            ECMA_FINALIZE (current_value);
           }
+
+          ECMA_FINALIZE (current_value);
+
           /* 8b-iv */
           index ? --index : zero_reached = true;
-
-          ecma_deref_ecma_string (index_str_p);
         }
         /* 8c */
         if (!k_present)
@@ -2727,13 +3374,15 @@ ecma_builtin_array_prototype_object_reduce_right (ecma_value_t this_arg, /**< th
 
       for (; !zero_reached && ecma_is_completion_value_empty (ret_value); index ? --index : zero_reached = true)
       {
-        /* 9a */
-        ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
-        /* 9b */
-        if (ecma_op_object_get_property (obj_p, index_str_p) != NULL)
+        /* 9a, 9b, 9c-i */
+        bool is_present;
+
+        ECMA_TRY_CATCH (current_value,
+                        ecma_builtin_array_prototype_helper_get_element (obj_p, index, &is_present),
+                        ret_value);
+
+        if (is_present)
         {
-          /* 9c-i */
-          ECMA_TRY_CATCH (current_value, ecma_op_object_get (obj_p, index_str_p), ret_value);
           /* 9c-ii */
           *num_p = ecma_uint32_to_number (index);
           current_index = ecma_make_number_value (num_p);
@@ -2750,9 +3399,9 @@ ecma_builtin_array_prototype_object_reduce_right (ecma_value_t this_arg, /**< th
           accumulator = ecma_copy_value (call_value, true);
 
           ECMA_FINALIZE (call_value);
-          ECMA_FINALIZE (current_value);
         }
-        ecma_deref_ecma_string (index_str_p);
+
+        ECMA_FINALIZE (current_value);
         /* 9d in for loop */
       }
 
@@ -2772,7 +3421,7 @@ ecma_builtin_array_prototype_object_reduce_right (ecma_value_t this_arg, /**< th
   ECMA_FINALIZE (obj_this);
 
   return ret_value;
-} /* ecma_builtin_array_prototype_object_reduce */
+} /* ecma_builtin_array_prototype_object_reduce_right */
 
 /**
  * @}
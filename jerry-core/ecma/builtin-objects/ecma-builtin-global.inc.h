@@ -202,12 +202,14 @@ OBJECT_VALUE (LIT_MAGIC_STRING_MATH_UL,
               ECMA_PROPERTY_CONFIGURABLE)
 #endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_MATH_BUILTIN */
 
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_JSON_BUILTIN
 // ECMA-262 v5, 15.1.5.2
-CP_UNIMPLEMENTED_VALUE (LIT_MAGIC_STRING_JSON_U,
-                        ecma_builtin_get (ECMA_BUILTIN_ID_JSON),
-                        ECMA_PROPERTY_WRITABLE,
-                        ECMA_PROPERTY_NOT_ENUMERABLE,
-                        ECMA_PROPERTY_CONFIGURABLE)
+OBJECT_VALUE (LIT_MAGIC_STRING_JSON_U,
+              ecma_builtin_get (ECMA_BUILTIN_ID_JSON),
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_JSON_BUILTIN */
 
 #ifdef CONFIG_ECMA_COMPACT_PROFILE
 OBJECT_VALUE (LIT_MAGIC_STRING_COMPACT_PROFILE_ERROR_UL,
@@ -201,6 +201,8 @@ ecma_builtin_helper_object_get_properties (ecma_object_t *obj_p, /** < object */
 
   uint32_t index = 0;
 
+  ecma_op_object_materialize_properties (obj_p);
+
   for (ecma_property_t *property_p = ecma_get_property_list (obj_p);
        property_p != NULL;
        property_p = ECMA_GET_POINTER (ecma_property_t, property_p->next_property_p))
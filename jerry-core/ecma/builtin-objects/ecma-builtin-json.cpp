@@ -0,0 +1,2050 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-array-object.h"
+#include "ecma-builtins.h"
+#include "ecma-conversion.h"
+#include "ecma-exceptions.h"
+#include "ecma-fast-array.h"
+#include "ecma-function-object.h"
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-objects.h"
+#include "ecma-objects-general.h"
+#include "ecma-shapes.h"
+#include "ecma-try-catch-macro.h"
+#include "jrt.h"
+#include "jrt-libc-includes.h"
+#include "lit-char-helpers.h"
+#include "lit-literal.h"
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_JSON_BUILTIN
+
+#define ECMA_BUILTINS_INTERNAL
+#include "ecma-builtins-internal.h"
+
+#define BUILTIN_INC_HEADER_NAME "ecma-builtin-json.inc.h"
+#define BUILTIN_UNDERSCORED_ID json
+#include "ecma-builtin-internal-routines-template.inc.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmabuiltins
+ * @{
+ *
+ * \addtogroup json ECMA JSON object built-in
+ * @{
+ */
+
+/**
+ * Number of entries in the cache of property names, created during parse of a JSON text
+ */
+#define ECMA_BUILTIN_JSON_KEY_CACHE_SIZE 32
+
+/**
+ * Maximum number of characters in the gap of JSON.stringify (ECMA-262 v5, 15.12.3, steps 6 and 7)
+ */
+#define ECMA_BUILTIN_JSON_GAP_MAX_LENGTH 10
+
+/**
+ * Size of the buffer of JSON.stringify, allocated upon first write to the buffer
+ */
+#define ECMA_BUILTIN_JSON_BUFFER_INITIAL_SIZE 64
+
+/**
+ * Entry of the cache of property names, created during parse of a JSON text
+ */
+typedef struct
+{
+  const lit_utf8_byte_t *chars_p; /**< characters of the name (in the parser's buffer) */
+  lit_utf8_size_t size; /**< size of the name */
+  ecma_string_t *name_p; /**< the name (NULL - if the entry is not used) */
+} ecma_json_key_cache_entry_t;
+
+/**
+ * Context of JSON text parser
+ */
+typedef struct
+{
+  lit_utf8_byte_t *current_p; /**< current position in the text */
+  lit_utf8_byte_t *end_p; /**< end of the text */
+  ecma_json_key_cache_entry_t key_cache[ECMA_BUILTIN_JSON_KEY_CACHE_SIZE]; /**< cache of property names */
+} ecma_json_parser_t;
+
+/**
+ * Growable buffer, in which JSON text is written by JSON.stringify
+ */
+typedef struct
+{
+  lit_utf8_byte_t *buffer_p; /**< buffer (NULL - if the buffer is not allocated yet) */
+  lit_utf8_size_t size; /**< size of the text, written to the buffer */
+  lit_utf8_size_t capacity; /**< size of the buffer */
+} ecma_json_buffer_t;
+
+/**
+ * Item of the stack of objects, that are being serialized by JSON.stringify
+ */
+typedef struct ecma_json_stack_item_t
+{
+  ecma_object_t *object_p; /**< the object */
+  const struct ecma_json_stack_item_t *prev_p; /**< previous item (NULL - for the bottom item) */
+} ecma_json_stack_item_t;
+
+/**
+ * Context of JSON.stringify
+ */
+typedef struct
+{
+  ecma_json_buffer_t buffer; /**< buffer with the JSON text */
+  ecma_object_t *replacer_function_p; /**< ReplacerFunction (NULL - if not specified) */
+  ecma_string_t **property_list_p; /**< PropertyList (NULL - if not specified) */
+  ecma_length_t property_list_length; /**< number of the names in the PropertyList */
+  size_t property_list_size; /**< size of the buffer of the PropertyList */
+  const ecma_json_stack_item_t *stack_top_p; /**< top of the stack (NULL - if the stack is empty) */
+  uint32_t indent_level; /**< number of gaps in the current indent */
+  lit_utf8_size_t gap_size; /**< size of the gap (0 - if the gap is empty) */
+  lit_utf8_byte_t gap[ECMA_BUILTIN_JSON_GAP_MAX_LENGTH * LIT_UTF8_MAX_BYTES_IN_CODE_UNIT]; /**< the gap */
+} ecma_json_stringify_context_t;
+
+/**
+ * Get names of the object's own enumerable properties
+ *
+ * Note:
+ *      objects in shaped form are not converted to property list form,
+ *      the names are taken from the object's shape
+ *
+ * @return number of the names
+ *         (the names are referenced and stored to the buffer, if it is specified)
+ */
+static ecma_length_t
+ecma_builtin_json_get_own_enumerable_names (ecma_object_t *obj_p, /**< object */
+                                            ecma_string_t **names_p) /**< buffer for the names
+                                                                      *   (NULL - to only count the names) */
+{
+  ecma_length_t names_number = 0;
+
+  if (ecma_get_object_is_shaped (obj_p))
+  {
+    for (ecma_shape_t *shape_p = ecma_shaped_object_get_shape (obj_p);
+         shape_p->parent_cp != ECMA_NULL_POINTER;
+         shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shape_p->parent_cp))
+    {
+      if (names_p != NULL)
+      {
+        names_p[names_number] = ecma_copy_or_ref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t,
+                                                                                         shape_p->name_cp));
+      }
+
+      names_number++;
+    }
+
+    return names_number;
+  }
+
+  ecma_op_object_materialize_properties (obj_p);
+
+  for (ecma_property_t *property_p = ecma_get_property_list (obj_p);
+       property_p != NULL;
+       property_p = ECMA_GET_POINTER (ecma_property_t, property_p->next_property_p))
+  {
+    ecma_string_t *property_name_p;
+
+    if (property_p->type == ECMA_PROPERTY_NAMEDDATA)
+    {
+      property_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, property_p->u.named_data_property.name_p);
+    }
+    else if (property_p->type == ECMA_PROPERTY_NAMEDACCESSOR)
+    {
+      property_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, property_p->u.named_accessor_property.name_p);
+    }
+    else
+    {
+      continue;
+    }
+
+    if (!ecma_is_property_enumerable (property_p))
+    {
+      continue;
+    }
+
+    if (names_p != NULL)
+    {
+      names_p[names_number] = ecma_copy_or_ref_ecma_string (property_name_p);
+    }
+
+    names_number++;
+  }
+
+  return names_number;
+} /* ecma_builtin_json_get_own_enumerable_names */
+
+/**
+ * Define own data property of an object, created by JSON.parse, or of an object, passed to the reviver
+ *
+ * See also:
+ *          ECMA-262 v5, 15.12.2, steps 3.b, 3.c and abstract operation Walk
+ */
+static void
+ecma_builtin_json_define_property (ecma_object_t *obj_p, /**< object */
+                                   ecma_string_t *name_p, /**< property name */
+                                   ecma_value_t value) /**< property value */
+{
+  ecma_property_descriptor_t prop_desc = ecma_make_empty_property_descriptor ();
+  {
+    prop_desc.is_value_defined = true;
+    prop_desc.value = value;
+
+    prop_desc.is_writable_defined = true;
+    prop_desc.is_writable = true;
+
+    prop_desc.is_enumerable_defined = true;
+    prop_desc.is_enumerable = true;
+
+    prop_desc.is_configurable_defined = true;
+    prop_desc.is_configurable = true;
+  }
+
+  /* objects, passed to the reviver, can be non-extensible, so the operation can return false */
+  ecma_completion_value_t completion = ecma_op_object_define_own_property (obj_p, name_p, &prop_desc, false);
+
+  JERRY_ASSERT (ecma_is_completion_value_normal (completion));
+  ecma_free_completion_value (completion);
+} /* ecma_builtin_json_define_property */
+
+/**
+ * Skip white space of JSON text
+ *
+ * See also:
+ *          ECMA-262 v5, 15.12.1.1 (JSONWhiteSpace)
+ */
+static void
+ecma_builtin_json_parse_skip_white_space (ecma_json_parser_t *parser_p) /**< parser */
+{
+  while (parser_p->current_p < parser_p->end_p)
+  {
+    const lit_utf8_byte_t byte = *parser_p->current_p;
+
+    if (byte != LIT_CHAR_SP
+        && byte != LIT_CHAR_TAB
+        && byte != LIT_CHAR_CR
+        && byte != LIT_CHAR_LF)
+    {
+      break;
+    }
+
+    parser_p->current_p++;
+  }
+} /* ecma_builtin_json_parse_skip_white_space */
+
+/**
+ * Parse JSON string (ECMA-262 v5, 15.12.1.1, JSONString)
+ *
+ * Escape sequences are decoded in place, as decoded characters are never longer than their escape sequences,
+ * so characters of the string are stored in the parser's buffer, starting from the string's opening quote.
+ *
+ * @return true - if the string was parsed successfully,
+ *         false - otherwise (the text is not valid JSON text).
+ */
+static bool
+ecma_builtin_json_parse_string (ecma_json_parser_t *parser_p, /**< parser */
+                                const lit_utf8_byte_t **out_chars_p, /**< out: characters of the string */
+                                lit_utf8_size_t *out_size_p) /**< out: size of the string */
+{
+  JERRY_ASSERT (parser_p->current_p < parser_p->end_p
+                && *parser_p->current_p == LIT_CHAR_DOUBLE_QUOTE);
+
+  lit_utf8_byte_t *const chars_p = parser_p->current_p;
+  lit_utf8_byte_t *read_p = parser_p->current_p + 1;
+  lit_utf8_byte_t *write_p = chars_p;
+  const lit_utf8_byte_t *end_p = parser_p->end_p;
+
+  bool has_escaped_surrogates = false;
+
+  while (true)
+  {
+    if (read_p >= end_p)
+    {
+      return false;
+    }
+
+    const lit_utf8_byte_t byte = *read_p++;
+
+    if (byte == LIT_CHAR_DOUBLE_QUOTE)
+    {
+      break;
+    }
+    else if (byte < LIT_CHAR_SP)
+    {
+      /* control characters should be escaped */
+      return false;
+    }
+    else if (byte != LIT_CHAR_BACKSLASH)
+    {
+      *write_p++ = byte;
+      continue;
+    }
+
+    if (read_p >= end_p)
+    {
+      return false;
+    }
+
+    const lit_utf8_byte_t escaped_byte = *read_p++;
+
+    switch (escaped_byte)
+    {
+      case LIT_CHAR_DOUBLE_QUOTE:
+      case LIT_CHAR_BACKSLASH:
+      case LIT_CHAR_SLASH:
+      {
+        *write_p++ = escaped_byte;
+        break;
+      }
+      case LIT_CHAR_LOWERCASE_B:
+      {
+        *write_p++ = (lit_utf8_byte_t) LIT_CHAR_BS;
+        break;
+      }
+      case LIT_CHAR_LOWERCASE_F:
+      {
+        *write_p++ = (lit_utf8_byte_t) LIT_CHAR_FF;
+        break;
+      }
+      case LIT_CHAR_LOWERCASE_N:
+      {
+        *write_p++ = (lit_utf8_byte_t) LIT_CHAR_LF;
+        break;
+      }
+      case LIT_CHAR_LOWERCASE_R:
+      {
+        *write_p++ = (lit_utf8_byte_t) LIT_CHAR_CR;
+        break;
+      }
+      case LIT_CHAR_LOWERCASE_T:
+      {
+        *write_p++ = (lit_utf8_byte_t) LIT_CHAR_TAB;
+        break;
+      }
+      case LIT_CHAR_LOWERCASE_U:
+      {
+        if (end_p - read_p < 4)
+        {
+          return false;
+        }
+
+        ecma_char_t code_unit = 0;
+
+        for (uint32_t i = 0; i < 4; i++)
+        {
+          if (!isxdigit (read_p[i]))
+          {
+            return false;
+          }
+
+          code_unit = (ecma_char_t) ((code_unit << 4u) + lit_char_hex_to_int (read_p[i]));
+        }
+
+        read_p += 4;
+
+        if (code_unit >= LIT_UTF16_HIGH_SURROGATE_MIN
+            && code_unit <= LIT_UTF16_LOW_SURROGATE_MAX)
+        {
+          has_escaped_surrogates = true;
+        }
+
+        /* the escape sequence is 6 bytes long, so the code unit's representation fits to its place */
+        write_p += lit_code_unit_to_utf8 (code_unit, write_p);
+        break;
+      }
+      default:
+      {
+        return false;
+      }
+    }
+  }
+
+  parser_p->current_p = read_p;
+
+  lit_utf8_size_t size = (lit_utf8_size_t) (write_p - chars_p);
+
+  if (has_escaped_surrogates)
+  {
+    /* escaped pairs of surrogates were decoded to separate code units */
+    size = lit_utf8_string_combine_surrogates (chars_p, size);
+  }
+
+  *out_chars_p = chars_p;
+  *out_size_p = size;
+
+  return true;
+} /* ecma_builtin_json_parse_string */
+
+/**
+ * Get property name with specified characters for an object, created by JSON.parse
+ *
+ * Objects of a JSON text usually share names of their properties, so the names are cached
+ * during the parse. Names, that are not in the cache, are looked up in the literal storage,
+ * as property names of JSON texts often correspond to names, used in the script's source code.
+ *
+ * @return pointer to ecma-string (should be dereferenced with ecma_deref_ecma_string)
+ */
+static ecma_string_t *
+ecma_builtin_json_parse_get_key (ecma_json_parser_t *parser_p, /**< parser */
+                                 const lit_utf8_byte_t *chars_p, /**< characters of the name */
+                                 lit_utf8_size_t size) /**< size of the name */
+{
+  const lit_string_hash_t hash = lit_utf8_string_calc_hash (chars_p, size);
+
+  ecma_json_key_cache_entry_t *entry_p = parser_p->key_cache + (hash % ECMA_BUILTIN_JSON_KEY_CACHE_SIZE);
+
+  if (entry_p->name_p != NULL
+      && entry_p->size == size
+      && memcmp (entry_p->chars_p, chars_p, size) == 0)
+  {
+    return ecma_copy_or_ref_ecma_string (entry_p->name_p);
+  }
+
+  ecma_string_t *name_p;
+  literal_t lit = lit_find_literal_by_utf8_string (chars_p, size);
+
+  if (lit != NULL)
+  {
+    name_p = ecma_new_ecma_string_from_lit_cp (lit_cpointer_t::compress (lit));
+  }
+  else
+  {
+    name_p = ecma_new_ecma_string_from_utf8 (chars_p, size);
+  }
+
+  if (entry_p->name_p != NULL)
+  {
+    ecma_deref_ecma_string (entry_p->name_p);
+  }
+
+  entry_p->chars_p = chars_p;
+  entry_p->size = size;
+  entry_p->name_p = ecma_copy_or_ref_ecma_string (name_p);
+
+  return name_p;
+} /* ecma_builtin_json_parse_get_key */
+
+/**
+ * Parse JSON number (ECMA-262 v5, 15.12.1.1, JSONNumber)
+ *
+ * @return true - if the number was parsed successfully (out_value_p is set to the number),
+ *         false - otherwise (the text is not valid JSON text).
+ */
+static bool
+ecma_builtin_json_parse_number (ecma_json_parser_t *parser_p, /**< parser */
+                                ecma_value_t *out_value_p) /**< out: number value */
+{
+  const lit_utf8_byte_t *start_p = parser_p->current_p;
+  const lit_utf8_byte_t *current_p = parser_p->current_p;
+  const lit_utf8_byte_t *end_p = parser_p->end_p;
+
+  bool is_negative = false;
+
+  if (*current_p == LIT_CHAR_MINUS)
+  {
+    is_negative = true;
+    current_p++;
+  }
+
+  if (current_p >= end_p
+      || !isdigit (*current_p))
+  {
+    return false;
+  }
+
+  /* integers with at most 9 digits are computed directly */
+  bool is_small_integer = true;
+  int32_t integer = 0;
+
+  if (*current_p == LIT_CHAR_0)
+  {
+    current_p++;
+  }
+  else
+  {
+    uint32_t digits_number = 0;
+
+    while (current_p < end_p
+           && isdigit (*current_p))
+    {
+      integer = integer * 10 + (int32_t) (*current_p - LIT_CHAR_0);
+
+      if (++digits_number == 9)
+      {
+        is_small_integer = false;
+      }
+
+      current_p++;
+    }
+  }
+
+  if (current_p < end_p
+      && *current_p == LIT_CHAR_DOT)
+  {
+    is_small_integer = false;
+    current_p++;
+
+    if (current_p >= end_p
+        || !isdigit (*current_p))
+    {
+      return false;
+    }
+
+    while (current_p < end_p
+           && isdigit (*current_p))
+    {
+      current_p++;
+    }
+  }
+
+  if (current_p < end_p
+      && (*current_p == LIT_CHAR_LOWERCASE_E
+          || *current_p == LIT_CHAR_UPPERCASE_E))
+  {
+    is_small_integer = false;
+    current_p++;
+
+    if (current_p < end_p
+        && (*current_p == LIT_CHAR_PLUS
+            || *current_p == LIT_CHAR_MINUS))
+    {
+      current_p++;
+    }
+
+    if (current_p >= end_p
+        || !isdigit (*current_p))
+    {
+      return false;
+    }
+
+    while (current_p < end_p
+           && isdigit (*current_p))
+    {
+      current_p++;
+    }
+  }
+
+  parser_p->current_p = (lit_utf8_byte_t *) current_p;
+
+  ecma_number_t num;
+
+  if (is_small_integer)
+  {
+    num = (ecma_number_t) (is_negative ? -integer : integer);
+
+    /* -0 is not representable with integer value */
+    if (is_negative && integer == 0)
+    {
+      num = ecma_number_negate (num);
+    }
+  }
+  else
+  {
+    num = ecma_utf8_string_to_number (start_p, (lit_utf8_size_t) (current_p - start_p));
+  }
+
+  ecma_integer_value_t integer_value;
+
+  if (ecma_number_is_integer_value (num, &integer_value))
+  {
+    *out_value_p = ecma_make_integer_value (integer_value);
+  }
+  else
+  {
+    ecma_number_t *num_p = ecma_alloc_number ();
+    *num_p = num;
+
+    *out_value_p = ecma_make_number_value (num_p);
+  }
+
+  return true;
+} /* ecma_builtin_json_parse_number */
+
+/**
+ * Parse keyword of JSON text ('null', 'true' or 'false')
+ *
+ * @return true - if the text continues with the keyword,
+ *         false - otherwise.
+ */
+static bool
+ecma_builtin_json_parse_keyword (ecma_json_parser_t *parser_p, /**< parser */
+                                 lit_magic_string_id_t keyword_id) /**< keyword */
+{
+  const lit_utf8_size_t keyword_size = lit_get_magic_string_size (keyword_id);
+
+  if ((lit_utf8_size_t) (parser_p->end_p - parser_p->current_p) < keyword_size
+      || memcmp (parser_p->current_p, lit_get_magic_string_utf8 (keyword_id), keyword_size) != 0)
+  {
+    return false;
+  }
+
+  parser_p->current_p += keyword_size;
+
+  return true;
+} /* ecma_builtin_json_parse_keyword */
+
+static bool
+ecma_builtin_json_parse_value (ecma_json_parser_t *parser_p, ecma_value_t *out_value_p);
+
+/**
+ * Parse JSON object (ECMA-262 v5, 15.12.1.2, JSONObject)
+ *
+ * @return true - if the object was parsed successfully (out_value_p is set to the object),
+ *         false - otherwise (the text is not valid JSON text).
+ */
+static bool
+ecma_builtin_json_parse_object (ecma_json_parser_t *parser_p, /**< parser */
+                                ecma_value_t *out_value_p) /**< out: object value */
+{
+  JERRY_ASSERT (*parser_p->current_p == LIT_CHAR_LEFT_BRACE);
+  parser_p->current_p++;
+
+  ecma_object_t *obj_p = ecma_op_create_object_object_noarg ();
+
+  ecma_builtin_json_parse_skip_white_space (parser_p);
+
+  if (parser_p->current_p < parser_p->end_p
+      && *parser_p->current_p == LIT_CHAR_RIGHT_BRACE)
+  {
+    parser_p->current_p++;
+
+    *out_value_p = ecma_make_object_value (obj_p);
+    return true;
+  }
+
+  while (true)
+  {
+    ecma_builtin_json_parse_skip_white_space (parser_p);
+
+    const lit_utf8_byte_t *name_chars_p;
+    lit_utf8_size_t name_size;
+
+    if (parser_p->current_p >= parser_p->end_p
+        || *parser_p->current_p != LIT_CHAR_DOUBLE_QUOTE
+        || !ecma_builtin_json_parse_string (parser_p, &name_chars_p, &name_size))
+    {
+      break;
+    }
+
+    ecma_builtin_json_parse_skip_white_space (parser_p);
+
+    if (parser_p->current_p >= parser_p->end_p
+        || *parser_p->current_p != LIT_CHAR_COLON)
+    {
+      break;
+    }
+
+    parser_p->current_p++;
+
+    ecma_value_t value;
+
+    if (!ecma_builtin_json_parse_value (parser_p, &value))
+    {
+      break;
+    }
+
+    ecma_string_t *name_p = ecma_builtin_json_parse_get_key (parser_p, name_chars_p, name_size);
+
+    ecma_builtin_json_define_property (obj_p, name_p, value);
+
+    ecma_deref_ecma_string (name_p);
+    ecma_free_value (value, true);
+
+    ecma_builtin_json_parse_skip_white_space (parser_p);
+
+    if (parser_p->current_p >= parser_p->end_p)
+    {
+      break;
+    }
+
+    const lit_utf8_byte_t byte = *parser_p->current_p++;
+
+    if (byte == LIT_CHAR_RIGHT_BRACE)
+    {
+      *out_value_p = ecma_make_object_value (obj_p);
+      return true;
+    }
+    else if (byte != LIT_CHAR_COMMA)
+    {
+      break;
+    }
+  }
+
+  ecma_deref_object (obj_p);
+
+  return false;
+} /* ecma_builtin_json_parse_object */
+
+/**
+ * Parse JSON array (ECMA-262 v5, 15.12.1.2, JSONArray)
+ *
+ * Elements are appended directly to the vector of the array, if the array is in fast form.
+ *
+ * @return true - if the array was parsed successfully (out_value_p is set to the array),
+ *         false - otherwise (the text is not valid JSON text).
+ */
+static bool
+ecma_builtin_json_parse_array (ecma_json_parser_t *parser_p, /**< parser */
+                               ecma_value_t *out_value_p) /**< out: array value */
+{
+  JERRY_ASSERT (*parser_p->current_p == LIT_CHAR_LEFT_SQUARE);
+  parser_p->current_p++;
+
+  ecma_completion_value_t array_completion = ecma_op_create_array_object (NULL, 0, false);
+  JERRY_ASSERT (ecma_is_completion_value_normal (array_completion));
+  ecma_object_t *array_p = ecma_get_object_from_completion_value (array_completion);
+
+  ecma_builtin_json_parse_skip_white_space (parser_p);
+
+  if (parser_p->current_p < parser_p->end_p
+      && *parser_p->current_p == LIT_CHAR_RIGHT_SQUARE)
+  {
+    parser_p->current_p++;
+
+    *out_value_p = ecma_make_object_value (array_p);
+    return true;
+  }
+
+  uint32_t index = 0;
+
+  while (true)
+  {
+    ecma_value_t value;
+
+    if (!ecma_builtin_json_parse_value (parser_p, &value))
+    {
+      break;
+    }
+
+    ecma_fast_array_elements_t *elements_p = ecma_get_object_fast_elements (array_p);
+
+    if (elements_p != NULL
+        && ecma_fast_array_can_append (array_p))
+    {
+      JERRY_ASSERT (elements_p->length == index);
+
+      ecma_fast_array_append (array_p, value);
+    }
+    else
+    {
+      ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
+      ecma_builtin_json_define_property (array_p, index_str_p, value);
+      ecma_deref_ecma_string (index_str_p);
+    }
+
+    ecma_free_value (value, true);
+    index++;
+
+    ecma_builtin_json_parse_skip_white_space (parser_p);
+
+    if (parser_p->current_p >= parser_p->end_p)
+    {
+      break;
+    }
+
+    const lit_utf8_byte_t byte = *parser_p->current_p++;
+
+    if (byte == LIT_CHAR_RIGHT_SQUARE)
+    {
+      *out_value_p = ecma_make_object_value (array_p);
+      return true;
+    }
+    else if (byte != LIT_CHAR_COMMA)
+    {
+      break;
+    }
+  }
+
+  ecma_deref_object (array_p);
+
+  return false;
+} /* ecma_builtin_json_parse_array */
+
+/**
+ * Parse JSON value (ECMA-262 v5, 15.12.1.2, JSONValue)
+ *
+ * @return true - if the value was parsed successfully (out_value_p is set to the value,
+ *                that should be freed with ecma_free_value),
+ *         false - otherwise (the text is not valid JSON text).
+ */
+static bool
+ecma_builtin_json_parse_value (ecma_json_parser_t *parser_p, /**< parser */
+                               ecma_value_t *out_value_p) /**< out: value */
+{
+  ecma_builtin_json_parse_skip_white_space (parser_p);
+
+  if (parser_p->current_p >= parser_p->end_p)
+  {
+    return false;
+  }
+
+  switch (*parser_p->current_p)
+  {
+    case LIT_CHAR_LEFT_BRACE:
+    {
+      return ecma_builtin_json_parse_object (parser_p, out_value_p);
+    }
+    case LIT_CHAR_LEFT_SQUARE:
+    {
+      return ecma_builtin_json_parse_array (parser_p, out_value_p);
+    }
+    case LIT_CHAR_DOUBLE_QUOTE:
+    {
+      const lit_utf8_byte_t *chars_p;
+      lit_utf8_size_t size;
+
+      if (!ecma_builtin_json_parse_string (parser_p, &chars_p, &size))
+      {
+        return false;
+      }
+
+      *out_value_p = ecma_make_string_value (ecma_new_ecma_string_from_utf8 (chars_p, size));
+      return true;
+    }
+    case LIT_CHAR_LOWERCASE_N:
+    {
+      *out_value_p = ecma_make_simple_value (ECMA_SIMPLE_VALUE_NULL);
+      return ecma_builtin_json_parse_keyword (parser_p, LIT_MAGIC_STRING_NULL);
+    }
+    case LIT_CHAR_LOWERCASE_T:
+    {
+      *out_value_p = ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+      return ecma_builtin_json_parse_keyword (parser_p, LIT_MAGIC_STRING_TRUE);
+    }
+    case LIT_CHAR_LOWERCASE_F:
+    {
+      *out_value_p = ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE);
+      return ecma_builtin_json_parse_keyword (parser_p, LIT_MAGIC_STRING_FALSE);
+    }
+    default:
+    {
+      return ecma_builtin_json_parse_number (parser_p, out_value_p);
+    }
+  }
+} /* ecma_builtin_json_parse_value */
+
+/**
+ * Abstract operation Walk of JSON.parse
+ *
+ * See also:
+ *          ECMA-262 v5, 15.12.2
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value.
+ */
+static ecma_completion_value_t
+ecma_builtin_json_walk (ecma_object_t *reviver_p, /**< reviver function */
+                        ecma_object_t *holder_p, /**< holder object */
+                        ecma_string_t *name_p) /**< property name */
+{
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  /* 1. */
+  ECMA_TRY_CATCH (value_get, ecma_op_object_get (holder_p, name_p), ret_value);
+
+  /* 2. */
+  if (ecma_is_value_object (value_get))
+  {
+    ecma_object_t *obj_p = ecma_get_object_from_value (value_get);
+    ecma_length_t names_number;
+    uint32_t length = 0;
+
+    if (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_ARRAY)
+    {
+      names_number = 0;
+
+      /* 2.a - 2.b */
+      ecma_string_t *magic_string_length_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
+
+      ECMA_TRY_CATCH (length_value, ecma_op_object_get (obj_p, magic_string_length_p), ret_value);
+      ECMA_OP_TO_NUMBER_TRY_CATCH (length_number, length_value, ret_value);
+
+      length = ecma_number_to_uint32 (length_number);
+
+      ECMA_OP_TO_NUMBER_FINALIZE (length_number);
+      ECMA_FINALIZE (length_value);
+
+      ecma_deref_ecma_string (magic_string_length_p);
+    }
+    else
+    {
+      /* 2.c.i */
+      names_number = ecma_builtin_json_get_own_enumerable_names (obj_p, NULL);
+    }
+
+    MEM_DEFINE_LOCAL_ARRAY (names_p, names_number, ecma_string_t *);
+
+    if (names_number != 0)
+    {
+      ecma_builtin_json_get_own_enumerable_names (obj_p, names_p);
+    }
+
+    const uint32_t iterations_number = (names_number != 0) ? (uint32_t) names_number : length;
+
+    /* 2.b.iii, 2.c.ii */
+    for (uint32_t i = 0; i < iterations_number && ecma_is_completion_value_empty (ret_value); i++)
+    {
+      ecma_string_t *element_name_p;
+
+      if (names_number != 0)
+      {
+        element_name_p = ecma_copy_or_ref_ecma_string (names_p[i]);
+      }
+      else
+      {
+        element_name_p = ecma_new_ecma_string_from_uint32 (i);
+      }
+
+      ECMA_TRY_CATCH (new_element, ecma_builtin_json_walk (reviver_p, obj_p, element_name_p), ret_value);
+
+      if (ecma_is_value_undefined (new_element))
+      {
+        ecma_completion_value_t delete_completion = ecma_op_object_delete (obj_p, element_name_p, false);
+        JERRY_ASSERT (ecma_is_completion_value_normal (delete_completion));
+        ecma_free_completion_value (delete_completion);
+      }
+      else
+      {
+        ecma_builtin_json_define_property (obj_p, element_name_p, new_element);
+      }
+
+      ECMA_FINALIZE (new_element);
+
+      ecma_deref_ecma_string (element_name_p);
+    }
+
+    for (ecma_length_t i = 0; i < names_number; i++)
+    {
+      ecma_deref_ecma_string (names_p[i]);
+    }
+
+    MEM_FINALIZE_LOCAL_ARRAY (names_p);
+  }
+
+  /* 3. */
+  if (ecma_is_completion_value_empty (ret_value))
+  {
+    ecma_value_t call_args[] = { ecma_make_string_value (name_p), value_get };
+
+    ret_value = ecma_op_function_call (reviver_p, ecma_make_object_value (holder_p), call_args, 2);
+  }
+
+  ECMA_FINALIZE (value_get);
+
+  return ret_value;
+} /* ecma_builtin_json_walk */
+
+/**
+ * The JSON object's 'parse' routine
+ *
+ * The text is parsed in one pass over its utf-8 representation, and the objects are created directly.
+ *
+ * See also:
+ *          ECMA-262 v5, 15.12.2
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value.
+ */
+static ecma_completion_value_t
+ecma_builtin_json_parse (ecma_value_t this_arg __attr_unused___, /**< 'this' argument */
+                         ecma_value_t arg1, /**< text */
+                         ecma_value_t arg2) /**< reviver */
+{
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  /* 1. */
+  ECMA_TRY_CATCH (text, ecma_op_to_string (arg1), ret_value);
+
+  ecma_string_t *text_p = ecma_get_string_from_value (text);
+  const lit_utf8_size_t text_size = ecma_string_get_size (text_p);
+
+  MEM_DEFINE_LOCAL_ARRAY (text_buffer_p, text_size, lit_utf8_byte_t);
+
+  ssize_t bytes_copied = ecma_string_to_utf8_string (text_p, text_buffer_p, (ssize_t) text_size);
+  JERRY_ASSERT (bytes_copied == (ssize_t) text_size);
+
+  /* surrogates of a pair are represented separately in strings, created from escape sequences of literals */
+  const lit_utf8_size_t parsed_size = lit_utf8_string_combine_surrogates (text_buffer_p, text_size);
+
+  ecma_json_parser_t parser;
+  parser.current_p = text_buffer_p;
+  parser.end_p = text_buffer_p + parsed_size;
+
+  for (uint32_t i = 0; i < ECMA_BUILTIN_JSON_KEY_CACHE_SIZE; i++)
+  {
+    parser.key_cache[i].name_p = NULL;
+  }
+
+  /* 2. */
+  ecma_value_t unfiltered;
+  bool is_parsed = ecma_builtin_json_parse_value (&parser, &unfiltered);
+
+  if (is_parsed)
+  {
+    ecma_builtin_json_parse_skip_white_space (&parser);
+
+    if (parser.current_p != parser.end_p)
+    {
+      ecma_free_value (unfiltered, true);
+      is_parsed = false;
+    }
+  }
+
+  for (uint32_t i = 0; i < ECMA_BUILTIN_JSON_KEY_CACHE_SIZE; i++)
+  {
+    if (parser.key_cache[i].name_p != NULL)
+    {
+      ecma_deref_ecma_string (parser.key_cache[i].name_p);
+    }
+  }
+
+  if (!is_parsed)
+  {
+    ret_value = ecma_make_throw_obj_completion_value (ecma_new_standard_error (ECMA_ERROR_SYNTAX));
+  }
+  else if (ecma_op_is_callable (arg2))
+  {
+    /* 3. */
+    ecma_object_t *root_p = ecma_op_create_object_object_noarg ();
+    ecma_string_t *empty_string_p = ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
+
+    ecma_builtin_json_define_property (root_p, empty_string_p, unfiltered);
+
+    ret_value = ecma_builtin_json_walk (ecma_get_object_from_value (arg2), root_p, empty_string_p);
+
+    ecma_deref_ecma_string (empty_string_p);
+    ecma_deref_object (root_p);
+    ecma_free_value (unfiltered, true);
+  }
+  else
+  {
+    /* 4. */
+    ret_value = ecma_make_normal_completion_value (unfiltered);
+  }
+
+  MEM_FINALIZE_LOCAL_ARRAY (text_buffer_p);
+
+  ECMA_FINALIZE (text);
+
+  return ret_value;
+} /* ecma_builtin_json_parse */
+
+/**
+ * Reserve space at the end of JSON.stringify's buffer, growing the buffer if necessary
+ *
+ * @return pointer to the reserved space (valid until the buffer's next growth)
+ */
+static lit_utf8_byte_t *
+ecma_builtin_json_buffer_reserve (ecma_json_buffer_t *buffer_p, /**< buffer */
+                                  lit_utf8_size_t size) /**< size of the space to reserve */
+{
+  if (buffer_p->capacity - buffer_p->size < size)
+  {
+    lit_utf8_size_t new_capacity = JERRY_MAX (buffer_p->capacity, ECMA_BUILTIN_JSON_BUFFER_INITIAL_SIZE);
+
+    while (new_capacity - buffer_p->size < size)
+    {
+      new_capacity *= 2;
+    }
+
+    lit_utf8_byte_t *new_buffer_p = (lit_utf8_byte_t *) ecma_alloc_buffer (new_capacity);
+
+    if (buffer_p->buffer_p != NULL)
+    {
+      memcpy (new_buffer_p, buffer_p->buffer_p, buffer_p->size);
+
+      ecma_dealloc_buffer (buffer_p->buffer_p, buffer_p->capacity);
+    }
+
+    buffer_p->buffer_p = new_buffer_p;
+    buffer_p->capacity = new_capacity;
+  }
+
+  return buffer_p->buffer_p + buffer_p->size;
+} /* ecma_builtin_json_buffer_reserve */
+
+/**
+ * Append characters to JSON.stringify's buffer
+ */
+static void
+ecma_builtin_json_buffer_append (ecma_json_buffer_t *buffer_p, /**< buffer */
+                                 const lit_utf8_byte_t *chars_p, /**< characters */
+                                 lit_utf8_size_t size) /**< size of the characters */
+{
+  memcpy (ecma_builtin_json_buffer_reserve (buffer_p, size), chars_p, size);
+  buffer_p->size += size;
+} /* ecma_builtin_json_buffer_append */
+
+/**
+ * Append a character to JSON.stringify's buffer
+ */
+static void
+ecma_builtin_json_buffer_append_char (ecma_json_buffer_t *buffer_p, /**< buffer */
+                                      lit_utf8_byte_t byte) /**< ASCII character */
+{
+  *ecma_builtin_json_buffer_reserve (buffer_p, 1) = byte;
+  buffer_p->size++;
+} /* ecma_builtin_json_buffer_append_char */
+
+/**
+ * Append a magic string to JSON.stringify's buffer
+ */
+static void
+ecma_builtin_json_buffer_append_magic_string (ecma_json_buffer_t *buffer_p, /**< buffer */
+                                              lit_magic_string_id_t id) /**< magic string id */
+{
+  ecma_builtin_json_buffer_append (buffer_p, lit_get_magic_string_utf8 (id), lit_get_magic_string_size (id));
+} /* ecma_builtin_json_buffer_append_magic_string */
+
+/**
+ * Append quoted string to JSON.stringify's buffer
+ *
+ * The string's characters are copied to the buffer as is, and are escaped only if some of them should be.
+ *
+ * See also:
+ *          ECMA-262 v5, 15.12.3, abstract operation Quote
+ */
+static void
+ecma_builtin_json_buffer_append_quoted_string (ecma_json_buffer_t *buffer_p, /**< buffer */
+                                               ecma_string_t *string_p) /**< string */
+{
+  const lit_utf8_size_t string_size = ecma_string_get_size (string_p);
+
+  lit_utf8_byte_t *chars_p = ecma_builtin_json_buffer_reserve (buffer_p, string_size + 2);
+
+  /* 1. */
+  *chars_p++ = LIT_CHAR_DOUBLE_QUOTE;
+
+  ssize_t bytes_copied = ecma_string_to_utf8_string (string_p, chars_p, (ssize_t) string_size);
+  JERRY_ASSERT (bytes_copied == (ssize_t) string_size);
+
+  lit_utf8_size_t unescaped_size = 0;
+
+  while (unescaped_size < string_size
+         && chars_p[unescaped_size] >= LIT_CHAR_SP
+         && chars_p[unescaped_size] != LIT_CHAR_DOUBLE_QUOTE
+         && chars_p[unescaped_size] != LIT_CHAR_BACKSLASH)
+  {
+    unescaped_size++;
+  }
+
+  if (unescaped_size == string_size)
+  {
+    /* 3. */
+    chars_p[string_size] = LIT_CHAR_DOUBLE_QUOTE;
+    buffer_p->size += string_size + 2;
+
+    return;
+  }
+
+  /* 2. */
+  buffer_p->size += unescaped_size + 1;
+
+  const lit_utf8_size_t rest_size = string_size - unescaped_size;
+
+  MEM_DEFINE_LOCAL_ARRAY (rest_p, rest_size, lit_utf8_byte_t);
+
+  memcpy (rest_p, chars_p + unescaped_size, rest_size);
+
+  /* each character is replaced with at most 6 characters ('\uXXXX'), and is followed with closing quote */
+  lit_utf8_byte_t *write_p = ecma_builtin_json_buffer_reserve (buffer_p, rest_size * 6 + 1);
+  lit_utf8_byte_t *const write_start_p = write_p;
+
+  for (lit_utf8_size_t i = 0; i < rest_size; i++)
+  {
+    const lit_utf8_byte_t byte = rest_p[i];
+    lit_utf8_byte_t escaped_byte;
+
+    switch (byte)
+    {
+      case LIT_CHAR_DOUBLE_QUOTE:
+      case LIT_CHAR_BACKSLASH:
+      {
+        escaped_byte = byte;
+        break;
+      }
+      case LIT_CHAR_BS:
+      {
+        escaped_byte = LIT_CHAR_LOWERCASE_B;
+        break;
+      }
+      case LIT_CHAR_FF:
+      {
+        escaped_byte = LIT_CHAR_LOWERCASE_F;
+        break;
+      }
+      case LIT_CHAR_LF:
+      {
+        escaped_byte = LIT_CHAR_LOWERCASE_N;
+        break;
+      }
+      case LIT_CHAR_CR:
+      {
+        escaped_byte = LIT_CHAR_LOWERCASE_R;
+        break;
+      }
+      case LIT_CHAR_TAB:
+      {
+        escaped_byte = LIT_CHAR_LOWERCASE_T;
+        break;
+      }
+      default:
+      {
+        if (byte >= LIT_CHAR_SP)
+        {
+          *write_p++ = byte;
+        }
+        else
+        {
+          const lit_utf8_byte_t hex_digits[] = "0123456789abcdef";
+
+          *write_p++ = LIT_CHAR_BACKSLASH;
+          *write_p++ = LIT_CHAR_LOWERCASE_U;
+          *write_p++ = LIT_CHAR_0;
+          *write_p++ = LIT_CHAR_0;
+          *write_p++ = hex_digits[byte >> 4u];
+          *write_p++ = hex_digits[byte & 0xfu];
+        }
+
+        continue;
+      }
+    }
+
+    *write_p++ = LIT_CHAR_BACKSLASH;
+    *write_p++ = escaped_byte;
+  }
+
+  /* 3. */
+  *write_p++ = LIT_CHAR_DOUBLE_QUOTE;
+
+  buffer_p->size += (lit_utf8_size_t) (write_p - write_start_p);
+
+  MEM_FINALIZE_LOCAL_ARRAY (rest_p);
+} /* ecma_builtin_json_buffer_append_quoted_string */
+
+/**
+ * Append number to JSON.stringify's buffer
+ *
+ * See also:
+ *          ECMA-262 v5, 15.12.3, abstract operation Str, step 9
+ */
+static void
+ecma_builtin_json_buffer_append_number (ecma_json_buffer_t *buffer_p, /**< buffer */
+                                        ecma_value_t value) /**< number value */
+{
+  if (ecma_is_value_integer_number (value))
+  {
+    ecma_integer_value_t integer = ecma_get_integer_from_value (value);
+    lit_utf8_byte_t *chars_p = ecma_builtin_json_buffer_reserve (buffer_p, ECMA_MAX_CHARS_IN_STRINGIFIED_UINT32 + 1);
+
+    if (integer < 0)
+    {
+      *chars_p++ = LIT_CHAR_MINUS;
+      buffer_p->size++;
+
+      integer = -integer;
+    }
+
+    buffer_p->size += (lit_utf8_size_t) ecma_uint32_to_utf8_string ((uint32_t) integer,
+                                                                     chars_p,
+                                                                     ECMA_MAX_CHARS_IN_STRINGIFIED_UINT32);
+    return;
+  }
+
+  const ecma_number_t num = ecma_get_number_from_value (value);
+
+  if (ecma_number_is_nan (num)
+      || ecma_number_is_infinity (num))
+  {
+    ecma_builtin_json_buffer_append_magic_string (buffer_p, LIT_MAGIC_STRING_NULL);
+    return;
+  }
+
+  lit_utf8_byte_t *chars_p = ecma_builtin_json_buffer_reserve (buffer_p, ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER);
+
+  buffer_p->size += ecma_number_to_utf8_string (num, chars_p, ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER);
+} /* ecma_builtin_json_buffer_append_number */
+
+/**
+ * Start new line of the JSON text and append current indent to JSON.stringify's buffer
+ */
+static void
+ecma_builtin_json_buffer_append_indent (ecma_json_stringify_context_t *context_p, /**< context */
+                                        uint32_t indent_level) /**< number of gaps in the indent */
+{
+  JERRY_ASSERT (context_p->gap_size != 0);
+
+  ecma_builtin_json_buffer_append_char (&context_p->buffer, LIT_CHAR_LF);
+
+  for (uint32_t i = 0; i < indent_level; i++)
+  {
+    ecma_builtin_json_buffer_append (&context_p->buffer, context_p->gap, context_p->gap_size);
+  }
+} /* ecma_builtin_json_buffer_append_indent */
+
+static ecma_completion_value_t
+ecma_builtin_json_str (ecma_json_stringify_context_t *context_p, ecma_object_t *holder_p,
+                       ecma_string_t *key_p, ecma_value_t value);
+
+/**
+ * Check that the object is not being serialized and push it to the stack of JSON.stringify
+ *
+ * See also:
+ *          ECMA-262 v5, 15.12.3, abstract operations JO and JA, steps 1, 2 and 3
+ *
+ * @return true - if the object was pushed,
+ *         false - if the structure is cyclical.
+ */
+static bool
+ecma_builtin_json_push_object (ecma_json_stringify_context_t *context_p, /**< context */
+                               ecma_json_stack_item_t *item_p, /**< stack item for the object */
+                               ecma_object_t *obj_p) /**< object */
+{
+  for (const ecma_json_stack_item_t *iter_p = context_p->stack_top_p;
+       iter_p != NULL;
+       iter_p = iter_p->prev_p)
+  {
+    if (iter_p->object_p == obj_p)
+    {
+      return false;
+    }
+  }
+
+  item_p->object_p = obj_p;
+  item_p->prev_p = context_p->stack_top_p;
+
+  context_p->stack_top_p = item_p;
+  context_p->indent_level++;
+
+  return true;
+} /* ecma_builtin_json_push_object */
+
+/**
+ * Pop the object from the stack of JSON.stringify
+ *
+ * See also:
+ *          ECMA-262 v5, 15.12.3, abstract operations JO and JA, steps 11 and 12
+ */
+static void
+ecma_builtin_json_pop_object (ecma_json_stringify_context_t *context_p) /**< context */
+{
+  JERRY_ASSERT (context_p->stack_top_p != NULL && context_p->indent_level > 0);
+
+  context_p->stack_top_p = context_p->stack_top_p->prev_p;
+  context_p->indent_level--;
+} /* ecma_builtin_json_pop_object */
+
+/**
+ * Abstract operation JO of JSON.stringify
+ *
+ * Members are written to the buffer right away, and are removed from the buffer, if their values
+ * are not serializable.
+ *
+ * See also:
+ *          ECMA-262 v5, 15.12.3
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value.
+ */
+static ecma_completion_value_t
+ecma_builtin_json_serialize_object (ecma_json_stringify_context_t *context_p, /**< context */
+                                    ecma_object_t *obj_p) /**< object */
+{
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  /* 1. - 4. */
+  ecma_json_stack_item_t stack_item;
+
+  if (!ecma_builtin_json_push_object (context_p, &stack_item, obj_p))
+  {
+    return ecma_make_throw_obj_completion_value (ecma_new_standard_error (ECMA_ERROR_TYPE));
+  }
+
+  /* 5. - 6. */
+  ecma_length_t names_number;
+
+  if (context_p->property_list_p != NULL)
+  {
+    names_number = context_p->property_list_length;
+  }
+  else
+  {
+    names_number = ecma_builtin_json_get_own_enumerable_names (obj_p, NULL);
+  }
+
+  MEM_DEFINE_LOCAL_ARRAY (own_names_p, (context_p->property_list_p != NULL) ? 0 : names_number, ecma_string_t *);
+
+  ecma_string_t **names_p = context_p->property_list_p;
+
+  if (names_p == NULL)
+  {
+    ecma_builtin_json_get_own_enumerable_names (obj_p, own_names_p);
+    names_p = own_names_p;
+  }
+
+  ecma_json_buffer_t *buffer_p = &context_p->buffer;
+  bool is_empty = true;
+
+  ecma_builtin_json_buffer_append_char (buffer_p, LIT_CHAR_LEFT_BRACE);
+
+  /* 8. */
+  for (ecma_length_t i = 0; i < names_number && ecma_is_completion_value_empty (ret_value); i++)
+  {
+    const lit_utf8_size_t member_start = buffer_p->size;
+
+    if (!is_empty)
+    {
+      ecma_builtin_json_buffer_append_char (buffer_p, LIT_CHAR_COMMA);
+    }
+
+    if (context_p->gap_size != 0)
+    {
+      ecma_builtin_json_buffer_append_indent (context_p, context_p->indent_level);
+    }
+
+    /* 8.b.i - 8.b.iii */
+    ecma_builtin_json_buffer_append_quoted_string (buffer_p, names_p[i]);
+    ecma_builtin_json_buffer_append_char (buffer_p, LIT_CHAR_COLON);
+
+    if (context_p->gap_size != 0)
+    {
+      ecma_builtin_json_buffer_append_char (buffer_p, LIT_CHAR_SP);
+    }
+
+    /* 8.a */
+    ECMA_TRY_CATCH (value, ecma_op_object_get (obj_p, names_p[i]), ret_value);
+    ECMA_TRY_CATCH (str_result, ecma_builtin_json_str (context_p, obj_p, names_p[i], value), ret_value);
+
+    /* 8.b */
+    if (ecma_is_value_undefined (str_result))
+    {
+      buffer_p->size = member_start;
+    }
+    else
+    {
+      is_empty = false;
+    }
+
+    ECMA_FINALIZE (str_result);
+    ECMA_FINALIZE (value);
+  }
+
+  if (ecma_is_completion_value_empty (ret_value))
+  {
+    /* 9. - 10. */
+    if (!is_empty && context_p->gap_size != 0)
+    {
+      ecma_builtin_json_buffer_append_indent (context_p, context_p->indent_level - 1);
+    }
+
+    ecma_builtin_json_buffer_append_char (buffer_p, LIT_CHAR_RIGHT_BRACE);
+
+    ret_value = ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_TRUE);
+  }
+
+  if (own_names_p != NULL)
+  {
+    for (ecma_length_t i = 0; i < names_number; i++)
+    {
+      ecma_deref_ecma_string (own_names_p[i]);
+    }
+  }
+
+  MEM_FINALIZE_LOCAL_ARRAY (own_names_p);
+
+  /* 11. - 12. */
+  ecma_builtin_json_pop_object (context_p);
+
+  return ret_value;
+} /* ecma_builtin_json_serialize_object */
+
+/**
+ * Abstract operation JA of JSON.stringify
+ *
+ * Elements of arrays in fast form are read from the vector, and their names are created only if they
+ * are passed to toJSON or ReplacerFunction.
+ *
+ * See also:
+ *          ECMA-262 v5, 15.12.3
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value.
+ */
+static ecma_completion_value_t
+ecma_builtin_json_serialize_array (ecma_json_stringify_context_t *context_p, /**< context */
+                                   ecma_object_t *array_p) /**< array */
+{
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  /* 1. - 4. */
+  ecma_json_stack_item_t stack_item;
+
+  if (!ecma_builtin_json_push_object (context_p, &stack_item, array_p))
+  {
+    return ecma_make_throw_obj_completion_value (ecma_new_standard_error (ECMA_ERROR_TYPE));
+  }
+
+  ecma_json_buffer_t *buffer_p = &context_p->buffer;
+
+  /* 6. */
+  ecma_string_t *magic_string_length_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
+
+  ECMA_TRY_CATCH (length_value, ecma_op_object_get (array_p, magic_string_length_p), ret_value);
+  ECMA_OP_TO_NUMBER_TRY_CATCH (length_number, length_value, ret_value);
+
+  const uint32_t length = ecma_number_to_uint32 (length_number);
+
+  ecma_builtin_json_buffer_append_char (buffer_p, LIT_CHAR_LEFT_SQUARE);
+
+  /* 8. */
+  for (uint32_t index = 0; index < length && ecma_is_completion_value_empty (ret_value); index++)
+  {
+    if (index != 0)
+    {
+      ecma_builtin_json_buffer_append_char (buffer_p, LIT_CHAR_COMMA);
+    }
+
+    if (context_p->gap_size != 0)
+    {
+      ecma_builtin_json_buffer_append_indent (context_p, context_p->indent_level);
+    }
+
+    ecma_fast_array_elements_t *elements_p = ecma_get_object_fast_elements (array_p);
+    ecma_string_t *index_str_p = NULL;
+    ecma_completion_value_t element_completion;
+
+    if (elements_p != NULL
+        && index < elements_p->length)
+    {
+      ecma_value_t element_value = ECMA_FAST_ARRAY_ELEMENTS_GET_VALUES (elements_p)[index];
+
+      element_completion = ecma_make_normal_completion_value (ecma_copy_value (element_value, true));
+    }
+    else
+    {
+      index_str_p = ecma_new_ecma_string_from_uint32 (index);
+
+      element_completion = ecma_op_object_get (array_p, index_str_p);
+    }
+
+    /* 8.a */
+    ECMA_TRY_CATCH (value, element_completion, ret_value);
+
+    if (index_str_p == NULL
+        && (ecma_is_value_object (value) || context_p->replacer_function_p != NULL))
+    {
+      index_str_p = ecma_new_ecma_string_from_uint32 (index);
+    }
+
+    ECMA_TRY_CATCH (str_result, ecma_builtin_json_str (context_p, array_p, index_str_p, value), ret_value);
+
+    /* 8.b */
+    if (ecma_is_value_undefined (str_result))
+    {
+      ecma_builtin_json_buffer_append_magic_string (buffer_p, LIT_MAGIC_STRING_NULL);
+    }
+
+    ECMA_FINALIZE (str_result);
+    ECMA_FINALIZE (value);
+
+    if (index_str_p != NULL)
+    {
+      ecma_deref_ecma_string (index_str_p);
+    }
+  }
+
+  if (ecma_is_completion_value_empty (ret_value))
+  {
+    /* 9. - 10. */
+    if (length != 0 && context_p->gap_size != 0)
+    {
+      ecma_builtin_json_buffer_append_indent (context_p, context_p->indent_level - 1);
+    }
+
+    ecma_builtin_json_buffer_append_char (buffer_p, LIT_CHAR_RIGHT_SQUARE);
+
+    ret_value = ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_TRUE);
+  }
+
+  ECMA_OP_TO_NUMBER_FINALIZE (length_number);
+  ECMA_FINALIZE (length_value);
+
+  ecma_deref_ecma_string (magic_string_length_p);
+
+  /* 11. - 12. */
+  ecma_builtin_json_pop_object (context_p);
+
+  return ret_value;
+} /* ecma_builtin_json_serialize_array */
+
+/**
+ * Steps 4 - 11 of abstract operation Str of JSON.stringify
+ *
+ * See also:
+ *          ECMA-262 v5, 15.12.3
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value.
+ */
+static ecma_completion_value_t
+ecma_builtin_json_str_value (ecma_json_stringify_context_t *context_p, /**< context */
+                             ecma_value_t value) /**< value */
+{
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+  ecma_json_buffer_t *buffer_p = &context_p->buffer;
+
+  if (ecma_is_value_object (value))
+  {
+    ecma_object_t *obj_p = ecma_get_object_from_value (value);
+    const lit_magic_string_id_t class_name = ecma_object_get_class_name (obj_p);
+
+    /* 4. */
+    if (class_name == LIT_MAGIC_STRING_NUMBER_UL)
+    {
+      ECMA_TRY_CATCH (num_value, ecma_op_to_number (value), ret_value);
+
+      ecma_builtin_json_buffer_append_number (buffer_p, num_value);
+
+      ECMA_FINALIZE (num_value);
+    }
+    else if (class_name == LIT_MAGIC_STRING_STRING_UL)
+    {
+      ECMA_TRY_CATCH (str_value, ecma_op_to_string (value), ret_value);
+
+      ecma_builtin_json_buffer_append_quoted_string (buffer_p, ecma_get_string_from_value (str_value));
+
+      ECMA_FINALIZE (str_value);
+    }
+    else if (class_name == LIT_MAGIC_STRING_BOOLEAN_UL)
+    {
+      ecma_property_t *prim_value_prop_p = ecma_get_internal_property (obj_p,
+                                                                       ECMA_INTERNAL_PROPERTY_PRIMITIVE_BOOLEAN_VALUE);
+      const bool is_true = (prim_value_prop_p->u.internal_property.value == ECMA_SIMPLE_VALUE_TRUE);
+
+      ecma_builtin_json_buffer_append_magic_string (buffer_p,
+                                                    is_true ? LIT_MAGIC_STRING_TRUE : LIT_MAGIC_STRING_FALSE);
+    }
+    else if (ecma_op_is_callable (value))
+    {
+      /* 11. */
+      return ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+    }
+    else if (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_ARRAY)
+    {
+      /* 10.a */
+      return ecma_builtin_json_serialize_array (context_p, obj_p);
+    }
+    else
+    {
+      /* 10.b */
+      return ecma_builtin_json_serialize_object (context_p, obj_p);
+    }
+  }
+  else if (ecma_is_value_null (value))
+  {
+    /* 5. */
+    ecma_builtin_json_buffer_append_magic_string (buffer_p, LIT_MAGIC_STRING_NULL);
+  }
+  else if (ecma_is_value_boolean (value))
+  {
+    /* 6. - 7. */
+    ecma_builtin_json_buffer_append_magic_string (buffer_p,
+                                                  ecma_is_value_true (value) ? LIT_MAGIC_STRING_TRUE
+                                                                             : LIT_MAGIC_STRING_FALSE);
+  }
+  else if (ecma_is_value_string (value))
+  {
+    /* 8. */
+    ecma_builtin_json_buffer_append_quoted_string (buffer_p, ecma_get_string_from_value (value));
+  }
+  else if (ecma_is_value_number (value))
+  {
+    /* 9. */
+    ecma_builtin_json_buffer_append_number (buffer_p, value);
+  }
+  else
+  {
+    /* 11. */
+    JERRY_ASSERT (ecma_is_value_undefined (value));
+
+    return ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+  }
+
+  if (ecma_is_completion_value_empty (ret_value))
+  {
+    ret_value = ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_TRUE);
+  }
+
+  return ret_value;
+} /* ecma_builtin_json_str_value */
+
+/**
+ * Abstract operation Str of JSON.stringify
+ *
+ * The serialized value is written to the context's buffer.
+ *
+ * See also:
+ *          ECMA-262 v5, 15.12.3
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value.
+ *         Normal completion value is true, if the value was serialized,
+ *         or undefined, if the value is not serializable (nothing was written to the buffer).
+ */
+static ecma_completion_value_t
+ecma_builtin_json_str (ecma_json_stringify_context_t *context_p, /**< context */
+                       ecma_object_t *holder_p, /**< holder object */
+                       ecma_string_t *key_p, /**< property name (can be NULL, if the value is not an object
+                                              *   and there is no ReplacerFunction) */
+                       ecma_value_t value) /**< value of the property (step 1) */
+{
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  ecma_value_t current_value = ecma_copy_value (value, true);
+
+  /* 2. */
+  if (ecma_is_value_object (current_value))
+  {
+    JERRY_ASSERT (key_p != NULL);
+
+    ecma_string_t *to_json_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_TO_JSON_UL);
+
+    ECMA_TRY_CATCH (to_json, ecma_op_object_get (ecma_get_object_from_value (current_value), to_json_str_p), ret_value);
+
+    if (ecma_op_is_callable (to_json))
+    {
+      ecma_value_t call_args[] = { ecma_make_string_value (key_p) };
+
+      ECMA_TRY_CATCH (call_value,
+                      ecma_op_function_call (ecma_get_object_from_value (to_json), current_value, call_args, 1),
+                      ret_value);
+
+      ecma_free_value (current_value, true);
+      current_value = ecma_copy_value (call_value, true);
+
+      ECMA_FINALIZE (call_value);
+    }
+
+    ECMA_FINALIZE (to_json);
+
+    ecma_deref_ecma_string (to_json_str_p);
+  }
+
+  /* 3. */
+  if (ecma_is_completion_value_empty (ret_value)
+      && context_p->replacer_function_p != NULL)
+  {
+    JERRY_ASSERT (key_p != NULL && holder_p != NULL);
+
+    ecma_value_t call_args[] = { ecma_make_string_value (key_p), current_value };
+
+    ECMA_TRY_CATCH (call_value,
+                    ecma_op_function_call (context_p->replacer_function_p,
+                                           ecma_make_object_value (holder_p),
+                                           call_args,
+                                           2),
+                    ret_value);
+
+    ecma_free_value (current_value, true);
+    current_value = ecma_copy_value (call_value, true);
+
+    ECMA_FINALIZE (call_value);
+  }
+
+  /* 4. - 11. */
+  if (ecma_is_completion_value_empty (ret_value))
+  {
+    ret_value = ecma_builtin_json_str_value (context_p, current_value);
+  }
+
+  ecma_free_value (current_value, true);
+
+  return ret_value;
+} /* ecma_builtin_json_str */
+
+/**
+ * Create PropertyList of JSON.stringify from the replacer array
+ *
+ * See also:
+ *          ECMA-262 v5, 15.12.3, step 4.b
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value.
+ */
+static ecma_completion_value_t
+ecma_builtin_json_create_property_list (ecma_json_stringify_context_t *context_p, /**< context */
+                                        ecma_object_t *replacer_p) /**< replacer array */
+{
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  ecma_string_t *magic_string_length_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
+
+  ECMA_TRY_CATCH (length_value, ecma_op_object_get (replacer_p, magic_string_length_p), ret_value);
+  ECMA_OP_TO_NUMBER_TRY_CATCH (length_number, length_value, ret_value);
+
+  const uint32_t length = ecma_number_to_uint32 (length_number);
+
+  /* the list is allocated even if it is empty, as empty PropertyList differs from unspecified one */
+  context_p->property_list_size = JERRY_MAX (length, 1u) * sizeof (ecma_string_t *);
+  context_p->property_list_p = (ecma_string_t **) ecma_alloc_buffer (context_p->property_list_size);
+  context_p->property_list_length = 0;
+
+  for (uint32_t index = 0; index < length && ecma_is_completion_value_empty (ret_value); index++)
+  {
+    ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
+
+    /* 4.b.ii.1 */
+    ECMA_TRY_CATCH (value, ecma_op_object_get (replacer_p, index_str_p), ret_value);
+
+    bool is_item = ecma_is_value_string (value) || ecma_is_value_number (value);
+
+    if (ecma_is_value_object (value))
+    {
+      const lit_magic_string_id_t class_name = ecma_object_get_class_name (ecma_get_object_from_value (value));
+
+      is_item = (class_name == LIT_MAGIC_STRING_STRING_UL || class_name == LIT_MAGIC_STRING_NUMBER_UL);
+    }
+
+    if (is_item)
+    {
+      /* 4.b.ii.2 - 4.b.ii.4 */
+      ECMA_TRY_CATCH (item, ecma_op_to_string (value), ret_value);
+
+      ecma_string_t *item_p = ecma_get_string_from_value (item);
+      bool is_duplicate = false;
+
+      /* 4.b.ii.5 */
+      for (ecma_length_t i = 0; i < context_p->property_list_length && !is_duplicate; i++)
+      {
+        is_duplicate = ecma_compare_ecma_strings (context_p->property_list_p[i], item_p);
+      }
+
+      if (!is_duplicate)
+      {
+        context_p->property_list_p[context_p->property_list_length++] = ecma_copy_or_ref_ecma_string (item_p);
+      }
+
+      ECMA_FINALIZE (item);
+    }
+
+    ECMA_FINALIZE (value);
+
+    ecma_deref_ecma_string (index_str_p);
+  }
+
+  ECMA_OP_TO_NUMBER_FINALIZE (length_number);
+  ECMA_FINALIZE (length_value);
+
+  ecma_deref_ecma_string (magic_string_length_p);
+
+  return ret_value;
+} /* ecma_builtin_json_create_property_list */
+
+/**
+ * Initialize gap of JSON.stringify
+ *
+ * See also:
+ *          ECMA-262 v5, 15.12.3, steps 5 - 8
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value.
+ */
+static ecma_completion_value_t
+ecma_builtin_json_init_gap (ecma_json_stringify_context_t *context_p, /**< context */
+                            ecma_value_t space) /**< space argument */
+{
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  bool is_number = ecma_is_value_number (space);
+  bool is_string = ecma_is_value_string (space);
+
+  /* 5. */
+  if (ecma_is_value_object (space))
+  {
+    const lit_magic_string_id_t class_name = ecma_object_get_class_name (ecma_get_object_from_value (space));
+
+    is_number = (class_name == LIT_MAGIC_STRING_NUMBER_UL);
+    is_string = (class_name == LIT_MAGIC_STRING_STRING_UL);
+  }
+
+  if (is_number)
+  {
+    /* 6. */
+    ECMA_OP_TO_NUMBER_TRY_CATCH (space_number, space, ret_value);
+
+    if (space_number >= 1)
+    {
+      ecma_number_t spaces_number = ecma_number_trunc (JERRY_MIN (space_number,
+                                                                  (ecma_number_t) ECMA_BUILTIN_JSON_GAP_MAX_LENGTH));
+
+      context_p->gap_size = (lit_utf8_size_t) spaces_number;
+      memset (context_p->gap, LIT_CHAR_SP, context_p->gap_size);
+    }
+
+    ECMA_OP_TO_NUMBER_FINALIZE (space_number);
+  }
+  else if (is_string)
+  {
+    /* 7. */
+    ECMA_TRY_CATCH (space_str_value, ecma_op_to_string (space), ret_value);
+
+    ecma_string_t *space_str_p = ecma_get_string_from_value (space_str_value);
+    const ecma_length_t space_length = ecma_string_get_length (space_str_p);
+
+    ecma_string_t *gap_str_p = ecma_string_substr (space_str_p,
+                                                   0,
+                                                   JERRY_MIN (space_length, ECMA_BUILTIN_JSON_GAP_MAX_LENGTH));
+
+    ssize_t gap_size = ecma_string_to_utf8_string (gap_str_p, context_p->gap, (ssize_t) sizeof (context_p->gap));
+    JERRY_ASSERT (gap_size >= 0);
+
+    context_p->gap_size = (lit_utf8_size_t) gap_size;
+
+    ecma_deref_ecma_string (gap_str_p);
+
+    ECMA_FINALIZE (space_str_value);
+  }
+
+  return ret_value;
+} /* ecma_builtin_json_init_gap */
+
+/**
+ * The JSON object's 'stringify' routine
+ *
+ * The JSON text is written to a growable buffer, from which the resulting string is created.
+ *
+ * See also:
+ *          ECMA-262 v5, 15.12.3
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value.
+ */
+static ecma_completion_value_t
+ecma_builtin_json_stringify (ecma_value_t this_arg __attr_unused___, /**< 'this' argument */
+                             ecma_value_t arg1, /**< value */
+                             ecma_value_t arg2, /**< replacer */
+                             ecma_value_t arg3) /**< space */
+{
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  /* 1. - 3. */
+  ecma_json_stringify_context_t context;
+  context.buffer.buffer_p = NULL;
+  context.buffer.size = 0;
+  context.buffer.capacity = 0;
+  context.replacer_function_p = NULL;
+  context.property_list_p = NULL;
+  context.property_list_length = 0;
+  context.property_list_size = 0;
+  context.stack_top_p = NULL;
+  context.indent_level = 0;
+  context.gap_size = 0;
+
+  /* 4. */
+  if (ecma_is_value_object (arg2))
+  {
+    ecma_object_t *replacer_p = ecma_get_object_from_value (arg2);
+
+    if (ecma_op_is_callable (arg2))
+    {
+      context.replacer_function_p = replacer_p;
+    }
+    else if (ecma_get_object_type (replacer_p) == ECMA_OBJECT_TYPE_ARRAY)
+    {
+      ret_value = ecma_builtin_json_create_property_list (&context, replacer_p);
+    }
+  }
+
+  /* 5. - 8. */
+  if (ecma_is_completion_value_empty (ret_value))
+  {
+    ret_value = ecma_builtin_json_init_gap (&context, arg3);
+  }
+
+  if (ecma_is_completion_value_empty (ret_value))
+  {
+    /* 9. - 10. (the wrapper is only observable through ReplacerFunction) */
+    ecma_object_t *wrapper_p = NULL;
+    ecma_string_t *empty_string_p = ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
+
+    if (context.replacer_function_p != NULL)
+    {
+      wrapper_p = ecma_op_create_object_object_noarg ();
+
+      ecma_builtin_json_define_property (wrapper_p, empty_string_p, arg1);
+    }
+
+    /* 11. */
+    ECMA_TRY_CATCH (str_result, ecma_builtin_json_str (&context, wrapper_p, empty_string_p, arg1), ret_value);
+
+    if (ecma_is_value_undefined (str_result))
+    {
+      ret_value = ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+    }
+    else
+    {
+      /* surrogates of a pair could be appended separately, e.g. from repeated gap string or from literals */
+      const lit_utf8_size_t result_size = lit_utf8_string_combine_surrogates (context.buffer.buffer_p,
+                                                                              context.buffer.size);
+
+      ecma_string_t *result_p = ecma_new_ecma_string_from_utf8 (context.buffer.buffer_p, result_size);
+
+      ret_value = ecma_make_normal_completion_value (ecma_make_string_value (result_p));
+    }
+
+    ECMA_FINALIZE (str_result);
+
+    if (wrapper_p != NULL)
+    {
+      ecma_deref_object (wrapper_p);
+    }
+
+    ecma_deref_ecma_string (empty_string_p);
+  }
+
+  JERRY_ASSERT (context.stack_top_p == NULL);
+
+  if (context.property_list_p != NULL)
+  {
+    for (ecma_length_t i = 0; i < context.property_list_length; i++)
+    {
+      ecma_deref_ecma_string (context.property_list_p[i]);
+    }
+
+    ecma_dealloc_buffer (context.property_list_p, context.property_list_size);
+  }
+
+  if (context.buffer.buffer_p != NULL)
+  {
+    ecma_dealloc_buffer (context.buffer.buffer_p, context.buffer.capacity);
+  }
+
+  return ret_value;
+} /* ecma_builtin_json_stringify */
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_JSON_BUILTIN */
@@ -91,9 +91,7 @@ ecma_builtin_number_prototype_object_to_string (ecma_value_t this_arg, /**< this
 
   if (ecma_is_value_number (this_arg))
   {
-    ecma_number_t *this_arg_number_p = ecma_get_number_from_value (this_arg);
-
-    this_arg_number = *this_arg_number_p;
+    this_arg_number = ecma_get_number_from_value (this_arg);
   }
   else if (ecma_is_value_object (this_arg))
   {
@@ -199,6 +199,8 @@ ecma_builtin_object_object_seal (ecma_value_t this_arg __attr_unused___, /**< 't
     // 2.
     ecma_object_t *obj_p = ecma_get_object_from_value (arg);
 
+    ecma_op_object_materialize_properties (obj_p);
+
     ecma_property_t *property_p;
     for (property_p = ecma_get_property_list (obj_p);
          property_p != NULL && ecma_is_completion_value_empty (ret_value);
@@ -280,6 +282,8 @@ ecma_builtin_object_object_freeze (ecma_value_t this_arg __attr_unused___, /**<
     // 2.
     ecma_object_t *obj_p = ecma_get_object_from_value (arg);
 
+    ecma_op_object_materialize_properties (obj_p);
+
     ecma_property_t *property_p;
     for (property_p = ecma_get_property_list (obj_p);
          property_p != NULL && ecma_is_completion_value_empty (ret_value);
@@ -409,6 +413,8 @@ ecma_builtin_object_object_is_sealed (ecma_value_t this_arg __attr_unused___, /*
       sealed = true;
     }
 
+    ecma_op_object_materialize_properties (obj_p);
+
     // 2.
     for (property_p = ecma_get_property_list (obj_p);
          property_p != NULL && sealed;
@@ -474,6 +480,8 @@ ecma_builtin_object_object_is_frozen (ecma_value_t this_arg __attr_unused___, /*
       frozen = true;
     }
 
+    ecma_op_object_materialize_properties (obj_p);
+
     // 2.
     for (property_p = ecma_get_property_list (obj_p);
          property_p != NULL && frozen;
@@ -718,6 +726,8 @@ ecma_builtin_object_object_define_properties (ecma_value_t this_arg __attr_unuse
     ecma_object_t *props_p = ecma_get_object_from_value (props);
     ecma_property_t *property_p;
 
+    ecma_op_object_materialize_properties (props_p);
+
     // First we need to know how many properties should be stored
     uint32_t property_number = 0;
     for (property_p = ecma_get_property_list (props_p);
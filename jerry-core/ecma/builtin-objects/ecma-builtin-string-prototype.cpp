@@ -496,8 +496,7 @@ ecma_builtin_string_prototype_object_trim (ecma_value_t this_arg) /**< this argu
   const ecma_length_t length = ecma_string_get_size (original_string_p);
 
   /* Workaround: avoid repeated call of ecma_string_get_char_at_pos() because its overhead */
-  lit_utf8_byte_t *original_utf8_str_p = (lit_utf8_byte_t *) mem_heap_alloc_block (size + 1,
-                                                                                   MEM_HEAP_ALLOC_SHORT_TERM);
+  lit_utf8_byte_t *original_utf8_str_p = (lit_utf8_byte_t *) ecma_alloc_buffer (size + 1);
   ecma_string_to_utf8_string (original_string_p, original_utf8_str_p, (ssize_t) size);
 
   uint32_t prefix = 0, postfix = 0;
@@ -522,7 +521,7 @@ ecma_builtin_string_prototype_object_trim (ecma_value_t this_arg) /**< this argu
   /* 4 */
   ret_value = ecma_make_normal_completion_value (ecma_make_string_value (new_str_p));
 
-  mem_heap_free_block (original_utf8_str_p);
+  ecma_dealloc_buffer (original_utf8_str_p, size + 1);
 
   ECMA_FINALIZE (to_string_val);
   ECMA_FINALIZE (check_coercible_val);
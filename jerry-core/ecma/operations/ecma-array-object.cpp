@@ -17,6 +17,7 @@
 #include "ecma-array-object.h"
 #include "ecma-builtins.h"
 #include "ecma-exceptions.h"
+#include "ecma-fast-array.h"
 #include "ecma-gc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
@@ -81,9 +82,9 @@ ecma_op_create_array_object (const ecma_value_t *arguments_list_p, /**< list of
       && arguments_list_len == 1
       && ecma_is_value_number (arguments_list_p[0]))
   {
-    ecma_number_t *num_p = ecma_get_number_from_value (arguments_list_p[0]);
-    uint32_t num_uint32 = ecma_number_to_uint32 (*num_p);
-    if (*num_p != ecma_uint32_to_number (num_uint32))
+    ecma_number_t num = ecma_get_number_from_value (arguments_list_p[0]);
+    uint32_t num_uint32 = ecma_number_to_uint32 (num);
+    if (num != ecma_uint32_to_number (num_uint32))
     {
       return ecma_make_throw_obj_completion_value (ecma_new_standard_error (ECMA_ERROR_RANGE));
     }
@@ -123,42 +124,56 @@ ecma_op_create_array_object (const ecma_value_t *arguments_list_p, /**< list of
   ecma_property_t *length_prop_p = ecma_create_named_data_property (obj_p,
                                                                     length_magic_string_p,
                                                                     true, false, false);
-  ecma_set_named_data_property_value (length_prop_p, ecma_make_number_value (length_num_p));
+  ecma_set_named_data_property_value (obj_p, length_prop_p, ecma_make_number_value (length_num_p));
 
   ecma_deref_ecma_string (length_magic_string_p);
 
-  for (uint32_t index = 0;
-       index < array_items_count;
-       index++)
+  if (array_items_count == length)
   {
-    ecma_string_t* item_name_string_p = ecma_new_ecma_string_from_uint32 (index);
-
-    ecma_property_descriptor_t item_prop_desc = ecma_make_empty_property_descriptor ();
-    {
-      item_prop_desc.is_value_defined = true;
-      item_prop_desc.value = array_items_p[index];
-
-      item_prop_desc.is_writable_defined = true;
-      item_prop_desc.is_writable = true;
-
-      item_prop_desc.is_enumerable_defined = true;
-      item_prop_desc.is_enumerable = true;
-
-      item_prop_desc.is_configurable_defined = true;
-      item_prop_desc.is_configurable = true;
-    }
-
-    ecma_op_object_define_own_property (obj_p,
-                                        item_name_string_p,
-                                        &item_prop_desc,
-                                        false);
-
-    ecma_deref_ecma_string (item_name_string_p);
+    /* the array has no holes, so it is created in fast form */
+    ecma_fast_array_init (obj_p, array_items_p, array_items_count);
+  }
+  else
+  {
+    JERRY_ASSERT (array_items_count == 0);
   }
 
   return ecma_make_normal_completion_value (ecma_make_object_value (obj_p));
 } /* ecma_op_create_array_object */
 
+/**
+ * Check whether the property descriptor describes element of an array in fast form,
+ * i.e. data property with 'Writable', 'Enumerable' and 'Configurable' attributes set to true
+ *
+ * @return true / false
+ */
+static bool
+ecma_op_array_object_is_default_element_descriptor (const ecma_property_descriptor_t* desc_p, /**< descriptor */
+                                                    bool is_element_exists) /**< is the element already present
+                                                                             *   (if so, absent attributes keep
+                                                                             *   their values, otherwise,
+                                                                             *   they are set to false) */
+{
+  if (desc_p->is_get_defined
+      || desc_p->is_set_defined)
+  {
+    return false;
+  }
+
+  if (is_element_exists)
+  {
+    return ((!desc_p->is_writable_defined || desc_p->is_writable)
+            && (!desc_p->is_enumerable_defined || desc_p->is_enumerable)
+            && (!desc_p->is_configurable_defined || desc_p->is_configurable));
+  }
+  else
+  {
+    return (desc_p->is_writable_defined && desc_p->is_writable
+            && desc_p->is_enumerable_defined && desc_p->is_enumerable
+            && desc_p->is_configurable_defined && desc_p->is_configurable);
+  }
+} /* ecma_op_array_object_is_default_element_descriptor */
+
 /**
  * [[DefineOwnProperty]] ecma array object's operation
  *
@@ -186,8 +201,7 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
   // 2.
   ecma_value_t old_len_value = ecma_get_named_data_property_value (len_prop_p);
 
-  ecma_number_t *num_p = ecma_get_number_from_value (old_len_value);
-  uint32_t old_len_uint32 = ecma_number_to_uint32 (*num_p);
+  uint32_t old_len_uint32 = ecma_number_to_uint32 (ecma_get_number_from_value (old_len_value));
 
   // 3.
   bool is_property_name_equal_length = ecma_compare_ecma_strings (property_name_p,
@@ -197,6 +211,14 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
 
   if (is_property_name_equal_length)
   {
+    if (ecma_get_object_fast_elements (obj_p) != NULL
+        && property_desc_p->is_writable_defined
+        && !property_desc_p->is_writable)
+    {
+      /* 'length' of arrays in fast form is always writable */
+      ecma_fast_array_convert_to_property_list (obj_p);
+    }
+
     // a.
     if (!property_desc_p->is_value_defined)
     {
@@ -216,7 +238,7 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
     JERRY_ASSERT (ecma_is_completion_value_normal (completion)
                   && ecma_is_value_number (ecma_get_completion_value_value (completion)));
 
-    new_len_num = *ecma_get_number_from_completion_value (completion);
+    new_len_num = ecma_get_number_from_completion_value (completion);
 
     ecma_free_completion_value (completion);
 
@@ -229,6 +251,13 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
     }
     else
     {
+      if (new_len_uint32 > old_len_uint32
+          && ecma_get_object_fast_elements (obj_p) != NULL)
+      {
+        /* increasing length creates holes, that are not allowed in arrays in fast form */
+        ecma_fast_array_convert_to_property_list (obj_p);
+      }
+
       // b., e.
       ecma_number_t *new_len_num_p = ecma_alloc_number ();
       *new_len_num_p = new_len_num;
@@ -299,6 +328,14 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
 
             bool reduce_succeeded = true;
 
+            if (ecma_get_object_fast_elements (obj_p) != NULL)
+            {
+              /* elements of arrays in fast form are configurable, so all of them are successfully deleted */
+              ecma_fast_array_truncate (obj_p, new_len_uint32);
+
+              old_len_uint32 = new_len_uint32;
+            }
+
             while (new_len_uint32 < old_len_uint32)
             {
               // i
@@ -314,9 +351,7 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
               // iii
               if (ecma_is_completion_value_normal_false (delete_succeeded))
               {
-                JERRY_ASSERT (ecma_is_value_number (new_len_property_desc.value));
-
-                ecma_number_t *new_len_num_p = ecma_get_number_from_value (new_len_property_desc.value);
+                JERRY_ASSERT (new_len_property_desc.value == ecma_make_number_value (new_len_num_p));
 
                 // 1.
                 *new_len_num_p = ecma_uint32_to_number (old_len_uint32 + 1);
@@ -386,29 +421,8 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
   {
     // 4.a.
     uint32_t index;
-    bool is_index;
-
-    if (property_name_p->container == ECMA_STRING_CONTAINER_UINT32_IN_DESC)
-    {
-      index = property_name_p->u.uint32_number;
-      is_index = true;
-    }
-    else
-    {
-      ecma_number_t number = ecma_string_to_number (property_name_p);
-      index = ecma_number_to_uint32 (number);
 
-      ecma_string_t *to_uint32_to_string_p = ecma_new_ecma_string_from_uint32 (index);
-
-      is_index = ecma_compare_ecma_strings (property_name_p,
-                                            to_uint32_to_string_p);
-
-      ecma_deref_ecma_string (to_uint32_to_string_p);
-    }
-
-    is_index = is_index && (index != ECMA_MAX_VALUE_OF_VALID_ARRAY_INDEX);
-
-    if (!is_index)
+    if (!ecma_string_get_array_index (property_name_p, &index))
     {
       // 5.
       return ecma_op_general_object_define_own_property (obj_p,
@@ -419,6 +433,41 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
 
     // 4.
 
+    if (ecma_get_object_fast_elements (obj_p) != NULL)
+    {
+      if (ecma_op_array_object_is_default_element_descriptor (property_desc_p, index < old_len_uint32))
+      {
+        if (index < old_len_uint32)
+        {
+          // c., f.
+          if (property_desc_p->is_value_defined)
+          {
+            ecma_fast_array_assign_value (obj_p, index, property_desc_p->value);
+          }
+
+          return ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_TRUE);
+        }
+        else if (index == old_len_uint32
+                 && ecma_get_object_extensible (obj_p))
+        {
+          // c., e., f.
+          ecma_value_t value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+
+          if (property_desc_p->is_value_defined)
+          {
+            value = property_desc_p->value;
+          }
+
+          ecma_fast_array_append (obj_p, value);
+
+          return ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_TRUE);
+        }
+      }
+
+      /* the element would be a hole, or would have non-default attributes */
+      ecma_fast_array_convert_to_property_list (obj_p);
+    }
+
     // b.
     if (index >= old_len_uint32
         && !ecma_is_property_writable (len_prop_p))
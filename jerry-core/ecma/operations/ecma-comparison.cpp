@@ -73,8 +73,8 @@ ecma_op_abstract_equality_compare (ecma_value_t x, /**< first operand */
     }
     else if (is_x_number)
     { // c.
-      ecma_number_t x_num = *ecma_get_number_from_value (x);
-      ecma_number_t y_num = *ecma_get_number_from_value (y);
+      ecma_number_t x_num = ecma_get_number_from_value (x);
+      ecma_number_t y_num = ecma_get_number_from_value (y);
 
       bool is_x_equal_to_y = (x_num == y_num);
 
@@ -268,8 +268,8 @@ ecma_op_strict_equality_compare (ecma_value_t x, /**< first operand */
     // d. If x is +0 and y is -0, return true.
     // e. If x is -0 and y is +0, return true.
 
-    ecma_number_t x_num = *ecma_get_number_from_value (x);
-    ecma_number_t y_num = *ecma_get_number_from_value (y);
+    ecma_number_t x_num = ecma_get_number_from_value (x);
+    ecma_number_t y_num = ecma_get_number_from_value (y);
 
     bool is_x_equal_to_y = (x_num == y_num);
 
@@ -333,6 +333,15 @@ ecma_op_abstract_relational_compare (ecma_value_t x, /**< first operand */
                                      ecma_value_t y, /**< second operand */
                                      bool left_first) /**< 'LeftFirst' flag */
 {
+  if (ecma_is_value_integer_number (x)
+      && ecma_is_value_integer_number (y))
+  {
+    /* integer numbers are primitive, finite and not -0, so steps 3.e - 3.l reduce to comparison of the integers */
+    const bool is_x_less_than_y = (ecma_get_integer_from_value (x) < ecma_get_integer_from_value (y));
+
+    return ecma_make_simple_completion_value (is_x_less_than_y ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+  }
+
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
 
   ecma_value_t first_converted_value = left_first ? x : y;
@@ -111,22 +111,22 @@ ecma_op_same_value (ecma_value_t x, /**< ecma-value */
 
   if (is_x_number)
   {
-    ecma_number_t *x_num_p = ecma_get_number_from_value (x);
-    ecma_number_t *y_num_p = ecma_get_number_from_value (y);
+    ecma_number_t x_num = ecma_get_number_from_value (x);
+    ecma_number_t y_num = ecma_get_number_from_value (y);
 
-    if (ecma_number_is_nan (*x_num_p)
-        && ecma_number_is_nan (*y_num_p))
+    if (ecma_number_is_nan (x_num)
+        && ecma_number_is_nan (y_num))
     {
       return true;
     }
-    else if (ecma_number_is_zero (*x_num_p)
-             && ecma_number_is_zero (*y_num_p)
-             && ecma_number_is_negative (*x_num_p) != ecma_number_is_negative (*y_num_p))
+    else if (ecma_number_is_zero (x_num)
+             && ecma_number_is_zero (y_num)
+             && ecma_number_is_negative (x_num) != ecma_number_is_negative (y_num))
     {
       return false;
     }
 
-    return (*x_num_p == *y_num_p);
+    return (x_num == y_num);
   }
 
   if (is_x_string)
@@ -203,10 +203,10 @@ ecma_op_to_boolean (ecma_value_t value) /**< ecma-value */
   }
   else if (ecma_is_value_number (value))
   {
-    ecma_number_t *num_p = ecma_get_number_from_value (value);
+    ecma_number_t num = ecma_get_number_from_value (value);
 
-    if (ecma_number_is_nan (*num_p)
-        || ecma_number_is_zero (*num_p))
+    if (ecma_number_is_nan (num)
+        || ecma_number_is_zero (num))
     {
       ret_value = ECMA_SIMPLE_VALUE_FALSE;
     }
@@ -348,8 +348,8 @@ ecma_op_to_string (ecma_value_t value) /**< ecma-value */
     }
     else if (ecma_is_value_number (value))
     {
-      ecma_number_t *num_p = ecma_get_number_from_value (value);
-      res_p = ecma_new_ecma_string_from_number (*num_p);
+      ecma_number_t num = ecma_get_number_from_value (value);
+      res_p = ecma_new_ecma_string_from_number (num);
     }
     else if (ecma_is_value_undefined (value))
     {
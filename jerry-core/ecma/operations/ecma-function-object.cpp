@@ -23,6 +23,7 @@
 #include "ecma-objects.h"
 #include "ecma-objects-general.h"
 #include "ecma-objects-arguments.h"
+#include "ecma-shapes.h"
 #include "ecma-try-catch-macro.h"
 
 #define JERRY_INTERNAL
@@ -184,6 +185,7 @@ ecma_op_create_function_object (ecma_string_t* formal_parameter_list_p[], /**< f
   // 9.
   ecma_property_t *scope_prop_p = ecma_create_internal_property (f, ECMA_INTERNAL_PROPERTY_SCOPE);
   ECMA_SET_POINTER (scope_prop_p->u.internal_property.value, scope_p);
+  ecma_gc_write_barrier (f, scope_p);
 
   // 10., 11.
   ecma_property_t *formal_parameters_prop_p = ecma_create_internal_property (f,
@@ -372,6 +374,243 @@ ecma_op_create_external_function_object (ecma_external_pointer_t code_p) /**< po
   return function_obj_p;
 } /* ecma_op_create_external_function_object */
 
+/**
+ * Add name to table of names of a lexical environment's bindings, if the table doesn't contain the name yet
+ *
+ * @return index of the name in the table
+ */
+static ecma_length_t
+ecma_op_function_add_slot_name (ecma_string_t *names_p[], /**< names table */
+                                ecma_length_t *names_number_p, /**< in-out: number of names in the table */
+                                ecma_string_t *name_p) /**< name to add */
+{
+  for (ecma_length_t slot = 0; slot < *names_number_p; slot++)
+  {
+    if (ecma_compare_ecma_strings (names_p[slot], name_p))
+    {
+      return slot;
+    }
+  }
+
+  names_p[*names_number_p] = ecma_copy_or_ref_ecma_string (name_p);
+
+  return (*names_number_p)++;
+} /* ecma_op_function_add_slot_name */
+
+/**
+ * Get names of bindings of the function's local lexical environment,
+ * if the environment can store the bindings in array of slots
+ *
+ * Note:
+ *      the table is built upon first call of the function, and is held by the function object
+ *      (see also: ecma_lex_env_slot_names_t)
+ *
+ * @return pointer to the names table - if the bindings can be stored in slots,
+ *         NULL - otherwise (the function's code performs direct call to eval, that can introduce
+ *                new bindings, or the function has too many bindings).
+ */
+static ecma_lex_env_slot_names_t*
+ecma_op_function_get_slot_names (ecma_object_t *func_obj_p, /**< Function object */
+                                 const opcode_t *opcodes_p, /**< byte-code array */
+                                 opcode_counter_t code_first_opcode_idx, /**< index of first opcode
+                                                                          *   of function's body */
+                                 bool do_instantiate_args_obj) /**< flag indicating whether Arguments object
+                                                                *   should be instantiated */
+{
+  ecma_property_t *slot_names_prop_p = ecma_find_internal_property (func_obj_p,
+                                                                    ECMA_INTERNAL_PROPERTY_LEX_ENV_SLOT_NAMES);
+
+  if (likely (slot_names_prop_p != NULL))
+  {
+    return ECMA_GET_POINTER (ecma_lex_env_slot_names_t, slot_names_prop_p->u.internal_property.value);
+  }
+
+  /* the property with null value indicates that local environments of the function are property lists */
+  slot_names_prop_p = ecma_create_internal_property (func_obj_p, ECMA_INTERNAL_PROPERTY_LEX_ENV_SLOT_NAMES);
+
+  opcode_scope_code_flags_t scope_flags = vm_get_scope_flags (opcodes_p,
+                                                              (opcode_counter_t) (code_first_opcode_idx - 1));
+
+  if (!(scope_flags & OPCODE_SCOPE_CODE_FLAGS_NOT_REF_EVAL_IDENTIFIER))
+  {
+    return NULL;
+  }
+
+  ecma_property_t *formal_parameters_prop_p = ecma_get_internal_property (func_obj_p,
+                                                                          ECMA_INTERNAL_PROPERTY_FORMAL_PARAMETERS);
+  ecma_collection_header_t *formal_parameters_p;
+  formal_parameters_p = ECMA_GET_POINTER (ecma_collection_header_t,
+                                          formal_parameters_prop_p->u.internal_property.value);
+
+  const ecma_length_t formal_parameters_number = (formal_parameters_p != NULL ? formal_parameters_p->unit_number
+                                                                              : 0);
+
+  JERRY_ASSERT (vm_get_opcode (opcodes_p, code_first_opcode_idx).op_idx == __op__idx_reg_var_decl);
+  const opcode_counter_t decls_begin_oc = (opcode_counter_t) (code_first_opcode_idx + 1);
+
+  ecma_length_t decls_number = 0;
+
+  for (opcode_counter_t oc = decls_begin_oc;
+       vm_get_next_declared_name (opcodes_p, &oc).packed_value != MEM_CP_NULL;
+       decls_number++)
+  {
+  }
+
+  const ecma_length_t max_names_number = formal_parameters_number + decls_number + 1u;
+
+  if (max_names_number > ECMA_LEX_ENV_MAX_SLOTS)
+  {
+    return NULL;
+  }
+
+  ecma_lex_env_slot_names_t *slot_names_p;
+
+  MEM_DEFINE_LOCAL_ARRAY (names_p, max_names_number, ecma_string_t*);
+
+  ecma_length_t names_number = 0;
+
+  if (formal_parameters_p != NULL)
+  {
+    ecma_collection_iterator_t formal_params_iterator;
+    ecma_collection_iterator_init (&formal_params_iterator, formal_parameters_p);
+
+    while (ecma_collection_iterator_next (&formal_params_iterator))
+    {
+      ecma_op_function_add_slot_name (names_p,
+                                      &names_number,
+                                      ecma_get_string_from_value (*formal_params_iterator.current_value_p));
+    }
+  }
+
+  const ecma_length_t params_number = names_number;
+
+  opcode_counter_t oc = decls_begin_oc;
+  lit_cpointer_t name_lit_cp;
+
+  while ((name_lit_cp = vm_get_next_declared_name (opcodes_p, &oc)).packed_value != MEM_CP_NULL)
+  {
+    ecma_string_t *name_p = ecma_new_ecma_string_from_lit_cp (name_lit_cp);
+    ecma_op_function_add_slot_name (names_p, &names_number, name_p);
+    ecma_deref_ecma_string (name_p);
+  }
+
+  ecma_length_t arguments_slot = ECMA_LEX_ENV_NO_SLOT;
+
+  if (do_instantiate_args_obj)
+  {
+    /* the Arguments object is not instantiated, if there is a formal parameter, named 'arguments' */
+    ecma_string_t *arguments_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_ARGUMENTS);
+
+    arguments_slot = ecma_op_function_add_slot_name (names_p, &names_number, arguments_string_p);
+
+    if (arguments_slot < params_number)
+    {
+      arguments_slot = ECMA_LEX_ENV_NO_SLOT;
+    }
+
+    ecma_deref_ecma_string (arguments_string_p);
+  }
+
+  slot_names_p = (ecma_lex_env_slot_names_t *) mem_heap_alloc_block (sizeof (ecma_lex_env_slot_names_t)
+                                                                     + names_number * sizeof (mem_cpointer_t),
+                                                                     MEM_HEAP_ALLOC_LONG_TERM);
+
+  slot_names_p->names_number = names_number;
+  slot_names_p->params_number = params_number;
+  slot_names_p->arguments_slot = arguments_slot;
+
+  mem_cpointer_t *slot_names_cp_p = ECMA_LEX_ENV_SLOT_NAMES_GET_NAMES (slot_names_p);
+
+  for (ecma_length_t slot = 0; slot < names_number; slot++)
+  {
+    ECMA_SET_NON_NULL_POINTER (slot_names_cp_p[slot], names_p[slot]);
+  }
+
+  MEM_FINALIZE_LOCAL_ARRAY (names_p);
+
+  ECMA_SET_NON_NULL_POINTER (slot_names_prop_p->u.internal_property.value, slot_names_p);
+
+  return slot_names_p;
+} /* ecma_op_function_get_slot_names */
+
+/**
+ * Setup formal parameters' bindings and, if necessary, Arguments object with 'arguments' binding
+ * in local lexical environment of a function, that stores its bindings in array of slots.
+ *
+ * See also:
+ *          ecma_function_call_setup_args_variables
+ */
+static void
+ecma_function_call_setup_args_slots (ecma_object_t *func_obj_p, /**< Function object */
+                                     ecma_object_t *env_p, /**< slots lexical environment */
+                                     ecma_collection_header_t *formal_parameters_p, /**< formal parameters */
+                                     const ecma_value_t *arguments_list_p, /**< arguments list */
+                                     ecma_length_t arguments_list_len, /**< length of argument list */
+                                     bool is_strict) /**< flag indicating strict mode */
+{
+  ecma_lex_env_slots_t *slots_p = ecma_get_lex_env_slots (env_p);
+  const ecma_lex_env_slot_names_t *slot_names_p = ECMA_GET_NON_NULL_POINTER (ecma_lex_env_slot_names_t,
+                                                                            slots_p->names_cp);
+  const mem_cpointer_t *names_p = ECMA_LEX_ENV_SLOT_NAMES_GET_NAMES (slot_names_p);
+
+  if (formal_parameters_p != NULL)
+  {
+    ecma_collection_iterator_t formal_params_iterator;
+    ecma_collection_iterator_init (&formal_params_iterator, formal_parameters_p);
+
+    /*
+     * Formal parameters' names are placed at the table's beginning in order of the reversed formal parameter list,
+     * so a parameter occupies next slot, unless a parameter with the same name and greater index
+     * has already taken it.
+     */
+    ecma_length_t slot = 0;
+
+    for (ssize_t n = (ssize_t) formal_parameters_p->unit_number - 1;
+         n >= 0;
+         n--)
+    {
+      bool is_moved = ecma_collection_iterator_next (&formal_params_iterator);
+      JERRY_ASSERT (is_moved);
+
+      ecma_value_t formal_parameter_name_value = *formal_params_iterator.current_value_p;
+      ecma_string_t *formal_parameter_name_string_p = ecma_get_string_from_value (formal_parameter_name_value);
+
+      if (slot < slot_names_p->params_number
+          && ecma_compare_ecma_strings (formal_parameter_name_string_p,
+                                        ECMA_GET_NON_NULL_POINTER (ecma_string_t, names_p[slot])))
+      {
+        if (n < (ssize_t) arguments_list_len)
+        {
+          ecma_assign_lex_env_slot_value (env_p, slot, arguments_list_p[n]);
+        }
+
+        slot++;
+      }
+    }
+
+    JERRY_ASSERT (slot == slot_names_p->params_number);
+  }
+
+  if (slot_names_p->arguments_slot != ECMA_LEX_ENV_NO_SLOT)
+  {
+    ecma_object_t *args_obj_p = ecma_op_create_arguments_object (func_obj_p,
+                                                                 env_p,
+                                                                 formal_parameters_p,
+                                                                 arguments_list_p,
+                                                                 arguments_list_len,
+                                                                 is_strict);
+
+    ecma_assign_lex_env_slot_value (env_p, slot_names_p->arguments_slot, ecma_make_object_value (args_obj_p));
+
+    if (is_strict)
+    {
+      slots_p->immutable_slot = slot_names_p->arguments_slot;
+    }
+
+    ecma_deref_object (args_obj_p);
+  }
+} /* ecma_function_call_setup_args_slots */
+
 /**
  * Setup variables for arguments listed in formal parameter list,
  * and, if necessary, Arguments object with 'arguments' binding.
@@ -398,6 +637,18 @@ ecma_function_call_setup_args_variables (ecma_object_t *func_obj_p, /**< Functio
   formal_parameters_p = ECMA_GET_POINTER (ecma_collection_header_t,
                                           formal_parameters_prop_p->u.internal_property.value);
 
+  if (ecma_get_lex_env_type (env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS)
+  {
+    ecma_function_call_setup_args_slots (func_obj_p,
+                                         env_p,
+                                         formal_parameters_p,
+                                         arguments_list_p,
+                                         arguments_list_len,
+                                         is_strict);
+
+    return ecma_make_empty_completion_value ();
+  }
+
   if (formal_parameters_p != NULL)
   {
     ecma_length_t formal_parameters_count = formal_parameters_p->unit_number;
@@ -672,7 +923,20 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
       }
 
       // 5.
-      ecma_object_t *local_env_p = ecma_create_decl_lex_env (scope_p);
+      ecma_lex_env_slot_names_t *slot_names_p = ecma_op_function_get_slot_names (func_obj_p,
+                                                                                 opcodes_p,
+                                                                                 code_first_opcode_idx,
+                                                                                 do_instantiate_args_obj);
+      ecma_object_t *local_env_p;
+
+      if (slot_names_p != NULL)
+      {
+        local_env_p = ecma_create_decl_slots_lex_env (scope_p, func_obj_p, slot_names_p);
+      }
+      else
+      {
+        local_env_p = ecma_create_decl_lex_env (scope_p);
+      }
 
       // 9.
       ECMA_TRY_CATCH (args_var_declaration_ret,
@@ -784,6 +1048,9 @@ ecma_op_function_construct_simple_or_external (ecma_object_t *func_obj_p, /**< F
     ecma_deref_object (prototype_p);
   }
 
+  /* objects, created by same constructor, usually get same properties, so they share shape */
+  ecma_shaped_object_init (obj_p);
+
   // 3.
   /*
    * [[Class]] property of ECMA_OBJECT_TYPE_GENERAL type objects
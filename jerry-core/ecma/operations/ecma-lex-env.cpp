@@ -122,6 +122,10 @@ ecma_op_has_binding (ecma_object_t *lex_env_p, /**< lexical environment */
 
     return (property_p != NULL);
   }
+  else if (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS)
+  {
+    return (ecma_find_lex_env_slot (lex_env_p, name_p) != ECMA_LEX_ENV_NO_SLOT);
+  }
   else
   {
     JERRY_ASSERT (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND);
@@ -155,6 +159,12 @@ ecma_op_create_mutable_binding (ecma_object_t *lex_env_p, /**< lexical environme
                                      name_p,
                                      true, false, is_deletable);
   }
+  else if (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS)
+  {
+    /* all bindings of the environment are created together with it, and are not deletable */
+    JERRY_ASSERT (ecma_find_lex_env_slot (lex_env_p, name_p) != ECMA_LEX_ENV_NO_SLOT);
+    JERRY_ASSERT (!is_deletable);
+  }
   else
   {
     JERRY_ASSERT (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND);
@@ -213,7 +223,7 @@ ecma_op_set_mutable_binding (ecma_object_t *lex_env_p, /**< lexical environment
                 && ecma_is_lexical_environment (lex_env_p));
   JERRY_ASSERT (name_p != NULL);
 
-  if (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+  if (ecma_get_lex_env_type (lex_env_p) != ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND)
   {
 #ifndef JERRY_NDEBUG
 # ifdef CONFIG_ECMA_COMPACT_PROFILE
@@ -235,6 +245,14 @@ ecma_op_set_mutable_binding (ecma_object_t *lex_env_p, /**< lexical environment
 # endif /* CONFIG_ECMA_COMPACT_PROFILE */
 #endif /* !JERRY_NDEBUG */
 
+    if (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS)
+    {
+      ecma_length_t slot = ecma_find_lex_env_slot (lex_env_p, name_p);
+      JERRY_ASSERT (slot != ECMA_LEX_ENV_NO_SLOT);
+
+      return ecma_op_set_mutable_binding_in_slot (lex_env_p, slot, value, is_strict);
+    }
+
     ecma_property_t *property_p = ecma_get_named_data_property (lex_env_p, name_p);
 
     if (ecma_is_property_writable (property_p))
@@ -288,7 +306,7 @@ ecma_op_get_binding_value (ecma_object_t *lex_env_p, /**< lexical environment */
                 && ecma_is_lexical_environment (lex_env_p));
   JERRY_ASSERT (name_p != NULL);
 
-  if (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+  if (ecma_get_lex_env_type (lex_env_p) != ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND)
   {
 #ifndef JERRY_NDEBUG
 # ifdef CONFIG_ECMA_COMPACT_PROFILE
@@ -310,6 +328,14 @@ ecma_op_get_binding_value (ecma_object_t *lex_env_p, /**< lexical environment */
 # endif /* CONFIG_ECMA_COMPACT_PROFILE */
 #endif /* !JERRY_NDEBUG */
 
+    if (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS)
+    {
+      ecma_length_t slot = ecma_find_lex_env_slot (lex_env_p, name_p);
+      JERRY_ASSERT (slot != ECMA_LEX_ENV_NO_SLOT);
+
+      return ecma_op_get_binding_value_in_slot (lex_env_p, slot, is_strict);
+    }
+
     ecma_property_t *property_p = ecma_get_named_data_property (lex_env_p, name_p);
 
     ecma_value_t prop_value = ecma_get_named_data_property_value (property_p);
@@ -353,6 +379,65 @@ ecma_op_get_binding_value (ecma_object_t *lex_env_p, /**< lexical environment */
   }
 } /* ecma_op_get_binding_value */
 
+/**
+ * SetMutableBinding operation for binding, stored in specified slot of lexical environment
+ *
+ * See also: ECMA-262 v5, 10.2.1
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value.
+ */
+ecma_completion_value_t
+ecma_op_set_mutable_binding_in_slot (ecma_object_t *lex_env_p, /**< slots lexical environment */
+                                     ecma_length_t slot, /**< index of the binding's slot */
+                                     ecma_value_t value, /**< argument V */
+                                     bool is_strict) /**< argument S */
+{
+  if (likely (slot != ecma_get_lex_env_slots (lex_env_p)->immutable_slot))
+  {
+    ecma_assign_lex_env_slot_value (lex_env_p, slot, value);
+  }
+  else if (is_strict)
+  {
+    return ecma_make_throw_obj_completion_value (ecma_new_standard_error (ECMA_ERROR_TYPE));
+  }
+
+  return ecma_make_empty_completion_value ();
+} /* ecma_op_set_mutable_binding_in_slot */
+
+/**
+ * GetBindingValue operation for binding, stored in specified slot of lexical environment
+ *
+ * See also: ECMA-262 v5, 10.2.1
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value.
+ */
+ecma_completion_value_t
+ecma_op_get_binding_value_in_slot (ecma_object_t *lex_env_p, /**< slots lexical environment */
+                                   ecma_length_t slot, /**< index of the binding's slot */
+                                   bool is_strict) /**< argument S */
+{
+  ecma_value_t value = ecma_get_lex_env_slot_value (lex_env_p, slot);
+
+  if (unlikely (ecma_is_value_empty (value)))
+  {
+    /* unitialized immutable binding */
+    JERRY_ASSERT (slot == ecma_get_lex_env_slots (lex_env_p)->immutable_slot);
+
+    if (is_strict)
+    {
+      return ecma_make_throw_obj_completion_value (ecma_new_standard_error (ECMA_ERROR_REFERENCE));
+    }
+    else
+    {
+      return ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+    }
+  }
+
+  return ecma_make_normal_completion_value (ecma_copy_value (value, true));
+} /* ecma_op_get_binding_value_in_slot */
+
 /**
  * DeleteBinding operation.
  *
@@ -398,6 +483,13 @@ ecma_op_delete_binding (ecma_object_t *lex_env_p, /**< lexical environment */
 
     return ecma_make_simple_completion_value (ret_val);
   }
+  else if (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS)
+  {
+    /* bindings, stored in slots, are not deletable */
+    bool is_found = (ecma_find_lex_env_slot (lex_env_p, name_p) != ECMA_LEX_ENV_NO_SLOT);
+
+    return ecma_make_simple_completion_value (is_found ? ECMA_SIMPLE_VALUE_FALSE : ECMA_SIMPLE_VALUE_TRUE);
+  }
   else
   {
     JERRY_ASSERT (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND);
@@ -422,7 +514,7 @@ ecma_op_implicit_this_value (ecma_object_t *lex_env_p) /**< lexical environment
   JERRY_ASSERT (lex_env_p != NULL
                 && ecma_is_lexical_environment (lex_env_p));
 
-  if (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+  if (ecma_get_lex_env_type (lex_env_p) != ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND)
   {
     return ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_UNDEFINED);
   }
@@ -455,7 +547,23 @@ ecma_op_create_immutable_binding (ecma_object_t *lex_env_p, /**< lexical environ
 {
   JERRY_ASSERT (lex_env_p != NULL
                 && ecma_is_lexical_environment (lex_env_p));
-  JERRY_ASSERT (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE);
+  JERRY_ASSERT (ecma_get_lex_env_type (lex_env_p) != ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND);
+
+  if (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS)
+  {
+    ecma_lex_env_slots_t *slots_p = ecma_get_lex_env_slots (lex_env_p);
+    ecma_length_t slot = ecma_find_lex_env_slot (lex_env_p, name_p);
+
+    /* the binding is created together with the environment, and is not used before the call */
+    JERRY_ASSERT (slot != ECMA_LEX_ENV_NO_SLOT);
+    JERRY_ASSERT (slots_p->immutable_slot == ECMA_LEX_ENV_NO_SLOT);
+    JERRY_ASSERT (ecma_is_value_undefined (ecma_get_lex_env_slot_value (lex_env_p, slot)));
+
+    slots_p->immutable_slot = slot;
+    ECMA_LEX_ENV_SLOTS_GET_VALUES (slots_p)[slot] = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+
+    return;
+  }
 
   /*
    * Warning:
@@ -467,7 +575,7 @@ ecma_op_create_immutable_binding (ecma_object_t *lex_env_p, /**< lexical environ
 
   JERRY_ASSERT (ecma_is_value_undefined (ecma_get_named_data_property_value (prop_p)));
 
-  ecma_set_named_data_property_value (prop_p,
+  ecma_set_named_data_property_value (lex_env_p, prop_p,
                                       ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY));
 } /* ecma_op_create_immutable_binding */
 
@@ -483,7 +591,23 @@ ecma_op_initialize_immutable_binding (ecma_object_t *lex_env_p, /**< lexical env
 {
   JERRY_ASSERT (lex_env_p != NULL
                 && ecma_is_lexical_environment (lex_env_p));
-  JERRY_ASSERT (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE);
+  JERRY_ASSERT (ecma_get_lex_env_type (lex_env_p) != ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND);
+
+  if (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS)
+  {
+    ecma_lex_env_slots_t *slots_p = ecma_get_lex_env_slots (lex_env_p);
+    ecma_length_t slot = ecma_find_lex_env_slot (lex_env_p, name_p);
+
+    /* The binding must be unitialized immutable binding */
+    JERRY_ASSERT (slot != ECMA_LEX_ENV_NO_SLOT
+                  && slot == slots_p->immutable_slot
+                  && ecma_is_value_empty (ecma_get_lex_env_slot_value (lex_env_p, slot)));
+
+    ECMA_LEX_ENV_SLOTS_GET_VALUES (slots_p)[slot] = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+    ecma_assign_lex_env_slot_value (lex_env_p, slot, value);
+
+    return;
+  }
 
   ecma_property_t *prop_p = ecma_get_named_data_property (lex_env_p, name_p);
 
@@ -68,6 +68,13 @@ extern ecma_completion_value_t ecma_op_set_mutable_binding (ecma_object_t *lex_e
 extern ecma_completion_value_t ecma_op_get_binding_value (ecma_object_t *lex_env_p,
                                                           ecma_string_t *name_p,
                                                           bool is_strict);
+extern ecma_completion_value_t ecma_op_set_mutable_binding_in_slot (ecma_object_t *lex_env_p,
+                                                                    ecma_length_t slot,
+                                                                    ecma_value_t value,
+                                                                    bool is_strict);
+extern ecma_completion_value_t ecma_op_get_binding_value_in_slot (ecma_object_t *lex_env_p,
+                                                                  ecma_length_t slot,
+                                                                  bool is_strict);
 extern ecma_completion_value_t ecma_op_delete_binding (ecma_object_t *lex_env_p,
                                                        ecma_string_t *name_p);
 extern ecma_completion_value_t ecma_op_implicit_this_value (ecma_object_t *lex_env_p);
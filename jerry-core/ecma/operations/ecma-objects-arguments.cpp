@@ -33,11 +33,208 @@
 #include "ecma-try-catch-macro.h"
 #include "jrt.h"
 
+/**
+ * Kinds of properties, that are not stored explicitly by Arguments object in compact form
+ */
+typedef enum
+{
+  ECMA_ARGUMENTS_PROPERTY_NONE, /**< the property is stored explicitly, or doesn't exist */
+  ECMA_ARGUMENTS_PROPERTY_INDEX, /**< index of an argument */
+  ECMA_ARGUMENTS_PROPERTY_MAPPED_PARAMETER, /**< index of a formal parameter without corresponding argument,
+                                             *   that is mapped to the parameter's binding */
+  ECMA_ARGUMENTS_PROPERTY_LENGTH, /**< 'length' */
+  ECMA_ARGUMENTS_PROPERTY_CALLEE, /**< 'callee' of non-strict mode Arguments object */
+  ECMA_ARGUMENTS_PROPERTY_THROWER /**< 'callee' and 'caller' of strict mode Arguments object */
+} ecma_arguments_property_t;
+
+/**
+ * Get description of arguments' values, held by Arguments object in compact form
+ *
+ * @return pointer to the description - if the object is in compact form,
+ *         NULL - if the object's properties are materialized (see also: ecma_op_arguments_object_materialize).
+ */
+static ecma_arguments_values_t*
+ecma_arguments_get_values (ecma_object_t *obj_p) /**< Arguments object */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_ARGUMENTS);
+
+  ecma_property_t *values_prop_p = ecma_find_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_ARGUMENTS_VALUES);
+
+  if (values_prop_p == NULL)
+  {
+    return NULL;
+  }
+
+  return ECMA_GET_NON_NULL_POINTER (ecma_arguments_values_t, values_prop_p->u.internal_property.value);
+} /* ecma_arguments_get_values */
+
+/**
+ * Get binding of formal parameter, to which the index of Arguments object is mapped
+ *
+ * @return reference to the binding (see also: ecma_arguments_values_t) - if the index is mapped,
+ *         ECMA_NULL_POINTER - otherwise.
+ */
+static mem_cpointer_t
+ecma_arguments_get_mapped_binding (const ecma_arguments_values_t *args_values_p, /**< arguments' values */
+                                   uint32_t index) /**< index */
+{
+  if (index >= args_values_p->mapped_bindings_number)
+  {
+    return ECMA_NULL_POINTER;
+  }
+
+  return ECMA_ARGUMENTS_VALUES_GET_MAPPED_BINDINGS (args_values_p)[index];
+} /* ecma_arguments_get_mapped_binding */
+
+/**
+ * Get value of formal parameter's binding, to which an index of Arguments object is mapped
+ *
+ * @return ecma-value (not copied)
+ */
+static ecma_value_t
+ecma_arguments_get_binding_value (const ecma_arguments_values_t *args_values_p, /**< arguments' values */
+                                  mem_cpointer_t binding_ref) /**< reference to the binding */
+{
+  JERRY_ASSERT (binding_ref != ECMA_NULL_POINTER);
+
+  ecma_object_t *lex_env_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, args_values_p->lex_env_cp);
+
+  if (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS)
+  {
+    return ecma_get_lex_env_slot_value (lex_env_p, (ecma_length_t) (binding_ref - 1u));
+  }
+  else
+  {
+    return ecma_get_named_data_property_value (ECMA_GET_NON_NULL_POINTER (ecma_property_t, binding_ref));
+  }
+} /* ecma_arguments_get_binding_value */
+
+/**
+ * Assign value to formal parameter's binding, to which an index of Arguments object is mapped
+ */
+static void
+ecma_arguments_assign_binding_value (const ecma_arguments_values_t *args_values_p, /**< arguments' values */
+                                     mem_cpointer_t binding_ref, /**< reference to the binding */
+                                     ecma_value_t value) /**< value to assign */
+{
+  JERRY_ASSERT (binding_ref != ECMA_NULL_POINTER);
+
+  ecma_object_t *lex_env_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, args_values_p->lex_env_cp);
+
+  if (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS)
+  {
+    ecma_assign_lex_env_slot_value (lex_env_p, (ecma_length_t) (binding_ref - 1u), value);
+  }
+  else
+  {
+    ecma_named_data_property_assign_value (lex_env_p, ECMA_GET_NON_NULL_POINTER (ecma_property_t, binding_ref), value);
+  }
+} /* ecma_arguments_assign_binding_value */
+
+/**
+ * Get name of formal parameter's binding, to which an index of Arguments object is mapped
+ *
+ * @return pointer to ecma-string (not referenced)
+ */
+static ecma_string_t*
+ecma_arguments_get_binding_name (const ecma_arguments_values_t *args_values_p, /**< arguments' values */
+                                 mem_cpointer_t binding_ref) /**< reference to the binding */
+{
+  JERRY_ASSERT (binding_ref != ECMA_NULL_POINTER);
+
+  ecma_object_t *lex_env_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, args_values_p->lex_env_cp);
+
+  if (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS)
+  {
+    return ecma_get_lex_env_slot_name (lex_env_p, (ecma_length_t) (binding_ref - 1u));
+  }
+  else
+  {
+    ecma_property_t *binding_p = ECMA_GET_NON_NULL_POINTER (ecma_property_t, binding_ref);
+
+    return ECMA_GET_NON_NULL_POINTER (ecma_string_t, binding_p->u.named_data_property.name_p);
+  }
+} /* ecma_arguments_get_binding_name */
+
+/**
+ * Determine whether the property is one of properties, not stored explicitly by Arguments object in compact form
+ *
+ * @return kind of the property
+ */
+static ecma_arguments_property_t
+ecma_arguments_get_property_kind (const ecma_arguments_values_t *args_values_p, /**< arguments' values */
+                                  ecma_string_t *property_name_p, /**< property name */
+                                  uint32_t *out_index_p) /**< out: index of argument
+                                                          *        (for ECMA_ARGUMENTS_PROPERTY_INDEX and
+                                                          *         ECMA_ARGUMENTS_PROPERTY_MAPPED_PARAMETER) */
+{
+  uint32_t index;
+  lit_magic_string_id_t magic_string_id;
+
+  if (property_name_p->container == ECMA_STRING_CONTAINER_UINT32_IN_DESC)
+  {
+    index = property_name_p->u.uint32_number;
+  }
+  else if (ecma_is_string_magic (property_name_p, &magic_string_id))
+  {
+    if (magic_string_id == LIT_MAGIC_STRING_LENGTH)
+    {
+      return ECMA_ARGUMENTS_PROPERTY_LENGTH;
+    }
+    else if (magic_string_id == LIT_MAGIC_STRING_CALLEE)
+    {
+      return ((args_values_p->callee_cp != ECMA_NULL_POINTER) ? ECMA_ARGUMENTS_PROPERTY_CALLEE
+                                                              : ECMA_ARGUMENTS_PROPERTY_THROWER);
+    }
+    else if (magic_string_id == LIT_MAGIC_STRING_CALLER
+             && args_values_p->callee_cp == ECMA_NULL_POINTER)
+    {
+      return ECMA_ARGUMENTS_PROPERTY_THROWER;
+    }
+
+    return ECMA_ARGUMENTS_PROPERTY_NONE;
+  }
+  else
+  {
+    index = ecma_number_to_uint32 (ecma_string_to_number (property_name_p));
+
+    ecma_string_t *index_string_p = ecma_new_ecma_string_from_uint32 (index);
+    bool is_index = ecma_compare_ecma_strings (property_name_p, index_string_p);
+    ecma_deref_ecma_string (index_string_p);
+
+    if (!is_index)
+    {
+      return ECMA_ARGUMENTS_PROPERTY_NONE;
+    }
+  }
+
+  *out_index_p = index;
+
+  if (index < args_values_p->length)
+  {
+    return ECMA_ARGUMENTS_PROPERTY_INDEX;
+  }
+  else if (ecma_arguments_get_mapped_binding (args_values_p, index) != ECMA_NULL_POINTER)
+  {
+    return ECMA_ARGUMENTS_PROPERTY_MAPPED_PARAMETER;
+  }
+
+  return ECMA_ARGUMENTS_PROPERTY_NONE;
+} /* ecma_arguments_get_property_kind */
+
 /**
  * Arguments object creation operation.
  *
  * See also: ECMA-262 v5, 10.6
  *
+ * Note:
+ *      the object is created in compact form: values of the arguments, 'length' and 'callee'
+ *      are held in ECMA_INTERNAL_PROPERTY_ARGUMENTS_VALUES internal property, and mapped arguments
+ *      refer to bindings (properties or slots) of corresponding formal parameters directly. [[Get]] and [[Put]]
+ *      of the properties are performed without creating them; the properties are materialized upon any other access
+ *      to them
+ *      (see also: ecma_op_arguments_object_materialize).
+ *
  * @return pointer to newly created Arguments object
  */
 ecma_object_t*
@@ -49,22 +246,177 @@ ecma_op_create_arguments_object (ecma_object_t *func_obj_p, /**< callee function
                                  ecma_length_t arguments_list_length, /**< length of arguments' list */
                                  bool is_strict) /**< flag indicating whether strict mode is enabled */
 {
-  // 1.
-  ecma_number_t *len_p = ecma_alloc_number ();
-  *len_p = ecma_uint32_to_number (arguments_list_length);
-
-  // 2., 3., 6.
+  // 2., 3., 4., 6.
   ecma_object_t *prototype_p = ecma_builtin_get (ECMA_BUILTIN_ID_OBJECT_PROTOTYPE);
 
-  ecma_object_t *obj_p = ecma_create_object (prototype_p, true, ECMA_OBJECT_TYPE_GENERAL);
+  ecma_object_t *obj_p = ecma_create_object (prototype_p, true, ECMA_OBJECT_TYPE_ARGUMENTS);
 
   ecma_deref_object (prototype_p);
 
-  // 4.
-  ecma_property_t *class_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_CLASS);
-  class_prop_p->u.internal_property.value = LIT_MAGIC_STRING_ARGUMENTS_UL;
+  const bool is_mapped = (!is_strict
+                          && arguments_list_length > 0
+                          && formal_params_p != NULL
+                          && formal_params_p->unit_number > 0);
+
+  const ecma_length_t mapped_bindings_number = is_mapped ? formal_params_p->unit_number : 0;
+
+  size_t args_values_size = (sizeof (ecma_arguments_values_t)
+                             + arguments_list_length * sizeof (ecma_value_t)
+                             + mapped_bindings_number * sizeof (mem_cpointer_t));
+
+  ecma_arguments_values_t *args_values_p;
+  args_values_p = (ecma_arguments_values_t *) mem_heap_alloc_block (args_values_size, MEM_HEAP_ALLOC_SHORT_TERM);
+
+  // 1.
+  args_values_p->length = arguments_list_length;
+  args_values_p->mapped_bindings_number = mapped_bindings_number;
+  args_values_p->lex_env_cp = ECMA_NULL_POINTER;
+
+  // 13., 14.
+  if (is_strict)
+  {
+    args_values_p->callee_cp = ECMA_NULL_POINTER;
+  }
+  else
+  {
+    ECMA_SET_NON_NULL_POINTER (args_values_p->callee_cp, func_obj_p);
+    ecma_gc_write_barrier (obj_p, func_obj_p);
+  }
+
+  ecma_value_t *values_p = ECMA_ARGUMENTS_VALUES_GET_VALUES (args_values_p);
+
+  if (is_mapped)
+  {
+    mem_cpointer_t *mapped_bindings_p = ECMA_ARGUMENTS_VALUES_GET_MAPPED_BINDINGS (args_values_p);
+
+    for (ecma_length_t indx = 0; indx < mapped_bindings_number; indx++)
+    {
+      mapped_bindings_p[indx] = ECMA_NULL_POINTER;
+    }
+
+    const ecma_length_t formal_params_number = mapped_bindings_number;
+
+    ecma_collection_iterator_t formal_params_iterator;
+    ecma_collection_iterator_init (&formal_params_iterator, formal_params_p);
+
+    /*
+     * Formal parameter list is stored in reversed order, so the first occurence of a name
+     * corresponds to the last formal parameter with the name (ECMA-262 v5, 10.6, 11.c.ii)
+     */
+    for (ecma_length_t param_index = 0;
+         ecma_collection_iterator_next (&formal_params_iterator);
+         param_index++)
+    {
+      JERRY_ASSERT (param_index < formal_params_number);
+
+      ecma_length_t indx = formal_params_number - 1u - param_index;
+
+      JERRY_ASSERT (ecma_is_value_string (*formal_params_iterator.current_value_p));
+      ecma_string_t *param_name_p = ecma_get_string_from_value (*formal_params_iterator.current_value_p);
+
+      mem_cpointer_t binding_cp;
+
+      if (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS)
+      {
+        ecma_length_t slot = ecma_find_lex_env_slot (lex_env_p, param_name_p);
+        JERRY_ASSERT (slot != ECMA_LEX_ENV_NO_SLOT && slot < ECMA_LEX_ENV_MAX_SLOTS);
+
+        binding_cp = (mem_cpointer_t) (slot + 1u);
+      }
+      else
+      {
+        ecma_property_t *binding_p = ecma_find_named_property (lex_env_p, param_name_p);
+        JERRY_ASSERT (binding_p != NULL && binding_p->type == ECMA_PROPERTY_NAMEDDATA);
+
+        ECMA_SET_NON_NULL_POINTER (binding_cp, binding_p);
+      }
+
+      bool is_first_occurence = true;
+
+      for (ecma_length_t indx2 = indx + 1; indx2 < formal_params_number; indx2++)
+      {
+        if (mapped_bindings_p[indx2] == binding_cp)
+        {
+          is_first_occurence = false;
+
+          break;
+        }
+      }
+
+      if (is_first_occurence)
+      {
+        mapped_bindings_p[indx] = binding_cp;
+      }
+    }
+
+    // 12.
+    ecma_property_t *scope_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_SCOPE);
+    ECMA_SET_POINTER (scope_prop_p->u.internal_property.value, lex_env_p);
+    ecma_gc_write_barrier (obj_p, lex_env_p);
+
+    ECMA_SET_NON_NULL_POINTER (args_values_p->lex_env_cp, lex_env_p);
+  }
+
+  // 11.a, 11.b
+  for (ecma_length_t indx = 0; indx < arguments_list_length; indx++)
+  {
+    if (ecma_arguments_get_mapped_binding (args_values_p, indx) != ECMA_NULL_POINTER)
+    {
+      /* value of mapped argument is held by corresponding binding */
+      values_p[indx] = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+    }
+    else
+    {
+      values_p[indx] = ecma_copy_value (arguments_list_p[indx], false);
+
+      if (ecma_is_value_object (values_p[indx]))
+      {
+        ecma_gc_write_barrier (obj_p, ecma_get_object_from_value (values_p[indx]));
+      }
+    }
+  }
+
+  ecma_property_t *values_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_ARGUMENTS_VALUES);
+  ECMA_SET_NON_NULL_POINTER (values_prop_p->u.internal_property.value, args_values_p);
+
+  return obj_p;
+} /* ecma_op_create_arguments_object */
+
+/**
+ * Create properties of Arguments object in compact form explicitly, converting it to general form.
+ *
+ * See also: ECMA-262 v5, 10.6
+ *
+ * Note:
+ *      mapped Arguments object remains ECMA_OBJECT_TYPE_ARGUMENTS object with [[ParametersMap]],
+ *      otherwise the object becomes ECMA_OBJECT_TYPE_GENERAL object with 'Arguments' [[Class]].
+ */
+void
+ecma_op_arguments_object_materialize (ecma_object_t *obj_p) /**< Arguments object */
+{
+  ecma_arguments_values_t *args_values_p = ecma_arguments_get_values (obj_p);
+
+  if (args_values_p == NULL)
+  {
+    return;
+  }
+
+  const ecma_length_t arguments_list_length = args_values_p->length;
+  const ecma_length_t mapped_bindings_number = args_values_p->mapped_bindings_number;
+  const bool is_mapped = (mapped_bindings_number != 0);
+  ecma_value_t *values_p = ECMA_ARGUMENTS_VALUES_GET_VALUES (args_values_p);
+
+  /* the properties, held in compact form, are created regardless of [[Extensible]] */
+  const bool is_extensible = ecma_get_object_extensible (obj_p);
+  ecma_set_object_extensible (obj_p, true);
+
+  /* the properties are defined through general [[DefineOwnProperty]] */
+  ecma_set_object_type (obj_p, ECMA_OBJECT_TYPE_GENERAL);
 
   // 7.
+  ecma_number_t *len_p = ecma_alloc_number ();
+  *len_p = ecma_uint32_to_number (arguments_list_length);
+
   ecma_property_descriptor_t prop_desc = ecma_make_empty_property_descriptor ();
   {
     prop_desc.is_value_defined = true;
@@ -89,148 +441,112 @@ ecma_op_create_arguments_object (ecma_object_t *func_obj_p, /**< callee function
 
   ecma_dealloc_number (len_p);
 
-  // 11.a, 11.b
-  for (ecma_length_t indx = 0;
-       indx < arguments_list_length;
-       indx++)
-  {
-    prop_desc = ecma_make_empty_property_descriptor ();
-    {
-      prop_desc.is_value_defined = true;
-      prop_desc.value = arguments_list_p[indx];
-
-      prop_desc.is_writable_defined = true;
-      prop_desc.is_writable = true;
-
-      prop_desc.is_enumerable_defined = true;
-      prop_desc.is_enumerable = true;
-
-      prop_desc.is_configurable_defined = true;
-      prop_desc.is_configurable = true;
-    }
+  // 8.
+  ecma_object_t *map_p = NULL;
 
-    ecma_string_t *indx_string_p = ecma_new_ecma_string_from_uint32 (indx);
-
-    completion = ecma_op_object_define_own_property (obj_p,
-                                                     indx_string_p,
-                                                     &prop_desc,
-                                                     false);
-    JERRY_ASSERT (ecma_is_completion_value_normal_true (completion));
-
-    ecma_deref_ecma_string (indx_string_p);
+  if (is_mapped)
+  {
+    map_p = ecma_op_create_object_object_noarg ();
   }
 
-  if (formal_params_p != NULL)
+  // 11.
+  for (ecma_length_t indx = 0;
+       indx < arguments_list_length || indx < mapped_bindings_number;
+       indx++)
   {
-    const ecma_length_t formal_params_number = formal_params_p->unit_number;
+    mem_cpointer_t binding_ref = ecma_arguments_get_mapped_binding (args_values_p, indx);
 
-    ecma_collection_iterator_t formal_params_iterator;
-    ecma_collection_iterator_init (&formal_params_iterator, formal_params_p);
+    ecma_string_t *indx_string_p = ecma_new_ecma_string_from_uint32 (indx);
 
-    if (!is_strict
-        && arguments_list_length > 0
-        && formal_params_number > 0)
+    if (indx < arguments_list_length)
     {
-      // 8.
-      ecma_object_t *map_p = ecma_op_create_object_object_noarg ();
-
-      // 11.c
-      MEM_DEFINE_LOCAL_ARRAY (formal_params, formal_params_number, ecma_string_t *);
-
-      JERRY_ASSERT (formal_params_iterator.current_value_p == NULL);
-      uint32_t param_index;
-      for (param_index = 0;
-           ecma_collection_iterator_next (&formal_params_iterator);
-           param_index++)
+      prop_desc = ecma_make_empty_property_descriptor ();
       {
-        JERRY_ASSERT (formal_params_iterator.current_value_p != NULL);
-        JERRY_ASSERT (param_index < formal_params_number);
+        prop_desc.is_value_defined = true;
 
-        JERRY_ASSERT (ecma_is_value_string (*formal_params_iterator.current_value_p));
-        ecma_string_t *param_name_p = ecma_get_string_from_value (*formal_params_iterator.current_value_p);
-
-        /*
-         * Formal parameter list is stored in reversed order
-         */
-        formal_params[formal_params_number - 1u - param_index] = param_name_p;
-      }
-      JERRY_ASSERT (param_index == formal_params_number);
-
-      for (int32_t indx = (int32_t) formal_params_number - 1;
-           indx >= 0;
-           indx--)
-      {
-        // i.
-        ecma_string_t *name_p = formal_params[indx];
-        bool is_first_occurence = true;
-
-        // ii.
-        for (int32_t indx2 = indx + 1;
-             indx2 < (int32_t) formal_params_number;
-             indx2++)
+        if (binding_ref != ECMA_NULL_POINTER)
         {
-          if (ecma_compare_ecma_strings (name_p, formal_params[indx2]))
-          {
-            is_first_occurence = false;
-
-            break;
-          }
+          prop_desc.value = ecma_arguments_get_binding_value (args_values_p, binding_ref);
         }
-
-        if (is_first_occurence)
+        else
         {
-          ecma_string_t *indx_string_p = ecma_new_ecma_string_from_uint32 ((uint32_t) indx);
+          prop_desc.value = values_p[indx];
+        }
 
-          prop_desc = ecma_make_empty_property_descriptor ();
-          {
-            prop_desc.is_value_defined = true;
-            prop_desc.value = ecma_make_string_value (name_p);
+        prop_desc.is_writable_defined = true;
+        prop_desc.is_writable = true;
 
-            prop_desc.is_configurable_defined = true;
-            prop_desc.is_configurable = true;
-          }
+        prop_desc.is_enumerable_defined = true;
+        prop_desc.is_enumerable = true;
 
-          completion = ecma_op_object_define_own_property (map_p,
-                                                           indx_string_p,
-                                                           &prop_desc,
-                                                           false);
-          JERRY_ASSERT (ecma_is_completion_value_normal_true (completion));
+        prop_desc.is_configurable_defined = true;
+        prop_desc.is_configurable = true;
+      }
 
-          ecma_deref_ecma_string (indx_string_p);
-        }
+      completion = ecma_op_object_define_own_property (obj_p,
+                                                       indx_string_p,
+                                                       &prop_desc,
+                                                       false);
+      JERRY_ASSERT (ecma_is_completion_value_normal_true (completion));
+    }
+
+    // 11.c
+    if (binding_ref != ECMA_NULL_POINTER)
+    {
+      prop_desc = ecma_make_empty_property_descriptor ();
+      {
+        prop_desc.is_value_defined = true;
+        prop_desc.value = ecma_make_string_value (ecma_arguments_get_binding_name (args_values_p, binding_ref));
+
+        prop_desc.is_configurable_defined = true;
+        prop_desc.is_configurable = true;
       }
 
-      MEM_FINALIZE_LOCAL_ARRAY (formal_params);
+      completion = ecma_op_object_define_own_property (map_p,
+                                                       indx_string_p,
+                                                       &prop_desc,
+                                                       false);
+      JERRY_ASSERT (ecma_is_completion_value_normal_true (completion));
+    }
 
-      // 12.
-      ecma_set_object_type (obj_p, ECMA_OBJECT_TYPE_ARGUMENTS);
+    ecma_deref_ecma_string (indx_string_p);
+  }
 
-      /*
-       * [[Class]] property is not stored explicitly for objects of ECMA_OBJECT_TYPE_ARGUMENTS type.
-       *
-       * See also: ecma_object_get_class_name
-       */
-      ecma_delete_property (obj_p, class_prop_p);
+  if (is_mapped)
+  {
+    // 12.
+    ecma_property_t *scope_prop_p = ecma_get_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_SCOPE);
+    ecma_object_t *lex_env_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, scope_prop_p->u.internal_property.value);
 
-      ecma_property_t *parameters_map_prop_p = ecma_create_internal_property (obj_p,
-                                                                              ECMA_INTERNAL_PROPERTY_PARAMETERS_MAP);
-      ECMA_SET_POINTER (parameters_map_prop_p->u.internal_property.value, map_p);
+    ecma_property_t *map_scope_prop_p = ecma_create_internal_property (map_p, ECMA_INTERNAL_PROPERTY_SCOPE);
+    ECMA_SET_POINTER (map_scope_prop_p->u.internal_property.value, lex_env_p);
+    ecma_gc_write_barrier (map_p, lex_env_p);
 
-      ecma_property_t *scope_prop_p = ecma_create_internal_property (map_p,
-                                                                     ECMA_INTERNAL_PROPERTY_SCOPE);
-      ECMA_SET_POINTER (scope_prop_p->u.internal_property.value, lex_env_p);
+    ecma_delete_property (obj_p, scope_prop_p);
 
-      ecma_deref_object (map_p);
-    }
+    ecma_property_t *parameters_map_prop_p = ecma_create_internal_property (obj_p,
+                                                                            ECMA_INTERNAL_PROPERTY_PARAMETERS_MAP);
+    ECMA_SET_POINTER (parameters_map_prop_p->u.internal_property.value, map_p);
+    ecma_gc_write_barrier (obj_p, map_p);
+
+    ecma_deref_object (map_p);
+  }
+  else
+  {
+    // 4.
+    ecma_property_t *class_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_CLASS);
+    class_prop_p->u.internal_property.value = LIT_MAGIC_STRING_ARGUMENTS_UL;
   }
 
   // 13.
-  if (!is_strict)
+  ecma_object_t *callee_p = ECMA_GET_POINTER (ecma_object_t, args_values_p->callee_cp);
+
+  if (callee_p != NULL)
   {
     prop_desc = ecma_make_empty_property_descriptor ();
     {
       prop_desc.is_value_defined = true;
-      prop_desc.value = ecma_make_object_value (func_obj_p);
+      prop_desc.value = ecma_make_object_value (callee_p);
 
       prop_desc.is_writable_defined = true;
       prop_desc.is_writable = true;
@@ -292,8 +608,76 @@ ecma_op_create_arguments_object (ecma_object_t *func_obj_p, /**< callee function
     ecma_deref_object (thrower_p);
   }
 
-  return obj_p;
-} /* ecma_op_create_arguments_object */
+  if (is_mapped)
+  {
+    ecma_set_object_type (obj_p, ECMA_OBJECT_TYPE_ARGUMENTS);
+  }
+
+  ecma_set_object_extensible (obj_p, is_extensible);
+
+  ecma_delete_property (obj_p, ecma_get_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_ARGUMENTS_VALUES));
+} /* ecma_op_arguments_object_materialize */
+
+/**
+ * Get value of property, held by Arguments object in compact form
+ *
+ * @return the property's value (should be freed with ecma_free_value)
+ */
+static ecma_value_t
+ecma_arguments_get_compact_property_value (const ecma_arguments_values_t *args_values_p, /**< arguments' values */
+                                           ecma_arguments_property_t kind, /**< kind of the property */
+                                           uint32_t index) /**< index of argument
+                                                            *   (for ECMA_ARGUMENTS_PROPERTY_INDEX and
+                                                            *    ECMA_ARGUMENTS_PROPERTY_MAPPED_PARAMETER) */
+{
+  switch (kind)
+  {
+    case ECMA_ARGUMENTS_PROPERTY_INDEX:
+    case ECMA_ARGUMENTS_PROPERTY_MAPPED_PARAMETER:
+    {
+      mem_cpointer_t binding_ref = ecma_arguments_get_mapped_binding (args_values_p, index);
+
+      if (binding_ref != ECMA_NULL_POINTER)
+      {
+        return ecma_copy_value (ecma_arguments_get_binding_value (args_values_p, binding_ref), true);
+      }
+      else
+      {
+        return ecma_copy_value (ECMA_ARGUMENTS_VALUES_GET_VALUES (args_values_p)[index], true);
+      }
+    }
+
+    case ECMA_ARGUMENTS_PROPERTY_LENGTH:
+    {
+      if (args_values_p->length <= (ecma_length_t) ECMA_INTEGER_NUMBER_MAX)
+      {
+        return ecma_make_integer_value ((ecma_integer_value_t) args_values_p->length);
+      }
+      else
+      {
+        ecma_number_t *len_p = ecma_alloc_number ();
+        *len_p = ecma_uint32_to_number (args_values_p->length);
+
+        return ecma_make_number_value (len_p);
+      }
+    }
+
+    case ECMA_ARGUMENTS_PROPERTY_CALLEE:
+    {
+      return ecma_copy_value (ecma_make_object_value (ECMA_GET_NON_NULL_POINTER (ecma_object_t,
+                                                                                 args_values_p->callee_cp)),
+                              true);
+    }
+
+    case ECMA_ARGUMENTS_PROPERTY_NONE:
+    case ECMA_ARGUMENTS_PROPERTY_THROWER:
+    {
+      break;
+    }
+  }
+
+  JERRY_UNREACHABLE ();
+} /* ecma_arguments_get_compact_property_value */
 
 /**
  * Get value of function's argument mapped to index of Arguments object.
@@ -342,6 +726,29 @@ ecma_completion_value_t
 ecma_op_arguments_object_get (ecma_object_t *obj_p, /**< the object */
                               ecma_string_t *property_name_p) /**< property name */
 {
+  ecma_arguments_values_t *args_values_p = ecma_arguments_get_values (obj_p);
+
+  if (args_values_p != NULL)
+  {
+    uint32_t index = 0;
+    ecma_arguments_property_t kind = ecma_arguments_get_property_kind (args_values_p, property_name_p, &index);
+
+    if (kind == ECMA_ARGUMENTS_PROPERTY_NONE)
+    {
+      return ecma_op_general_object_get (obj_p, property_name_p);
+    }
+    else if (kind != ECMA_ARGUMENTS_PROPERTY_THROWER)
+    {
+      return ecma_make_normal_completion_value (ecma_arguments_get_compact_property_value (args_values_p,
+                                                                                          kind,
+                                                                                          index));
+    }
+
+    ecma_op_arguments_object_materialize (obj_p);
+
+    return ecma_op_object_get (obj_p, property_name_p);
+  }
+
   // 1.
   ecma_property_t *map_prop_p = ecma_get_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_PARAMETERS_MAP);
   ecma_object_t *map_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t,
@@ -379,6 +786,23 @@ ecma_property_t*
 ecma_op_arguments_object_get_own_property (ecma_object_t *obj_p, /**< the object */
                                            ecma_string_t *property_name_p) /**< property name */
 {
+  ecma_arguments_values_t *args_values_p = ecma_arguments_get_values (obj_p);
+
+  if (args_values_p != NULL)
+  {
+    uint32_t index;
+
+    if (ecma_arguments_get_property_kind (args_values_p, property_name_p, &index) == ECMA_ARGUMENTS_PROPERTY_NONE)
+    {
+      return ecma_op_general_object_get_own_property (obj_p, property_name_p);
+    }
+
+    /* the property descriptor is requested, so the property should exist explicitly */
+    ecma_op_arguments_object_materialize (obj_p);
+
+    return ecma_op_object_get_own_property (obj_p, property_name_p);
+  }
+
   // 1.
   ecma_property_t *desc_p = ecma_op_general_object_get_own_property (obj_p, property_name_p);
 
@@ -411,6 +835,64 @@ ecma_op_arguments_object_get_own_property (ecma_object_t *obj_p, /**< the object
   return desc_p;
 } /* ecma_op_arguments_object_get_own_property */
 
+/**
+ * [[Put]] ecma Arguments object's operation
+ *
+ * Note:
+ *      assignment to an argument of Arguments object in compact form is performed directly,
+ *      other cases are handled by the general [[Put]] operation (ECMA-262 v5, 8.12.5)
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value
+ */
+ecma_completion_value_t
+ecma_op_arguments_object_put (ecma_object_t *obj_p, /**< the object */
+                              ecma_string_t *property_name_p, /**< property name */
+                              ecma_value_t value, /**< ecma-value */
+                              bool is_throw) /**< flag that controls failure handling */
+{
+  ecma_arguments_values_t *args_values_p = ecma_arguments_get_values (obj_p);
+
+  uint32_t index;
+
+  if (args_values_p == NULL
+      || ecma_arguments_get_property_kind (args_values_p,
+                                           property_name_p,
+                                           &index) != ECMA_ARGUMENTS_PROPERTY_INDEX)
+  {
+    return ecma_op_general_object_put (obj_p, property_name_p, value, is_throw);
+  }
+
+  mem_cpointer_t binding_ref = ecma_arguments_get_mapped_binding (args_values_p, index);
+
+  if (binding_ref != ECMA_NULL_POINTER)
+  {
+    ecma_arguments_assign_binding_value (args_values_p, binding_ref, value);
+  }
+  else
+  {
+    ecma_value_t *value_p = ECMA_ARGUMENTS_VALUES_GET_VALUES (args_values_p) + index;
+
+    if (ecma_is_value_number (value)
+        && ecma_is_value_number (*value_p))
+    {
+      *value_p = ecma_update_number_value (*value_p, value);
+    }
+    else
+    {
+      ecma_free_value (*value_p, false);
+      *value_p = ecma_copy_value (value, false);
+
+      if (ecma_is_value_object (value))
+      {
+        ecma_gc_write_barrier (obj_p, ecma_get_object_from_value (value));
+      }
+    }
+  }
+
+  return ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_TRUE);
+} /* ecma_op_arguments_object_put */
+
 /**
  * [[DefineOwnProperty]] ecma Arguments object's operation
  *
@@ -428,6 +910,22 @@ ecma_op_arguments_object_define_own_property (ecma_object_t *obj_p, /**< the obj
                                                                                                   *   descriptor */
                                               bool is_throw) /**< flag that controls failure handling */
 {
+  ecma_arguments_values_t *args_values_p = ecma_arguments_get_values (obj_p);
+
+  if (args_values_p != NULL)
+  {
+    uint32_t index;
+
+    if (ecma_arguments_get_property_kind (args_values_p, property_name_p, &index) == ECMA_ARGUMENTS_PROPERTY_NONE)
+    {
+      return ecma_op_general_object_define_own_property (obj_p, property_name_p, property_desc_p, is_throw);
+    }
+
+    ecma_op_arguments_object_materialize (obj_p);
+
+    return ecma_op_object_define_own_property (obj_p, property_name_p, property_desc_p, is_throw);
+  }
+
   // 1.
   ecma_property_t *map_prop_p = ecma_get_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_PARAMETERS_MAP);
   ecma_object_t *map_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t,
@@ -526,6 +1024,22 @@ ecma_op_arguments_object_delete (ecma_object_t *obj_p, /**< the object */
                                  ecma_string_t *property_name_p, /**< property name */
                                  bool is_throw) /**< flag that controls failure handling */
 {
+  ecma_arguments_values_t *args_values_p = ecma_arguments_get_values (obj_p);
+
+  if (args_values_p != NULL)
+  {
+    uint32_t index;
+
+    if (ecma_arguments_get_property_kind (args_values_p, property_name_p, &index) == ECMA_ARGUMENTS_PROPERTY_NONE)
+    {
+      return ecma_op_general_object_delete (obj_p, property_name_p, is_throw);
+    }
+
+    ecma_op_arguments_object_materialize (obj_p);
+
+    return ecma_op_object_delete (obj_p, property_name_p, is_throw);
+  }
+
   // 1.
   ecma_property_t *map_prop_p = ecma_get_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_PARAMETERS_MAP);
   ecma_object_t *map_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t,
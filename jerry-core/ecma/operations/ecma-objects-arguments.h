@@ -27,10 +27,16 @@ ecma_op_create_arguments_object (ecma_object_t *func_obj_p,
                                  ecma_length_t arguments_list_length,
                                  bool is_strict);
 
+extern void ecma_op_arguments_object_materialize (ecma_object_t *obj_p);
+
 extern ecma_completion_value_t ecma_op_arguments_object_get (ecma_object_t *obj_p,
                                                              ecma_string_t *property_name_p);
 extern ecma_property_t *ecma_op_arguments_object_get_own_property (ecma_object_t *obj_p,
                                                                    ecma_string_t *property_name_p);
+extern ecma_completion_value_t ecma_op_arguments_object_put (ecma_object_t *obj_p,
+                                                             ecma_string_t *property_name_p,
+                                                             ecma_value_t value,
+                                                             bool is_throw);
 extern ecma_completion_value_t ecma_op_arguments_object_delete (ecma_object_t *obj_p,
                                                                 ecma_string_t *property_name_p,
                                                                 bool is_throw);
@@ -15,12 +15,14 @@
 
 #include "ecma-builtins.h"
 #include "ecma-exceptions.h"
+#include "ecma-fast-array.h"
 #include "ecma-function-object.h"
 #include "ecma-gc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-objects.h"
 #include "ecma-objects-general.h"
+#include "ecma-shapes.h"
 #include "ecma-try-catch-macro.h"
 
 /** \addtogroup ecma ECMA
@@ -116,6 +118,8 @@ ecma_op_create_object_object_noarg_and_set_prototype (ecma_object_t *object_prot
 {
   ecma_object_t *obj_p = ecma_create_object (object_prototype_p, true, ECMA_OBJECT_TYPE_GENERAL);
 
+  ecma_shaped_object_init (obj_p);
+
   /*
    * [[Class]] property of ECMA_OBJECT_TYPE_GENERAL type objects
    * without ECMA_INTERNAL_PROPERTY_CLASS internal property
@@ -146,7 +150,47 @@ ecma_op_general_object_get (ecma_object_t *obj_p, /**< the object */
   JERRY_ASSERT (property_name_p != NULL);
 
   // 1.
-  const ecma_property_t* prop_p = ecma_op_object_get_property (obj_p, property_name_p);
+  const ecma_property_t* prop_p = NULL;
+  uint32_t index;
+
+  for (ecma_object_t *holder_p = obj_p;
+       holder_p != NULL;
+       holder_p = ecma_get_object_prototype (holder_p))
+  {
+    if (ecma_get_object_is_shaped (holder_p))
+    {
+      /* values of properties of objects in shaped form are read from slots, without creating descriptors */
+      const ecma_length_t slot = ecma_shaped_object_find_slot (holder_p, property_name_p);
+
+      if (slot != ECMA_SHAPE_NO_SLOT)
+      {
+        return ecma_make_normal_completion_value (ecma_copy_value (ecma_shaped_object_get_value (holder_p, slot),
+                                                                   true));
+      }
+    }
+    else if (ecma_get_object_fast_elements (holder_p) != NULL
+             && ecma_string_get_array_index (property_name_p, &index))
+    {
+      /* elements of arrays in fast form are read from the vector, without creating descriptors */
+      const ecma_fast_array_elements_t *elements_p = ecma_get_object_fast_elements (holder_p);
+
+      if (index < elements_p->length)
+      {
+        const ecma_value_t value = ECMA_FAST_ARRAY_ELEMENTS_GET_VALUES (elements_p)[index];
+
+        return ecma_make_normal_completion_value (ecma_copy_value (value, true));
+      }
+    }
+    else
+    {
+      prop_p = ecma_op_object_get_own_property (holder_p, property_name_p);
+
+      if (prop_p != NULL)
+      {
+        break;
+      }
+    }
+  }
 
   // 2.
   if (prop_p == NULL)
@@ -264,6 +308,45 @@ ecma_op_general_object_put (ecma_object_t *obj_p, /**< the object */
                 && !ecma_is_lexical_environment (obj_p));
   JERRY_ASSERT (property_name_p != NULL);
 
+  if (ecma_get_object_is_shaped (obj_p))
+  {
+    const ecma_length_t slot = ecma_shaped_object_find_slot (obj_p, property_name_p);
+
+    if (slot != ECMA_SHAPE_NO_SLOT)
+    {
+      /* properties, stored in slots, are writable data properties, so steps 1 - 3 reduce to assignment */
+      ecma_shaped_object_assign_value (obj_p, slot, value);
+
+      return ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_TRUE);
+    }
+  }
+  else if (ecma_get_object_fast_elements (obj_p) != NULL)
+  {
+    uint32_t index;
+
+    if (ecma_string_get_array_index (property_name_p, &index))
+    {
+      const uint32_t length = ecma_get_object_fast_elements (obj_p)->length;
+
+      if (index < length)
+      {
+        /* elements of arrays in fast form are writable data properties, so steps 1 - 3 reduce to assignment */
+        ecma_fast_array_assign_value (obj_p, index, value);
+
+        return ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_TRUE);
+      }
+      else if (index == length
+               && ecma_fast_array_can_append (obj_p))
+      {
+        /* the array's prototypes don't have the property, so steps 1 - 5 reduce to [[DefineOwnProperty]]
+         * of the element with default attributes, that appends it to the vector */
+        ecma_fast_array_append (obj_p, value);
+
+        return ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_TRUE);
+      }
+    }
+  }
+
   // 1.
   if (!ecma_op_object_can_put (obj_p, property_name_p))
   {
@@ -641,13 +724,26 @@ ecma_op_general_object_define_own_property (ecma_object_t *obj_p, /**< the objec
     if (is_property_desc_generic_descriptor
         || is_property_desc_data_descriptor)
     {
-      ecma_property_t *new_prop_p = ecma_create_named_data_property (obj_p,
-                                                                     property_name_p,
-                                                                     property_desc_p->is_writable,
-                                                                     property_desc_p->is_enumerable,
-                                                                     property_desc_p->is_configurable);
+      bool is_added_to_slots = false;
 
-      ecma_named_data_property_assign_value (obj_p, new_prop_p, property_desc_p->value);
+      if (ecma_get_object_is_shaped (obj_p)
+          && property_desc_p->is_writable
+          && property_desc_p->is_enumerable
+          && property_desc_p->is_configurable)
+      {
+        is_added_to_slots = ecma_shaped_object_add_property (obj_p, property_name_p, property_desc_p->value);
+      }
+
+      if (!is_added_to_slots)
+      {
+        ecma_property_t *new_prop_p = ecma_create_named_data_property (obj_p,
+                                                                       property_name_p,
+                                                                       property_desc_p->is_writable,
+                                                                       property_desc_p->is_enumerable,
+                                                                       property_desc_p->is_configurable);
+
+        ecma_named_data_property_assign_value (obj_p, new_prop_p, property_desc_p->value);
+      }
     }
     else
     {
@@ -16,6 +16,7 @@
 #include "ecma-array-object.h"
 #include "ecma-builtins.h"
 #include "ecma-exceptions.h"
+#include "ecma-fast-array.h"
 #include "ecma-globals.h"
 #include "ecma-function-object.h"
 #include "ecma-lcache.h"
@@ -23,6 +24,7 @@
 #include "ecma-objects-arguments.h"
 #include "ecma-objects-general.h"
 #include "ecma-objects.h"
+#include "ecma-shapes.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -168,7 +170,12 @@ ecma_op_object_get_own_property (ecma_object_t *obj_p, /**< the object */
 
   ecma_property_t *prop_p = NULL;
 
-  if (likely (ecma_lcache_lookup (obj_p, property_name_p, &prop_p)))
+  if (ecma_get_object_is_shaped (obj_p))
+  {
+    /* objects in shaped form are not put to LCache */
+    return ecma_op_general_object_get_own_property (obj_p, property_name_p);
+  }
+  else if (likely (ecma_lcache_lookup (obj_p, property_name_p, &prop_p)))
   {
     return prop_p;
   }
@@ -218,6 +225,35 @@ ecma_op_object_get_property (ecma_object_t *obj_p, /**< the object */
   return ecma_op_general_object_get_property (obj_p, property_name_p);
 } /* ecma_op_object_get_property */
 
+/**
+ * [[HasProperty]] ecma object's operation
+ *
+ * Unlike [[GetProperty]], the operation doesn't require property descriptors of elements
+ * of arrays in fast form, so the arrays are not converted to the usual form.
+ *
+ * See also:
+ *          ECMA-262 v5, 8.12.6
+ *
+ * @return true - if the property exists in the object or in its prototype chain,
+ *         false - otherwise.
+ */
+bool
+ecma_op_object_has_property (ecma_object_t *obj_p, /**< the object */
+                             ecma_string_t *property_name_p) /**< property name */
+{
+  ecma_fast_array_elements_t *elements_p = ecma_get_object_fast_elements (obj_p);
+  uint32_t index;
+
+  if (elements_p != NULL
+      && ecma_string_get_array_index (property_name_p, &index)
+      && index < elements_p->length)
+  {
+    return true;
+  }
+
+  return (ecma_op_object_get_property (obj_p, property_name_p) != NULL);
+} /* ecma_op_object_has_property */
+
 /**
  * [[Put]] ecma object's operation
  *
@@ -240,24 +276,28 @@ ecma_op_object_put (ecma_object_t *obj_p, /**< the object */
   const ecma_object_type_t type = ecma_get_object_type (obj_p);
   ecma_assert_object_type_is_valid (type);
 
-  /*
-   * typedef ecma_property_t* (*put_ptr_t) (ecma_object_t *, ecma_string_t *);
-   * static const put_ptr_t put [ECMA_OBJECT_TYPE__COUNT] =
-   * {
-   *   [ECMA_OBJECT_TYPE_GENERAL]           = &ecma_op_general_object_put,
-   *   [ECMA_OBJECT_TYPE_ARRAY]             = &ecma_op_general_object_put,
-   *   [ECMA_OBJECT_TYPE_FUNCTION]          = &ecma_op_general_object_put,
-   *   [ECMA_OBJECT_TYPE_BOUND_FUNCTION]    = &ecma_op_general_object_put,
-   *   [ECMA_OBJECT_TYPE_EXTERNAL_FUNCTION] = &ecma_op_general_object_put,
-   *   [ECMA_OBJECT_TYPE_BUILT_IN_FUNCTION] = &ecma_op_general_object_put,
-   *   [ECMA_OBJECT_TYPE_ARGUMENTS]         = &ecma_op_general_object_put,
-   *   [ECMA_OBJECT_TYPE_STRING]            = &ecma_op_general_object_put
-   * };
-   *
-   * return put[type] (obj_p, property_name_p);
-   */
+  switch (type)
+  {
+    case ECMA_OBJECT_TYPE_GENERAL:
+    case ECMA_OBJECT_TYPE_ARRAY:
+    case ECMA_OBJECT_TYPE_FUNCTION:
+    case ECMA_OBJECT_TYPE_BOUND_FUNCTION:
+    case ECMA_OBJECT_TYPE_EXTERNAL_FUNCTION:
+    case ECMA_OBJECT_TYPE_BUILT_IN_FUNCTION:
+    case ECMA_OBJECT_TYPE_STRING:
+    {
+      return ecma_op_general_object_put (obj_p, property_name_p, value, is_throw);
+    }
+
+    case ECMA_OBJECT_TYPE_ARGUMENTS:
+    {
+      return ecma_op_arguments_object_put (obj_p, property_name_p, value, is_throw);
+    }
+  }
+
+  JERRY_ASSERT (false);
 
-  return ecma_op_general_object_put (obj_p, property_name_p, value, is_throw);
+  return ecma_make_empty_completion_value ();
 } /* ecma_op_object_put */
 
 /**
@@ -486,6 +526,36 @@ ecma_op_object_has_instance (ecma_object_t *obj_p, /**< the object */
   JERRY_UNREACHABLE ();
 } /* ecma_op_object_has_instance */
 
+/**
+ * Create all own properties of the object explicitly, so that they could be enumerated
+ * by iterating the object's property list
+ *
+ * Note:
+ *      Arguments object in compact form doesn't store its 'length', 'callee' and index properties explicitly
+ *      (see also: ecma_op_create_arguments_object), objects in shaped form store values of their properties
+ *      in slots (see also: ecma_shaped_object_convert_to_property_list), and arrays in fast form store
+ *      their elements in dense vector (see also: ecma_fast_array_convert_to_property_list)
+ */
+void
+ecma_op_object_materialize_properties (ecma_object_t *obj_p) /**< the object */
+{
+  JERRY_ASSERT (obj_p != NULL
+                && !ecma_is_lexical_environment (obj_p));
+
+  if (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_ARGUMENTS)
+  {
+    ecma_op_arguments_object_materialize (obj_p);
+  }
+  else if (ecma_get_object_is_shaped (obj_p))
+  {
+    ecma_shaped_object_convert_to_property_list (obj_p);
+  }
+  else if (ecma_get_object_fast_elements (obj_p) != NULL)
+  {
+    ecma_fast_array_convert_to_property_list (obj_p);
+  }
+} /* ecma_op_object_materialize_properties */
+
 /**
  * Object's isPrototypeOf operation
  *
@@ -669,6 +739,12 @@ ecma_object_get_class_name (ecma_object_t *obj_p) /**< object */
             return LIT_MAGIC_STRING_MATH_UL;
           }
 #endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_MATH_BUILTIN */
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_JSON_BUILTIN
+          case ECMA_BUILTIN_ID_JSON:
+          {
+            return LIT_MAGIC_STRING_JSON_U;
+          }
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_JSON_BUILTIN */
 #ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_ERROR_BUILTINS
           case ECMA_BUILTIN_ID_ERROR_PROTOTYPE:
           case ECMA_BUILTIN_ID_EVAL_ERROR_PROTOTYPE:
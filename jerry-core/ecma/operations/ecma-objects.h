@@ -29,6 +29,7 @@
 extern ecma_completion_value_t ecma_op_object_get (ecma_object_t *obj_p, ecma_string_t *property_name_p);
 extern ecma_property_t *ecma_op_object_get_own_property (ecma_object_t *obj_p, ecma_string_t *property_name_p);
 extern ecma_property_t *ecma_op_object_get_property (ecma_object_t *obj_p, ecma_string_t *property_name_p);
+extern bool ecma_op_object_has_property (ecma_object_t *obj_p, ecma_string_t *property_name_p);
 extern ecma_completion_value_t ecma_op_object_put (ecma_object_t *obj_p,
                                                    ecma_string_t *property_name_p,
                                                    ecma_value_t value,
@@ -45,6 +46,7 @@ ecma_op_object_define_own_property (ecma_object_t *obj_p,
                                     bool is_throw);
 extern ecma_completion_value_t ecma_op_object_has_instance (ecma_object_t *obj_p,
                                                             ecma_value_t value);
+extern void ecma_op_object_materialize_properties (ecma_object_t *obj_p);
 extern bool ecma_op_object_is_prototype_of (ecma_object_t *base_p, ecma_object_t *target_p);
 
 extern lit_magic_string_id_t ecma_object_get_class_name (ecma_object_t *obj_p);
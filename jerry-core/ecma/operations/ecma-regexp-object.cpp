@@ -168,7 +168,7 @@ ecma_op_create_regexp_object (ecma_string_t *pattern_p, /**< input pattern */
                                                                     magic_string_p,
                                                                     false, false, false);
   ecma_deref_ecma_string (magic_string_p);
-  ecma_set_named_data_property_value (source_prop_p,
+  ecma_set_named_data_property_value (obj_p, source_prop_p,
                                       ecma_make_string_value (ecma_copy_or_ref_ecma_string (pattern_p)));
 
   ecma_simple_value_t prop_value;
@@ -180,7 +180,7 @@ ecma_op_create_regexp_object (ecma_string_t *pattern_p, /**< input pattern */
                                                                     false, false, false);
   ecma_deref_ecma_string (magic_string_p);
   prop_value = flags & RE_FLAG_GLOBAL ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE;
-  ecma_set_named_data_property_value (global_prop_p, ecma_make_simple_value (prop_value));
+  ecma_set_named_data_property_value (obj_p, global_prop_p, ecma_make_simple_value (prop_value));
 
   /* Set ignoreCase property. ECMA-262 v5, 15.10.7.3*/
   magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_IGNORECASE_UL);
@@ -189,7 +189,7 @@ ecma_op_create_regexp_object (ecma_string_t *pattern_p, /**< input pattern */
                                                                         false, false, false);
   ecma_deref_ecma_string (magic_string_p);
   prop_value = flags & RE_FLAG_IGNORE_CASE ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE;
-  ecma_set_named_data_property_value (ignorecase_prop_p, ecma_make_simple_value (prop_value));
+  ecma_set_named_data_property_value (obj_p, ignorecase_prop_p, ecma_make_simple_value (prop_value));
 
 
   /* Set multiline property. ECMA-262 v5, 15.10.7.4*/
@@ -199,7 +199,7 @@ ecma_op_create_regexp_object (ecma_string_t *pattern_p, /**< input pattern */
                                                                        false, false, false);
   ecma_deref_ecma_string (magic_string_p);
   prop_value = flags & RE_FLAG_MULTILINE ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE;
-  ecma_set_named_data_property_value (multiline_prop_p, ecma_make_simple_value (prop_value));
+  ecma_set_named_data_property_value (obj_p, multiline_prop_p, ecma_make_simple_value (prop_value));
 
   /* Set lastIndex property. ECMA-262 v5, 15.10.7.5*/
   magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_LASTINDEX_UL);
@@ -1225,10 +1225,10 @@ ecma_regexp_exec_helper (ecma_object_t *obj_p, /**< RegExp object */
   {
     ecma_string_t *magic_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_LASTINDEX_UL);
     ecma_property_t *lastindex_prop_p = ecma_op_object_get_property (obj_p, magic_str_p);
-    ecma_number_t *lastindex_num_p = ecma_get_number_from_value (lastindex_prop_p->u.named_data_property.value);
-    index = ecma_number_to_int32 (*lastindex_num_p);
+    ecma_number_t lastindex_num = ecma_get_number_from_value (lastindex_prop_p->u.named_data_property.value);
+    index = ecma_number_to_int32 (lastindex_num);
     JERRY_ASSERT (str_p != NULL);
-    str_p += ecma_number_to_int32 (*lastindex_num_p);
+    str_p += ecma_number_to_int32 (lastindex_num);
     ecma_deref_ecma_string (magic_str_p);
   }
 
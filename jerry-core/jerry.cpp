@@ -154,14 +154,14 @@ jerry_api_convert_ecma_value_to_api_value (jerry_api_value_t *out_value_p, /**<
   }
   else if (ecma_is_value_number (value))
   {
-    ecma_number_t *num = ecma_get_number_from_value (value);
+    ecma_number_t num = ecma_get_number_from_value (value);
 
 #if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT32
     out_value_p->type = JERRY_API_DATA_TYPE_FLOAT32;
-    out_value_p->v_float32 = *num;
+    out_value_p->v_float32 = num;
 #elif CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64
     out_value_p->type = JERRY_API_DATA_TYPE_FLOAT64;
-    out_value_p->v_float64 = *num;
+    out_value_p->v_float64 = num;
 #endif /* CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64 */
   }
   else if (ecma_is_value_string (value))
@@ -1257,13 +1257,33 @@ jerry_init (jerry_flag_t flags) /**< combination of Jerry flags */
       "Ignoring detailed memory statistics options because memory statistics dump mode is not enabled.\n");
   }
 
+  if (flags & (JERRY_FLAG_OPCODE_PAIR_STATS))
+  {
+#ifndef MEM_STATS
+    flags &= ~JERRY_FLAG_OPCODE_PAIR_STATS;
+
+    JERRY_WARNING_MSG ("Ignoring opcode pair statistics option because of '!MEM_STATS' build configuration.\n");
+#endif /* !MEM_STATS */
+  }
+
+  if (flags & (JERRY_FLAG_INLINE_CACHE_STATS))
+  {
+#ifndef MEM_STATS
+    flags &= ~JERRY_FLAG_INLINE_CACHE_STATS;
+
+    JERRY_WARNING_MSG ("Ignoring inline cache statistics option because of '!MEM_STATS' build configuration.\n");
+#endif /* !MEM_STATS */
+  }
+
   jerry_flags = flags;
 
   jerry_make_api_available ();
 
   mem_init ();
   serializer_init ();
-  ecma_init ();
+  ecma_init ((flags & JERRY_FLAG_GC_INCREMENTAL) != 0,
+             (flags & JERRY_FLAG_GC_PROACTIVE) != 0,
+             (flags & JERRY_FLAG_GC_GENERATIONAL) != 0);
 } /* jerry_init */
 
 /**
@@ -1276,6 +1296,13 @@ jerry_cleanup (void)
 
   bool is_show_mem_stats = ((jerry_flags & JERRY_FLAG_MEM_STATS) != 0);
 
+#ifdef MEM_STATS
+  if (is_show_mem_stats)
+  {
+    ecma_gc_stats_print ();
+  }
+#endif /* MEM_STATS */
+
   ecma_finalize ();
   serializer_free ();
   mem_finalize (is_show_mem_stats);
@@ -1294,6 +1321,25 @@ jerry_get_memory_limits (size_t *out_data_bss_brk_limit_p, /**< out: Jerry's max
   *out_stack_limit_p = CONFIG_MEM_STACK_LIMIT;
 } /* jerry_get_memory_limits */
 
+/**
+ * Perform a step of incremental garbage collection
+ *
+ * Unreachable objects are found and freed in garbage collection cycles. The routine continues
+ * current cycle (or starts a new one), processing at most the specified number of objects,
+ * so duration of the call is limited by the budget, and the cycle can be completed
+ * with a series of calls, interleaved with execution of scripts.
+ *
+ * @return true - if garbage collection cycle was completed during the step,
+ *         false - otherwise.
+ */
+bool
+jerry_gc_step (uint32_t budget) /**< maximum number of objects to process during the step */
+{
+  jerry_assert_api_available ();
+
+  return ecma_gc_step (budget);
+} /* jerry_gc_step */
+
 /**
  * Check whether 'abort' should be called instead of 'exit' upon exiting with non-zero exit code.
  *
@@ -1354,8 +1400,10 @@ jerry_parse (const jerry_api_char_t* source_p, /**< script source */
 #endif /* MEM_STATS */
 
   bool is_show_mem_stats_per_opcode = ((jerry_flags & JERRY_FLAG_MEM_STATS_PER_OPCODE) != 0);
+  bool is_show_opcode_pair_stats = ((jerry_flags & JERRY_FLAG_OPCODE_PAIR_STATS) != 0);
+  bool is_show_inline_cache_stats = ((jerry_flags & JERRY_FLAG_INLINE_CACHE_STATS) != 0);
 
-  vm_init (opcodes_p, is_show_mem_stats_per_opcode);
+  vm_init (opcodes_p, is_show_mem_stats_per_opcode, is_show_opcode_pair_stats, is_show_inline_cache_stats);
 
   return true;
 } /* jerry_parse */
@@ -40,6 +40,18 @@ typedef uint32_t jerry_flag_t;
                                                      *   FIXME: Remove. */
 #define JERRY_FLAG_ENABLE_LOG             (1u << 5) /**< enable logging */
 #define JERRY_FLAG_ABORT_ON_FAIL          (1u << 6) /**< abort instead of exit in case of failure */
+#define JERRY_FLAG_GC_INCREMENTAL         (1u << 7) /**< perform incremental garbage collection steps
+                                                     *   upon object allocations (see also: jerry_gc_step) */
+#define JERRY_FLAG_GC_PROACTIVE           (1u << 8) /**< trigger garbage collection upon growth of heap usage
+                                                     *   by a factor relative to the heap usage after previous
+                                                     *   garbage collection (see also: CONFIG_ECMA_GC_PROACTIVE_*) */
+#define JERRY_FLAG_GC_GENERATIONAL        (1u << 9) /**< allocate objects into the nursery (young generation),
+                                                     *   and collect it with minor collections
+                                                     *   (see also: CONFIG_ECMA_GC_NURSERY_SIZE) */
+#define JERRY_FLAG_OPCODE_PAIR_STATS      (1u << 10) /**< dump histogram of pairs of consecutively executed opcodes
+                                                      *   (MEM_STATS build) */
+#define JERRY_FLAG_INLINE_CACHE_STATS     (1u << 11) /**< dump statistics of hits and misses of inline caches
+                                                      *   of property access opcodes (MEM_STATS build) */
 
 /**
  * Error codes
@@ -81,6 +93,7 @@ extern EXTERN_C void jerry_init (jerry_flag_t flags);
 extern EXTERN_C void jerry_cleanup (void);
 
 extern EXTERN_C void jerry_get_memory_limits (size_t *out_data_bss_brk_limit_p, size_t *out_stack_limit_p);
+extern EXTERN_C bool jerry_gc_step (uint32_t budget);
 extern EXTERN_C void jerry_reg_err_callback (jerry_error_callback_t callback);
 
 extern EXTERN_C bool jerry_parse (const jerry_api_char_t * source_p, size_t source_size);
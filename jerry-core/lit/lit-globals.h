@@ -109,9 +109,9 @@ typedef uint32_t lit_utf8_size_t;
 typedef uint32_t lit_code_point_t;
 
 /**
- * ECMA string hash
+ * ECMA string hash (calculated from all characters of the string)
  */
-typedef uint8_t lit_string_hash_t;
+typedef uint16_t lit_string_hash_t;
 
 /**
  * ECMA string hash value length, in bits
@@ -119,8 +119,9 @@ typedef uint8_t lit_string_hash_t;
 #define LIT_STRING_HASH_BITS (sizeof (lit_string_hash_t) * JERRY_BITSINBYTE)
 
 /**
- * Number of string's last characters to use for hash calculation
+ * Parameters of FNV-1a hash, from which ECMA string hash is calculated
  */
-#define LIT_STRING_HASH_LAST_BYTES_COUNT (2)
+#define LIT_STRING_HASH_FNV_OFFSET_BASIS (2166136261u)
+#define LIT_STRING_HASH_FNV_PRIME (16777619u)
 
 #endif /* LIT_GLOBALS_H */
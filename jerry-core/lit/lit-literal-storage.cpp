@@ -37,7 +37,7 @@ lit_charset_record_t::get_prev () const
   it.skip (RCS_DYN_STORAGE_LENGTH_UNIT);
 
   cpointer_t cpointer;
-  cpointer.packed_value = it.read<uint16_t> ();
+  cpointer.packed_value = it.read<mem_cpointer_t> ();
 
   return cpointer_t::decompress (cpointer);
 } /* lit_charset_record_t::get_prev */
@@ -51,9 +51,44 @@ lit_charset_record_t::set_prev (rcs_record_t *prev_rec_p) /**< pointer to the re
   rcs_record_iterator_t it ((rcs_recordset_t *)&lit_storage, (rcs_record_t *)this);
   it.skip (RCS_DYN_STORAGE_LENGTH_UNIT);
 
-  it.write<uint16_t> (cpointer_t::compress (prev_rec_p).packed_value);
+  it.write<mem_cpointer_t> (cpointer_t::compress (prev_rec_p).packed_value);
 } /* lit_charset_record_t::set_prev */
 
+/**
+ * Get hash value of the record's charset (the value of the 'hash' field in the header)
+ *
+ * @return hash value of the string
+ */
+lit_string_hash_t
+lit_charset_record_t::get_hash () const
+{
+  if (likely (lit_storage.is_header_in_one_node (this, _header_size)))
+  {
+    /* usually, the header is not split between nodes of the storage, so the field is read directly */
+    lit_string_hash_t hash;
+    memcpy (&hash, (const uint8_t *) this + _hash_offset, sizeof (hash));
+
+    return hash;
+  }
+
+  rcs_record_iterator_t it ((rcs_recordset_t *)&lit_storage, (rcs_record_t *)this);
+  it.skip (_hash_offset);
+
+  return it.read<lit_string_hash_t> ();
+} /* lit_charset_record_t::get_hash */
+
+/**
+ * Set record's hash (the value of the 'hash' field in the header)
+ */
+void
+lit_charset_record_t::set_hash (lit_string_hash_t hash) /**< hash value */
+{
+  rcs_record_iterator_t it ((rcs_recordset_t *)&lit_storage, (rcs_record_t *)this);
+  it.skip (_hash_offset);
+
+  it.write<lit_string_hash_t> (hash);
+} /* lit_charset_record_t::set_hash */
+
 /**
  * Set the charset of the record
  */
@@ -235,7 +270,7 @@ lit_literal_storage_t::create_charset_record (const lit_utf8_byte_t *str, /**< s
 
   ret->set_alignment_bytes_count (alignment);
   ret->set_charset (str, buf_size);
-  ret->set_hash (lit_utf8_string_calc_hash_last_bytes (str, ret->get_length ()));
+  ret->set_hash (lit_utf8_string_calc_hash (str, ret->get_length ()));
 
   return ret;
 } /* lit_literal_storage_t::create_charset_record */
@@ -469,6 +504,9 @@ template ecma_number_t rcs_record_iterator_t::read<ecma_number_t> ();
 template void rcs_record_iterator_t::write<uint16_t> (uint16_t);
 template uint16_t rcs_record_iterator_t::read<uint16_t> ();
 
+template void rcs_record_iterator_t::write<uint32_t> (uint32_t);
+template uint32_t rcs_record_iterator_t::read<uint32_t> ();
+
 template lit_magic_string_id_t lit_magic_record_t::get_magic_str_id<lit_magic_string_id_t>() const;
 template lit_magic_string_ex_id_t lit_magic_record_t::get_magic_str_id<lit_magic_string_ex_id_t>() const;
 template void lit_magic_record_t::set_magic_str_id<lit_magic_string_id_t>(lit_magic_string_id_t);
@@ -29,10 +29,10 @@ extern lit_literal_storage_t lit_storage;
  * ------- header -----------------------
  * type (4 bits)
  * alignment (2 bits)
- * unused (2 bits)
- * hash (8 bits)
+ * unused (10 bits)
  * length (16 bits)
  * pointer to prev (16 bits)
+ * hash (16 bits)
  * ------- characters -------------------
  * ...
  * chars
@@ -92,16 +92,7 @@ public:
     set_field (_alignment_field_pos, _alignment_field_width, count);
   } /* set_alignment_bytes_count */
 
-  /**
-   * Get hash value of the record's charset.
-   *
-   * @return hash value of the string (the value of the 'hash' field in the header)
-   */
-  lit_string_hash_t
-  get_hash () const
-  {
-    return (lit_string_hash_t) get_field (_hash_field_pos, _hash_field_width);
-  } /* get_hash */
+  lit_string_hash_t get_hash () const;
 
   /**
    * Get the length of the string, which is contained inside the record
@@ -145,14 +136,7 @@ private:
     set_field (_length_field_pos, _length_field_width, size >> RCS_DYN_STORAGE_ALIGNMENT_LOG);
   } /* set_size */
 
-  /**
-   * Set record's hash (the value of the 'hash' field in the header)
-   */
-  void
-  set_hash (lit_string_hash_t hash) /**< hash value */
-  {
-    set_field (_hash_field_pos, _hash_field_width, hash);
-  } /* set_hash */
+  void set_hash (lit_string_hash_t);
 
   void set_prev (rcs_record_t *);
 
@@ -162,18 +146,12 @@ private:
    * Offset and length of 'alignment' field, in bits
    */
   static const uint32_t _alignment_field_pos = _fields_offset_begin;
-  static const uint32_t _alignment_field_width = 2u;
+  static const uint32_t _alignment_field_width = RCS_DYN_STORAGE_ALIGNMENT_LOG;
 
   /**
-   * Offset and length of 'hash' field, in bits
+   * Offset and length of 'length' field, in bits
    */
-  static const uint32_t _hash_field_pos = _alignment_field_pos + _alignment_field_width + 2u;
-  static const uint32_t _hash_field_width = 8u;
-
-  /**
-   * Offset and length of 'alignment' field, in bits
-   */
-  static const uint32_t _length_field_pos = _hash_field_pos + _hash_field_width;
+  static const uint32_t _length_field_pos = _alignment_field_pos + _alignment_field_width + 10u;
   static const uint32_t _length_field_width = 16u;
 
   /**
@@ -182,7 +160,12 @@ private:
   static const uint32_t _prev_field_pos = _length_field_pos + _length_field_width;
   static const uint32_t _prev_field_width = rcs_cpointer_t::bit_field_width;
 
-  static const size_t _header_size = RCS_DYN_STORAGE_LENGTH_UNIT + RCS_DYN_STORAGE_LENGTH_UNIT / 2;
+  /**
+   * Offset of 'hash' field, in bytes
+   */
+  static const size_t _hash_offset = RCS_DYN_STORAGE_LENGTH_UNIT + RCS_DYN_STORAGE_LENGTH_UNIT / 2;
+
+  static const size_t _header_size = _hash_offset + sizeof (lit_string_hash_t);
 }; /* lit_charset_record_t */
 
 /**
@@ -105,13 +105,17 @@ lit_find_literal_by_utf8_string (const lit_utf8_byte_t *str_p, /**< a string to
                                  lit_utf8_size_t str_size)        /**< length of the string */
 {
   JERRY_ASSERT (str_p || !str_size);
+
+  const lit_string_hash_t str_hash = lit_utf8_string_calc_hash (str_p, str_size);
+
   for (literal_t lit = lit_storage.get_first (); lit != NULL; lit = lit_storage.get_next (lit))
   {
     rcs_record_t::type_t type = lit->get_type ();
 
     if (type == LIT_STR_T)
     {
-      if (static_cast<lit_charset_record_t *>(lit)->get_length () != str_size)
+      if (static_cast<lit_charset_record_t *>(lit)->get_length () != str_size
+          || static_cast<lit_charset_record_t *>(lit)->get_hash () != str_hash)
       {
         continue;
       }
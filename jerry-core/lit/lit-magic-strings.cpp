@@ -22,6 +22,11 @@
  */
 static lit_utf8_size_t lit_magic_string_sizes[LIT_MAGIC_STRING__COUNT];
 
+/**
+ * Hashes of magic strings
+ */
+static lit_string_hash_t lit_magic_string_hashes[LIT_MAGIC_STRING__COUNT];
+
 /**
  * External magic strings data array, count and lengths
  */
@@ -53,6 +58,8 @@ lit_magic_strings_init (void)
        id = (lit_magic_string_id_t) (id + 1))
   {
     lit_magic_string_sizes[id] = lit_zt_utf8_string_size (lit_get_magic_string_utf8 (id));
+    lit_magic_string_hashes[id] = lit_utf8_string_calc_hash (lit_get_magic_string_utf8 (id),
+                                                             lit_magic_string_sizes[id]);
 
 #ifndef JERRY_NDEBUG
     ecma_magic_string_max_length = JERRY_MAX (ecma_magic_string_max_length, lit_magic_string_sizes[id]);
@@ -117,6 +124,17 @@ lit_get_magic_string_size (lit_magic_string_id_t id) /**< magic string id */
   return lit_magic_string_sizes[id];
 } /* lit_get_magic_string_size */
 
+/**
+ * Get hash of specified magic string
+ *
+ * @return hash of the string
+ */
+lit_string_hash_t
+lit_get_magic_string_hash (lit_magic_string_id_t id) /**< magic string id */
+{
+  return lit_magic_string_hashes[id];
+} /* lit_get_magic_string_hash */
+
 /**
  * Get specified magic string as zero-terminated string from external table
  *
@@ -63,6 +63,7 @@ LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_URI_ERROR_UL, "URIError")
 LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_MATH_UL, "Math")
 LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_JSON_U, "JSON")
 LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_PARSE, "parse")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_STRINGIFY, "stringify")
 LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_PARSE_INT, "parseInt")
 LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_PARSE_FLOAT, "parseFloat")
 LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_IS_NAN, "isNaN")
@@ -39,6 +39,7 @@ lit_is_utf8_string_valid (const lit_utf8_byte_t *utf8_buf_p, /**< utf-8 string *
     lit_utf8_byte_t c = utf8_buf_p[idx++];
     if ((c & LIT_UTF8_1_BYTE_MASK) == LIT_UTF8_1_BYTE_MARKER)
     {
+      is_prev_code_point_high_surrogate = false;
       continue;
     }
 
@@ -545,26 +546,31 @@ lit_read_code_point_from_utf8 (const lit_utf8_byte_t *buf_p, /**< buffer with ch
 
 
 /**
- * Calculate hash from last LIT_STRING_HASH_LAST_BYTES_COUNT characters from the buffer.
+ * Calculate hash from all characters of the buffer.
+ *
+ * The hash is 32-bit FNV-1a hash of the characters, folded to width of lit_string_hash_t,
+ * so every character affects every bit of the hash.
  *
  * @return ecma-string's hash
  */
 lit_string_hash_t
-lit_utf8_string_calc_hash_last_bytes (const lit_utf8_byte_t *utf8_buf_p, /**< characters buffer */
-                                      lit_utf8_size_t utf8_buf_size) /**< number of characters in the buffer */
+lit_utf8_string_calc_hash (const lit_utf8_byte_t *utf8_buf_p, /**< characters buffer */
+                           lit_utf8_size_t utf8_buf_size) /**< number of characters in the buffer */
 {
-  JERRY_ASSERT (utf8_buf_p != NULL);
+  JERRY_ASSERT (utf8_buf_p != NULL || utf8_buf_size == 0);
+
+  uint32_t hash = LIT_STRING_HASH_FNV_OFFSET_BASIS;
 
-  lit_utf8_byte_t byte1 = (utf8_buf_size > 0) ? utf8_buf_p[utf8_buf_size - 1] : 0;
-  lit_utf8_byte_t byte2 = (utf8_buf_size > 1) ? utf8_buf_p[utf8_buf_size - 2] : 0;
+  for (lit_utf8_size_t i = 0; i < utf8_buf_size; i++)
+  {
+    hash ^= utf8_buf_p[i];
+    hash *= LIT_STRING_HASH_FNV_PRIME;
+  }
 
-  uint32_t t1 = (uint32_t) byte1 + (uint32_t) byte2;
-  uint32_t t2 = t1 * 0x24418b66;
-  uint32_t t3 = (t2 >> 16) ^ (t2 & 0xffffu);
-  uint32_t t4 = (t3 >> 8) ^ (t3 & 0xffu);
+  JERRY_STATIC_ASSERT (LIT_STRING_HASH_BITS == 16);
 
-  return (lit_string_hash_t) t4;
-} /* lit_utf8_string_calc_hash_last_bytes */
+  return (lit_string_hash_t) ((hash >> 16u) ^ hash);
+} /* lit_utf8_string_calc_hash */
 
 /**
  * Return code unit at the specified position in string
@@ -702,6 +708,100 @@ lit_code_point_to_utf8 (lit_code_point_t code_point, /**< code point */
   }
 } /* lit_code_unit_to_utf8 */
 
+/**
+ * Check whether the buffer starts with a surrogate code unit, represented with 3-byte utf-8 sequence
+ *
+ * @return true - if the code unit is in the specified range of surrogates,
+ *         false - otherwise.
+ */
+static bool
+lit_utf8_is_surrogate_at (const lit_utf8_byte_t *buf_p, /**< buffer, holding at least 3 bytes */
+                          lit_code_point_t min_code_unit, /**< lower bound of the surrogates' range */
+                          lit_code_point_t max_code_unit) /**< upper bound of the surrogates' range */
+{
+  if ((buf_p[0] & LIT_UTF8_3_BYTE_MASK) != LIT_UTF8_3_BYTE_MARKER)
+  {
+    return false;
+  }
+
+  lit_code_point_t code_unit;
+  lit_read_code_point_from_utf8 (buf_p, LIT_UTF8_MAX_BYTES_IN_CODE_UNIT, &code_unit);
+
+  return (code_unit >= min_code_unit && code_unit <= max_code_unit);
+} /* lit_utf8_is_surrogate_at */
+
+/**
+ * Replace pairs of surrogates, that are represented with two 3-byte utf-8 sequences,
+ * with 4-byte utf-8 sequences of corresponding code points.
+ *
+ * Such pairs appear when code units are converted to utf-8 one by one (see also: lit_code_unit_to_utf8),
+ * and are not allowed in strings' internal representation (see also: lit_is_utf8_string_valid).
+ *
+ * Note:
+ *      the conversion is performed in place, as the result is never longer than the source
+ *
+ * @return size of the converted string
+ */
+lit_utf8_size_t
+lit_utf8_string_combine_surrogates (lit_utf8_byte_t *utf8_buf_p, /**< utf-8 string */
+                                    lit_utf8_size_t utf8_buf_size) /**< string size */
+{
+  JERRY_ASSERT (utf8_buf_p != NULL || utf8_buf_size == 0);
+
+  /* utf-8 sequences of all surrogates start with the byte */
+  const lit_utf8_byte_t surrogate_first_byte = (lit_utf8_byte_t) (LIT_UTF8_3_BYTE_MARKER
+                                                                   | (LIT_UTF16_HIGH_SURROGATE_MIN >> 12));
+
+  const lit_utf8_byte_t *const end_p = utf8_buf_p + utf8_buf_size;
+  const lit_utf8_byte_t *read_p = utf8_buf_p;
+  const lit_utf8_byte_t *iter_p = utf8_buf_p;
+  lit_utf8_byte_t *write_p = utf8_buf_p;
+
+  while (end_p - iter_p >= 2 * LIT_UTF8_MAX_BYTES_IN_CODE_UNIT)
+  {
+    const lit_utf8_byte_t *high_p = iter_p;
+    const lit_utf8_byte_t *low_p = iter_p + LIT_UTF8_MAX_BYTES_IN_CODE_UNIT;
+
+    if (*high_p != surrogate_first_byte
+        || !lit_utf8_is_surrogate_at (high_p, LIT_UTF16_HIGH_SURROGATE_MIN, LIT_UTF16_HIGH_SURROGATE_MAX)
+        || !lit_utf8_is_surrogate_at (low_p, LIT_UTF16_LOW_SURROGATE_MIN, LIT_UTF16_LOW_SURROGATE_MAX))
+    {
+      iter_p++;
+      continue;
+    }
+
+    /* bytes before the pair are kept as is */
+    if (write_p != read_p)
+    {
+      memmove (write_p, read_p, (size_t) (high_p - read_p));
+    }
+
+    write_p += high_p - read_p;
+
+    lit_code_point_t high_surrogate, low_surrogate;
+    lit_read_code_point_from_utf8 (high_p, LIT_UTF8_MAX_BYTES_IN_CODE_UNIT, &high_surrogate);
+    lit_read_code_point_from_utf8 (low_p, LIT_UTF8_MAX_BYTES_IN_CODE_UNIT, &low_surrogate);
+
+    lit_code_point_t code_point = LIT_UTF16_FIRST_SURROGATE_CODE_POINT;
+    code_point += (high_surrogate - LIT_UTF16_HIGH_SURROGATE_MIN) << LIT_UTF16_BITS_IN_SURROGATE;
+    code_point += low_surrogate - LIT_UTF16_LOW_SURROGATE_MIN;
+
+    write_p += lit_code_point_to_utf8 (code_point, write_p);
+
+    iter_p = low_p + LIT_UTF8_MAX_BYTES_IN_CODE_UNIT;
+    read_p = iter_p;
+  }
+
+  if (write_p != read_p)
+  {
+    memmove (write_p, read_p, (size_t) (end_p - read_p));
+  }
+
+  write_p += end_p - read_p;
+
+  return (lit_utf8_size_t) (write_p - utf8_buf_p);
+} /* lit_utf8_string_combine_surrogates */
+
 /**
  * Compare utf-8 string to utf-8 string
  *
@@ -137,7 +137,7 @@ lit_utf8_size_t lit_zt_utf8_string_size (const lit_utf8_byte_t *);
 ecma_length_t lit_utf8_string_length (const lit_utf8_byte_t *, lit_utf8_size_t);
 
 /* hash */
-lit_string_hash_t lit_utf8_string_calc_hash_last_bytes (const lit_utf8_byte_t *, lit_utf8_size_t);
+lit_string_hash_t lit_utf8_string_calc_hash (const lit_utf8_byte_t *, lit_utf8_size_t);
 
 /* code unit access */
 ecma_char_t lit_utf8_string_code_unit_at (const lit_utf8_byte_t *, lit_utf8_size_t, ecma_length_t);
@@ -146,6 +146,7 @@ lit_utf8_size_t lit_get_unicode_char_size_by_utf8_first_byte (lit_utf8_byte_t);
 /* conversion */
 lit_utf8_size_t lit_code_unit_to_utf8 (ecma_char_t, lit_utf8_byte_t *);
 lit_utf8_size_t lit_code_point_to_utf8 (lit_code_point_t, lit_utf8_byte_t *);
+lit_utf8_size_t lit_utf8_string_combine_surrogates (lit_utf8_byte_t *, lit_utf8_size_t);
 
 /* comparison */
 bool lit_compare_utf8_strings (const lit_utf8_byte_t *,
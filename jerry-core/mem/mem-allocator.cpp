@@ -23,28 +23,97 @@
 #include "mem-heap.h"
 #include "mem-poolman.h"
 
+#ifdef CONFIG_MEM_LARGE_HEAP
+# include <sys/mman.h>
+#endif /* CONFIG_MEM_LARGE_HEAP */
+
 #define MEM_ALLOCATOR_INTERNAL
 
 #include "mem-allocator-internal.h"
 
+#ifndef CONFIG_MEM_LARGE_HEAP
 /**
  * Area for heap
  */
 static uint8_t mem_heap_area[ MEM_HEAP_AREA_SIZE ] __attribute__ ((aligned (JERRY_MAX (MEM_ALIGNMENT,
                                                                                        MEM_HEAP_CHUNK_SIZE))));
+#else /* CONFIG_MEM_LARGE_HEAP */
+/**
+ * Area for heap
+ *
+ * In large heap mode the area is reserved with mmap during initialization of memory allocators,
+ * so physical pages of the area are committed only after they are touched.
+ */
+static uint8_t *mem_heap_area = NULL;
+#endif /* CONFIG_MEM_LARGE_HEAP */
 
 /**
  * The 'try to give memory back' callback
  */
 static mem_try_give_memory_back_callback_t mem_try_give_memory_back_callback = NULL;
 
+#ifdef MEM_STATS
+/**
+ * Print pools' memory usage statistics
+ */
+static void
+mem_pools_stats_print (void)
+{
+  mem_pools_stats_t stats;
+  mem_pools_get_stats (&stats);
+
+  printf ("Pools stats:\n");
+  printf ("  Pools: %zu\n"
+          "  Allocated chunks: %zu\n"
+          "  Free chunks: %zu\n"
+          "  Peak pools: %zu\n"
+          "  Peak allocated chunks: %zu\n",
+          stats.pools_count,
+          stats.allocated_chunks,
+          stats.free_chunks,
+          stats.peak_pools_count,
+          stats.peak_allocated_chunks);
+
+  for (size_t size_class = 0; size_class < MEM_POOL_SIZE_CLASSES_NUMBER; size_class++)
+  {
+    printf (" Chunk size: %zu\n"
+            "  Pools: %zu\n"
+            "  Allocated chunks: %zu\n"
+            "  Free chunks: %zu\n"
+            "  Peak allocated chunks: %zu\n",
+            MEM_POOL_CLASS_CHUNK_SIZE (size_class),
+            stats.size_class_pools_count[size_class],
+            stats.size_class_allocated_chunks[size_class],
+            stats.size_class_free_chunks[size_class],
+            stats.size_class_peak_allocated_chunks[size_class]);
+  }
+
+  printf ("\n");
+} /* mem_pools_stats_print */
+#endif /* MEM_STATS */
+
 /**
  * Initialize memory allocators.
  */
 void
 mem_init (void)
 {
-  mem_heap_init (mem_heap_area, sizeof (mem_heap_area));
+#ifdef CONFIG_MEM_LARGE_HEAP
+  void *area_p = mmap (NULL,
+                       MEM_HEAP_AREA_SIZE,
+                       PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+                       -1,
+                       0);
+  if (area_p == MAP_FAILED)
+  {
+    jerry_fatal (ERR_OUT_OF_MEMORY);
+  }
+
+  mem_heap_area = (uint8_t*) area_p;
+#endif /* CONFIG_MEM_LARGE_HEAP */
+
+  mem_heap_init (mem_heap_area, MEM_HEAP_AREA_SIZE);
   mem_pools_init ();
 } /* mem_init */
 
@@ -62,26 +131,16 @@ mem_finalize (bool is_show_mem_stats) /**< show heap memory stats
     mem_heap_print (false, false, true);
 
 #ifdef MEM_STATS
-    mem_pools_stats_t stats;
-    mem_pools_get_stats (&stats);
-
-    printf ("Pools stats:\n");
-    printf (" Chunk size: %zu\n"
-            "  Pools: %zu\n"
-            "  Allocated chunks: %zu\n"
-            "  Free chunks: %zu\n"
-            "  Peak pools: %zu\n"
-            "  Peak allocated chunks: %zu\n\n",
-            MEM_POOL_CHUNK_SIZE,
-            stats.pools_count,
-            stats.allocated_chunks,
-            stats.free_chunks,
-            stats.peak_pools_count,
-            stats.peak_allocated_chunks);
+    mem_pools_stats_print ();
 #endif /* MEM_STATS */
   }
 
   mem_heap_finalize ();
+
+#ifdef CONFIG_MEM_LARGE_HEAP
+  munmap (mem_heap_area, MEM_HEAP_AREA_SIZE);
+  mem_heap_area = NULL;
+#endif /* CONFIG_MEM_LARGE_HEAP */
 } /* mem_finalize */
 
 /**
@@ -206,21 +265,6 @@ mem_stats_print (void)
 {
   mem_heap_print (false, false, true);
 
-  mem_pools_stats_t stats;
-  mem_pools_get_stats (&stats);
-
-  printf ("Pools stats:\n");
-  printf (" Chunk size: %zu\n"
-          "  Pools: %zu\n"
-          "  Allocated chunks: %zu\n"
-          "  Free chunks: %zu\n"
-          "  Peak pools: %zu\n"
-          "  Peak allocated chunks: %zu\n\n",
-          MEM_POOL_CHUNK_SIZE,
-          stats.pools_count,
-          stats.allocated_chunks,
-          stats.free_chunks,
-          stats.peak_pools_count,
-          stats.peak_allocated_chunks);
+  mem_pools_stats_print ();
 } /* mem_stats_print */
 #endif /* MEM_STATS */
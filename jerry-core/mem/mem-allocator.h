@@ -28,11 +28,6 @@
 #include "mem-heap.h"
 #include "mem-poolman.h"
 
-/**
- * Compressed pointer
- */
-typedef uint16_t mem_cpointer_t;
-
 /**
  * Representation of NULL value for compressed pointers
  */
@@ -48,6 +43,15 @@ typedef uint16_t mem_cpointer_t;
  */
 #define MEM_CP_WIDTH (MEM_HEAP_OFFSET_LOG - MEM_ALIGNMENT_LOG)
 
+/**
+ * Compressed pointer
+ */
+#if MEM_CP_WIDTH <= 16
+typedef uint16_t mem_cpointer_t;
+#else /* MEM_CP_WIDTH > 16 */
+typedef uint32_t mem_cpointer_t;
+#endif /* MEM_CP_WIDTH > 16 */
+
 /**
  * Compressed pointer value mask
  */
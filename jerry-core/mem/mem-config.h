@@ -38,6 +38,12 @@
  */
 #define MEM_POOL_CHUNK_SIZE ((size_t) (CONFIG_MEM_POOL_CHUNK_SIZE))
 
+#define MEM_POOL_SIZE_CLASSES_NUMBER (CONFIG_MEM_POOL_SIZE_CLASSES_NUMBER)
+
+#define MEM_POOL_CLASS_CHUNK_SIZE(size_class) (MEM_POOL_CHUNK_SIZE << (size_class))
+
+#define MEM_POOL_MAX_CHUNK_SIZE (MEM_POOL_CLASS_CHUNK_SIZE (MEM_POOL_SIZE_CLASSES_NUMBER - 1))
+
 /**
  * Log2 of maximum number of chunks in a pool
  */
@@ -130,6 +130,28 @@ JERRY_STATIC_ASSERT (MEM_HEAP_CHUNK_SIZE >= sizeof (mem_block_header_t));
  */
 JERRY_STATIC_ASSERT (MEM_HEAP_CHUNK_SIZE % MEM_ALIGNMENT == 0);
 
+/**
+ * Links of a free block in the free list of its size class
+ *
+ * Note:
+ *      the links are stored in the data space of the free block, right after the block's header
+ */
+typedef struct
+{
+  mem_block_header_t *prev_free_block_p; /**< previous free block of the same size class (or NULL) */
+  mem_block_header_t *next_free_block_p; /**< next free block of the same size class (or NULL) */
+} mem_free_block_links_t;
+
+/**
+ * Chunk should have enough space for block header and free list links
+ */
+JERRY_STATIC_ASSERT (MEM_HEAP_CHUNK_SIZE >= sizeof (mem_block_header_t) + sizeof (mem_free_block_links_t));
+
+/**
+ * Bitmap of non-empty free lists should have a bit for each size class
+ */
+JERRY_STATIC_ASSERT (MEM_HEAP_FREE_LISTS_NUMBER <= sizeof (uint32_t) * JERRY_BITSINBYTE);
+
 /**
  * Description of heap state
  */
@@ -139,9 +161,13 @@ typedef struct
   size_t heap_size; /**< heap space size */
   mem_block_header_t* first_block_p; /**< first block of the heap */
   mem_block_header_t* last_block_p;  /**< last block of the heap */
+  mem_block_header_t* free_lists[MEM_HEAP_FREE_LISTS_NUMBER]; /**< free blocks, segregated by size class */
+  uint32_t free_lists_bitmap; /**< bitmap of non-empty free lists (i-th bit corresponds to i-th size class) */
   size_t allocated_bytes; /**< total size of allocated heap space */
   size_t limit; /**< current limit of heap usage, that is upon being reached,
                  *   causes call of "try give memory back" callbacks */
+  bool is_limit_fixed; /**< the limit is set with mem_heap_set_limit and is not adjusted
+                        *   upon allocations and frees */
 } mem_heap_state_t;
 
 /**
@@ -162,6 +188,9 @@ static void mem_init_block_header (uint8_t *first_chunk_p,
                                    mem_block_header_t *next_block_p);
 static void mem_check_heap (void);
 
+static void mem_heap_insert_free_block (mem_block_header_t *block_p);
+static void mem_heap_remove_free_block (mem_block_header_t *block_p);
+
 #ifdef MEM_STATS
 /**
  * Heap's memory usage statistics
@@ -173,18 +202,24 @@ static void mem_heap_stat_alloc_block (mem_block_header_t *block_header_p);
 static void mem_heap_stat_free_block (mem_block_header_t *block_header_p);
 static void mem_heap_stat_free_block_split (void);
 static void mem_heap_stat_free_block_merge (void);
+static void mem_heap_stat_free_list_insert (size_t list_index, size_t chunks);
+static void mem_heap_stat_free_list_remove (size_t list_index, size_t chunks);
 
 #  define MEM_HEAP_STAT_INIT() mem_heap_stat_init ()
 #  define MEM_HEAP_STAT_ALLOC_BLOCK(v) mem_heap_stat_alloc_block (v)
 #  define MEM_HEAP_STAT_FREE_BLOCK(v) mem_heap_stat_free_block (v)
 #  define MEM_HEAP_STAT_FREE_BLOCK_SPLIT() mem_heap_stat_free_block_split ()
 #  define MEM_HEAP_STAT_FREE_BLOCK_MERGE() mem_heap_stat_free_block_merge ()
+#  define MEM_HEAP_STAT_FREE_LIST_INSERT(i, c) mem_heap_stat_free_list_insert (i, c)
+#  define MEM_HEAP_STAT_FREE_LIST_REMOVE(i, c) mem_heap_stat_free_list_remove (i, c)
 #else /* !MEM_STATS */
 #  define MEM_HEAP_STAT_INIT()
 #  define MEM_HEAP_STAT_ALLOC_BLOCK(v)
 #  define MEM_HEAP_STAT_FREE_BLOCK(v)
 #  define MEM_HEAP_STAT_FREE_BLOCK_SPLIT()
 #  define MEM_HEAP_STAT_FREE_BLOCK_MERGE()
+#  define MEM_HEAP_STAT_FREE_LIST_INSERT(i, c)
+#  define MEM_HEAP_STAT_FREE_LIST_REMOVE(i, c)
 #endif /* !MEM_STATS */
 
 /**
@@ -394,6 +429,199 @@ mem_is_block_free (const mem_block_header_t *block_header_p) /**< block header *
   return (block_header_p->allocated_bytes == 0);
 } /* mem_is_block_free */
 
+/**
+ * Get free list links of the specified free block
+ *
+ * @return pointer to the links, located at the beginning of the block's data space
+ */
+static mem_free_block_links_t*
+mem_get_free_block_links (const mem_block_header_t *block_header_p) /**< free block */
+{
+  return (mem_free_block_links_t*) (block_header_p + 1);
+} /* mem_get_free_block_links */
+
+/**
+ * Get index of size class for free blocks of the specified size
+ *
+ * @return index of free list, such that 2 ^ index <= chunks_count < 2 ^ (index + 1)
+ */
+static size_t
+mem_heap_get_free_list_index (size_t chunks_count) /**< size of block in chunks */
+{
+  JERRY_ASSERT (chunks_count != 0);
+
+  size_t list_index = 0;
+
+  while (chunks_count >>= 1)
+  {
+    list_index++;
+  }
+
+  JERRY_ASSERT (list_index < MEM_HEAP_FREE_LISTS_NUMBER);
+
+  return list_index;
+} /* mem_heap_get_free_list_index */
+
+/**
+ * Put free block to the free list of its size class
+ *
+ * Note:
+ *      block's header should be accessible, and its neighbour fields should be already set up
+ */
+static void
+mem_heap_insert_free_block (mem_block_header_t *block_p) /**< free block */
+{
+  JERRY_ASSERT (mem_is_block_free (block_p));
+
+  const size_t chunks = mem_get_block_chunks_count (block_p);
+  const size_t list_index = mem_heap_get_free_list_index (chunks);
+
+  mem_block_header_t *list_head_p = mem_heap.free_lists[list_index];
+
+  mem_free_block_links_t *links_p = mem_get_free_block_links (block_p);
+
+  VALGRIND_UNDEFINED_STRUCT (links_p);
+
+  links_p->prev_free_block_p = NULL;
+  links_p->next_free_block_p = list_head_p;
+
+  VALGRIND_NOACCESS_STRUCT (links_p);
+
+  if (list_head_p != NULL)
+  {
+    mem_free_block_links_t *head_links_p = mem_get_free_block_links (list_head_p);
+
+    VALGRIND_DEFINED_STRUCT (head_links_p);
+    JERRY_ASSERT (head_links_p->prev_free_block_p == NULL);
+    head_links_p->prev_free_block_p = block_p;
+    VALGRIND_NOACCESS_STRUCT (head_links_p);
+  }
+
+  mem_heap.free_lists[list_index] = block_p;
+  mem_heap.free_lists_bitmap |= (1u << list_index);
+
+  MEM_HEAP_STAT_FREE_LIST_INSERT (list_index, chunks);
+} /* mem_heap_insert_free_block */
+
+/**
+ * Remove free block from the free list of its size class
+ *
+ * Note:
+ *      block's header should be accessible, and its neighbour fields should be the same
+ *      as upon insertion of the block to the free list
+ */
+static void
+mem_heap_remove_free_block (mem_block_header_t *block_p) /**< free block */
+{
+  JERRY_ASSERT (mem_is_block_free (block_p));
+
+  const size_t chunks = mem_get_block_chunks_count (block_p);
+  const size_t list_index = mem_heap_get_free_list_index (chunks);
+
+  mem_free_block_links_t *links_p = mem_get_free_block_links (block_p);
+
+  VALGRIND_DEFINED_STRUCT (links_p);
+
+  mem_block_header_t *prev_free_block_p = links_p->prev_free_block_p;
+  mem_block_header_t *next_free_block_p = links_p->next_free_block_p;
+
+  VALGRIND_NOACCESS_STRUCT (links_p);
+
+  if (prev_free_block_p == NULL)
+  {
+    JERRY_ASSERT (mem_heap.free_lists[list_index] == block_p);
+
+    mem_heap.free_lists[list_index] = next_free_block_p;
+  }
+  else
+  {
+    mem_free_block_links_t *prev_links_p = mem_get_free_block_links (prev_free_block_p);
+
+    VALGRIND_DEFINED_STRUCT (prev_links_p);
+    prev_links_p->next_free_block_p = next_free_block_p;
+    VALGRIND_NOACCESS_STRUCT (prev_links_p);
+  }
+
+  if (next_free_block_p != NULL)
+  {
+    mem_free_block_links_t *next_links_p = mem_get_free_block_links (next_free_block_p);
+
+    VALGRIND_DEFINED_STRUCT (next_links_p);
+    next_links_p->prev_free_block_p = prev_free_block_p;
+    VALGRIND_NOACCESS_STRUCT (next_links_p);
+  }
+
+  if (mem_heap.free_lists[list_index] == NULL)
+  {
+    mem_heap.free_lists_bitmap &= ~(1u << list_index);
+  }
+
+  MEM_HEAP_STAT_FREE_LIST_REMOVE (list_index, chunks);
+} /* mem_heap_remove_free_block */
+
+/**
+ * Find a free block that is large enough for the specified number of chunks
+ *
+ * Note:
+ *      Size classes, starting from the first one, all blocks of which are large enough, are looked up
+ *      in the bitmap of non-empty free lists, so the search takes constant time.
+ *      Only if there is no such free block, the size class, which the requested size belongs to, is scanned.
+ *
+ * @return pointer to the found free block,
+ *         or NULL - if there is no free block of sufficient size.
+ */
+static mem_block_header_t*
+mem_heap_find_free_block (size_t chunks_count) /**< required size in chunks */
+{
+  size_t list_index = mem_heap_get_free_list_index (chunks_count);
+
+  /* size class of blocks that are surely large enough */
+  size_t fit_list_index = list_index;
+
+  if ((chunks_count & (chunks_count - 1u)) != 0)
+  {
+    fit_list_index++;
+  }
+
+  if (fit_list_index < MEM_HEAP_FREE_LISTS_NUMBER)
+  {
+    uint32_t suitable_lists_bitmap = mem_heap.free_lists_bitmap >> fit_list_index;
+
+    if (suitable_lists_bitmap != 0)
+    {
+      while ((suitable_lists_bitmap & 1u) == 0)
+      {
+        suitable_lists_bitmap >>= 1;
+        fit_list_index++;
+      }
+
+      return mem_heap.free_lists[fit_list_index];
+    }
+  }
+
+  for (mem_block_header_t *block_p = mem_heap.free_lists[list_index], *next_free_block_p;
+       block_p != NULL;
+       block_p = next_free_block_p)
+  {
+    VALGRIND_DEFINED_STRUCT (block_p);
+    const size_t block_chunks_count = mem_get_block_chunks_count (block_p);
+    VALGRIND_NOACCESS_STRUCT (block_p);
+
+    if (block_chunks_count >= chunks_count)
+    {
+      return block_p;
+    }
+
+    mem_free_block_links_t *links_p = mem_get_free_block_links (block_p);
+
+    VALGRIND_DEFINED_STRUCT (links_p);
+    next_free_block_p = links_p->next_free_block_p;
+    VALGRIND_NOACCESS_STRUCT (links_p);
+  }
+
+  return NULL;
+} /* mem_heap_find_free_block */
+
 /**
  * Startup initialization of heap
  *
@@ -417,6 +645,7 @@ mem_heap_init (uint8_t *heap_start, /**< first address of heap space */
   mem_heap.heap_start = heap_start;
   mem_heap.heap_size = heap_size;
   mem_heap.limit = CONFIG_MEM_HEAP_DESIRED_LIMIT;
+  mem_heap.is_limit_fixed = false;
 
   VALGRIND_NOACCESS_SPACE (heap_start, heap_size);
 
@@ -430,7 +659,17 @@ mem_heap_init (uint8_t *heap_start, /**< first address of heap space */
   mem_heap.first_block_p = (mem_block_header_t*) mem_heap.heap_start;
   mem_heap.last_block_p = mem_heap.first_block_p;
 
+  for (size_t list_index = 0; list_index < MEM_HEAP_FREE_LISTS_NUMBER; list_index++)
+  {
+    mem_heap.free_lists[list_index] = NULL;
+  }
+  mem_heap.free_lists_bitmap = 0;
+
   MEM_HEAP_STAT_INIT ();
+
+  VALGRIND_DEFINED_STRUCT (mem_heap.first_block_p);
+  mem_heap_insert_free_block (mem_heap.first_block_p);
+  VALGRIND_NOACCESS_STRUCT (mem_heap.first_block_p);
 } /* mem_heap_init */
 
 /**
@@ -501,7 +740,6 @@ void* mem_heap_alloc_block_internal (size_t size_in_bytes, /**< size of region t
                                                                            *   (one-chunked or general) */
                                      mem_heap_alloc_term_t alloc_term) /**< expected allocation term */
 {
-  mem_block_header_t *block_p;
   mem_direction_t direction;
 
   JERRY_ASSERT (size_in_bytes != 0);
@@ -512,40 +750,19 @@ void* mem_heap_alloc_block_internal (size_t size_in_bytes, /**< size of region t
 
   if (alloc_term == MEM_HEAP_ALLOC_LONG_TERM)
   {
-    block_p = mem_heap.first_block_p;
     direction = MEM_DIRECTION_NEXT;
   }
   else
   {
     JERRY_ASSERT (alloc_term == MEM_HEAP_ALLOC_SHORT_TERM);
 
-    block_p = mem_heap.last_block_p;
     direction = MEM_DIRECTION_PREV;
   }
 
-  /* searching for appropriate block */
-  while (block_p != NULL)
-  {
-    VALGRIND_DEFINED_STRUCT (block_p);
-
-    if (mem_is_block_free (block_p))
-    {
-      if (mem_get_block_data_space_size (block_p) >= size_in_bytes)
-      {
-        break;
-      }
-    }
-    else
-    {
-      JERRY_ASSERT (!mem_is_block_free (block_p));
-    }
-
-    mem_block_header_t *next_block_p = mem_get_next_block_by_direction (block_p, direction);
-
-    VALGRIND_NOACCESS_STRUCT (block_p);
+  size_t new_block_size_in_chunks = mem_get_block_chunks_count_from_data_size (size_in_bytes);
 
-    block_p = next_block_p;
-  }
+  /* searching for appropriate block */
+  mem_block_header_t *block_p = mem_heap_find_free_block (new_block_size_in_chunks);
 
   if (block_p == NULL)
   {
@@ -553,11 +770,16 @@ void* mem_heap_alloc_block_internal (size_t size_in_bytes, /**< size of region t
     return NULL;
   }
 
+  VALGRIND_DEFINED_STRUCT (block_p);
+
+  mem_heap_remove_free_block (block_p);
+
   mem_heap.allocated_bytes += size_in_bytes;
 
   JERRY_ASSERT (mem_heap.allocated_bytes <= mem_heap.heap_size);
 
-  if (mem_heap.allocated_bytes >= mem_heap.limit)
+  if (mem_heap.allocated_bytes >= mem_heap.limit
+      && !mem_heap.is_limit_fixed)
   {
     mem_heap.limit = JERRY_MIN (mem_heap.heap_size,
                                 JERRY_MAX (mem_heap.limit + CONFIG_MEM_HEAP_DESIRED_LIMIT,
@@ -566,7 +788,6 @@ void* mem_heap_alloc_block_internal (size_t size_in_bytes, /**< size of region t
   }
 
   /* appropriate block found, allocating space */
-  size_t new_block_size_in_chunks = mem_get_block_chunks_count_from_data_size (size_in_bytes);
   size_t found_block_size_in_chunks = mem_get_block_chunks_count (block_p);
 
   JERRY_ASSERT (new_block_size_in_chunks <= found_block_size_in_chunks);
@@ -588,6 +809,9 @@ void* mem_heap_alloc_block_internal (size_t size_in_bytes, /**< size of region t
 
       mem_set_block_next (prev_block_p, block_p);
 
+      /* beginning of the found block remains free */
+      mem_heap_insert_free_block (prev_block_p);
+
       VALGRIND_NOACCESS_STRUCT (prev_block_p);
 
       if (next_block_p == NULL)
@@ -615,6 +839,10 @@ void* mem_heap_alloc_block_internal (size_t size_in_bytes, /**< size of region t
 
       mem_block_header_t *new_free_block_p = (mem_block_header_t*) new_free_block_first_chunk_p;
 
+      VALGRIND_DEFINED_STRUCT (new_free_block_p);
+      mem_heap_insert_free_block (new_free_block_p);
+      VALGRIND_NOACCESS_STRUCT (new_free_block_p);
+
       if (next_block_p == NULL)
       {
         mem_heap.last_block_p = new_free_block_p;
@@ -782,22 +1010,25 @@ mem_heap_free_block (void *ptr) /**< pointer to beginning of data space of the b
   mem_block_header_t *prev_block_p = mem_get_next_block_by_direction (block_p, MEM_DIRECTION_PREV);
   mem_block_header_t *next_block_p = mem_get_next_block_by_direction (block_p, MEM_DIRECTION_NEXT);
 
-  JERRY_ASSERT (mem_heap.limit >= mem_heap.allocated_bytes);
+  JERRY_ASSERT (mem_heap.limit >= mem_heap.allocated_bytes || mem_heap.is_limit_fixed);
 
   size_t bytes = block_p->allocated_bytes;
   JERRY_ASSERT (mem_heap.allocated_bytes >= bytes);
   mem_heap.allocated_bytes -= bytes;
 
-  if (mem_heap.allocated_bytes * 3 <= mem_heap.limit)
+  if (!mem_heap.is_limit_fixed)
   {
-    mem_heap.limit /= 2;
-  }
-  else if (mem_heap.allocated_bytes + CONFIG_MEM_HEAP_DESIRED_LIMIT <= mem_heap.limit)
-  {
-    mem_heap.limit -= CONFIG_MEM_HEAP_DESIRED_LIMIT;
-  }
+    if (mem_heap.allocated_bytes * 3 <= mem_heap.limit)
+    {
+      mem_heap.limit /= 2;
+    }
+    else if (mem_heap.allocated_bytes + CONFIG_MEM_HEAP_DESIRED_LIMIT <= mem_heap.limit)
+    {
+      mem_heap.limit -= CONFIG_MEM_HEAP_DESIRED_LIMIT;
+    }
 
-  JERRY_ASSERT (mem_heap.limit >= mem_heap.allocated_bytes);
+    JERRY_ASSERT (mem_heap.limit >= mem_heap.allocated_bytes);
+  }
 
   MEM_HEAP_STAT_FREE_BLOCK (block_p);
 
@@ -809,6 +1040,9 @@ mem_heap_free_block (void *ptr) /**< pointer to beginning of data space of the b
   block_p->allocated_bytes = 0;
   block_p->length_type = mem_block_length_type_t::GENERAL;
 
+  /* the block to put to a free list after merging with free neighbours */
+  mem_block_header_t *free_block_p = block_p;
+
   if (next_block_p != NULL)
   {
     VALGRIND_DEFINED_STRUCT (next_block_p);
@@ -818,6 +1052,8 @@ mem_heap_free_block (void *ptr) /**< pointer to beginning of data space of the b
       /* merge with the next block */
       MEM_HEAP_STAT_FREE_BLOCK_MERGE ();
 
+      mem_heap_remove_free_block (next_block_p);
+
       mem_block_header_t *next_next_block_p = mem_get_next_block_by_direction (next_block_p, MEM_DIRECTION_NEXT);
 
       VALGRIND_NOACCESS_STRUCT (next_block_p);
@@ -849,6 +1085,8 @@ mem_heap_free_block (void *ptr) /**< pointer to beginning of data space of the b
       /* merge with the previous block */
       MEM_HEAP_STAT_FREE_BLOCK_MERGE ();
 
+      mem_heap_remove_free_block (prev_block_p);
+
       mem_set_block_next (prev_block_p, next_block_p);
       if (next_block_p != NULL)
       {
@@ -863,8 +1101,15 @@ mem_heap_free_block (void *ptr) /**< pointer to beginning of data space of the b
       {
         mem_heap.last_block_p = prev_block_p;
       }
+
+      free_block_p = prev_block_p;
     }
+  }
+
+  mem_heap_insert_free_block (free_block_p);
 
+  if (prev_block_p != NULL)
+  {
     VALGRIND_NOACCESS_STRUCT (prev_block_p);
   }
 
@@ -945,6 +1190,46 @@ mem_heap_get_chunked_block_start (void *ptr) /**< pointer into a block */
   return (void*) (block_p + 1);
 } /* mem_heap_get_chunked_block_start */
 
+/**
+ * Get index of the heap chunk, containing specified address
+ *
+ * @return index of the chunk, counting from the heap's beginning
+ */
+size_t
+mem_heap_get_chunk_index (const void *ptr) /**< pointer into the heap */
+{
+  JERRY_ASSERT (mem_heap.heap_start <= ptr
+                && ptr < mem_heap.heap_start + mem_heap.heap_size);
+
+  return (size_t) ((const uint8_t*) ptr - mem_heap.heap_start) / MEM_HEAP_CHUNK_SIZE;
+} /* mem_heap_get_chunk_index */
+
+/**
+ * Get beginning of user data of the allocated block, that begins at the heap chunk with specified index
+ *
+ * Note:
+ *      The interface should only be used by allocators, working on top of the heap,
+ *      to find their blocks in constant time. Caller should never rely on some specific
+ *      internals of heap implementation.
+ *
+ * @return beginning of user data space of the block
+ */
+void*
+mem_heap_get_block_start_by_chunk_index (size_t chunk_index) /**< index of first chunk of the block */
+{
+  JERRY_ASSERT (chunk_index < mem_heap.heap_size / MEM_HEAP_CHUNK_SIZE);
+
+  mem_block_header_t *block_p = (mem_block_header_t*) (mem_heap.heap_start + chunk_index * MEM_HEAP_CHUNK_SIZE);
+
+#ifndef JERRY_NDEBUG
+  VALGRIND_DEFINED_STRUCT (block_p);
+  JERRY_ASSERT (!mem_is_block_free (block_p));
+  VALGRIND_NOACCESS_STRUCT (block_p);
+#endif /* !JERRY_NDEBUG */
+
+  return (void*) (block_p + 1);
+} /* mem_heap_get_block_start_by_chunk_index */
+
 /**
  * Get size of one-chunked block data space
  */
@@ -969,6 +1254,43 @@ mem_heap_recommend_allocation_size (size_t minimum_allocation_size) /**< minimum
   return heap_chunk_aligned_allocation_size - sizeof (mem_block_header_t);
 } /* mem_heap_recommend_allocation_size */
 
+/**
+ * Get total size of allocated heap space
+ *
+ * @return number of allocated bytes
+ */
+size_t
+mem_heap_get_allocated_bytes (void)
+{
+  return mem_heap.allocated_bytes;
+} /* mem_heap_get_allocated_bytes */
+
+/**
+ * Set limit of heap usage, upon reaching which "try give memory back" callbacks are called
+ * with low severity (see also: mem_heap_alloc_block_try_give_memory_back)
+ *
+ * Note:
+ *      after the call, the limit is not adjusted automatically upon allocations and frees,
+ *      so it is the caller's responsibility to raise the limit after the callbacks are called
+ */
+void
+mem_heap_set_limit (size_t limit) /**< new limit, in bytes */
+{
+  mem_heap.limit = JERRY_MIN (limit, mem_heap.heap_size);
+  mem_heap.is_limit_fixed = true;
+} /* mem_heap_set_limit */
+
+/**
+ * Get current limit of heap usage
+ *
+ * @return limit, in bytes
+ */
+size_t
+mem_heap_get_limit (void)
+{
+  return mem_heap.limit;
+} /* mem_heap_get_limit */
+
 /**
  * Print heap
  */
@@ -1047,6 +1369,19 @@ mem_heap_print (bool dump_block_headers, /**< print block headers */
             mem_heap_stats.peak_allocated_chunks,
             mem_heap_stats.peak_allocated_bytes,
             mem_heap_stats.peak_waste_bytes);
+
+    printf ("  Free blocks by size class:\n");
+    for (size_t list_index = 0; list_index < MEM_HEAP_FREE_LISTS_NUMBER; list_index++)
+    {
+      if (mem_heap_stats.free_blocks[list_index] != 0)
+      {
+        printf ("    [%zu; %zu) chunks: %zu blocks, %zu chunks\n",
+                (size_t) 1u << list_index,
+                (size_t) 1u << (list_index + 1),
+                mem_heap_stats.free_blocks[list_index],
+                mem_heap_stats.free_chunks[list_index]);
+      }
+    }
   }
 #else /* MEM_STATS */
   (void) dump_stats;
@@ -1068,6 +1403,7 @@ mem_check_heap (void)
   bool is_last_block_was_met = false;
   size_t chunk_sizes_sum = 0;
   size_t allocated_sum = 0;
+  size_t free_blocks_count = 0;
 
   for (mem_block_header_t *block_p = mem_heap.first_block_p, *next_block_p;
        block_p != NULL;
@@ -1084,6 +1420,10 @@ mem_check_heap (void)
     {
       allocated_sum += block_p->allocated_bytes;
     }
+    else
+    {
+      free_blocks_count++;
+    }
 
     next_block_p = mem_get_next_block_by_direction (block_p, MEM_DIRECTION_NEXT);
 
@@ -1134,6 +1474,42 @@ mem_check_heap (void)
 
   JERRY_ASSERT (chunk_sizes_sum * MEM_HEAP_CHUNK_SIZE == mem_heap.heap_size);
   JERRY_ASSERT (is_first_block_was_met);
+
+  size_t free_lists_blocks_count = 0;
+
+  for (size_t list_index = 0; list_index < MEM_HEAP_FREE_LISTS_NUMBER; list_index++)
+  {
+    JERRY_ASSERT ((mem_heap.free_lists[list_index] != NULL)
+                  == ((mem_heap.free_lists_bitmap & (1u << list_index)) != 0));
+
+    mem_block_header_t *prev_free_block_p = NULL;
+
+    for (mem_block_header_t *block_p = mem_heap.free_lists[list_index], *next_free_block_p;
+         block_p != NULL;
+         block_p = next_free_block_p)
+    {
+      VALGRIND_DEFINED_STRUCT (block_p);
+
+      JERRY_ASSERT (mem_is_block_free (block_p));
+      JERRY_ASSERT (mem_heap_get_free_list_index (mem_get_block_chunks_count (block_p)) == list_index);
+
+      VALGRIND_NOACCESS_STRUCT (block_p);
+
+      mem_free_block_links_t *links_p = mem_get_free_block_links (block_p);
+
+      VALGRIND_DEFINED_STRUCT (links_p);
+
+      JERRY_ASSERT (links_p->prev_free_block_p == prev_free_block_p);
+      next_free_block_p = links_p->next_free_block_p;
+
+      VALGRIND_NOACCESS_STRUCT (links_p);
+
+      free_lists_blocks_count++;
+      prev_free_block_p = block_p;
+    }
+  }
+
+  JERRY_ASSERT (free_lists_blocks_count == free_blocks_count);
 #endif /* !JERRY_DISABLE_HEAVY_DEBUG */
 } /* mem_check_heap */
 
@@ -1273,6 +1649,31 @@ mem_heap_stat_free_block_merge (void)
 {
   mem_heap_stats.blocks--;
 } /* mem_heap_stat_free_block_merge */
+
+/**
+ * Account insertion of a free block to free list of specified size class
+ */
+static void
+mem_heap_stat_free_list_insert (size_t list_index, /**< index of size class */
+                                size_t chunks) /**< size of the free block in chunks */
+{
+  mem_heap_stats.free_blocks[list_index]++;
+  mem_heap_stats.free_chunks[list_index] += chunks;
+} /* mem_heap_stat_free_list_insert */
+
+/**
+ * Account removal of a free block from free list of specified size class
+ */
+static void
+mem_heap_stat_free_list_remove (size_t list_index, /**< index of size class */
+                                size_t chunks) /**< size of the free block in chunks */
+{
+  JERRY_ASSERT (mem_heap_stats.free_blocks[list_index] >= 1);
+  JERRY_ASSERT (mem_heap_stats.free_chunks[list_index] >= chunks);
+
+  mem_heap_stats.free_blocks[list_index]--;
+  mem_heap_stats.free_chunks[list_index] -= chunks;
+} /* mem_heap_stat_free_list_remove */
 #endif /* MEM_STATS */
 
 /**
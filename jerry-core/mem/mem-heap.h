@@ -27,6 +27,7 @@
 #define JERRY_MEM_HEAP_H
 
 #include "jrt.h"
+#include "mem-config.h"
 
 /**
  * Type of allocation (argument of mem_Alloc)
@@ -46,9 +47,21 @@ extern void* mem_heap_alloc_chunked_block (mem_heap_alloc_term_t alloc_term);
 extern void mem_heap_free_block (void *ptr);
 extern void* mem_heap_get_chunked_block_start (void *ptr);
 extern size_t mem_heap_get_chunked_block_data_size (void);
+extern size_t mem_heap_get_chunk_index (const void *ptr);
+extern void* mem_heap_get_block_start_by_chunk_index (size_t chunk_index);
 extern size_t __attr_pure___ mem_heap_recommend_allocation_size (size_t minimum_allocation_size);
+extern size_t mem_heap_get_allocated_bytes (void);
+extern void mem_heap_set_limit (size_t limit);
+extern size_t mem_heap_get_limit (void);
 extern void mem_heap_print (bool dump_block_headers, bool dump_block_data, bool dump_stats);
 
+/**
+ * Number of size classes of free heap blocks
+ *
+ * Free blocks of i-th class consist of [2 ^ i; 2 ^ (i + 1)) chunks.
+ */
+#define MEM_HEAP_FREE_LISTS_NUMBER (MEM_HEAP_OFFSET_LOG + 1)
+
 #ifdef MEM_STATS
 /**
  * Heap memory usage statistics
@@ -74,6 +87,9 @@ typedef struct
                            and due to block headers */
   size_t peak_waste_bytes; /**< peak bytes waste */
   size_t global_peak_waste_bytes; /**< non-resettable peak bytes waste */
+
+  size_t free_blocks[MEM_HEAP_FREE_LISTS_NUMBER]; /**< free blocks count, per size class */
+  size_t free_chunks[MEM_HEAP_FREE_LISTS_NUMBER]; /**< free chunks count, per size class */
 } mem_heap_stats_t;
 
 extern void mem_heap_get_stats (mem_heap_stats_t *out_heap_stats_p);
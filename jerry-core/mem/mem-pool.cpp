@@ -51,8 +51,9 @@ static void mem_check_pool (mem_pool_state_t *pool_p);
 /**
  * Get address of pool chunk with specified index
  */
-#define MEM_POOL_CHUNK_ADDRESS(pool_header_p, chunk_index) ((uint8_t*) (MEM_POOL_SPACE_START(pool_p) + \
-                                                                        MEM_POOL_CHUNK_SIZE * chunk_index))
+#define MEM_POOL_CHUNK_ADDRESS(pool_header_p, chunk_index) \
+  ((uint8_t*) (MEM_POOL_SPACE_START (pool_header_p) + \
+               MEM_POOL_CLASS_CHUNK_SIZE ((pool_header_p)->size_class) * (chunk_index)))
 
 /**
  * Is the chunk is inside of the pool?
@@ -66,7 +67,8 @@ mem_pool_is_chunk_inside (mem_pool_state_t *pool_p, /**< pool */
   if (chunk_p >= (uint8_t*) pool_p && chunk_p < (uint8_t*) pool_p + MEM_POOL_SIZE)
   {
     JERRY_ASSERT (chunk_p >= MEM_POOL_SPACE_START (pool_p)
-                  && chunk_p <= MEM_POOL_SPACE_START (pool_p) + MEM_POOL_CHUNKS_NUMBER * MEM_POOL_CHUNK_SIZE);
+                  && chunk_p <= MEM_POOL_SPACE_START (pool_p) + (MEM_POOL_CLASS_CHUNKS_NUMBER (pool_p->size_class) *
+                                                                 MEM_POOL_CLASS_CHUNK_SIZE (pool_p->size_class)));
 
     return true;
   }
@@ -82,7 +84,8 @@ mem_pool_is_chunk_inside (mem_pool_state_t *pool_p, /**< pool */
  */
 void
 mem_pool_init (mem_pool_state_t *pool_p, /**< pool */
-               size_t pool_size)         /**< pool size */
+               size_t pool_size, /**< pool size */
+               mem_pool_size_class_t size_class) /**< size class of the pool's chunks */
 {
   JERRY_ASSERT (pool_p != NULL);
   JERRY_ASSERT ((size_t)MEM_POOL_SPACE_START (pool_p) % MEM_ALIGNMENT == 0);
@@ -96,11 +99,18 @@ mem_pool_init (mem_pool_state_t *pool_p, /**< pool */
 
   JERRY_ASSERT (pool_size == MEM_POOL_SIZE);
 
+  JERRY_STATIC_ASSERT (MEM_POOL_SIZE_CLASSES_NUMBER <= (1u << MEM_POOL_SIZE_CLASS_WIDTH));
+  JERRY_ASSERT (size_class < MEM_POOL_SIZE_CLASSES_NUMBER);
+
+  pool_p->size_class = (mem_pool_size_class_t) (size_class & ((1u << MEM_POOL_SIZE_CLASS_WIDTH) - 1u));
+
+  const size_t chunks_number = MEM_POOL_CLASS_CHUNKS_NUMBER (size_class);
+
   /*
    * All chunks are free right after initialization
    */
-  pool_p->free_chunks_number = (mem_pool_chunk_index_t) MEM_POOL_CHUNKS_NUMBER;
-  JERRY_ASSERT (pool_p->free_chunks_number == MEM_POOL_CHUNKS_NUMBER);
+  pool_p->free_chunks_number = (mem_pool_chunk_index_t) chunks_number;
+  JERRY_ASSERT (pool_p->free_chunks_number == chunks_number);
 
   /*
    * Chunk with zero index is first free chunk in the pool now
@@ -108,7 +118,7 @@ mem_pool_init (mem_pool_state_t *pool_p, /**< pool */
   pool_p->first_free_chunk = 0;
 
   for (mem_pool_chunk_index_t chunk_index = 0;
-       chunk_index < MEM_POOL_CHUNKS_NUMBER;
+       chunk_index < chunks_number;
        chunk_index++)
   {
     mem_pool_chunk_index_t *next_free_chunk_index_p = (mem_pool_chunk_index_t*) MEM_POOL_CHUNK_ADDRESS (pool_p,
@@ -116,7 +126,7 @@ mem_pool_init (mem_pool_state_t *pool_p, /**< pool */
 
     *next_free_chunk_index_p = (mem_pool_chunk_index_t) (chunk_index + 1u);
 
-    VALGRIND_NOACCESS_SPACE (next_free_chunk_index_p, MEM_POOL_CHUNK_SIZE);
+    VALGRIND_NOACCESS_SPACE (next_free_chunk_index_p, MEM_POOL_CLASS_CHUNK_SIZE (size_class));
   }
 
   mem_check_pool (pool_p);
@@ -131,18 +141,18 @@ mem_pool_alloc_chunk (mem_pool_state_t *pool_p) /**< pool */
   mem_check_pool (pool_p);
 
   JERRY_ASSERT (pool_p->free_chunks_number != 0);
-  JERRY_ASSERT (pool_p->first_free_chunk < MEM_POOL_CHUNKS_NUMBER);
+  JERRY_ASSERT (pool_p->first_free_chunk < MEM_POOL_CLASS_CHUNKS_NUMBER (pool_p->size_class));
 
   mem_pool_chunk_index_t chunk_index = pool_p->first_free_chunk;
   uint8_t *chunk_p = MEM_POOL_CHUNK_ADDRESS (pool_p, chunk_index);
 
-  VALGRIND_DEFINED_SPACE (chunk_p, MEM_POOL_CHUNK_SIZE);
+  VALGRIND_DEFINED_SPACE (chunk_p, MEM_POOL_CLASS_CHUNK_SIZE (pool_p->size_class));
 
   mem_pool_chunk_index_t *next_free_chunk_index_p = (mem_pool_chunk_index_t*) chunk_p;
   pool_p->first_free_chunk = *next_free_chunk_index_p;
   pool_p->free_chunks_number--;
 
-  VALGRIND_UNDEFINED_SPACE (chunk_p, MEM_POOL_CHUNK_SIZE);
+  VALGRIND_UNDEFINED_SPACE (chunk_p, MEM_POOL_CLASS_CHUNK_SIZE (pool_p->size_class));
 
   mem_check_pool (pool_p);
 
@@ -156,14 +166,16 @@ void
 mem_pool_free_chunk (mem_pool_state_t *pool_p,  /**< pool */
                      uint8_t *chunk_p)         /**< chunk pointer */
 {
-  JERRY_ASSERT (pool_p->free_chunks_number < MEM_POOL_CHUNKS_NUMBER);
+  const size_t chunk_size = MEM_POOL_CLASS_CHUNK_SIZE (pool_p->size_class);
+
+  JERRY_ASSERT (pool_p->free_chunks_number < MEM_POOL_CLASS_CHUNKS_NUMBER (pool_p->size_class));
   JERRY_ASSERT (mem_pool_is_chunk_inside (pool_p, chunk_p));
-  JERRY_ASSERT (((uintptr_t) chunk_p - (uintptr_t) MEM_POOL_SPACE_START (pool_p)) % MEM_POOL_CHUNK_SIZE == 0);
+  JERRY_ASSERT (((uintptr_t) chunk_p - (uintptr_t) MEM_POOL_SPACE_START (pool_p)) % chunk_size == 0);
 
   mem_check_pool (pool_p);
 
   const size_t chunk_byte_offset = (size_t) (chunk_p - MEM_POOL_SPACE_START (pool_p));
-  const mem_pool_chunk_index_t chunk_index = (mem_pool_chunk_index_t) (chunk_byte_offset / MEM_POOL_CHUNK_SIZE);
+  const mem_pool_chunk_index_t chunk_index = (mem_pool_chunk_index_t) (chunk_byte_offset / chunk_size);
 
   mem_pool_chunk_index_t *next_free_chunk_index_p = (mem_pool_chunk_index_t*) chunk_p;
 
@@ -172,7 +184,7 @@ mem_pool_free_chunk (mem_pool_state_t *pool_p,  /**< pool */
   pool_p->first_free_chunk = chunk_index;
   pool_p->free_chunks_number++;
 
-  VALGRIND_NOACCESS_SPACE (next_free_chunk_index_p, MEM_POOL_CHUNK_SIZE);
+  VALGRIND_NOACCESS_SPACE (next_free_chunk_index_p, chunk_size);
 
   mem_check_pool (pool_p);
 } /* mem_pool_free_chunk */
@@ -184,23 +196,27 @@ static void
 mem_check_pool (mem_pool_state_t __attr_unused___ *pool_p) /**< pool (unused #ifdef JERRY_DISABLE_HEAVY_DEBUG) */
 {
 #ifndef JERRY_DISABLE_HEAVY_DEBUG
-  JERRY_ASSERT (pool_p->free_chunks_number <= MEM_POOL_CHUNKS_NUMBER);
+  JERRY_ASSERT (pool_p->size_class < MEM_POOL_SIZE_CLASSES_NUMBER);
+
+  const size_t chunks_number = MEM_POOL_CLASS_CHUNKS_NUMBER (pool_p->size_class);
+
+  JERRY_ASSERT (pool_p->free_chunks_number <= chunks_number);
 
   size_t met_free_chunks_number = 0;
   mem_pool_chunk_index_t chunk_index = pool_p->first_free_chunk;
 
-  while (chunk_index != MEM_POOL_CHUNKS_NUMBER)
+  while (chunk_index != chunks_number)
   {
     uint8_t *chunk_p = MEM_POOL_CHUNK_ADDRESS (pool_p, chunk_index);
     mem_pool_chunk_index_t *next_free_chunk_index_p = (mem_pool_chunk_index_t*) chunk_p;
 
     met_free_chunks_number++;
 
-    VALGRIND_DEFINED_SPACE (next_free_chunk_index_p, MEM_POOL_CHUNK_SIZE);
+    VALGRIND_DEFINED_SPACE (next_free_chunk_index_p, MEM_POOL_CLASS_CHUNK_SIZE (pool_p->size_class));
 
     chunk_index = *next_free_chunk_index_p;
 
-    VALGRIND_NOACCESS_SPACE (next_free_chunk_index_p, MEM_POOL_CHUNK_SIZE);
+    VALGRIND_NOACCESS_SPACE (next_free_chunk_index_p, MEM_POOL_CLASS_CHUNK_SIZE (pool_p->size_class));
   }
 
   JERRY_ASSERT (met_free_chunks_number == pool_p->free_chunks_number);
@@ -39,9 +39,24 @@
                                         MEM_POOL_CHUNK_SIZE)) + sizeof (mem_pool_state_t))
 
 /**
- * Number of chunks in a pool
+ * Number of chunks in a pool of the specified size class
+ *
+ * Note:
+ *      pools of all size classes are of the same size (MEM_POOL_SIZE),
+ *      so pools of larger size classes contain less chunks.
+ */
+#define MEM_POOL_CLASS_CHUNKS_NUMBER(size_class) ((MEM_POOL_SIZE - sizeof (mem_pool_state_t)) / \
+                                                  MEM_POOL_CLASS_CHUNK_SIZE (size_class))
+
+/**
+ * Number of chunks in a pool of the smallest size class
+ */
+#define MEM_POOL_CHUNKS_NUMBER (MEM_POOL_CLASS_CHUNKS_NUMBER (0))
+
+/**
+ * Width of pool's size class field
  */
-#define MEM_POOL_CHUNKS_NUMBER ((MEM_POOL_SIZE - sizeof (mem_pool_state_t)) / MEM_POOL_CHUNK_SIZE)
+#define MEM_POOL_SIZE_CLASS_WIDTH (2)
 
 /**
  * Get pool's space size
@@ -53,6 +68,11 @@
  */
 typedef uint8_t mem_pool_chunk_index_t;
 
+/**
+ * Index of pool chunks' size class
+ */
+typedef uint8_t mem_pool_size_class_t;
+
 /**
  * State of a memory pool
  */
@@ -64,11 +84,17 @@ typedef struct __attribute__ ((aligned (MEM_ALIGNMENT))) mem_pool_state_t
   /** Number of free chunks (mem_pool_chunk_index_t) */
   mem_pool_chunk_index_t free_chunks_number : MEM_POOL_MAX_CHUNKS_NUMBER_LOG;
 
-  /** Pointer to the next pool with same chunk size */
+  /** Pointer to the next pool in the same list of pools */
   mem_cpointer_t next_pool_cp : MEM_CP_WIDTH;
+
+  /** Pointer to the previous pool in the same list of pools */
+  mem_cpointer_t prev_pool_cp : MEM_CP_WIDTH;
+
+  /** Size class of the pool's chunks (mem_pool_size_class_t) */
+  mem_pool_size_class_t size_class : MEM_POOL_SIZE_CLASS_WIDTH;
 } mem_pool_state_t;
 
-extern void mem_pool_init (mem_pool_state_t *pool_p, size_t pool_size);
+extern void mem_pool_init (mem_pool_state_t *pool_p, size_t pool_size, mem_pool_size_class_t size_class);
 extern uint8_t* mem_pool_alloc_chunk (mem_pool_state_t *pool_p);
 extern void mem_pool_free_chunk (mem_pool_state_t *pool_p, uint8_t *chunk_p);
 extern bool __attr_const___ mem_pool_is_chunk_inside (mem_pool_state_t *pool_p, uint8_t *chunk_p);
@@ -34,14 +34,41 @@
 #include "mem-poolman.h"
 
 /**
- * Lists of pools
+ * Lists of pools with at least one free chunk, for each size class
  */
-mem_pool_state_t *mem_pools;
+mem_pool_state_t *mem_pools[MEM_POOL_SIZE_CLASSES_NUMBER];
 
 /**
- * Number of free chunks
+ * Lists of pools without free chunks, for each size class
  */
-size_t mem_free_chunks_number;
+mem_pool_state_t *mem_full_pools[MEM_POOL_SIZE_CLASSES_NUMBER];
+
+/**
+ * Number of free chunks, for each size class
+ */
+size_t mem_free_chunks_number[MEM_POOL_SIZE_CLASSES_NUMBER];
+
+/**
+ * Number of heap chunks
+ */
+#define MEM_POOLS_HEAP_CHUNKS_NUMBER (MEM_HEAP_AREA_SIZE / MEM_HEAP_CHUNK_SIZE)
+
+/**
+ * Width of an element of pools' start bitmap
+ */
+#define MEM_POOLS_BITMAP_ELEMENT_WIDTH (sizeof (uint32_t) * JERRY_BITSINBYTE)
+
+/**
+ * Bitmap of heap chunks, with which pools begin
+ *
+ * A pool occupies only several heap chunks, so the pool containing
+ * a given chunk is found by checking just the few preceding bits.
+ */
+static uint32_t mem_pools_start_bitmap[JERRY_ALIGNUP (MEM_POOLS_HEAP_CHUNKS_NUMBER,
+                                                      MEM_POOLS_BITMAP_ELEMENT_WIDTH)
+                                       / MEM_POOLS_BITMAP_ELEMENT_WIDTH];
+
+static void mem_pools_free_pool (mem_pool_state_t **list_p, mem_pool_state_t *pool_state);
 
 #ifdef MEM_STATS
 /**
@@ -50,22 +77,22 @@ size_t mem_free_chunks_number;
 mem_pools_stats_t mem_pools_stats;
 
 static void mem_pools_stat_init (void);
-static void mem_pools_stat_alloc_pool (void);
-static void mem_pools_stat_free_pool (void);
-static void mem_pools_stat_alloc_chunk (void);
-static void mem_pools_stat_free_chunk (void);
+static void mem_pools_stat_alloc_pool (mem_pool_size_class_t);
+static void mem_pools_stat_free_pool (mem_pool_size_class_t);
+static void mem_pools_stat_alloc_chunk (mem_pool_size_class_t);
+static void mem_pools_stat_free_chunk (mem_pool_size_class_t);
 
 #  define MEM_POOLS_STAT_INIT() mem_pools_stat_init ()
-#  define MEM_POOLS_STAT_ALLOC_POOL() mem_pools_stat_alloc_pool ()
-#  define MEM_POOLS_STAT_FREE_POOL() mem_pools_stat_free_pool ()
-#  define MEM_POOLS_STAT_ALLOC_CHUNK() mem_pools_stat_alloc_chunk ()
-#  define MEM_POOLS_STAT_FREE_CHUNK() mem_pools_stat_free_chunk ()
+#  define MEM_POOLS_STAT_ALLOC_POOL(size_class) mem_pools_stat_alloc_pool (size_class)
+#  define MEM_POOLS_STAT_FREE_POOL(size_class) mem_pools_stat_free_pool (size_class)
+#  define MEM_POOLS_STAT_ALLOC_CHUNK(size_class) mem_pools_stat_alloc_chunk (size_class)
+#  define MEM_POOLS_STAT_FREE_CHUNK(size_class) mem_pools_stat_free_chunk (size_class)
 #else /* !MEM_STATS */
 #  define MEM_POOLS_STAT_INIT()
-#  define MEM_POOLS_STAT_ALLOC_POOL()
-#  define MEM_POOLS_STAT_FREE_POOL()
-#  define MEM_POOLS_STAT_ALLOC_CHUNK()
-#  define MEM_POOLS_STAT_FREE_CHUNK()
+#  define MEM_POOLS_STAT_ALLOC_POOL(size_class)
+#  define MEM_POOLS_STAT_FREE_POOL(size_class)
+#  define MEM_POOLS_STAT_ALLOC_CHUNK(size_class)
+#  define MEM_POOLS_STAT_FREE_CHUNK(size_class)
 #endif /* !MEM_STATS */
 
 /**
@@ -74,8 +101,14 @@ static void mem_pools_stat_free_chunk (void);
 void
 mem_pools_init (void)
 {
-  mem_pools = NULL;
-  mem_free_chunks_number = 0;
+  for (mem_pool_size_class_t size_class = 0; size_class < MEM_POOL_SIZE_CLASSES_NUMBER; size_class++)
+  {
+    mem_pools[size_class] = NULL;
+    mem_full_pools[size_class] = NULL;
+    mem_free_chunks_number[size_class] = 0;
+  }
+
+  memset (mem_pools_start_bitmap, 0, sizeof (mem_pools_start_bitmap));
 
   MEM_POOLS_STAT_INIT ();
 } /* mem_pools_init */
@@ -86,144 +119,289 @@ mem_pools_init (void)
 void
 mem_pools_finalize (void)
 {
-  JERRY_ASSERT (mem_pools == NULL);
-  JERRY_ASSERT (mem_free_chunks_number == 0);
+  for (mem_pool_size_class_t size_class = 0; size_class < MEM_POOL_SIZE_CLASSES_NUMBER; size_class++)
+  {
+    /* free pool, that was kept in the size class, if it became free (see also: mem_pools_free) */
+    if (mem_pools[size_class] != NULL
+        && mem_pools[size_class]->free_chunks_number == MEM_POOL_CLASS_CHUNKS_NUMBER (size_class))
+    {
+      mem_pools_free_pool (&mem_pools[size_class], mem_pools[size_class]);
+    }
+
+    JERRY_ASSERT (mem_pools[size_class] == NULL);
+    JERRY_ASSERT (mem_full_pools[size_class] == NULL);
+    JERRY_ASSERT (mem_free_chunks_number[size_class] == 0);
+  }
 } /* mem_pools_finalize */
 
 /**
- * Long path for mem_pools_alloc
- *
- * @return true - if there is a free chunk in mem_pools,
- *         false - otherwise (not enough memory).
+ * Set or clear the bit of pools' start bitmap, corresponding to the specified heap chunk
  */
-static bool __attr_noinline___
-mem_pools_alloc_longpath (void)
+static void
+mem_pools_set_start_bit (size_t heap_chunk_index, /**< index of heap chunk */
+                         bool value) /**< new value of the bit */
 {
-  /**
-   * If there are no free chunks, allocate new pool.
-   */
-  if (mem_free_chunks_number == 0)
+  JERRY_ASSERT (heap_chunk_index < MEM_POOLS_HEAP_CHUNKS_NUMBER);
+
+  const size_t element_index = heap_chunk_index / MEM_POOLS_BITMAP_ELEMENT_WIDTH;
+  const uint32_t bit_mask = (1u << (heap_chunk_index % MEM_POOLS_BITMAP_ELEMENT_WIDTH));
+
+  if (value)
+  {
+    mem_pools_start_bitmap[element_index] |= bit_mask;
+  }
+  else
   {
-    mem_pool_state_t *pool_state = (mem_pool_state_t*) mem_heap_alloc_block (MEM_POOL_SIZE, MEM_HEAP_ALLOC_LONG_TERM);
+    mem_pools_start_bitmap[element_index] &= ~bit_mask;
+  }
+} /* mem_pools_set_start_bit */
 
-    JERRY_ASSERT (pool_state != NULL);
+/**
+ * Check whether a pool begins with the specified heap chunk
+ *
+ * @return true / false
+ */
+static bool
+mem_pools_is_start_bit_set (size_t heap_chunk_index) /**< index of heap chunk */
+{
+  JERRY_ASSERT (heap_chunk_index < MEM_POOLS_HEAP_CHUNKS_NUMBER);
 
-    mem_pool_init (pool_state, MEM_POOL_SIZE);
+  const size_t element_index = heap_chunk_index / MEM_POOLS_BITMAP_ELEMENT_WIDTH;
+  const uint32_t bit_mask = (1u << (heap_chunk_index % MEM_POOLS_BITMAP_ELEMENT_WIDTH));
 
-    MEM_CP_SET_POINTER (pool_state->next_pool_cp, mem_pools);
+  return ((mem_pools_start_bitmap[element_index] & bit_mask) != 0);
+} /* mem_pools_is_start_bit_set */
 
-    mem_pools = pool_state;
+/**
+ * Find the pool that contains specified chunk
+ *
+ * @return pointer to the pool's state
+ */
+static mem_pool_state_t*
+mem_pools_get_pool_by_chunk (uint8_t *chunk_p) /**< chunk */
+{
+  size_t heap_chunk_index = mem_heap_get_chunk_index (chunk_p);
 
-    mem_free_chunks_number += MEM_POOL_CHUNKS_NUMBER;
+  /* a pool begins in a heap chunk and is followed by chunks of the same pool */
+  while (!mem_pools_is_start_bit_set (heap_chunk_index))
+  {
+    JERRY_ASSERT (heap_chunk_index > 0);
 
-    MEM_POOLS_STAT_ALLOC_POOL ();
+    heap_chunk_index--;
   }
-  else
+
+  mem_pool_state_t *pool_state = (mem_pool_state_t*) mem_heap_get_block_start_by_chunk_index (heap_chunk_index);
+
+  JERRY_ASSERT (mem_pool_is_chunk_inside (pool_state, chunk_p));
+
+  return pool_state;
+} /* mem_pools_get_pool_by_chunk */
+
+/**
+ * Put the pool at the head of specified list
+ */
+static void
+mem_pools_list_insert (mem_pool_state_t **list_p, /**< in-out: list of pools */
+                       mem_pool_state_t *pool_state) /**< pool to insert */
+{
+  pool_state->prev_pool_cp = MEM_CP_NULL;
+  MEM_CP_SET_POINTER (pool_state->next_pool_cp, *list_p);
+
+  if (*list_p != NULL)
   {
-    /**
-     * There is definitely at least one pool of specified type with at least one free chunk.
-     *
-     * Search for the pool.
-     */
-    mem_pool_state_t *pool_state = mem_pools, *prev_pool_state_p = NULL;
-
-    while (pool_state->first_free_chunk == MEM_POOL_CHUNKS_NUMBER)
-    {
-      prev_pool_state_p = pool_state;
-      pool_state = MEM_CP_GET_NON_NULL_POINTER (mem_pool_state_t, pool_state->next_pool_cp);
-    }
+    MEM_CP_SET_NON_NULL_POINTER ((*list_p)->prev_pool_cp, pool_state);
+  }
 
-    JERRY_ASSERT (prev_pool_state_p != NULL && pool_state != mem_pools);
+  *list_p = pool_state;
+} /* mem_pools_list_insert */
 
+/**
+ * Remove the pool from specified list
+ */
+static void
+mem_pools_list_remove (mem_pool_state_t **list_p, /**< in-out: list of pools */
+                       mem_pool_state_t *pool_state) /**< pool to remove */
+{
+  mem_pool_state_t *prev_pool_state_p = MEM_CP_GET_POINTER (mem_pool_state_t, pool_state->prev_pool_cp);
+  mem_pool_state_t *next_pool_state_p = MEM_CP_GET_POINTER (mem_pool_state_t, pool_state->next_pool_cp);
+
+  if (prev_pool_state_p == NULL)
+  {
+    JERRY_ASSERT (*list_p == pool_state);
+
+    *list_p = next_pool_state_p;
+  }
+  else
+  {
     prev_pool_state_p->next_pool_cp = pool_state->next_pool_cp;
-    MEM_CP_SET_NON_NULL_POINTER (pool_state->next_pool_cp, mem_pools);
-    mem_pools = pool_state;
   }
 
+  if (next_pool_state_p != NULL)
+  {
+    next_pool_state_p->prev_pool_cp = pool_state->prev_pool_cp;
+  }
+} /* mem_pools_list_remove */
+
+/**
+ * Long path for mem_pools_alloc
+ *
+ * @return true - if there is a free chunk in the list of pools of the size class,
+ *         false - otherwise (not enough memory).
+ */
+static bool __attr_noinline___
+mem_pools_alloc_longpath (mem_pool_size_class_t size_class) /**< size class */
+{
+  /**
+   * All pools with free chunks are in mem_pools list of the size class, so, if the list is empty, allocate new pool.
+   */
+  JERRY_ASSERT (mem_pools[size_class] == NULL && mem_free_chunks_number[size_class] == 0);
+
+  mem_pool_state_t *pool_state = (mem_pool_state_t*) mem_heap_alloc_block (MEM_POOL_SIZE, MEM_HEAP_ALLOC_LONG_TERM);
+
+  JERRY_ASSERT (pool_state != NULL);
+
+  mem_pool_init (pool_state, MEM_POOL_SIZE, size_class);
+
+  mem_pools_list_insert (&mem_pools[size_class], pool_state);
+  mem_pools_set_start_bit (mem_heap_get_chunk_index (pool_state), true);
+
+  mem_free_chunks_number[size_class] += MEM_POOL_CLASS_CHUNKS_NUMBER (size_class);
+
+  MEM_POOLS_STAT_ALLOC_POOL (size_class);
+
   return true;
 } /* mem_pools_alloc_longpath */
 
 /**
- * Allocate a chunk of specified size
+ * Allocate a chunk of the specified size class
  *
  * @return pointer to allocated chunk, if allocation was successful,
  *         or NULL - if not enough memory.
  */
-uint8_t*
-mem_pools_alloc (void)
+static uint8_t* __attr_always_inline___
+mem_pools_alloc_in_size_class (mem_pool_size_class_t size_class) /**< size class */
 {
-  if (mem_pools == NULL || mem_pools->first_free_chunk == MEM_POOL_CHUNKS_NUMBER)
+  JERRY_ASSERT (size_class < MEM_POOL_SIZE_CLASSES_NUMBER);
+
+  if (mem_pools[size_class] == NULL)
   {
-    if (!mem_pools_alloc_longpath ())
+    if (!mem_pools_alloc_longpath (size_class))
     {
       return NULL;
     }
   }
 
-  JERRY_ASSERT (mem_pools != NULL && mem_pools->first_free_chunk != MEM_POOL_CHUNKS_NUMBER);
+  mem_pool_state_t *pool_state = mem_pools[size_class];
+
+  JERRY_ASSERT (pool_state != NULL && pool_state->free_chunks_number != 0);
 
   /**
    * And allocate chunk within it.
    */
-  mem_free_chunks_number--;
+  mem_free_chunks_number[size_class]--;
 
-  MEM_POOLS_STAT_ALLOC_CHUNK ();
+  MEM_POOLS_STAT_ALLOC_CHUNK (size_class);
+
+  uint8_t *chunk_p = mem_pool_alloc_chunk (pool_state);
+
+  if (pool_state->free_chunks_number == 0)
+  {
+    mem_pools_list_remove (&mem_pools[size_class], pool_state);
+    mem_pools_list_insert (&mem_full_pools[size_class], pool_state);
+  }
 
-  return mem_pool_alloc_chunk (mem_pools);
+  return chunk_p;
+} /* mem_pools_alloc_in_size_class */
+
+/**
+ * Allocate a chunk of MEM_POOL_CHUNK_SIZE bytes
+ *
+ * @return pointer to allocated chunk, if allocation was successful,
+ *         or NULL - if not enough memory.
+ */
+uint8_t*
+mem_pools_alloc (void)
+{
+  return mem_pools_alloc_in_size_class (0);
 } /* mem_pools_alloc */
 
+/**
+ * Allocate a chunk of the smallest size class, fitting the specified size
+ *
+ * @return pointer to allocated chunk, if allocation was successful,
+ *         or NULL - if not enough memory.
+ */
+uint8_t*
+mem_pools_alloc_sized (size_t size) /**< size of the chunk, should not be greater than MEM_POOL_MAX_CHUNK_SIZE */
+{
+  JERRY_ASSERT (size <= MEM_POOL_MAX_CHUNK_SIZE);
+
+  mem_pool_size_class_t size_class = 0;
+
+  while (MEM_POOL_CLASS_CHUNK_SIZE (size_class) < size)
+  {
+    size_class++;
+  }
+
+  return mem_pools_alloc_in_size_class (size_class);
+} /* mem_pools_alloc_sized */
+
+/**
+ * Free the pool, all chunks of which are free
+ */
+static void
+mem_pools_free_pool (mem_pool_state_t **list_p, /**< list, containing the pool */
+                     mem_pool_state_t *pool_state) /**< pool */
+{
+  const mem_pool_size_class_t size_class = pool_state->size_class;
+
+  JERRY_ASSERT (pool_state->free_chunks_number == MEM_POOL_CLASS_CHUNKS_NUMBER (size_class));
+
+  mem_pools_list_remove (list_p, pool_state);
+  mem_pools_set_start_bit (mem_heap_get_chunk_index (pool_state), false);
+
+  mem_free_chunks_number[size_class] -= MEM_POOL_CLASS_CHUNKS_NUMBER (size_class);
+
+  mem_heap_free_block ((uint8_t*) pool_state);
+
+  MEM_POOLS_STAT_FREE_POOL (size_class);
+} /* mem_pools_free_pool */
+
 /**
  * Free the chunk
  */
 void
 mem_pools_free (uint8_t *chunk_p) /**< pointer to the chunk */
 {
-  mem_pool_state_t *pool_state = mem_pools, *prev_pool_state_p = NULL;
+  mem_pool_state_t *pool_state = mem_pools_get_pool_by_chunk (chunk_p);
+  const mem_pool_size_class_t size_class = pool_state->size_class;
 
-  /**
-   * Search for the pool containing specified chunk.
-   */
-  while (!mem_pool_is_chunk_inside (pool_state, chunk_p))
-  {
-    prev_pool_state_p = pool_state;
-    pool_state = MEM_CP_GET_NON_NULL_POINTER (mem_pool_state_t, pool_state->next_pool_cp);
-  }
+  const bool is_pool_full = (pool_state->free_chunks_number == 0);
 
   /**
    * Free the chunk
    */
   mem_pool_free_chunk (pool_state, chunk_p);
-  mem_free_chunks_number++;
+  mem_free_chunks_number[size_class]++;
+
+  MEM_POOLS_STAT_FREE_CHUNK (size_class);
 
-  MEM_POOLS_STAT_FREE_CHUNK ();
+  mem_pool_state_t **list_p = is_pool_full ? &mem_full_pools[size_class] : &mem_pools[size_class];
 
   /**
-   * If all chunks of the pool are free, free the pool itself.
+   * If all chunks of the pool are free, free the pool itself,
+   * unless it is the only pool of the size class with free chunks
+   * (so, repeated allocation and freeing of a single chunk doesn't allocate and free pool each time).
    */
-  if (pool_state->free_chunks_number == MEM_POOL_CHUNKS_NUMBER)
+  if (pool_state->free_chunks_number == MEM_POOL_CLASS_CHUNKS_NUMBER (size_class)
+      && mem_free_chunks_number[size_class] > MEM_POOL_CLASS_CHUNKS_NUMBER (size_class))
   {
-    if (prev_pool_state_p != NULL)
-    {
-      prev_pool_state_p->next_pool_cp = pool_state->next_pool_cp;
-    }
-    else
-    {
-      mem_pools = MEM_CP_GET_POINTER (mem_pool_state_t, pool_state->next_pool_cp);
-    }
-
-    mem_free_chunks_number -= MEM_POOL_CHUNKS_NUMBER;
-
-    mem_heap_free_block ((uint8_t*) pool_state);
-
-    MEM_POOLS_STAT_FREE_POOL ();
+    mem_pools_free_pool (list_p, pool_state);
   }
-  else if (mem_pools != pool_state)
+  else if (is_pool_full)
   {
-    JERRY_ASSERT (prev_pool_state_p != NULL);
-
-    prev_pool_state_p->next_pool_cp = pool_state->next_pool_cp;
-    MEM_CP_SET_NON_NULL_POINTER (pool_state->next_pool_cp, mem_pools);
-    mem_pools = pool_state;
+    mem_pools_list_remove (&mem_full_pools[size_class], pool_state);
+    mem_pools_list_insert (&mem_pools[size_class], pool_state);
   }
 } /* mem_pools_free */
 
@@ -247,6 +425,12 @@ mem_pools_stats_reset_peak (void)
 {
   mem_pools_stats.peak_pools_count = mem_pools_stats.pools_count;
   mem_pools_stats.peak_allocated_chunks = mem_pools_stats.allocated_chunks;
+
+  for (mem_pool_size_class_t size_class = 0; size_class < MEM_POOL_SIZE_CLASSES_NUMBER; size_class++)
+  {
+    mem_pools_stats.size_class_peak_allocated_chunks[size_class] =
+      mem_pools_stats.size_class_allocated_chunks[size_class];
+  }
 } /* mem_pools_stats_reset_peak */
 
 /**
@@ -262,10 +446,13 @@ mem_pools_stat_init (void)
  * Account allocation of a pool
  */
 static void
-mem_pools_stat_alloc_pool (void)
+mem_pools_stat_alloc_pool (mem_pool_size_class_t size_class) /**< size class of the pool */
 {
   mem_pools_stats.pools_count++;
-  mem_pools_stats.free_chunks = mem_free_chunks_number;
+  mem_pools_stats.free_chunks += MEM_POOL_CLASS_CHUNKS_NUMBER (size_class);
+
+  mem_pools_stats.size_class_pools_count[size_class]++;
+  mem_pools_stats.size_class_free_chunks[size_class] = mem_free_chunks_number[size_class];
 
   if (mem_pools_stats.pools_count > mem_pools_stats.peak_pools_count)
   {
@@ -281,25 +468,34 @@ mem_pools_stat_alloc_pool (void)
  * Account freeing of a pool
  */
 static void
-mem_pools_stat_free_pool (void)
+mem_pools_stat_free_pool (mem_pool_size_class_t size_class) /**< size class of the pool */
 {
   JERRY_ASSERT (mem_pools_stats.pools_count > 0);
+  JERRY_ASSERT (mem_pools_stats.size_class_pools_count[size_class] > 0);
+  JERRY_ASSERT (mem_pools_stats.free_chunks >= MEM_POOL_CLASS_CHUNKS_NUMBER (size_class));
 
   mem_pools_stats.pools_count--;
-  mem_pools_stats.free_chunks = mem_free_chunks_number;
+  mem_pools_stats.free_chunks -= MEM_POOL_CLASS_CHUNKS_NUMBER (size_class);
+
+  mem_pools_stats.size_class_pools_count[size_class]--;
+  mem_pools_stats.size_class_free_chunks[size_class] = mem_free_chunks_number[size_class];
 } /* mem_pools_stat_free_pool */
 
 /**
  * Account allocation of chunk in a pool
  */
 static void
-mem_pools_stat_alloc_chunk (void)
+mem_pools_stat_alloc_chunk (mem_pool_size_class_t size_class) /**< size class of the chunk */
 {
   JERRY_ASSERT (mem_pools_stats.free_chunks > 0);
+  JERRY_ASSERT (mem_pools_stats.size_class_free_chunks[size_class] > 0);
 
   mem_pools_stats.allocated_chunks++;
   mem_pools_stats.free_chunks--;
 
+  mem_pools_stats.size_class_allocated_chunks[size_class]++;
+  mem_pools_stats.size_class_free_chunks[size_class]--;
+
   if (mem_pools_stats.allocated_chunks > mem_pools_stats.peak_allocated_chunks)
   {
     mem_pools_stats.peak_allocated_chunks = mem_pools_stats.allocated_chunks;
@@ -308,18 +504,28 @@ mem_pools_stat_alloc_chunk (void)
   {
     mem_pools_stats.global_peak_allocated_chunks = mem_pools_stats.allocated_chunks;
   }
+  if (mem_pools_stats.size_class_allocated_chunks[size_class]
+      > mem_pools_stats.size_class_peak_allocated_chunks[size_class])
+  {
+    mem_pools_stats.size_class_peak_allocated_chunks[size_class] =
+      mem_pools_stats.size_class_allocated_chunks[size_class];
+  }
 } /* mem_pools_stat_alloc_chunk */
 
 /**
  * Account freeing of chunk in a pool
  */
 static void
-mem_pools_stat_free_chunk (void)
+mem_pools_stat_free_chunk (mem_pool_size_class_t size_class) /**< size class of the chunk */
 {
   JERRY_ASSERT (mem_pools_stats.allocated_chunks > 0);
+  JERRY_ASSERT (mem_pools_stats.size_class_allocated_chunks[size_class] > 0);
 
   mem_pools_stats.allocated_chunks--;
   mem_pools_stats.free_chunks++;
+
+  mem_pools_stats.size_class_allocated_chunks[size_class]--;
+  mem_pools_stats.size_class_free_chunks[size_class]++;
 } /* mem_pools_stat_free_chunk */
 #endif /* MEM_STATS */
 
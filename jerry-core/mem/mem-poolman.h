@@ -28,10 +28,12 @@
 #define JERRY_MEM_POOLMAN_H
 
 #include "jrt.h"
+#include "mem-config.h"
 
 extern void mem_pools_init (void);
 extern void mem_pools_finalize (void);
 extern uint8_t* mem_pools_alloc (void);
+extern uint8_t* mem_pools_alloc_sized (size_t size);
 extern void mem_pools_free (uint8_t *chunk_p);
 
 #ifdef MEM_STATS
@@ -60,6 +62,18 @@ typedef struct
 
   /** free chunks count */
   size_t free_chunks;
+
+  /** pools' count, for each size class */
+  size_t size_class_pools_count[MEM_POOL_SIZE_CLASSES_NUMBER];
+
+  /** allocated chunks count, for each size class */
+  size_t size_class_allocated_chunks[MEM_POOL_SIZE_CLASSES_NUMBER];
+
+  /** peak allocated chunks count, for each size class */
+  size_t size_class_peak_allocated_chunks[MEM_POOL_SIZE_CLASSES_NUMBER];
+
+  /** free chunks count, for each size class */
+  size_t size_class_free_chunks[MEM_POOL_SIZE_CLASSES_NUMBER];
 } mem_pools_stats_t;
 
 extern void mem_pools_get_stats (mem_pools_stats_t *out_pools_stats_p);
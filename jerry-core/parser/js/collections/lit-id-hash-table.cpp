@@ -40,15 +40,21 @@ lit_id_hash_table_init (uint8_t *table_buffer_p, /**< buffer to initialize hash
 {
   const size_t header_size = JERRY_ALIGNUP (sizeof (lit_id_hash_table), MEM_ALIGNMENT);
   const size_t raw_buckets_size = JERRY_ALIGNUP (sizeof (lit_cpointer_t) * buckets_count, MEM_ALIGNMENT);
+  const size_t raw_lex_env_depths_size = JERRY_ALIGNUP (sizeof (uint8_t) * buckets_count, MEM_ALIGNMENT);
+  const size_t raw_lex_env_slots_size = JERRY_ALIGNUP (sizeof (uint8_t) * buckets_count, MEM_ALIGNMENT);
   const size_t buckets_size = JERRY_ALIGNUP (sizeof (lit_cpointer_t*) * blocks_count, MEM_ALIGNMENT);
 
-  JERRY_ASSERT (header_size + raw_buckets_size + buckets_size <= buffer_size);
+  JERRY_ASSERT (header_size + raw_buckets_size + raw_lex_env_depths_size + raw_lex_env_slots_size + buckets_size
+                <= buffer_size);
 
   lit_id_hash_table *table_p = (lit_id_hash_table *) table_buffer_p;
 
   table_p->current_bucket_pos = 0;
   table_p->raw_buckets = (lit_cpointer_t*) (table_buffer_p + header_size);
-  table_p->buckets = (lit_cpointer_t **) (table_buffer_p + header_size + raw_buckets_size);
+  table_p->raw_lex_env_depths = (uint8_t *) (table_buffer_p + header_size + raw_buckets_size);
+  table_p->raw_lex_env_slots = (uint8_t *) (table_buffer_p + header_size + raw_buckets_size + raw_lex_env_depths_size);
+  table_p->buckets = (lit_cpointer_t **) (table_buffer_p + header_size + raw_buckets_size + raw_lex_env_depths_size
+                                          + raw_lex_env_slots_size);
 
   memset (table_p->buckets, 0, buckets_size);
 
@@ -66,9 +72,11 @@ lit_id_hash_table_get_size_for_table (size_t buckets_count, /**< number of pairs
 {
   const size_t header_size = JERRY_ALIGNUP (sizeof (lit_id_hash_table), MEM_ALIGNMENT);
   const size_t raw_buckets_size = JERRY_ALIGNUP (sizeof (lit_cpointer_t) * buckets_count, MEM_ALIGNMENT);
+  const size_t raw_lex_env_depths_size = JERRY_ALIGNUP (sizeof (uint8_t) * buckets_count, MEM_ALIGNMENT);
+  const size_t raw_lex_env_slots_size = JERRY_ALIGNUP (sizeof (uint8_t) * buckets_count, MEM_ALIGNMENT);
   const size_t buckets_size = JERRY_ALIGNUP (sizeof (lit_cpointer_t*) * blocks_count, MEM_ALIGNMENT);
 
-  return header_size + raw_buckets_size + buckets_size;
+  return header_size + raw_buckets_size + raw_lex_env_depths_size + raw_lex_env_slots_size + buckets_size;
 } /* lit_id_hash_table_get_size_for_table */
 
 /**
@@ -89,7 +97,13 @@ void
 lit_id_hash_table_insert (lit_id_hash_table *table_p, /**< table's header */
                           idx_t uid, /**< value of byte-code instruction's argument */
                           opcode_counter_t oc, /**< opcode counter of the instruction */
-                          lit_cpointer_t lit_cp) /**< literal identifier */
+                          lit_cpointer_t lit_cp, /**< literal identifier */
+                          uint8_t lex_env_depth, /**< number of innermost lexical environments,
+                                                  *   that can't contain binding for the identifier
+                                                  *   (see also: scopes_tree_resolve_identifiers) */
+                          uint8_t lex_env_slot) /**< index of the binding in the slots of lexical environment,
+                                                 *   the identifier is resolved in
+                                                 *   (or LIT_ID_HASH_TABLE_NO_LEX_ENV_SLOT) */
 {
   JERRY_ASSERT (table_p != NULL);
 
@@ -101,6 +115,11 @@ lit_id_hash_table_insert (lit_id_hash_table *table_p, /**< table's header */
   }
 
   table_p->buckets[block_id][uid] = lit_cp;
+
+  const size_t bucket_pos = (size_t) (table_p->buckets[block_id] - table_p->raw_buckets) + uid;
+  table_p->raw_lex_env_depths[bucket_pos] = lex_env_depth;
+  table_p->raw_lex_env_slots[bucket_pos] = lex_env_slot;
+
   table_p->current_bucket_pos++;
 } /* lit_id_hash_table_insert */
 
@@ -122,6 +141,50 @@ lit_id_hash_table_lookup (lit_id_hash_table *table_p, /**< table's header */
   return table_p->buckets[block_id][uid];
 } /* lit_id_hash_table_lookup */
 
+/**
+ * Lookup number of lexical environments, that can be skipped during resolution of the identifier
+ *
+ * @return number of innermost lexical environments, that can't contain binding for the identifier
+ */
+uint8_t
+lit_id_hash_table_lookup_lex_env_depth (lit_id_hash_table *table_p, /**< table's header */
+                                        idx_t uid, /**< value of byte-code instruction's argument */
+                                        opcode_counter_t oc) /**< opcode counter of the instruction */
+{
+  JERRY_ASSERT (table_p != NULL);
+
+  size_t block_id = oc / BLOCK_SIZE;
+  JERRY_ASSERT (table_p->buckets[block_id] != NULL);
+
+  const size_t bucket_pos = (size_t) (table_p->buckets[block_id] - table_p->raw_buckets) + uid;
+
+  return table_p->raw_lex_env_depths[bucket_pos];
+} /* lit_id_hash_table_lookup_lex_env_depth */
+
+/**
+ * Lookup index of the identifier's binding in the slots of lexical environment, the identifier is resolved in
+ *
+ * See also:
+ *          ecma_lex_env_slots_t
+ *
+ * @return slot index - if the index is known at parse time,
+ *         LIT_ID_HASH_TABLE_NO_LEX_ENV_SLOT - otherwise.
+ */
+uint8_t
+lit_id_hash_table_lookup_lex_env_slot (lit_id_hash_table *table_p, /**< table's header */
+                                       idx_t uid, /**< value of byte-code instruction's argument */
+                                       opcode_counter_t oc) /**< opcode counter of the instruction */
+{
+  JERRY_ASSERT (table_p != NULL);
+
+  size_t block_id = oc / BLOCK_SIZE;
+  JERRY_ASSERT (table_p->buckets[block_id] != NULL);
+
+  const size_t bucket_pos = (size_t) (table_p->buckets[block_id] - table_p->raw_buckets) + uid;
+
+  return table_p->raw_lex_env_slots[bucket_pos];
+} /* lit_id_hash_table_lookup_lex_env_slot */
+
 /**
  * @}
  * @}
@@ -21,17 +21,26 @@
 #include "opcodes.h"
 #include "lit-literal.h"
 
+/**
+ * Value of slot index for identifiers, index of which in the slots of lexical environment is not known at parse time
+ */
+#define LIT_ID_HASH_TABLE_NO_LEX_ENV_SLOT ((uint8_t) -1)
+
 typedef struct
 {
   size_t current_bucket_pos;
   lit_cpointer_t *raw_buckets;
+  uint8_t *raw_lex_env_depths;
+  uint8_t *raw_lex_env_slots;
   lit_cpointer_t **buckets;
 } lit_id_hash_table;
 
 lit_id_hash_table *lit_id_hash_table_init (uint8_t*, size_t, size_t, size_t);
 size_t lit_id_hash_table_get_size_for_table (size_t, size_t);
 void lit_id_hash_table_free (lit_id_hash_table *);
-void lit_id_hash_table_insert (lit_id_hash_table *, idx_t, opcode_counter_t, lit_cpointer_t);
+void lit_id_hash_table_insert (lit_id_hash_table *, idx_t, opcode_counter_t, lit_cpointer_t, uint8_t, uint8_t);
 lit_cpointer_t lit_id_hash_table_lookup (lit_id_hash_table *, idx_t, opcode_counter_t);
+uint8_t lit_id_hash_table_lookup_lex_env_depth (lit_id_hash_table *, idx_t, opcode_counter_t);
+uint8_t lit_id_hash_table_lookup_lex_env_slot (lit_id_hash_table *, idx_t, opcode_counter_t);
 
 #endif /* LIT_ID_HASH_TABLE */
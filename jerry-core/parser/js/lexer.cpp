@@ -103,7 +103,7 @@ create_token_from_lit (token_type type, literal_t lit)
  */
 static token
 create_token (token_type type,  /**< type of token */
-              uint16_t uid)     /**< uid of token */
+              uint32_t uid)     /**< uid of token */
 {
   token ret;
 
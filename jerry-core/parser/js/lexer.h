@@ -162,7 +162,7 @@ typedef struct
 {
   locus loc;
   token_type type;
-  uint16_t uid;
+  uint32_t uid;
 } token;
 
 /**
@@ -160,6 +160,8 @@ create_op_meta (opcode_t op, lit_cpointer_t lit_id1, lit_cpointer_t lit_id2, lit
   ret.lit_id[0] = lit_id1;
   ret.lit_id[1] = lit_id2;
   ret.lit_id[2] = lit_id3;
+  memset (ret.lex_env_depth, 0, sizeof (ret.lex_env_depth));
+  memset (ret.lex_env_slot, LIT_ID_HASH_TABLE_NO_LEX_ENV_SLOT, sizeof (ret.lex_env_slot));
 
   return ret;
 }
@@ -76,7 +76,7 @@ token_is (token_type tt)
   return tok.type == tt;
 }
 
-static uint16_t
+static uint32_t
 token_data (void)
 {
   return tok.uid;
@@ -91,7 +91,7 @@ static lit_cpointer_t
 token_data_as_lit_cp (void)
 {
   lit_cpointer_t cp;
-  cp.packed_value = tok.uid;
+  cp.packed_value = (mem_cpointer_t) tok.uid;
 
   return cp;
 } /* token_data_as_lit_cp */
@@ -20,9 +20,25 @@
 #define OPCODE(op) (__op__idx_##op)
 #define HASH_SIZE 128
 
+/**
+ * Key of literal identifiers to uids map
+ *
+ * Note:
+ *      an identifier, that is resolved differently in different parts of a block,
+ *      gets separate uid for each of the resolution variants (see also: scopes_tree_resolve_identifiers)
+ */
+typedef struct
+{
+  lit_cpointer_t lit_id; /**< literal identifier */
+  uint8_t lex_env_depth; /**< number of lexical environments, skipped during resolution of the identifier */
+  uint8_t lex_env_slot; /**< index of the identifier's binding in the slots of lexical environment,
+                         *   the identifier is resolved in */
+} lit_id_to_uid_key_t;
+
 static hash_table lit_id_to_uid = null_hash;
 static opcode_counter_t global_oc;
 static idx_t next_uid;
+static lit_cpointer_t arguments_lit_id;
 
 static void
 assert_tree (scopes_tree t)
@@ -115,10 +131,31 @@ start_new_block_if_necessary (void)
       hash_table_free (lit_id_to_uid);
       lit_id_to_uid = null_hash;
     }
-    lit_id_to_uid = hash_table_init (sizeof (lit_cpointer_t), sizeof (idx_t), HASH_SIZE, lit_id_hash);
+    lit_id_to_uid = hash_table_init (sizeof (lit_id_to_uid_key_t), sizeof (idx_t), HASH_SIZE, lit_id_hash);
   }
 }
 
+/**
+ * Get key of literal identifiers to uids map for specified literal operand of the instruction
+ *
+ * @return the key
+ */
+static lit_id_to_uid_key_t
+get_lit_id_to_uid_key (op_meta *om, /**< instruction */
+                       uint8_t i) /**< operand index */
+{
+  lit_id_to_uid_key_t key;
+
+  /* the map compares keys bytewise, so padding should be initialized */
+  memset (&key, 0, sizeof (key));
+
+  key.lit_id = om->lit_id[i];
+  key.lex_env_depth = om->lex_env_depth[i];
+  key.lex_env_slot = om->lex_env_slot[i];
+
+  return key;
+} /* get_lit_id_to_uid_key */
+
 static bool
 is_possible_literal (uint16_t mask, uint8_t index)
 {
@@ -155,13 +192,18 @@ change_uid (op_meta *om, lit_id_hash_table *lit_ids, uint16_t mask)
       if (get_uid (om, i) == LITERAL_TO_REWRITE)
       {
         JERRY_ASSERT (om->lit_id[i].packed_value != MEM_CP_NULL);
-        lit_cpointer_t lit_id = om->lit_id[i];
-        idx_t *uid = (idx_t *) hash_table_lookup (lit_id_to_uid, &lit_id);
+        lit_id_to_uid_key_t key = get_lit_id_to_uid_key (om, i);
+        idx_t *uid = (idx_t *) hash_table_lookup (lit_id_to_uid, &key);
         if (uid == NULL)
         {
-          hash_table_insert (lit_id_to_uid, &lit_id, &next_uid);
-          lit_id_hash_table_insert (lit_ids, next_uid, global_oc, lit_id);
-          uid = (idx_t *) hash_table_lookup (lit_id_to_uid, &lit_id);
+          hash_table_insert (lit_id_to_uid, &key, &next_uid);
+          lit_id_hash_table_insert (lit_ids,
+                                    next_uid,
+                                    global_oc,
+                                    key.lit_id,
+                                    key.lex_env_depth,
+                                    key.lex_env_slot);
+          uid = (idx_t *) hash_table_lookup (lit_id_to_uid, &key);
           JERRY_ASSERT (uid != NULL);
           JERRY_ASSERT (*uid == next_uid);
           next_uid++;
@@ -190,12 +232,12 @@ insert_uids_to_lit_id_map (op_meta *om, uint16_t mask)
       if (get_uid (om, i) == LITERAL_TO_REWRITE)
       {
         JERRY_ASSERT (om->lit_id[i].packed_value != MEM_CP_NULL);
-        lit_cpointer_t lit_id = om->lit_id[i];
-        idx_t *uid = (idx_t *) hash_table_lookup (lit_id_to_uid, &lit_id);
+        lit_id_to_uid_key_t key = get_lit_id_to_uid_key (om, i);
+        idx_t *uid = (idx_t *) hash_table_lookup (lit_id_to_uid, &key);
         if (uid == NULL)
         {
-          hash_table_insert (lit_id_to_uid, &lit_id, &next_uid);
-          uid = (idx_t *) hash_table_lookup (lit_id_to_uid, &lit_id);
+          hash_table_insert (lit_id_to_uid, &key, &next_uid);
+          uid = (idx_t *) hash_table_lookup (lit_id_to_uid, &key);
           JERRY_ASSERT (uid != NULL);
           JERRY_ASSERT (*uid == next_uid);
           next_uid++;
@@ -219,6 +261,531 @@ extract_op_meta (scopes_tree tree, opcode_counter_t opc_index)
   return (op_meta *) linked_list_element (tree->opcodes, opc_index);
 }
 
+/**
+ * Types of lexical environments, modelled at parse time
+ */
+typedef enum
+{
+  SCOPES_TREE_LEX_ENV_DYNAMIC, /**< set of the environment's bindings is not known at parse time
+                                *   (global or eval code, 'with' block, function with direct call to eval) */
+  SCOPES_TREE_LEX_ENV_FUNCTION, /**< local environment of a function */
+  SCOPES_TREE_LEX_ENV_SINGLE_BINDING /**< environment of 'catch' block or of named function expression */
+} scopes_tree_lex_env_type_t;
+
+/**
+ * Parse-time model of a lexical environment, that would be created at run-time for executing part of the code
+ */
+typedef struct scopes_tree_lex_env_t
+{
+  const struct scopes_tree_lex_env_t *outer_p; /**< model of the outer lexical environment */
+  scopes_tree_lex_env_type_t type; /**< type of the environment */
+  scopes_tree tree; /**< scope, containing instructions, listed below */
+  opcode_counter_t params_begin_oc; /**< first instruction of function's formal parameters list */
+  opcode_counter_t params_end_oc; /**< instruction, following the formal parameters list */
+  opcode_counter_t decls_begin_oc; /**< first 'var_decl' instruction of the function */
+  opcode_counter_t decls_end_oc; /**< instruction, following the last 'var_decl' instruction of the function */
+  scopes_tree decls_tree; /**< scope, children of which are function declarations,
+                           *   bound in the environment (or NULL, if there are no such scope) */
+  lit_cpointer_t name; /**< name of the single binding */
+  lit_cpointer_t *slot_names_p; /**< names of function environment's bindings, in order of the environment's slots
+                                 *   (see also: ecma_op_function_get_slot_names), or NULL */
+  uint8_t slot_names_number; /**< number of names in the slot_names_p array */
+} scopes_tree_lex_env_t;
+
+/**
+ * Check if the instruction is 'meta' instruction of specified type
+ *
+ * @return true / false
+ */
+static bool
+is_meta_of_type (op_meta *om, /**< instruction */
+                 opcode_meta_type type) /**< 'meta' instruction type */
+{
+  return (om->op.op_idx == OPCODE (meta) && om->op.data.meta.type == type);
+} /* is_meta_of_type */
+
+/**
+ * Add name to the table of function environment's slot names, if the table doesn't contain the name yet
+ *
+ * Note:
+ *      only names, that get slot indices, representable in op_meta::lex_env_slot, are registered
+ */
+static void
+add_lex_env_slot_name (scopes_tree_lex_env_t *env_p, /**< model of function's lexical environment */
+                       lit_cpointer_t name) /**< name of a binding */
+{
+  if (env_p->slot_names_number == LIT_ID_HASH_TABLE_NO_LEX_ENV_SLOT)
+  {
+    return;
+  }
+
+  for (uint8_t slot = 0; slot < env_p->slot_names_number; slot++)
+  {
+    if (env_p->slot_names_p[slot].packed_value == name.packed_value)
+    {
+      return;
+    }
+  }
+
+  env_p->slot_names_p[env_p->slot_names_number++] = name;
+} /* add_lex_env_slot_name */
+
+/**
+ * Build table of names of function environment's bindings in order of the environment's slots
+ *
+ * The order is the same as that of ecma_op_function_get_slot_names: formal parameters from the last one
+ * to the first one, declared variables, declared functions and 'arguments' (if the function references it).
+ */
+static void
+init_lex_env_slot_names (scopes_tree_lex_env_t *env_p, /**< model of function's lexical environment */
+                         opcode_scope_code_flags_t scope_flags) /**< function's scope flags */
+{
+  const uint8_t decl_funcs_number = (env_p->decls_tree != NULL ? env_p->decls_tree->t.children_num : 0);
+  const size_t max_names_number = JERRY_MIN ((size_t) (env_p->params_end_oc - env_p->params_begin_oc)
+                                             + (size_t) (env_p->decls_end_oc - env_p->decls_begin_oc)
+                                             + decl_funcs_number + 1u,
+                                             LIT_ID_HASH_TABLE_NO_LEX_ENV_SLOT);
+
+  env_p->slot_names_p = (lit_cpointer_t *) jsp_mm_alloc (max_names_number * sizeof (lit_cpointer_t));
+  env_p->slot_names_number = 0;
+
+  for (opcode_counter_t oc = env_p->params_end_oc; oc > env_p->params_begin_oc; oc--)
+  {
+    add_lex_env_slot_name (env_p, extract_op_meta (env_p->tree, (opcode_counter_t) (oc - 1))->lit_id[1]);
+  }
+
+  for (opcode_counter_t oc = env_p->decls_begin_oc; oc < env_p->decls_end_oc; oc++)
+  {
+    add_lex_env_slot_name (env_p, extract_op_meta (env_p->tree, oc)->lit_id[0]);
+  }
+
+  for (uint8_t child_id = 0; child_id < decl_funcs_number; child_id++)
+  {
+    scopes_tree child = *(scopes_tree *) linked_list_element (env_p->decls_tree->t.children, child_id);
+    add_lex_env_slot_name (env_p, extract_op_meta (child, 0)->lit_id[0]);
+  }
+
+  if (!(scope_flags & OPCODE_SCOPE_CODE_FLAGS_NOT_REF_ARGUMENTS_IDENTIFIER)
+      && arguments_lit_id.packed_value != MEM_CP_NULL)
+  {
+    add_lex_env_slot_name (env_p, arguments_lit_id);
+  }
+} /* init_lex_env_slot_names */
+
+/**
+ * Get index of the binding in the slots of function's lexical environment
+ *
+ * @return slot index - if it is known,
+ *         LIT_ID_HASH_TABLE_NO_LEX_ENV_SLOT - otherwise.
+ */
+static uint8_t
+get_lex_env_slot (const scopes_tree_lex_env_t *env_p, /**< model of lexical environment */
+                  lit_cpointer_t name) /**< name of the binding */
+{
+  if (env_p->slot_names_p != NULL)
+  {
+    for (uint8_t slot = 0; slot < env_p->slot_names_number; slot++)
+    {
+      if (env_p->slot_names_p[slot].packed_value == name.packed_value)
+      {
+        return slot;
+      }
+    }
+  }
+
+  return LIT_ID_HASH_TABLE_NO_LEX_ENV_SLOT;
+} /* get_lex_env_slot */
+
+/**
+ * Free resources, associated with model of lexical environment
+ */
+static void
+free_lex_env (scopes_tree_lex_env_t *env_p) /**< model of lexical environment */
+{
+  if (env_p->slot_names_p != NULL)
+  {
+    jsp_mm_free (env_p->slot_names_p);
+    env_p->slot_names_p = NULL;
+  }
+} /* free_lex_env */
+
+/**
+ * Initialize model of function's local lexical environment
+ *
+ * @return position of the function's 'function end' instruction
+ */
+static opcode_counter_t
+init_function_lex_env (scopes_tree_lex_env_t *env_p, /**< out: model of the environment */
+                       const scopes_tree_lex_env_t *outer_p, /**< model of the outer environment */
+                       scopes_tree tree, /**< scope, containing the function's code */
+                       opcode_counter_t func_oc, /**< position of 'func_decl_n' / 'func_expr_n' instruction */
+                       scopes_tree decls_tree) /**< scope with the function's nested function declarations
+                                                *   (or NULL, if the function is a function expression) */
+{
+  opcode_counter_t oc = (opcode_counter_t) (func_oc + 1);
+
+  env_p->outer_p = outer_p;
+  env_p->tree = tree;
+  env_p->params_begin_oc = oc;
+
+  while (!is_meta_of_type (extract_op_meta (tree, oc), OPCODE_META_TYPE_FUNCTION_END))
+  {
+    JERRY_ASSERT (is_meta_of_type (extract_op_meta (tree, oc), OPCODE_META_TYPE_VARG));
+    oc++;
+  }
+
+  const opcode_counter_t function_end_meta_oc = oc;
+  env_p->params_end_oc = function_end_meta_oc;
+
+  op_meta *scope_flags_om = extract_op_meta (tree, ++oc);
+  JERRY_ASSERT (is_meta_of_type (scope_flags_om, OPCODE_META_TYPE_SCOPE_CODE_FLAGS));
+  const opcode_scope_code_flags_t scope_flags = (opcode_scope_code_flags_t) scope_flags_om->op.data.meta.data_1;
+
+  /* direct call to eval can introduce new bindings to the function's environment */
+  env_p->type = ((scope_flags & OPCODE_SCOPE_CODE_FLAGS_NOT_REF_EVAL_IDENTIFIER) ? SCOPES_TREE_LEX_ENV_FUNCTION
+                                                                                  : SCOPES_TREE_LEX_ENV_DYNAMIC);
+
+  JERRY_ASSERT (extract_op_meta (tree, (opcode_counter_t) (oc + 1))->op.op_idx == OPCODE (reg_var_decl));
+  oc = (opcode_counter_t) (oc + 2);
+
+  env_p->decls_begin_oc = oc;
+  while (oc < tree->opcodes_num
+         && extract_op_meta (tree, oc)->op.op_idx == OPCODE (var_decl))
+  {
+    oc++;
+  }
+  env_p->decls_end_oc = oc;
+
+  env_p->decls_tree = decls_tree;
+  env_p->name = NOT_A_LITERAL;
+
+  env_p->slot_names_p = NULL;
+  env_p->slot_names_number = 0;
+
+  if (env_p->type == SCOPES_TREE_LEX_ENV_FUNCTION)
+  {
+    init_lex_env_slot_names (env_p, scope_flags);
+  }
+
+  return function_end_meta_oc;
+} /* init_function_lex_env */
+
+/**
+ * Initialize model of lexical environment with single binding
+ */
+static void
+init_single_binding_lex_env (scopes_tree_lex_env_t *env_p, /**< out: model of the environment */
+                             const scopes_tree_lex_env_t *outer_p, /**< model of the outer environment */
+                             lit_cpointer_t name) /**< name of the binding */
+{
+  memset (env_p, 0, sizeof (*env_p));
+
+  env_p->outer_p = outer_p;
+  env_p->type = SCOPES_TREE_LEX_ENV_SINGLE_BINDING;
+  env_p->name = name;
+} /* init_single_binding_lex_env */
+
+/**
+ * Initialize model of lexical environment, bindings of which are not known at parse time
+ */
+static void
+init_dynamic_lex_env (scopes_tree_lex_env_t *env_p, /**< out: model of the environment */
+                      const scopes_tree_lex_env_t *outer_p) /**< model of the outer environment */
+{
+  memset (env_p, 0, sizeof (*env_p));
+
+  env_p->outer_p = outer_p;
+  env_p->type = SCOPES_TREE_LEX_ENV_DYNAMIC;
+} /* init_dynamic_lex_env */
+
+/**
+ * Check if the lexical environment can contain binding with specified name at run-time
+ *
+ * @return true - if the binding could exist in the environment,
+ *         false - if the environment definitely doesn't contain the binding.
+ */
+static bool
+lex_env_may_have_binding (const scopes_tree_lex_env_t *env_p, /**< model of lexical environment */
+                          lit_cpointer_t lit_id) /**< name of the binding */
+{
+  switch (env_p->type)
+  {
+    case SCOPES_TREE_LEX_ENV_DYNAMIC:
+    {
+      return true;
+    }
+    case SCOPES_TREE_LEX_ENV_SINGLE_BINDING:
+    {
+      return (env_p->name.packed_value == lit_id.packed_value);
+    }
+    default:
+    {
+      JERRY_ASSERT (env_p->type == SCOPES_TREE_LEX_ENV_FUNCTION);
+
+      if (lit_id.packed_value == arguments_lit_id.packed_value)
+      {
+        return true;
+      }
+
+      for (opcode_counter_t oc = env_p->params_begin_oc; oc < env_p->params_end_oc; oc++)
+      {
+        if (extract_op_meta (env_p->tree, oc)->lit_id[1].packed_value == lit_id.packed_value)
+        {
+          return true;
+        }
+      }
+
+      for (opcode_counter_t oc = env_p->decls_begin_oc; oc < env_p->decls_end_oc; oc++)
+      {
+        if (extract_op_meta (env_p->tree, oc)->lit_id[0].packed_value == lit_id.packed_value)
+        {
+          return true;
+        }
+      }
+
+      if (env_p->decls_tree != NULL)
+      {
+        for (uint8_t child_id = 0; child_id < env_p->decls_tree->t.children_num; child_id++)
+        {
+          scopes_tree child = *(scopes_tree *) linked_list_element (env_p->decls_tree->t.children, child_id);
+          op_meta *func_decl_om = extract_op_meta (child, 0);
+          JERRY_ASSERT (func_decl_om->op.op_idx == OPCODE (func_decl_n));
+
+          if (func_decl_om->lit_id[0].packed_value == lit_id.packed_value)
+          {
+            return true;
+          }
+        }
+      }
+
+      return false;
+    }
+  }
+} /* lex_env_may_have_binding */
+
+/**
+ * Check if specified literal operand of the instruction is a reference to a variable
+ *
+ * @return true - if the operand is resolved through lexical environments at run-time,
+ *         false - if the operand is a name of declared entity, or a string literal.
+ */
+static bool
+is_variable_reference_operand (op_meta *om, /**< instruction */
+                               uint8_t i) /**< operand index */
+{
+  switch (om->op.op_idx)
+  {
+    case OPCODE (var_decl):
+    case OPCODE (func_decl_n):
+    {
+      return (i != 0);
+    }
+    case OPCODE (func_expr_n):
+    case OPCODE (delete_var):
+    {
+      return (i != 1);
+    }
+    case OPCODE (assignment):
+    {
+      return (i != 2 || om->op.data.assignment.type_value_right == OPCODE_ARG_TYPE_VARIABLE);
+    }
+    case OPCODE (meta):
+    {
+      switch (om->op.data.meta.type)
+      {
+        case OPCODE_META_TYPE_VARG_PROP_DATA:
+        case OPCODE_META_TYPE_VARG_PROP_GETTER:
+        case OPCODE_META_TYPE_VARG_PROP_SETTER:
+        {
+          return (i != 1);
+        }
+        case OPCODE_META_TYPE_CATCH_EXCEPTION_IDENTIFIER:
+        {
+          return false;
+        }
+        default:
+        {
+          return true;
+        }
+      }
+    }
+    default:
+    {
+      return true;
+    }
+  }
+} /* is_variable_reference_operand */
+
+/**
+ * Resolve variable references of the instruction
+ */
+static void
+resolve_op_meta_identifiers (op_meta *om, /**< instruction */
+                             const scopes_tree_lex_env_t *env_p) /**< model of lexical environment,
+                                                                  *   the instruction is executed in */
+{
+  for (uint8_t i = 0; i < 3; i++)
+  {
+    om->lex_env_depth[i] = 0;
+    om->lex_env_slot[i] = LIT_ID_HASH_TABLE_NO_LEX_ENV_SLOT;
+
+    if (om->lit_id[i].packed_value == MEM_CP_NULL
+        || !is_variable_reference_operand (om, i))
+    {
+      continue;
+    }
+
+    const scopes_tree_lex_env_t *iter_p = env_p;
+
+    /* skipping fewer environments than possible is always correct, so the depth is just limited */
+    while (om->lex_env_depth[i] < (uint8_t) -1
+           && !lex_env_may_have_binding (iter_p, om->lit_id[i]))
+    {
+      JERRY_ASSERT (iter_p->outer_p != NULL);
+
+      iter_p = iter_p->outer_p;
+      om->lex_env_depth[i]++;
+    }
+
+    om->lex_env_slot[i] = get_lex_env_slot (iter_p, om->lit_id[i]);
+  }
+} /* resolve_op_meta_identifiers */
+
+/**
+ * Resolve variable references of instructions in specified range of scope's instruction list
+ */
+static void
+resolve_identifiers_in_range (scopes_tree tree, /**< scope */
+                              const scopes_tree_lex_env_t *env_p, /**< model of lexical environment,
+                                                                   *   the range is executed in */
+                              opcode_counter_t begin_oc, /**< first instruction of the range */
+                              opcode_counter_t end_oc) /**< instruction, following the range */
+{
+  opcode_counter_t oc = begin_oc;
+
+  while (oc < end_oc)
+  {
+    op_meta *om = extract_op_meta (tree, oc);
+    resolve_op_meta_identifiers (om, env_p);
+
+    if (om->op.op_idx == OPCODE (func_expr_n))
+    {
+      scopes_tree_lex_env_t func_name_env;
+      scopes_tree_lex_env_t func_env;
+      const scopes_tree_lex_env_t *scope_env_p = env_p;
+
+      if (om->lit_id[1].packed_value != MEM_CP_NULL)
+      {
+        init_single_binding_lex_env (&func_name_env, env_p, om->lit_id[1]);
+        scope_env_p = &func_name_env;
+      }
+
+      const opcode_counter_t function_end_meta_oc = init_function_lex_env (&func_env, scope_env_p, tree, oc, NULL);
+      const op_meta *function_end_om = extract_op_meta (tree, function_end_meta_oc);
+      const opcode_counter_t function_end_oc = (opcode_counter_t) (
+        function_end_meta_oc + calc_opcode_counter_from_idx_idx (function_end_om->op.data.meta.data_1,
+                                                                 function_end_om->op.data.meta.data_2));
+
+      resolve_identifiers_in_range (tree, &func_env, (opcode_counter_t) (function_end_meta_oc + 1), function_end_oc);
+
+      free_lex_env (&func_env);
+
+      oc = function_end_oc;
+    }
+    else if (om->op.op_idx == OPCODE (with))
+    {
+      const opcode_counter_t with_end_oc = (opcode_counter_t) (
+        oc + calc_opcode_counter_from_idx_idx (om->op.data.with.oc_idx_1, om->op.data.with.oc_idx_2));
+
+      scopes_tree_lex_env_t with_env;
+      init_dynamic_lex_env (&with_env, env_p);
+
+      resolve_identifiers_in_range (tree, &with_env, (opcode_counter_t) (oc + 1), with_end_oc);
+
+      oc = with_end_oc;
+    }
+    else if (is_meta_of_type (om, OPCODE_META_TYPE_CATCH))
+    {
+      const opcode_counter_t catch_end_oc = (opcode_counter_t) (
+        oc + calc_opcode_counter_from_idx_idx (om->op.data.meta.data_1, om->op.data.meta.data_2));
+
+      op_meta *exception_identifier_om = extract_op_meta (tree, ++oc);
+      JERRY_ASSERT (is_meta_of_type (exception_identifier_om, OPCODE_META_TYPE_CATCH_EXCEPTION_IDENTIFIER));
+      resolve_op_meta_identifiers (exception_identifier_om, env_p);
+
+      scopes_tree_lex_env_t catch_env;
+      init_single_binding_lex_env (&catch_env, env_p, exception_identifier_om->lit_id[1]);
+
+      resolve_identifiers_in_range (tree, &catch_env, (opcode_counter_t) (oc + 1), catch_end_oc);
+
+      oc = catch_end_oc;
+    }
+    else
+    {
+      oc++;
+    }
+  }
+} /* resolve_identifiers_in_range */
+
+/**
+ * Resolve variable references in the scope and its subscopes
+ */
+static void
+resolve_identifiers_in_scope (scopes_tree tree, /**< scope */
+                              const scopes_tree_lex_env_t *outer_p) /**< model of lexical environment,
+                                                                     *   the scope's function is declared in
+                                                                     *   (or NULL, for the root scope) */
+{
+  scopes_tree_lex_env_t env;
+  opcode_counter_t body_begin_oc;
+
+  if (outer_p == NULL)
+  {
+    /* root scope is global code, eval code or code of a function, created through Function constructor */
+    init_dynamic_lex_env (&env, NULL);
+    body_begin_oc = 0;
+  }
+  else
+  {
+    body_begin_oc = (opcode_counter_t) (init_function_lex_env (&env, outer_p, tree, 0, tree) + 1);
+  }
+
+  resolve_identifiers_in_range (tree, &env, body_begin_oc, tree->opcodes_num);
+
+  for (uint8_t child_id = 0; child_id < tree->t.children_num; child_id++)
+  {
+    resolve_identifiers_in_scope (*(scopes_tree *) linked_list_element (tree->t.children, child_id), &env);
+  }
+
+  free_lex_env (&env);
+} /* resolve_identifiers_in_scope */
+
+/**
+ * Statically resolve references to variables
+ *
+ * For each literal operand, referencing a variable, the number of innermost lexical environments,
+ * that definitely don't contain binding for the variable at run-time, is calculated.
+ *
+ * Lexical environments of function calls, 'catch' blocks and named function expressions are modelled
+ * according to the code structure. Bindings of global and eval code, 'with' blocks and functions
+ * with direct eval calls are not known at parse time, so resolution doesn't skip such environments.
+ *
+ * The interpreter skips the calculated number of lexical environments without checking
+ * for existence of the binding (see also: get_variable_resolution_lex_env).
+ */
+void
+scopes_tree_resolve_identifiers (scopes_tree tree) /**< root scope */
+{
+  assert_tree (tree);
+
+  const lit_magic_string_id_t arguments_id = LIT_MAGIC_STRING_ARGUMENTS;
+  literal_t arguments_lit = lit_find_literal_by_utf8_string (lit_get_magic_string_utf8 (arguments_id),
+                                                             lit_get_magic_string_size (arguments_id));
+  arguments_lit_id = (arguments_lit == NULL) ? NOT_A_LITERAL : lit_cpointer_t::compress (arguments_lit);
+
+  resolve_identifiers_in_scope (tree, NULL);
+} /* scopes_tree_resolve_identifiers */
+
 static opcode_t
 generate_opcode (scopes_tree tree, opcode_counter_t opc_index, lit_id_hash_table *lit_ids)
 {
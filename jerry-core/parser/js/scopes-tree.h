@@ -29,6 +29,10 @@
 typedef struct
 {
   lit_cpointer_t lit_id[3];
+  uint8_t lex_env_depth[3]; /**< number of innermost lexical environments that can't contain binding
+                             *   for corresponding literal operand (see also: scopes_tree_resolve_identifiers) */
+  uint8_t lex_env_slot[3]; /**< index of the operand's binding in the slots of lexical environment,
+                            *   the operand is resolved in (or LIT_ID_HASH_TABLE_NO_LEX_ENV_SLOT) */
   opcode_t op;
 } op_meta;
 
@@ -56,6 +60,7 @@ void scopes_tree_add_op_meta (scopes_tree, op_meta);
 void scopes_tree_set_op_meta (scopes_tree, opcode_counter_t, op_meta);
 void scopes_tree_set_opcodes_num (scopes_tree, opcode_counter_t);
 op_meta scopes_tree_op_meta (scopes_tree, opcode_counter_t);
+void scopes_tree_resolve_identifiers (scopes_tree);
 size_t scopes_tree_count_literals_in_blocks (scopes_tree);
 opcode_counter_t scopes_tree_count_opcodes (scopes_tree);
 opcode_t *scopes_tree_raw_data (scopes_tree, uint8_t *, size_t, lit_id_hash_table *);
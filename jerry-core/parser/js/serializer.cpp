@@ -18,6 +18,8 @@
 #include "pretty-printer.h"
 #include "array-list.h"
 
+#define OPCODE(op) (__op__idx_##op)
+
 static bytecode_data_t bytecode_data;
 static scopes_tree current_scope;
 static bool print_opcodes;
@@ -77,6 +79,51 @@ serializer_get_literal_cp_by_uid (uint8_t id, /**< literal idx */
   return lit_id_hash_table_lookup (lit_id_hash, id, oc);
 } /* serializer_get_literal_cp_by_uid */
 
+/**
+ * Get number of lexical environments, that can be skipped during resolution of variable,
+ * referenced by literal id (operand value of instruction)
+ *
+ * See also:
+ *          scopes_tree_resolve_identifiers
+ *
+ * @return number of innermost lexical environments, that can't contain binding for the variable
+ */
+uint8_t
+serializer_get_lex_env_depth_by_uid (uint8_t id, /**< literal idx */
+                                     const opcode_t *opcodes_p, /**< pointer to bytecode */
+                                     opcode_counter_t oc) /**< position in the bytecode */
+{
+  lit_id_hash_table *lit_id_hash = GET_HASH_TABLE_FOR_BYTECODE (opcodes_p == NULL ? bytecode_data.opcodes : opcodes_p);
+  if (lit_id_hash == null_hash)
+  {
+    return 0;
+  }
+  return lit_id_hash_table_lookup_lex_env_depth (lit_id_hash, id, oc);
+} /* serializer_get_lex_env_depth_by_uid */
+
+/**
+ * Get index of binding in the slots of lexical environment, the variable, referenced by literal id
+ * (operand value of instruction), is resolved in
+ *
+ * See also:
+ *          scopes_tree_resolve_identifiers
+ *
+ * @return slot index - if the index is known at parse time,
+ *         LIT_ID_HASH_TABLE_NO_LEX_ENV_SLOT - otherwise.
+ */
+uint8_t
+serializer_get_lex_env_slot_by_uid (uint8_t id, /**< literal idx */
+                                    const opcode_t *opcodes_p, /**< pointer to bytecode */
+                                    opcode_counter_t oc) /**< position in the bytecode */
+{
+  lit_id_hash_table *lit_id_hash = GET_HASH_TABLE_FOR_BYTECODE (opcodes_p == NULL ? bytecode_data.opcodes : opcodes_p);
+  if (lit_id_hash == null_hash)
+  {
+    return LIT_ID_HASH_TABLE_NO_LEX_ENV_SLOT;
+  }
+  return lit_id_hash_table_lookup_lex_env_slot (lit_id_hash, id, oc);
+} /* serializer_get_lex_env_slot_by_uid */
+
 void
 serializer_set_strings_buffer (const ecma_char_t *s)
 {
@@ -89,11 +136,79 @@ serializer_set_scope (scopes_tree new_scope)
   current_scope = new_scope;
 }
 
+/**
+ * Replace comparison opcodes, that are immediately followed by conditional jump on the comparison's result,
+ * with corresponding fused opcodes (see also: OP_FUSED_COMPARISONS)
+ *
+ * Note:
+ *      the conditional jump opcode is kept in place, as it contains the jump's arguments,
+ *      and can be target of other jumps.
+ *
+ *      fused opcodes don't store the comparison's result to the temporary register. The jump opcode is the only
+ *      reader of the register, as the dumper emits such pairs only for checks of if-statements, loops, conditional
+ *      expressions and case clauses, while results of logical '&&' and '||' expressions, that are used after
+ *      the jump, are first copied to another register (see also: parse_logical_and_expression).
+ */
+static void
+serializer_fuse_comparisons_with_jumps (opcode_t *opcodes_p, /**< byte-code array */
+                                        opcode_counter_t opcodes_count) /**< number of instructions */
+{
+  for (opcode_counter_t oc = 0; oc + 1 < opcodes_count; oc++)
+  {
+    opcode_t *opcode_p = &opcodes_p[oc];
+    const opcode_t next_opcode = opcodes_p[oc + 1];
+
+    idx_t cond_var_idx;
+
+    switch (next_opcode.op_idx)
+    {
+      case OPCODE (is_true_jmp_up): cond_var_idx = next_opcode.data.is_true_jmp_up.value; break;
+      case OPCODE (is_false_jmp_up): cond_var_idx = next_opcode.data.is_false_jmp_up.value; break;
+      case OPCODE (is_true_jmp_down): cond_var_idx = next_opcode.data.is_true_jmp_down.value; break;
+      case OPCODE (is_false_jmp_down): cond_var_idx = next_opcode.data.is_false_jmp_down.value; break;
+      default: continue;
+    }
+
+    /* only results stored to temporary registers are considered, so storing them has no side effects */
+    if (cond_var_idx < OPCODE_REG_GENERAL_FIRST)
+    {
+      continue;
+    }
+
+#define FUSE_COMPARISON(op_name) \
+    case OPCODE (op_name): \
+    { \
+      if (opcode_p->data.op_name.dst == cond_var_idx) \
+      { \
+        opcode_p->op_idx = OPCODE (op_name ## _and_jmp); \
+      } \
+      break; \
+    }
+
+    switch (opcode_p->op_idx)
+    {
+      FUSE_COMPARISON (equal_value)
+      FUSE_COMPARISON (not_equal_value)
+      FUSE_COMPARISON (equal_value_type)
+      FUSE_COMPARISON (not_equal_value_type)
+      FUSE_COMPARISON (less_than)
+      FUSE_COMPARISON (greater_than)
+      FUSE_COMPARISON (less_or_equal_than)
+      FUSE_COMPARISON (greater_or_equal_than)
+      default: break;
+    }
+
+#undef FUSE_COMPARISON
+  }
+} /* serializer_fuse_comparisons_with_jumps */
+
 const opcode_t *
 serializer_merge_scopes_into_bytecode (void)
 {
   bytecode_data.opcodes_count = scopes_tree_count_opcodes (current_scope);
 
+  scopes_tree_resolve_identifiers (current_scope);
+
   const size_t buckets_count = scopes_tree_count_literals_in_blocks (current_scope);
   const size_t blocks_count = (size_t) bytecode_data.opcodes_count / BLOCK_SIZE + 1;
   const opcode_counter_t opcodes_count = scopes_tree_count_opcodes (current_scope);
@@ -113,6 +228,8 @@ serializer_merge_scopes_into_bytecode (void)
 
   const opcode_t *opcodes_p = scopes_tree_raw_data (current_scope, buffer_p, opcodes_array_size, lit_id_hash);
 
+  serializer_fuse_comparisons_with_jumps ((opcode_t *) opcodes_p, opcodes_count);
+
   opcodes_header_t *header_p = (opcodes_header_t*) buffer_p;
   MEM_CP_SET_POINTER (header_p->next_opcodes_cp, bytecode_data.opcodes);
   header_p->instructions_number = opcodes_count;
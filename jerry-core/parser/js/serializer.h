@@ -27,6 +27,8 @@ void serializer_set_show_opcodes (bool show_opcodes);
 op_meta serializer_get_op_meta (opcode_counter_t);
 opcode_t serializer_get_opcode (const opcode_t*, opcode_counter_t);
 lit_cpointer_t serializer_get_literal_cp_by_uid (uint8_t, const opcode_t*, opcode_counter_t);
+uint8_t serializer_get_lex_env_depth_by_uid (uint8_t, const opcode_t*, opcode_counter_t);
+uint8_t serializer_get_lex_env_slot_by_uid (uint8_t, const opcode_t*, opcode_counter_t);
 void serializer_set_strings_buffer (const ecma_char_t *);
 void serializer_set_scope (scopes_tree);
 const opcode_t *serializer_merge_scopes_into_bytecode (void);
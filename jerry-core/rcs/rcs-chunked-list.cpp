@@ -243,6 +243,38 @@ rcs_chunked_list_t::get_data_space_size (void)
   return rcs_chunked_list_t::get_node_size () - sizeof (node_t);
 } /* rcs_chunked_list_t::get_data_space_size */
 
+/**
+ * Check whether the specified area is placed in data space of one node
+ *
+ * Note:
+ *      nodes are one-chunked blocks of the heap, so the area is in one node if it is in one chunk.
+ *
+ * @return true - if the area doesn't cross boundary of a node,
+ *         false - otherwise.
+ */
+bool
+rcs_chunked_list_t::is_in_one_node (const void *area_p, /**< beginning of the area in a node's data space */
+                                    size_t size) /**< size of the area */
+const
+{
+  JERRY_ASSERT (size != 0);
+
+  const uintptr_t area_begin = (uintptr_t) area_p;
+  const uintptr_t area_last = area_begin + size - 1u;
+
+  if (JERRY_ALIGNDOWN (area_begin, MEM_HEAP_CHUNK_SIZE) != JERRY_ALIGNDOWN (area_last, MEM_HEAP_CHUNK_SIZE))
+  {
+    return false;
+  }
+
+#ifndef JERRY_NDEBUG
+  uint8_t *data_space_p = get_data_space (get_node_from_pointer ((void *) area_p));
+  JERRY_ASSERT (area_last < (uintptr_t) (data_space_p + get_data_space_size ()));
+#endif /* !JERRY_NDEBUG */
+
+  return true;
+} /* rcs_chunked_list_t::is_in_one_node */
+
 /**
  * Set previous node for the specified node
  */
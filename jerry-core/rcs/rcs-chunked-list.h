@@ -73,6 +73,7 @@ public:
   uint8_t* get_data_space (node_t *) const;
 
   static size_t get_data_space_size (void);
+  bool is_in_one_node (const void *, size_t) const;
 
 private:
   void set_prev (node_t *, node_t *);
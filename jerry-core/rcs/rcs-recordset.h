@@ -33,8 +33,15 @@
 
 /**
  * Logarithm of a dynamic storage unit alignment
+ *
+ * Note:
+ *      in large heap mode compressed pointers are wider, so records' headers are 64-bit.
  */
-#define RCS_DYN_STORAGE_ALIGNMENT_LOG (2u)
+#ifndef CONFIG_MEM_LARGE_HEAP
+# define RCS_DYN_STORAGE_ALIGNMENT_LOG (2u)
+#else /* CONFIG_MEM_LARGE_HEAP */
+# define RCS_DYN_STORAGE_ALIGNMENT_LOG (3u)
+#endif /* CONFIG_MEM_LARGE_HEAP */
 
 /**
  * Dynamic storage unit alignment
@@ -47,7 +54,16 @@
  * See also:
  *          rcs_dyn_storage_length_t
  */
-#define RCS_DYN_STORAGE_LENGTH_UNIT   (4u)
+#define RCS_DYN_STORAGE_LENGTH_UNIT   (1u << RCS_DYN_STORAGE_ALIGNMENT_LOG)
+
+/**
+ * Unsigned integer type of RCS_DYN_STORAGE_LENGTH_UNIT size, containing a record's header fields
+ */
+#ifndef CONFIG_MEM_LARGE_HEAP
+typedef uint32_t rcs_dyn_storage_unit_t;
+#else /* CONFIG_MEM_LARGE_HEAP */
+typedef uint64_t rcs_dyn_storage_unit_t;
+#endif /* CONFIG_MEM_LARGE_HEAP */
 
 /**
  * Dynamic storage
@@ -108,13 +124,13 @@ public:
         {
           mem_cpointer_t base_cp : MEM_CP_WIDTH; /**< pointer to base of addressed area */
 #if MEM_ALIGNMENT_LOG > RCS_DYN_STORAGE_ALIGNMENT_LOG
-          uint16_t ext     : (MEM_ALIGNMENT_LOG - RCS_DYN_STORAGE_ALIGNMENT_LOG); /**< extension of the basic
+          mem_cpointer_t ext : (MEM_ALIGNMENT_LOG - RCS_DYN_STORAGE_ALIGNMENT_LOG); /**< extension of the basic
                                                                                    *   compressed pointer
                                                                                    *   used for more detailed
                                                                                    *   addressing */
 #endif /* MEM_ALIGNMENT_LOG > RCS_DYN_STORAGE_ALIGNMENT_LOG */
         } value;
-        uint16_t packed_value;
+        mem_cpointer_t packed_value;
       };
 
       static cpointer_t compress (record_t *pointer_p);
@@ -154,6 +170,18 @@ public:
   record_t *get_first (void);
   record_t *get_next (record_t *rec_p);
 
+  /**
+   * Check whether the first bytes of the record are placed in one node of the storage
+   *
+   * @return true - if the area can be accessed directly, without record iterator,
+   *         false - otherwise.
+   */
+  bool is_header_in_one_node (const record_t *rec_p, /**< record */
+                              size_t header_size) const /**< size of the area at the record's beginning */
+  {
+    return _chunk_list.is_in_one_node (rec_p, header_size);
+  } /* is_header_in_one_node */
+
 private:
   friend class rcs_record_iterator_t;
 
@@ -30,6 +30,91 @@ typedef enum
   number_arithmetic_remainder, /**< remainder calculation */
 } number_arithmetic_op;
 
+/**
+ * Perform arithmetic operation on integer numbers, that are stored directly in number values.
+ *
+ * @return true - if result of the operation is representable with integer number value
+ *                (out_value_p is set to the value),
+ *         false - otherwise (the operation should be performed on ecma-numbers).
+ */
+static bool
+do_integer_arithmetic (number_arithmetic_op op, /**< number arithmetic operation */
+                       ecma_integer_value_t left, /**< left integer */
+                       ecma_integer_value_t right, /**< right integer */
+                       ecma_value_t *out_value_p) /**< out: integer number value */
+{
+  int64_t result;
+
+  switch (op)
+  {
+    case number_arithmetic_addition:
+    {
+      result = (int64_t) left + right;
+      break;
+    }
+    case number_arithmetic_substraction:
+    {
+      result = (int64_t) left - right;
+      break;
+    }
+    case number_arithmetic_multiplication:
+    {
+      result = (int64_t) left * right;
+
+      if (result == 0 && (left < 0 || right < 0))
+      {
+        /* -0 */
+        return false;
+      }
+      break;
+    }
+    case number_arithmetic_division:
+    {
+      if (right == 0
+          || left % right != 0
+          || (left == 0 && right < 0))
+      {
+        /* Infinity, NaN, fractional number or -0 */
+        return false;
+      }
+
+      result = (int64_t) left / right;
+      break;
+    }
+    case number_arithmetic_remainder:
+    {
+      if (right == 0)
+      {
+        /* NaN */
+        return false;
+      }
+
+      result = (int64_t) left % right;
+
+      if (result == 0 && left < 0)
+      {
+        /* -0 */
+        return false;
+      }
+      break;
+    }
+    default:
+    {
+      JERRY_UNREACHABLE ();
+    }
+  }
+
+  if (result < ECMA_INTEGER_NUMBER_MIN
+      || result > ECMA_INTEGER_NUMBER_MAX)
+  {
+    return false;
+  }
+
+  *out_value_p = ecma_make_integer_value ((ecma_integer_value_t) result);
+
+  return true;
+} /* do_integer_arithmetic */
+
 /**
  * Perform ECMA number arithmetic operation.
  *
@@ -50,6 +135,20 @@ do_number_arithmetic (int_data_t *int_data, /**< interpreter context */
 {
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
 
+  if (ecma_is_value_integer_number (left_value)
+      && ecma_is_value_integer_number (right_value))
+  {
+    ecma_value_t res_value;
+
+    if (do_integer_arithmetic (op,
+                               ecma_get_integer_from_value (left_value),
+                               ecma_get_integer_from_value (right_value),
+                               &res_value))
+    {
+      return set_variable_value (int_data, int_data->pos, dst_var_idx, res_value);
+    }
+  }
+
   ECMA_OP_TO_NUMBER_TRY_CATCH (num_left, left_value, ret_value);
   ECMA_OP_TO_NUMBER_TRY_CATCH (num_right, right_value, ret_value);
 
@@ -114,44 +213,58 @@ opfunc_addition (opcode_t opdata, /**< operation data */
 
   ECMA_TRY_CATCH (left_value, get_variable_value (int_data, left_var_idx, false), ret_value);
   ECMA_TRY_CATCH (right_value, get_variable_value (int_data, right_var_idx, false), ret_value);
-  ECMA_TRY_CATCH (prim_left_value,
-                  ecma_op_to_primitive (left_value,
-                                        ECMA_PREFERRED_TYPE_NO),
-                  ret_value);
-  ECMA_TRY_CATCH (prim_right_value,
-                  ecma_op_to_primitive (right_value,
-                                        ECMA_PREFERRED_TYPE_NO),
-                  ret_value);
-
-  if (ecma_is_value_string (prim_left_value)
-      || ecma_is_value_string (prim_right_value))
+
+  if (ecma_is_value_integer_number (left_value)
+      && ecma_is_value_integer_number (right_value))
+  {
+    ret_value = do_number_arithmetic (int_data,
+                                      dst_var_idx,
+                                      number_arithmetic_addition,
+                                      left_value,
+                                      right_value);
+  }
+  else
   {
-    ECMA_TRY_CATCH (str_left_value, ecma_op_to_string (prim_left_value), ret_value);
-    ECMA_TRY_CATCH (str_right_value, ecma_op_to_string (prim_right_value), ret_value);
+    ECMA_TRY_CATCH (prim_left_value,
+                    ecma_op_to_primitive (left_value,
+                                          ECMA_PREFERRED_TYPE_NO),
+                    ret_value);
+    ECMA_TRY_CATCH (prim_right_value,
+                    ecma_op_to_primitive (right_value,
+                                          ECMA_PREFERRED_TYPE_NO),
+                    ret_value);
+
+    if (ecma_is_value_string (prim_left_value)
+        || ecma_is_value_string (prim_right_value))
+    {
+      ECMA_TRY_CATCH (str_left_value, ecma_op_to_string (prim_left_value), ret_value);
+      ECMA_TRY_CATCH (str_right_value, ecma_op_to_string (prim_right_value), ret_value);
 
-    ecma_string_t *string1_p = ecma_get_string_from_value (str_left_value);
-    ecma_string_t *string2_p = ecma_get_string_from_value (str_right_value);
+      ecma_string_t *string1_p = ecma_get_string_from_value (str_left_value);
+      ecma_string_t *string2_p = ecma_get_string_from_value (str_right_value);
 
-    ecma_string_t *concat_str_p = ecma_concat_ecma_strings (string1_p, string2_p);
+      ecma_string_t *concat_str_p = ecma_concat_ecma_strings (string1_p, string2_p);
 
-    ret_value = set_variable_value (int_data, int_data->pos, dst_var_idx, ecma_make_string_value (concat_str_p));
+      ret_value = set_variable_value (int_data, int_data->pos, dst_var_idx, ecma_make_string_value (concat_str_p));
 
-    ecma_deref_ecma_string (concat_str_p);
+      ecma_deref_ecma_string (concat_str_p);
 
-    ECMA_FINALIZE (str_right_value);
-    ECMA_FINALIZE (str_left_value);
-  }
-  else
-  {
-    ret_value = do_number_arithmetic (int_data,
-                                      dst_var_idx,
-                                      number_arithmetic_addition,
-                                      prim_left_value,
-                                      prim_right_value);
+      ECMA_FINALIZE (str_right_value);
+      ECMA_FINALIZE (str_left_value);
+    }
+    else
+    {
+      ret_value = do_number_arithmetic (int_data,
+                                        dst_var_idx,
+                                        number_arithmetic_addition,
+                                        prim_left_value,
+                                        prim_right_value);
+    }
+
+    ECMA_FINALIZE (prim_right_value);
+    ECMA_FINALIZE (prim_left_value);
   }
 
-  ECMA_FINALIZE (prim_right_value);
-  ECMA_FINALIZE (prim_left_value);
   ECMA_FINALIZE (right_value);
   ECMA_FINALIZE (left_value);
 
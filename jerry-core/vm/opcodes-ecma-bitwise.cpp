@@ -30,6 +30,80 @@ typedef enum
   number_bitwise_not, /**< bitwise NOT calculation */
 } number_bitwise_logic_op;
 
+/**
+ * Perform bitwise logic operation on integer numbers, that are stored directly in number values.
+ *
+ * @return true - if result of the operation is representable with integer number value
+ *                (out_value_p is set to the value),
+ *         false - otherwise (the result should be stored in ecma-number).
+ */
+static bool
+do_integer_bitwise_logic (number_bitwise_logic_op op, /**< number bitwise logic operation */
+                          ecma_integer_value_t left, /**< left integer */
+                          ecma_integer_value_t right, /**< right integer */
+                          ecma_value_t *out_value_p) /**< out: integer number value */
+{
+  /* integer numbers fit into int32, so ToInt32 and ToUint32 are just casts */
+  const int32_t left_int32 = left;
+  const uint32_t left_uint32 = (uint32_t) left;
+  const uint32_t right_uint32 = (uint32_t) right;
+
+  int64_t result;
+
+  switch (op)
+  {
+    case number_bitwise_logic_and:
+    {
+      result = (int32_t) (left_uint32 & right_uint32);
+      break;
+    }
+    case number_bitwise_logic_or:
+    {
+      result = (int32_t) (left_uint32 | right_uint32);
+      break;
+    }
+    case number_bitwise_logic_xor:
+    {
+      result = (int32_t) (left_uint32 ^ right_uint32);
+      break;
+    }
+    case number_bitwise_shift_left:
+    {
+      result = (int32_t) (left_uint32 << (right_uint32 & 0x1F));
+      break;
+    }
+    case number_bitwise_shift_right:
+    {
+      result = left_int32 >> (right_uint32 & 0x1F);
+      break;
+    }
+    case number_bitwise_shift_uright:
+    {
+      result = left_uint32 >> (right_uint32 & 0x1F);
+      break;
+    }
+    case number_bitwise_not:
+    {
+      result = (int32_t) ~right_uint32;
+      break;
+    }
+    default:
+    {
+      JERRY_UNREACHABLE ();
+    }
+  }
+
+  if (result < ECMA_INTEGER_NUMBER_MIN
+      || result > ECMA_INTEGER_NUMBER_MAX)
+  {
+    return false;
+  }
+
+  *out_value_p = ecma_make_integer_value ((ecma_integer_value_t) result);
+
+  return true;
+} /* do_integer_bitwise_logic */
+
 /**
  * Perform ECMA number logic operation.
  *
@@ -50,6 +124,20 @@ do_number_bitwise_logic (int_data_t *int_data, /**< interpreter context */
 {
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
 
+  if (ecma_is_value_integer_number (left_value)
+      && ecma_is_value_integer_number (right_value))
+  {
+    ecma_value_t res_value;
+
+    if (do_integer_bitwise_logic (op,
+                                  ecma_get_integer_from_value (left_value),
+                                  ecma_get_integer_from_value (right_value),
+                                  &res_value))
+    {
+      return set_variable_value (int_data, int_data->pos, dst_var_idx, res_value);
+    }
+  }
+
   ECMA_OP_TO_NUMBER_TRY_CATCH (num_left, left_value, ret_value);
   ECMA_OP_TO_NUMBER_TRY_CATCH (num_right, right_value, ret_value);
 
@@ -301,7 +301,7 @@ opfunc_in (opcode_t opdata __attr_unused___, /**< operation data */
     ecma_string_t *left_value_prop_name_p = ecma_get_string_from_value (str_left_value);
     ecma_object_t *right_value_obj_p = ecma_get_object_from_value (right_value);
 
-    if (ecma_op_object_get_property (right_value_obj_p, left_value_prop_name_p) != NULL)
+    if (ecma_op_object_has_property (right_value_obj_p, left_value_prop_name_p))
     {
       is_in = ECMA_SIMPLE_VALUE_TRUE;
     }
@@ -34,6 +34,7 @@
 #include "serializer.h"
 
 bool is_reg_variable (int_data_t *int_data, idx_t var_idx);
+ecma_object_t *get_variable_resolution_lex_env (int_data_t *, opcode_counter_t, idx_t, lit_cpointer_t);
 ecma_completion_value_t get_variable_value (int_data_t *, idx_t, bool);
 ecma_completion_value_t set_variable_value (int_data_t *, opcode_counter_t, idx_t, ecma_value_t);
 ecma_completion_value_t fill_varg_list (int_data_t *int_data,
@@ -17,6 +17,14 @@
 #include "opcodes.h"
 #include "opcodes-ecma-support.h"
 
+/**
+ * Size, in bits, of the bitmap of enumerated names' hashes
+ *
+ * Note:
+ *      names' hashes are reduced to the size, to keep the bitmap small (32 bytes on stack)
+ */
+#define VM_FOR_IN_NAMES_HASHES_BITMAP_SIZE (256u)
+
 /**
  * Enumerate properties and construct collection with their
  * names for further iteration in for-in opcode handler.
@@ -32,7 +40,7 @@ vm_helper_for_in_enumerate_properties_names (ecma_object_t *obj_p) /**< starting
                                                                     *   conversion (ECMA-262 v5, 12.6.4, step 4) */
 {
   const size_t bitmap_row_size = sizeof (uint32_t) * JERRY_BITSINBYTE;
-  uint32_t names_hashes_bitmap[(1u << LIT_STRING_HASH_BITS) / bitmap_row_size];
+  uint32_t names_hashes_bitmap[VM_FOR_IN_NAMES_HASHES_BITMAP_SIZE / bitmap_row_size];
 
   memset (names_hashes_bitmap, 0, sizeof (names_hashes_bitmap));
 
@@ -43,6 +51,8 @@ vm_helper_for_in_enumerate_properties_names (ecma_object_t *obj_p) /**< starting
        prototype_chain_iter_p != NULL;
        prototype_chain_iter_p = ecma_get_object_prototype (prototype_chain_iter_p))
   {
+    ecma_op_object_materialize_properties (prototype_chain_iter_p);
+
     for (ecma_property_t *prop_iter_p = ecma_get_property_list (prototype_chain_iter_p);
          prop_iter_p != NULL;
          prop_iter_p = ECMA_GET_POINTER (ecma_property_t, prop_iter_p->next_property_p))
@@ -96,7 +106,7 @@ vm_helper_for_in_enumerate_properties_names (ecma_object_t *obj_p) /**< starting
           prop_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, prop_iter_p->u.named_accessor_property.name_p);
         }
 
-        lit_string_hash_t hash = prop_name_p->hash;
+        uint32_t hash = ecma_string_hash (prop_name_p) % VM_FOR_IN_NAMES_HASHES_BITMAP_SIZE;
         uint32_t bitmap_row = hash / bitmap_row_size;
         uint32_t bitmap_column = hash % bitmap_row_size;
 
@@ -234,7 +244,7 @@ opfunc_for_in (opcode_t opdata, /**< operation data */
 
         ecma_string_t *name_p = ecma_get_string_from_value (name_value);
 
-        if (ecma_op_object_get_property (obj_p, name_p) != NULL)
+        if (ecma_op_object_has_property (obj_p, name_p))
         {
           ecma_completion_value_t completion = set_variable_value (int_data_p,
                                                                    int_data_p->pos,
@@ -0,0 +1,356 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "opcodes.h"
+#include "opcodes-ecma-support.h"
+
+/**
+ * Perform the conditional jump opcode, that follows a fused comparison opcode, on the comparison's result
+ *
+ * Note:
+ *      the comparison's result is not stored to the destination register, as the register is read only
+ *      by the jump opcode (see also: serializer_fuse_comparisons_with_jumps)
+ */
+static void
+do_jmp_on_comparison_result (int_data_t *int_data, /**< interpreter context */
+                             bool is_true) /**< result of the comparison */
+{
+  int_data->pos++;
+
+  const opcode_t jmp_opdata = int_data->opcodes_p[int_data->pos];
+
+  bool is_jump_up;
+  bool is_jump;
+  opcode_counter_t offset;
+
+  switch (jmp_opdata.op_idx)
+  {
+    case __op__idx_is_true_jmp_up:
+    {
+      is_jump_up = true;
+      is_jump = is_true;
+      offset = calc_opcode_counter_from_idx_idx (jmp_opdata.data.is_true_jmp_up.opcode_1,
+                                                 jmp_opdata.data.is_true_jmp_up.opcode_2);
+      break;
+    }
+    case __op__idx_is_false_jmp_up:
+    {
+      is_jump_up = true;
+      is_jump = !is_true;
+      offset = calc_opcode_counter_from_idx_idx (jmp_opdata.data.is_false_jmp_up.opcode_1,
+                                                 jmp_opdata.data.is_false_jmp_up.opcode_2);
+      break;
+    }
+    case __op__idx_is_true_jmp_down:
+    {
+      is_jump_up = false;
+      is_jump = is_true;
+      offset = calc_opcode_counter_from_idx_idx (jmp_opdata.data.is_true_jmp_down.opcode_1,
+                                                 jmp_opdata.data.is_true_jmp_down.opcode_2);
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (jmp_opdata.op_idx == __op__idx_is_false_jmp_down);
+
+      is_jump_up = false;
+      is_jump = !is_true;
+      offset = calc_opcode_counter_from_idx_idx (jmp_opdata.data.is_false_jmp_down.opcode_1,
+                                                 jmp_opdata.data.is_false_jmp_down.opcode_2);
+      break;
+    }
+  }
+
+  if (!is_jump)
+  {
+    int_data->pos++;
+  }
+  else if (is_jump_up)
+  {
+    JERRY_ASSERT ((uint32_t) int_data->pos >= offset);
+    int_data->pos = (opcode_counter_t) (int_data->pos - offset);
+  }
+  else
+  {
+    JERRY_ASSERT ((uint32_t) int_data->pos + offset < MAX_OPCODES);
+    int_data->pos = (opcode_counter_t) (int_data->pos + offset);
+  }
+} /* do_jmp_on_comparison_result */
+
+/**
+ * 'Equals' opcode handler, fused with the following conditional jump opcode
+ *
+ * See also: ECMA-262 v5, 11.9.1
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value
+ */
+ecma_completion_value_t
+opfunc_equal_value_and_jmp (opcode_t opdata, /**< operation data */
+                            int_data_t *int_data) /**< interpreter context */
+{
+  const idx_t left_var_idx = opdata.data.equal_value_and_jmp.var_left;
+  const idx_t right_var_idx = opdata.data.equal_value_and_jmp.var_right;
+
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  ECMA_TRY_CATCH (left_value, get_variable_value (int_data, left_var_idx, false), ret_value);
+  ECMA_TRY_CATCH (right_value, get_variable_value (int_data, right_var_idx, false), ret_value);
+  ECMA_TRY_CATCH (compare_result,
+                  ecma_op_abstract_equality_compare (left_value, right_value),
+                  ret_value);
+
+  JERRY_ASSERT (ecma_is_value_boolean (compare_result));
+
+  do_jmp_on_comparison_result (int_data, ecma_is_value_true (compare_result));
+
+  ECMA_FINALIZE (compare_result);
+  ECMA_FINALIZE (right_value);
+  ECMA_FINALIZE (left_value);
+
+  return ret_value;
+} /* opfunc_equal_value_and_jmp */
+
+/**
+ * 'Does-not-equals' opcode handler, fused with the following conditional jump opcode
+ *
+ * See also: ECMA-262 v5, 11.9.2
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value
+ */
+ecma_completion_value_t
+opfunc_not_equal_value_and_jmp (opcode_t opdata, /**< operation data */
+                                int_data_t *int_data) /**< interpreter context */
+{
+  const idx_t left_var_idx = opdata.data.not_equal_value_and_jmp.var_left;
+  const idx_t right_var_idx = opdata.data.not_equal_value_and_jmp.var_right;
+
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  ECMA_TRY_CATCH (left_value, get_variable_value (int_data, left_var_idx, false), ret_value);
+  ECMA_TRY_CATCH (right_value, get_variable_value (int_data, right_var_idx, false), ret_value);
+  ECMA_TRY_CATCH (compare_result,
+                  ecma_op_abstract_equality_compare (left_value, right_value),
+                  ret_value);
+
+  JERRY_ASSERT (ecma_is_value_boolean (compare_result));
+
+  do_jmp_on_comparison_result (int_data, !ecma_is_value_true (compare_result));
+
+  ECMA_FINALIZE (compare_result);
+  ECMA_FINALIZE (right_value);
+  ECMA_FINALIZE (left_value);
+
+  return ret_value;
+} /* opfunc_not_equal_value_and_jmp */
+
+/**
+ * 'Strict Equals' opcode handler, fused with the following conditional jump opcode
+ *
+ * See also: ECMA-262 v5, 11.9.4
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value
+ */
+ecma_completion_value_t
+opfunc_equal_value_type_and_jmp (opcode_t opdata, /**< operation data */
+                                 int_data_t *int_data) /**< interpreter context */
+{
+  const idx_t left_var_idx = opdata.data.equal_value_type_and_jmp.var_left;
+  const idx_t right_var_idx = opdata.data.equal_value_type_and_jmp.var_right;
+
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  ECMA_TRY_CATCH (left_value, get_variable_value (int_data, left_var_idx, false), ret_value);
+  ECMA_TRY_CATCH (right_value, get_variable_value (int_data, right_var_idx, false), ret_value);
+
+  const bool is_equal = ecma_op_strict_equality_compare (left_value, right_value);
+
+  do_jmp_on_comparison_result (int_data, is_equal);
+
+  ECMA_FINALIZE (right_value);
+  ECMA_FINALIZE (left_value);
+
+  return ret_value;
+} /* opfunc_equal_value_type_and_jmp */
+
+/**
+ * 'Strict Does-not-equals' opcode handler, fused with the following conditional jump opcode
+ *
+ * See also: ECMA-262 v5, 11.9.5
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value
+ */
+ecma_completion_value_t
+opfunc_not_equal_value_type_and_jmp (opcode_t opdata, /**< operation data */
+                                     int_data_t *int_data) /**< interpreter context */
+{
+  const idx_t left_var_idx = opdata.data.not_equal_value_type_and_jmp.var_left;
+  const idx_t right_var_idx = opdata.data.not_equal_value_type_and_jmp.var_right;
+
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  ECMA_TRY_CATCH (left_value, get_variable_value (int_data, left_var_idx, false), ret_value);
+  ECMA_TRY_CATCH (right_value, get_variable_value (int_data, right_var_idx, false), ret_value);
+
+  const bool is_equal = ecma_op_strict_equality_compare (left_value, right_value);
+
+  do_jmp_on_comparison_result (int_data, !is_equal);
+
+  ECMA_FINALIZE (right_value);
+  ECMA_FINALIZE (left_value);
+
+  return ret_value;
+} /* opfunc_not_equal_value_type_and_jmp */
+
+/**
+ * 'Less-than' opcode handler, fused with the following conditional jump opcode
+ *
+ * See also: ECMA-262 v5, 11.8.1
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value
+ */
+ecma_completion_value_t
+opfunc_less_than_and_jmp (opcode_t opdata, /**< operation data */
+                          int_data_t *int_data) /**< interpreter context */
+{
+  const idx_t left_var_idx = opdata.data.less_than_and_jmp.var_left;
+  const idx_t right_var_idx = opdata.data.less_than_and_jmp.var_right;
+
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  ECMA_TRY_CATCH (left_value, get_variable_value (int_data, left_var_idx, false), ret_value);
+  ECMA_TRY_CATCH (right_value, get_variable_value (int_data, right_var_idx, false), ret_value);
+  ECMA_TRY_CATCH (compare_result,
+                  ecma_op_abstract_relational_compare (left_value, right_value, true),
+                  ret_value);
+
+  /* undefined result (one of the operands is NaN) corresponds to false */
+  do_jmp_on_comparison_result (int_data, ecma_is_value_true (compare_result));
+
+  ECMA_FINALIZE (compare_result);
+  ECMA_FINALIZE (right_value);
+  ECMA_FINALIZE (left_value);
+
+  return ret_value;
+} /* opfunc_less_than_and_jmp */
+
+/**
+ * 'Greater-than' opcode handler, fused with the following conditional jump opcode
+ *
+ * See also: ECMA-262 v5, 11.8.2
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value
+ */
+ecma_completion_value_t
+opfunc_greater_than_and_jmp (opcode_t opdata, /**< operation data */
+                             int_data_t *int_data) /**< interpreter context */
+{
+  const idx_t left_var_idx = opdata.data.greater_than_and_jmp.var_left;
+  const idx_t right_var_idx = opdata.data.greater_than_and_jmp.var_right;
+
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  ECMA_TRY_CATCH (left_value, get_variable_value (int_data, left_var_idx, false), ret_value);
+  ECMA_TRY_CATCH (right_value, get_variable_value (int_data, right_var_idx, false), ret_value);
+  ECMA_TRY_CATCH (compare_result,
+                  ecma_op_abstract_relational_compare (right_value, left_value, false),
+                  ret_value);
+
+  /* undefined result (one of the operands is NaN) corresponds to false */
+  do_jmp_on_comparison_result (int_data, ecma_is_value_true (compare_result));
+
+  ECMA_FINALIZE (compare_result);
+  ECMA_FINALIZE (right_value);
+  ECMA_FINALIZE (left_value);
+
+  return ret_value;
+} /* opfunc_greater_than_and_jmp */
+
+/**
+ * 'Less-than-or-equal' opcode handler, fused with the following conditional jump opcode
+ *
+ * See also: ECMA-262 v5, 11.8.3
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value
+ */
+ecma_completion_value_t
+opfunc_less_or_equal_than_and_jmp (opcode_t opdata, /**< operation data */
+                                   int_data_t *int_data) /**< interpreter context */
+{
+  const idx_t left_var_idx = opdata.data.less_or_equal_than_and_jmp.var_left;
+  const idx_t right_var_idx = opdata.data.less_or_equal_than_and_jmp.var_right;
+
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  ECMA_TRY_CATCH (left_value, get_variable_value (int_data, left_var_idx, false), ret_value);
+  ECMA_TRY_CATCH (right_value, get_variable_value (int_data, right_var_idx, false), ret_value);
+  ECMA_TRY_CATCH (compare_result,
+                  ecma_op_abstract_relational_compare (right_value, left_value, false),
+                  ret_value);
+
+  /* undefined result (one of the operands is NaN) corresponds to false */
+  const bool is_true = (!ecma_is_value_undefined (compare_result)
+                        && !ecma_is_value_true (compare_result));
+
+  do_jmp_on_comparison_result (int_data, is_true);
+
+  ECMA_FINALIZE (compare_result);
+  ECMA_FINALIZE (right_value);
+  ECMA_FINALIZE (left_value);
+
+  return ret_value;
+} /* opfunc_less_or_equal_than_and_jmp */
+
+/**
+ * 'Greater-than-or-equal' opcode handler, fused with the following conditional jump opcode
+ *
+ * See also: ECMA-262 v5, 11.8.4
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value
+ */
+ecma_completion_value_t
+opfunc_greater_or_equal_than_and_jmp (opcode_t opdata, /**< operation data */
+                                      int_data_t *int_data) /**< interpreter context */
+{
+  const idx_t left_var_idx = opdata.data.greater_or_equal_than_and_jmp.var_left;
+  const idx_t right_var_idx = opdata.data.greater_or_equal_than_and_jmp.var_right;
+
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  ECMA_TRY_CATCH (left_value, get_variable_value (int_data, left_var_idx, false), ret_value);
+  ECMA_TRY_CATCH (right_value, get_variable_value (int_data, right_var_idx, false), ret_value);
+  ECMA_TRY_CATCH (compare_result,
+                  ecma_op_abstract_relational_compare (left_value, right_value, true),
+                  ret_value);
+
+  /* undefined result (one of the operands is NaN) corresponds to false */
+  const bool is_true = (!ecma_is_value_undefined (compare_result)
+                        && !ecma_is_value_true (compare_result));
+
+  do_jmp_on_comparison_result (int_data, is_true);
+
+  ECMA_FINALIZE (compare_result);
+  ECMA_FINALIZE (right_value);
+  ECMA_FINALIZE (left_value);
+
+  return ret_value;
+} /* opfunc_greater_or_equal_than_and_jmp */
@@ -14,6 +14,7 @@
  */
 
 #include "opcodes-ecma-support.h"
+#include "vm-global-cache.h"
 
 #ifndef JERRY_NDEBUG
 /**
@@ -65,6 +66,94 @@ is_reg_variable (int_data_t *int_data, /**< interpreter context */
   return (var_idx >= int_data->min_reg_num && var_idx <= int_data->max_reg_num);
 } /* is_reg_variable */
 
+/**
+ * Get lexical environment to start resolution of non-register variable from
+ *
+ * Note:
+ *      innermost lexical environments, that can't contain binding for the variable,
+ *      are determined by the parser (see also: scopes_tree_resolve_identifiers),
+ *      so they are skipped without checking for the binding.
+ *
+ * @return pointer to lexical environment
+ */
+ecma_object_t *
+get_variable_resolution_lex_env (int_data_t *int_data, /**< interpreter context */
+                                 opcode_counter_t lit_oc, /**< opcode counter for literal */
+                                 idx_t var_idx, /**< variable identifier */
+                                 lit_cpointer_t lit_cp) /**< compressed pointer to variable name's literal */
+{
+  ecma_object_t *lex_env_p = int_data->lex_env_p;
+
+#ifndef JERRY_NDEBUG
+  ecma_string_t var_name_string;
+  ecma_new_ecma_string_on_stack_from_lit_cp (&var_name_string, lit_cp);
+#else /* JERRY_NDEBUG */
+  (void) lit_cp;
+#endif /* JERRY_NDEBUG */
+
+  for (uint8_t depth = serializer_get_lex_env_depth_by_uid (var_idx, int_data->opcodes_p, lit_oc);
+       depth != 0;
+       depth--)
+  {
+#ifndef JERRY_NDEBUG
+    JERRY_ASSERT (!ecma_op_has_binding (lex_env_p, &var_name_string));
+#endif /* !JERRY_NDEBUG */
+
+    lex_env_p = ecma_get_lex_env_outer_reference (lex_env_p);
+    JERRY_ASSERT (lex_env_p != NULL);
+  }
+
+#ifndef JERRY_NDEBUG
+  ecma_check_that_ecma_string_need_not_be_freed (&var_name_string);
+#endif /* !JERRY_NDEBUG */
+
+  return lex_env_p;
+} /* get_variable_resolution_lex_env */
+
+/**
+ * Get index of variable's binding in the slots of lexical environment, the variable is resolved in
+ *
+ * See also:
+ *          scopes_tree_resolve_identifiers
+ *
+ * @return slot index - if the environment stores its bindings in slots and the index is known at parse time,
+ *         ECMA_LEX_ENV_NO_SLOT - otherwise.
+ */
+static ecma_length_t
+get_variable_lex_env_slot (int_data_t *int_data, /**< interpreter context */
+                           opcode_counter_t lit_oc, /**< opcode counter for literal */
+                           idx_t var_idx, /**< variable identifier */
+                           ecma_object_t *resolution_lex_env_p, /**< lexical environment,
+                                                                 *   the variable is resolved in */
+                           lit_cpointer_t lit_cp) /**< compressed pointer to variable name's literal */
+{
+  if (ecma_get_lex_env_type (resolution_lex_env_p) != ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS)
+  {
+    return ECMA_LEX_ENV_NO_SLOT;
+  }
+
+  uint8_t slot = serializer_get_lex_env_slot_by_uid (var_idx, int_data->opcodes_p, lit_oc);
+
+  if (slot == LIT_ID_HASH_TABLE_NO_LEX_ENV_SLOT)
+  {
+    return ECMA_LEX_ENV_NO_SLOT;
+  }
+
+#ifndef JERRY_NDEBUG
+  ecma_string_t var_name_string;
+  ecma_new_ecma_string_on_stack_from_lit_cp (&var_name_string, lit_cp);
+
+  JERRY_ASSERT (ecma_compare_ecma_strings (ecma_get_lex_env_slot_name (resolution_lex_env_p, slot),
+                                           &var_name_string));
+
+  ecma_check_that_ecma_string_need_not_be_freed (&var_name_string);
+#else /* JERRY_NDEBUG */
+  (void) lit_cp;
+#endif /* JERRY_NDEBUG */
+
+  return slot;
+} /* get_variable_lex_env_slot */
+
 /**
  * Get variable's value.
  *
@@ -90,28 +179,53 @@ get_variable_value (int_data_t *int_data, /**< interpreter context */
   }
   else
   {
-    ecma_string_t var_name_string;
     lit_cpointer_t lit_cp = serializer_get_literal_cp_by_uid (var_idx, int_data->opcodes_p, int_data->pos);
     JERRY_ASSERT (lit_cp.packed_value != MEM_CP_NULL);
-    ecma_new_ecma_string_on_stack_from_lit_cp (&var_name_string, lit_cp);
 
-    ecma_object_t *ref_base_lex_env_p = ecma_op_resolve_reference_base (int_data->lex_env_p,
-                                                                        &var_name_string);
+    ecma_object_t *resolution_lex_env_p = get_variable_resolution_lex_env (int_data,
+                                                                          int_data->pos,
+                                                                          var_idx,
+                                                                          lit_cp);
+
+    ecma_value_t global_var_value;
+    ecma_length_t slot;
 
-    if (do_eval_or_arguments_check)
+    if (ecma_is_lexical_environment_global (resolution_lex_env_p)
+        && vm_global_cache_get_value (resolution_lex_env_p, lit_cp, &global_var_value))
     {
+      ret_value = ecma_make_normal_completion_value (global_var_value);
+    }
+    else if ((slot = get_variable_lex_env_slot (int_data,
+                                                int_data->pos,
+                                                var_idx,
+                                                resolution_lex_env_p,
+                                                lit_cp)) != ECMA_LEX_ENV_NO_SLOT)
+    {
+      ret_value = ecma_op_get_binding_value_in_slot (resolution_lex_env_p, slot, int_data->is_strict);
+    }
+    else
+    {
+      ecma_string_t var_name_string;
+      ecma_new_ecma_string_on_stack_from_lit_cp (&var_name_string, lit_cp);
+
+      ecma_object_t *ref_base_lex_env_p = ecma_op_resolve_reference_base (resolution_lex_env_p,
+                                                                          &var_name_string);
+
+      if (do_eval_or_arguments_check)
+      {
 #ifndef JERRY_NDEBUG
-      do_strict_eval_arguments_check (ref_base_lex_env_p,
-                                      &var_name_string,
-                                      int_data->is_strict);
+        do_strict_eval_arguments_check (ref_base_lex_env_p,
+                                        &var_name_string,
+                                        int_data->is_strict);
 #endif /* !JERRY_NDEBUG */
-    }
+      }
 
-    ret_value = ecma_op_get_value_lex_env_base (ref_base_lex_env_p,
-                                                &var_name_string,
-                                                int_data->is_strict);
+      ret_value = ecma_op_get_value_lex_env_base (ref_base_lex_env_p,
+                                                  &var_name_string,
+                                                  int_data->is_strict);
 
-    ecma_check_that_ecma_string_need_not_be_freed (&var_name_string);
+      ecma_check_that_ecma_string_need_not_be_freed (&var_name_string);
+    }
   }
 
   return ret_value;
@@ -141,7 +255,9 @@ set_variable_value (int_data_t *int_data, /**< interpreter context */
     if (ecma_is_value_number (reg_value)
         && ecma_is_value_number (value))
     {
-      *ecma_get_number_from_value (reg_value) = *ecma_get_number_from_value (value);
+      ecma_stack_frame_set_reg_value (&int_data->stack_frame,
+                                      var_idx - int_data->min_reg_num,
+                                      ecma_update_number_value (reg_value, value));
     }
     else
     {
@@ -157,26 +273,61 @@ set_variable_value (int_data_t *int_data, /**< interpreter context */
   }
   else
   {
-    ecma_string_t var_name_string;
     lit_cpointer_t lit_cp = serializer_get_literal_cp_by_uid (var_idx, int_data->opcodes_p, lit_oc);
     JERRY_ASSERT (lit_cp.packed_value != MEM_CP_NULL);
-    ecma_new_ecma_string_on_stack_from_lit_cp (&var_name_string, lit_cp);
 
-    ecma_object_t *ref_base_lex_env_p = ecma_op_resolve_reference_base (int_data->lex_env_p,
-                                                                        &var_name_string);
+    ecma_object_t *resolution_lex_env_p = get_variable_resolution_lex_env (int_data,
+                                                                          lit_oc,
+                                                                          var_idx,
+                                                                          lit_cp);
+
+    ecma_length_t slot;
+
+    if (ecma_is_lexical_environment_global (resolution_lex_env_p)
+        && vm_global_cache_put_value (resolution_lex_env_p, lit_cp, value))
+    {
+      ret_value = ecma_make_empty_completion_value ();
+    }
+    else if ((slot = get_variable_lex_env_slot (int_data,
+                                                lit_oc,
+                                                var_idx,
+                                                resolution_lex_env_p,
+                                                lit_cp)) != ECMA_LEX_ENV_NO_SLOT)
+    {
+#ifndef JERRY_NDEBUG
+      ecma_string_t var_name_string;
+      ecma_new_ecma_string_on_stack_from_lit_cp (&var_name_string, lit_cp);
+
+      do_strict_eval_arguments_check (resolution_lex_env_p,
+                                      &var_name_string,
+                                      int_data->is_strict);
+
+      ecma_check_that_ecma_string_need_not_be_freed (&var_name_string);
+#endif /* !JERRY_NDEBUG */
+
+      ret_value = ecma_op_set_mutable_binding_in_slot (resolution_lex_env_p, slot, value, int_data->is_strict);
+    }
+    else
+    {
+      ecma_string_t var_name_string;
+      ecma_new_ecma_string_on_stack_from_lit_cp (&var_name_string, lit_cp);
+
+      ecma_object_t *ref_base_lex_env_p = ecma_op_resolve_reference_base (resolution_lex_env_p,
+                                                                          &var_name_string);
 
 #ifndef JERRY_NDEBUG
-    do_strict_eval_arguments_check (ref_base_lex_env_p,
-                                    &var_name_string,
-                                    int_data->is_strict);
+      do_strict_eval_arguments_check (ref_base_lex_env_p,
+                                      &var_name_string,
+                                      int_data->is_strict);
 #endif /* !JERRY_NDEBUG */
 
-    ret_value = ecma_op_put_value_lex_env_base (ref_base_lex_env_p,
-                                                &var_name_string,
-                                                int_data->is_strict,
-                                                value);
+      ret_value = ecma_op_put_value_lex_env_base (ref_base_lex_env_p,
+                                                  &var_name_string,
+                                                  int_data->is_strict,
+                                                  value);
 
-    ecma_check_that_ecma_string_need_not_be_freed (&var_name_string);
+      ecma_check_that_ecma_string_need_not_be_freed (&var_name_string);
+    }
   }
 
   return ret_value;
@@ -14,9 +14,11 @@
  * limitations under the License.
  */
 
+#include "ecma-fast-array.h"
 #include "jrt.h"
 #include "opcodes.h"
 #include "opcodes-ecma-support.h"
+#include "vm-inline-cache.h"
 
 /**
  * Note:
@@ -1196,6 +1198,61 @@ opfunc_retval (opcode_t opdata __attr_unused___, /**< operation data */
   return ret_value;
 } /* opfunc_retval */
 
+/**
+ * Get vector of an array in fast form, accessed with a number, that is an array index
+ *
+ * The check allows accessing elements, indexed by numbers, without converting the numbers to strings.
+ *
+ * @return pointer to the vector - if the base is an array in fast form and the property name
+ *                                 is a number, that is an array index (out_index_p is set to the index),
+ *         NULL - otherwise (the access should be performed through generic [[Get]] / [[Put]]).
+ */
+static ecma_fast_array_elements_t*
+opfunc_get_fast_array_elements (ecma_value_t base_value, /**< base of the access */
+                                ecma_value_t prop_name_value, /**< property name */
+                                uint32_t *out_index_p) /**< out: array index */
+{
+  if (!ecma_is_value_object (base_value)
+      || !ecma_is_value_number (prop_name_value))
+  {
+    return NULL;
+  }
+
+  ecma_fast_array_elements_t *elements_p = ecma_get_object_fast_elements (ecma_get_object_from_value (base_value));
+
+  if (elements_p == NULL)
+  {
+    return NULL;
+  }
+
+  if (ecma_is_value_integer_number (prop_name_value))
+  {
+    const ecma_integer_value_t integer = ecma_get_integer_from_value (prop_name_value);
+
+    if (integer < 0)
+    {
+      return NULL;
+    }
+
+    *out_index_p = (uint32_t) integer;
+  }
+  else
+  {
+    const ecma_number_t num = ecma_get_number_from_value (prop_name_value);
+    const uint32_t index = ecma_number_to_uint32 (num);
+
+    if (ecma_uint32_to_number (index) != num
+        || index == ECMA_MAX_VALUE_OF_VALID_ARRAY_INDEX)
+    {
+      return NULL;
+    }
+
+    *out_index_p = index;
+  }
+
+  return elements_p;
+} /* opfunc_get_fast_array_elements */
+
 /**
  * 'Property getter' opcode handler.
  *
@@ -1221,26 +1278,56 @@ opfunc_prop_getter (opcode_t opdata __attr_unused___, /**< operation data */
   ECMA_TRY_CATCH (prop_name_value,
                   get_variable_value (int_data, prop_name_var_idx, false),
                   ret_value);
-  ECMA_TRY_CATCH (check_coercible_ret,
-                  ecma_op_check_object_coercible (base_value),
-                  ret_value);
-  ECMA_TRY_CATCH (prop_name_str_value,
-                  ecma_op_to_string (prop_name_value),
-                  ret_value);
 
-  ecma_string_t *prop_name_string_p = ecma_get_string_from_value (prop_name_str_value);
-  ecma_reference_t ref = ecma_make_reference (base_value, prop_name_string_p, int_data->is_strict);
+  ecma_value_t cached_value;
+  ecma_fast_array_elements_t *elements_p;
+  uint32_t index;
 
-  ECMA_TRY_CATCH (prop_value, ecma_op_get_value_object_base (ref), ret_value);
+  if ((elements_p = opfunc_get_fast_array_elements (base_value, prop_name_value, &index)) != NULL
+      && index < elements_p->length)
+  {
+    ret_value = set_variable_value (int_data,
+                                    int_data->pos,
+                                    lhs_var_idx,
+                                    ECMA_FAST_ARRAY_ELEMENTS_GET_VALUES (elements_p)[index]);
+  }
+  else if (ecma_is_value_object (base_value)
+      && ecma_is_value_string (prop_name_value)
+      && vm_inline_cache_get (int_data->opcodes_p,
+                              int_data->pos,
+                              ecma_get_object_from_value (base_value),
+                              ecma_get_string_from_value (prop_name_value),
+                              &cached_value))
+  {
+    ret_value = set_variable_value (int_data,
+                                    int_data->pos,
+                                    lhs_var_idx,
+                                    cached_value);
+  }
+  else
+  {
+    ECMA_TRY_CATCH (check_coercible_ret,
+                    ecma_op_check_object_coercible (base_value),
+                    ret_value);
+    ECMA_TRY_CATCH (prop_name_str_value,
+                    ecma_op_to_string (prop_name_value),
+                    ret_value);
 
-  ret_value = set_variable_value (int_data, int_data->pos, lhs_var_idx, prop_value);
+    ecma_string_t *prop_name_string_p = ecma_get_string_from_value (prop_name_str_value);
+    ecma_reference_t ref = ecma_make_reference (base_value, prop_name_string_p, int_data->is_strict);
 
-  ECMA_FINALIZE (prop_value);
+    ECMA_TRY_CATCH (prop_value, ecma_op_get_value_object_base (ref), ret_value);
 
-  ecma_free_reference (ref);
+    ret_value = set_variable_value (int_data, int_data->pos, lhs_var_idx, prop_value);
+
+    ECMA_FINALIZE (prop_value);
+
+    ecma_free_reference (ref);
+
+    ECMA_FINALIZE (prop_name_str_value);
+    ECMA_FINALIZE (check_coercible_ret);
+  }
 
-  ECMA_FINALIZE (prop_name_str_value);
-  ECMA_FINALIZE (check_coercible_ret);
   ECMA_FINALIZE (prop_name_value);
   ECMA_FINALIZE (base_value);
 
@@ -1267,6 +1354,7 @@ opfunc_prop_setter (opcode_t opdata __attr_unused___, /**< operation data */
   const idx_t rhs_var_idx = opdata.data.prop_setter.rhs;
 
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+  uint32_t index;
 
   ECMA_TRY_CATCH (base_value,
                   get_variable_value (int_data, base_var_idx, false),
@@ -1274,26 +1362,62 @@ opfunc_prop_setter (opcode_t opdata __attr_unused___, /**< operation data */
   ECMA_TRY_CATCH (prop_name_value,
                   get_variable_value (int_data, prop_name_var_idx, false),
                   ret_value);
-  ECMA_TRY_CATCH (check_coercible_ret,
-                  ecma_op_check_object_coercible (base_value),
-                  ret_value);
-  ECMA_TRY_CATCH (prop_name_str_value,
-                  ecma_op_to_string (prop_name_value),
-                  ret_value);
 
-  ecma_string_t *prop_name_string_p = ecma_get_string_from_value (prop_name_str_value);
-  ecma_reference_t ref = ecma_make_reference (base_value,
-                                              prop_name_string_p,
-                                              int_data->is_strict);
+  ecma_fast_array_elements_t *elements_p = opfunc_get_fast_array_elements (base_value, prop_name_value, &index);
+  ecma_object_t *obj_p = (elements_p != NULL ? ecma_get_object_from_value (base_value) : NULL);
 
-  ECMA_TRY_CATCH (rhs_value, get_variable_value (int_data, rhs_var_idx, false), ret_value);
-  ret_value = ecma_op_put_value_object_base (ref, rhs_value);
-  ECMA_FINALIZE (rhs_value);
+  if (elements_p != NULL
+      && (index < elements_p->length
+          || (index == elements_p->length && ecma_fast_array_can_append (obj_p))))
+  {
+    ECMA_TRY_CATCH (rhs_value, get_variable_value (int_data, rhs_var_idx, false), ret_value);
 
-  ecma_free_reference (ref);
+    if (index < elements_p->length)
+    {
+      ecma_fast_array_assign_value (obj_p, index, rhs_value);
+    }
+    else
+    {
+      ecma_fast_array_append (obj_p, rhs_value);
+    }
+
+    ECMA_FINALIZE (rhs_value);
+  }
+  else
+  {
+    ECMA_TRY_CATCH (check_coercible_ret,
+                    ecma_op_check_object_coercible (base_value),
+                    ret_value);
+    ECMA_TRY_CATCH (prop_name_str_value,
+                    ecma_op_to_string (prop_name_value),
+                    ret_value);
+
+    ecma_string_t *prop_name_string_p = ecma_get_string_from_value (prop_name_str_value);
+
+    ECMA_TRY_CATCH (rhs_value, get_variable_value (int_data, rhs_var_idx, false), ret_value);
+
+    if (!ecma_is_value_object (base_value)
+        || !ecma_is_value_string (prop_name_value)
+        || !vm_inline_cache_put (int_data->opcodes_p,
+                                 int_data->pos,
+                                 ecma_get_object_from_value (base_value),
+                                 prop_name_string_p,
+                                 rhs_value))
+    {
+      ecma_reference_t ref = ecma_make_reference (base_value,
+                                                  prop_name_string_p,
+                                                  int_data->is_strict);
+
+      ret_value = ecma_op_put_value_object_base (ref, rhs_value);
+
+      ecma_free_reference (ref);
+    }
+
+    ECMA_FINALIZE (rhs_value);
+    ECMA_FINALIZE (prop_name_str_value);
+    ECMA_FINALIZE (check_coercible_ret);
+  }
 
-  ECMA_FINALIZE (prop_name_str_value);
-  ECMA_FINALIZE (check_coercible_ret);
   ECMA_FINALIZE (prop_name_value);
   ECMA_FINALIZE (base_value);
 
@@ -1500,7 +1624,11 @@ evaluate_arg_for_typeof (int_data_t *int_data, /**< interpreter context */
 
     ecma_string_t *var_name_string_p = ecma_new_ecma_string_from_lit_cp (lit_cp);
 
-    ecma_object_t *ref_base_lex_env_p = ecma_op_resolve_reference_base (int_data->lex_env_p,
+    ecma_object_t *resolution_lex_env_p = get_variable_resolution_lex_env (int_data,
+                                                                          int_data->pos,
+                                                                          var_idx,
+                                                                          lit_cp);
+    ecma_object_t *ref_base_lex_env_p = ecma_op_resolve_reference_base (resolution_lex_env_p,
                                                                         var_name_string_p);
     if (ref_base_lex_env_p == NULL)
     {
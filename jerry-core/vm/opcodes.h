@@ -247,6 +247,22 @@ opcode_counter_t read_meta_opcode_counter (opcode_meta_type expected_type, int_d
         p##_3 (a, is_false_jmp_down, value, opcode_1, opcode_2)              \
         p##_2 (a, jmp_break_continue, opcode_1, opcode_2)
 
+/**
+ * Comparisons, fused with conditional jump opcode (is_{true,false}_jmp_{up,down}), that immediately follows
+ * the comparison opcode and checks its result (see also: serializer_merge_scopes_into_bytecode)
+ *
+ * Result of a fused comparison is passed to the jump directly, and is not stored to the 'dst' register.
+ */
+#define OP_FUSED_COMPARISONS(p, a)                                           \
+        p##_3 (a, equal_value_and_jmp, dst, var_left, var_right)             \
+        p##_3 (a, not_equal_value_and_jmp, dst, var_left, var_right)         \
+        p##_3 (a, equal_value_type_and_jmp, dst, var_left, var_right)        \
+        p##_3 (a, not_equal_value_type_and_jmp, dst, var_left, var_right)    \
+        p##_3 (a, less_than_and_jmp, dst, var_left, var_right)               \
+        p##_3 (a, greater_than_and_jmp, dst, var_left, var_right)            \
+        p##_3 (a, less_or_equal_than_and_jmp, dst, var_left, var_right)      \
+        p##_3 (a, greater_or_equal_than_and_jmp, dst, var_left, var_right)
+
 #define OP_LIST_FULL(p, a)                                                   \
         OP_CALLS_AND_ARGS (p, a)                                             \
         OP_INITS (p, a)                                                      \
@@ -258,6 +274,7 @@ opcode_counter_t read_meta_opcode_counter (opcode_meta_type expected_type, int_d
         OP_RELATIONAL (p, a)                                                 \
         OP_ARITHMETIC (p, a)                                                 \
         OP_JUMPS (p, a)                                                      \
+        OP_FUSED_COMPARISONS (p, a)                                          \
         p##_1 (a, var_decl, variable_name)                                   \
         p##_2 (a, reg_var_decl, min, max)                                    \
         p##_3 (a, meta, type, data_1, data_2)
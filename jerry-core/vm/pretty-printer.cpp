@@ -212,6 +212,14 @@ pp_op_meta (const opcode_t *opcodes_p,
     PP_OP (greater_than, "%s = %s > %s;");
     PP_OP (less_or_equal_than, "%s = %s <= %s;");
     PP_OP (greater_or_equal_than, "%s = %s >= %s;");
+    PP_OP (equal_value_and_jmp, "%s = %s == %s; (fused with jump, not stored)");
+    PP_OP (not_equal_value_and_jmp, "%s = %s != %s; (fused with jump, not stored)");
+    PP_OP (equal_value_type_and_jmp, "%s = %s === %s; (fused with jump, not stored)");
+    PP_OP (not_equal_value_type_and_jmp, "%s = %s !== %s; (fused with jump, not stored)");
+    PP_OP (less_than_and_jmp, "%s = %s < %s; (fused with jump, not stored)");
+    PP_OP (greater_than_and_jmp, "%s = %s > %s; (fused with jump, not stored)");
+    PP_OP (less_or_equal_than_and_jmp, "%s = %s <= %s; (fused with jump, not stored)");
+    PP_OP (greater_or_equal_than_and_jmp, "%s = %s >= %s; (fused with jump, not stored)");
     PP_OP (instanceof, "%s = %s instanceof %s;");
     PP_OP (in, "%s = %s in %s;");
     PP_OP (post_incr, "%s = %s++;");
@@ -0,0 +1,274 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-lex-env.h"
+#include "ecma-objects.h"
+#include "vm-global-cache.h"
+
+/** \addtogroup vm Virtual machine
+ * @{
+ *
+ * \addtogroup vmglobalcache Cache of global variables
+ * @{
+ *
+ * Entries of the table map compressed pointers of identifiers' literals to named data properties,
+ * holding the corresponding bindings of the Global lexical environment (properties of the Global object,
+ * or of the environment itself, if CONFIG_ECMA_GLOBAL_ENVIRONMENT_DECLARATIVE is defined).
+ *
+ * Upon hit, value of a global variable is read / assigned without constructing the variable's name string
+ * and looking up the binding.
+ *
+ * The entries don't hold references, as the Global object and environment are alive till finalization
+ * of the engine; deleted properties are removed from the table (see also: ecma_delete_property).
+ */
+
+#ifndef CONFIG_VM_GLOBAL_CACHE_DISABLE
+/**
+ * Entry of the global variables' cache
+ */
+typedef struct
+{
+  /** Compressed pointer to the identifier's literal (MEM_CP_NULL marks entry empty) */
+  lit_cpointer_t lit_cp;
+
+  /** Compressed pointer to the named data property, holding the binding */
+  mem_cpointer_t prop_cp;
+} vm_global_cache_entry_t;
+
+/**
+ * Number of entries in the global variables' cache
+ */
+#define VM_GLOBAL_CACHE_ENTRIES_NUMBER (1u << CONFIG_VM_GLOBAL_CACHE_ENTRIES_NUMBER_LOG)
+
+/**
+ * Global variables' cache
+ *
+ * Note:
+ *      literals with compressed pointers, equal modulo the table's size, share an entry
+ */
+static vm_global_cache_entry_t vm_global_cache_table[VM_GLOBAL_CACHE_ENTRIES_NUMBER];
+
+/**
+ * Get object, containing properties that hold bindings of the Global lexical environment
+ *
+ * @return pointer to the Global object, or to the environment itself (if it is declarative)
+ */
+static ecma_object_t*
+vm_global_cache_get_holder (ecma_object_t *global_lex_env_p) /**< Global lexical environment */
+{
+  JERRY_ASSERT (ecma_is_lexical_environment_global (global_lex_env_p));
+
+  if (ecma_get_lex_env_type (global_lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+  {
+    return global_lex_env_p;
+  }
+  else
+  {
+    return ecma_get_lex_env_binding_object (global_lex_env_p);
+  }
+} /* vm_global_cache_get_holder */
+
+/**
+ * Lookup named data property, holding binding of the global variable, in the cache,
+ * and update the cache upon miss
+ *
+ * @return pointer to the named data property (writable one, if is_put is true),
+ *         that can be read / assigned directly instead of [[GetBindingValue]] / [[SetMutableBinding]],
+ *         NULL - otherwise (the access should be performed through the generic path).
+ */
+static ecma_property_t*
+vm_global_cache_lookup (ecma_object_t *holder_p, /**< object, containing the bindings */
+                        lit_cpointer_t lit_cp, /**< compressed pointer to the identifier's literal */
+                        bool is_put) /**< is the access an assignment */
+{
+  JERRY_ASSERT (lit_cp.packed_value != MEM_CP_NULL);
+
+  vm_global_cache_entry_t *entry_p = &vm_global_cache_table[lit_cp.packed_value
+                                                             & (VM_GLOBAL_CACHE_ENTRIES_NUMBER - 1)];
+  ecma_property_t *prop_p;
+
+  if (entry_p->lit_cp.packed_value == lit_cp.packed_value)
+  {
+    prop_p = ECMA_GET_NON_NULL_POINTER (ecma_property_t, entry_p->prop_cp);
+
+    JERRY_ASSERT (prop_p->type == ECMA_PROPERTY_NAMEDDATA && ecma_is_property_global_cached (prop_p));
+
+    if (!is_put || ecma_is_property_writable (prop_p))
+    {
+      return prop_p;
+    }
+
+    return NULL;
+  }
+
+  ecma_string_t var_name_string;
+  ecma_new_ecma_string_on_stack_from_lit_cp (&var_name_string, lit_cp);
+
+  if (ecma_is_lexical_environment (holder_p))
+  {
+    prop_p = ecma_find_named_property (holder_p, &var_name_string);
+  }
+  else
+  {
+    /* properties of the built-in Global object are instantiated lazily */
+    prop_p = ecma_op_object_get_own_property (holder_p, &var_name_string);
+  }
+
+  ecma_check_that_ecma_string_need_not_be_freed (&var_name_string);
+
+  if (prop_p == NULL
+      || prop_p->type != ECMA_PROPERTY_NAMEDDATA
+      || ((is_put || ecma_is_lexical_environment (holder_p))
+          && !ecma_is_property_writable (prop_p)))
+  {
+    /* immutable bindings of declarative environments can be uninitialized, so they are not cached */
+    return NULL;
+  }
+
+  if (entry_p->lit_cp.packed_value != MEM_CP_NULL)
+  {
+    vm_global_cache_invalidate_property (ECMA_GET_NON_NULL_POINTER (ecma_property_t, entry_p->prop_cp));
+  }
+
+  ecma_set_property_global_cached (prop_p, true);
+
+  entry_p->lit_cp = lit_cp;
+  ECMA_SET_NON_NULL_POINTER (entry_p->prop_cp, prop_p);
+
+  return prop_p;
+} /* vm_global_cache_lookup */
+#endif /* !CONFIG_VM_GLOBAL_CACHE_DISABLE */
+
+/**
+ * Get value of the global variable through the cache
+ *
+ * @return true - if the value was taken from the variable's binding (out_value_p is set
+ *                to copy of the value, that should be freed with ecma_free_value),
+ *         false - otherwise (the access should be performed through the generic path).
+ */
+bool
+vm_global_cache_get_value (ecma_object_t *global_lex_env_p, /**< Global lexical environment */
+                           lit_cpointer_t lit_cp, /**< compressed pointer to the identifier's literal */
+                           ecma_value_t *out_value_p) /**< out: value of the variable */
+{
+#ifndef CONFIG_VM_GLOBAL_CACHE_DISABLE
+  ecma_property_t *prop_p = vm_global_cache_lookup (vm_global_cache_get_holder (global_lex_env_p),
+                                                    lit_cp,
+                                                    false);
+
+  if (prop_p == NULL)
+  {
+    return false;
+  }
+
+  *out_value_p = ecma_copy_value (ecma_get_named_data_property_value (prop_p), true);
+
+  return true;
+#else /* CONFIG_VM_GLOBAL_CACHE_DISABLE */
+  (void) global_lex_env_p;
+  (void) lit_cp;
+  (void) out_value_p;
+
+  return false;
+#endif /* CONFIG_VM_GLOBAL_CACHE_DISABLE */
+} /* vm_global_cache_get_value */
+
+/**
+ * Assign value to the global variable through the cache
+ *
+ * @return true - if the value was assigned to the variable's binding,
+ *         false - otherwise (the access should be performed through the generic path).
+ */
+bool
+vm_global_cache_put_value (ecma_object_t *global_lex_env_p, /**< Global lexical environment */
+                           lit_cpointer_t lit_cp, /**< compressed pointer to the identifier's literal */
+                           ecma_value_t value) /**< value to assign */
+{
+#ifndef CONFIG_VM_GLOBAL_CACHE_DISABLE
+  ecma_object_t *holder_p = vm_global_cache_get_holder (global_lex_env_p);
+  ecma_property_t *prop_p = vm_global_cache_lookup (holder_p, lit_cp, true);
+
+  if (prop_p == NULL)
+  {
+    return false;
+  }
+
+  ecma_named_data_property_assign_value (holder_p, prop_p, value);
+
+  return true;
+#else /* CONFIG_VM_GLOBAL_CACHE_DISABLE */
+  (void) global_lex_env_p;
+  (void) lit_cp;
+  (void) value;
+
+  return false;
+#endif /* CONFIG_VM_GLOBAL_CACHE_DISABLE */
+} /* vm_global_cache_put_value */
+
+/**
+ * Remove the specified property from the global variables' cache
+ *
+ * Note:
+ *      should be invoked before the property is deleted
+ */
+void
+vm_global_cache_invalidate_property (ecma_property_t *prop_p) /**< named data property */
+{
+  JERRY_ASSERT (ecma_is_property_global_cached (prop_p));
+
+#ifndef CONFIG_VM_GLOBAL_CACHE_DISABLE
+  mem_cpointer_t prop_cp;
+  ECMA_SET_NON_NULL_POINTER (prop_cp, prop_p);
+
+  for (uint32_t i = 0; i < VM_GLOBAL_CACHE_ENTRIES_NUMBER; i++)
+  {
+    if (vm_global_cache_table[i].lit_cp.packed_value != MEM_CP_NULL
+        && vm_global_cache_table[i].prop_cp == prop_cp)
+    {
+      vm_global_cache_table[i].lit_cp.packed_value = MEM_CP_NULL;
+    }
+  }
+#endif /* !CONFIG_VM_GLOBAL_CACHE_DISABLE */
+
+  ecma_set_property_global_cached (prop_p, false);
+} /* vm_global_cache_invalidate_property */
+
+/**
+ * Remove all entries from the global variables' cache
+ */
+void
+vm_global_cache_invalidate_all (void)
+{
+#ifndef CONFIG_VM_GLOBAL_CACHE_DISABLE
+  for (uint32_t i = 0; i < VM_GLOBAL_CACHE_ENTRIES_NUMBER; i++)
+  {
+    if (vm_global_cache_table[i].lit_cp.packed_value != MEM_CP_NULL)
+    {
+      ecma_set_property_global_cached (ECMA_GET_NON_NULL_POINTER (ecma_property_t,
+                                                                  vm_global_cache_table[i].prop_cp),
+                                       false);
+
+      vm_global_cache_table[i].lit_cp.packed_value = MEM_CP_NULL;
+    }
+  }
+#endif /* !CONFIG_VM_GLOBAL_CACHE_DISABLE */
+} /* vm_global_cache_invalidate_all */
+
+/**
+ * @}
+ * @}
+ */
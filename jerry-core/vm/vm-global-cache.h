@@ -0,0 +1,30 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VM_GLOBAL_CACHE_H
+#define VM_GLOBAL_CACHE_H
+
+#include "ecma-globals.h"
+
+extern bool vm_global_cache_get_value (ecma_object_t *global_lex_env_p,
+                                       lit_cpointer_t lit_cp,
+                                       ecma_value_t *out_value_p);
+extern bool vm_global_cache_put_value (ecma_object_t *global_lex_env_p,
+                                       lit_cpointer_t lit_cp,
+                                       ecma_value_t value);
+extern void vm_global_cache_invalidate_property (ecma_property_t *prop_p);
+extern void vm_global_cache_invalidate_all (void);
+
+#endif /* VM_GLOBAL_CACHE_H */
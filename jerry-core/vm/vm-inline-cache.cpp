@@ -0,0 +1,551 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-objects.h"
+#include "ecma-shapes.h"
+#include "jrt-libc-includes.h"
+#include "vm-inline-cache.h"
+
+/** \addtogroup vm Virtual machine
+ * @{
+ *
+ * \addtogroup vminlinecache Inline caches of property access opcodes
+ * @{
+ *
+ * Each 'prop_getter' / 'prop_setter' instruction is associated with an entry of the table,
+ * indexed by the instruction's opcode counter, that holds the object and its named data property,
+ * accessed by the instruction upon previous execution.
+ *
+ * While the instruction accesses properties with the same name of the same object,
+ * the property is taken from the entry without looking up the object's property list or the LCache.
+ *
+ * The entries hold references to the objects, so the objects and their properties can't be freed
+ * by the garbage collector, until the entries are replaced or invalidated (see also: LCache).
+ *
+ * For objects in shaped form, the entries are keyed by the objects' shapes instead, and hold the slot
+ * of the property, so the instruction accessing same property of different objects with same shape
+ * (for example, created by the same constructor) is satisfied by the cache. Such entries hold references
+ * to the shapes, not to the objects.
+ */
+
+#ifndef CONFIG_VM_INLINE_CACHE_DISABLE
+/**
+ * Entry of the inline caches' table
+ */
+typedef struct
+{
+  /** Compressed pointer to the object, or to the object's shape, if is_shape is set
+   *  (ECMA_NULL_POINTER marks entry empty) */
+  mem_cpointer_t object_cp;
+
+  /** Compressed pointer to the object's named data property, or to the shape, that added the property,
+   *  if is_shape is set */
+  mem_cpointer_t prop_cp;
+
+  /** Compressed pointer to the byte-code array, containing the instruction */
+  mem_cpointer_t opcodes_cp;
+
+  /** Opcode counter of the instruction */
+  opcode_counter_t oc;
+
+  /** Flag, indicating whether the entry describes slot of objects in shaped form */
+  bool is_shape;
+} vm_inline_cache_entry_t;
+
+/**
+ * Number of entries in the inline caches' table
+ */
+#define VM_INLINE_CACHE_ENTRIES_NUMBER (1u << CONFIG_VM_INLINE_CACHE_ENTRIES_NUMBER_LOG)
+
+/**
+ * Inline caches' table
+ *
+ * Note:
+ *      instructions with opcode counters, equal modulo the table's size, share an entry
+ */
+static vm_inline_cache_entry_t vm_inline_cache_table[VM_INLINE_CACHE_ENTRIES_NUMBER];
+#endif /* !CONFIG_VM_INLINE_CACHE_DISABLE */
+
+#ifdef MEM_STATS
+/**
+ * Inline caches' statistics
+ */
+typedef struct
+{
+  size_t get_hits; /**< number of property getter lookups, satisfied by the cache */
+  size_t get_misses; /**< number of property getter lookups, not satisfied by the cache */
+  size_t put_hits; /**< number of property setter lookups, satisfied by the cache */
+  size_t put_misses; /**< number of property setter lookups, not satisfied by the cache */
+  size_t invalidations; /**< number of entries invalidated because of deletion of the properties */
+} vm_inline_cache_stats_t;
+
+/**
+ * Inline caches' statistics
+ */
+static vm_inline_cache_stats_t vm_inline_cache_stats;
+
+/**
+ * Flag, indicating whether the statistics should be printed upon finalization of the interpreter
+ */
+static bool vm_inline_cache_stats_enabled = false;
+
+static void vm_inline_cache_stat_count_lookup (bool is_put, bool is_hit);
+
+#  define VM_INLINE_CACHE_STAT_COUNT(counter) vm_inline_cache_stats.counter++
+#  define VM_INLINE_CACHE_STAT_COUNT_LOOKUP(is_put, is_hit) vm_inline_cache_stat_count_lookup (is_put, is_hit)
+#else /* !MEM_STATS */
+#  define VM_INLINE_CACHE_STAT_COUNT(counter)
+#  define VM_INLINE_CACHE_STAT_COUNT_LOOKUP(is_put, is_hit)
+#endif /* !MEM_STATS */
+
+/**
+ * Initialize inline caches
+ */
+void
+vm_inline_cache_init (bool dump_stats) /**< dump statistics upon finalization of the interpreter */
+{
+#ifdef MEM_STATS
+  vm_inline_cache_stats_enabled = dump_stats;
+
+  memset (&vm_inline_cache_stats, 0, sizeof (vm_inline_cache_stats));
+#else /* MEM_STATS */
+  JERRY_ASSERT (!dump_stats);
+#endif /* !MEM_STATS */
+} /* vm_inline_cache_init */
+
+#ifndef CONFIG_VM_INLINE_CACHE_DISABLE
+/**
+ * Invalidate specified entry of the inline caches' table
+ */
+static void
+vm_inline_cache_invalidate_entry (vm_inline_cache_entry_t *entry_p) /**< entry to invalidate */
+{
+  JERRY_ASSERT (entry_p->object_cp != ECMA_NULL_POINTER);
+
+  if (entry_p->is_shape)
+  {
+    ecma_deref_shape (ECMA_GET_NON_NULL_POINTER (ecma_shape_t, entry_p->object_cp));
+  }
+  else
+  {
+    ecma_deref_object (ECMA_GET_NON_NULL_POINTER (ecma_object_t, entry_p->object_cp));
+  }
+
+  entry_p->object_cp = ECMA_NULL_POINTER;
+} /* vm_inline_cache_invalidate_entry */
+
+/**
+ * Check whether properties of the object can be accessed through inline caches
+ *
+ * Note:
+ *      own named data properties of the objects should be accessed by generic [[Get]] / [[Put]]
+ *      (ECMA-262 v5, 8.12.3, 8.12.5), and should not be handled specially
+ *      by the objects' [[GetOwnProperty]] / [[DefineOwnProperty]] operations
+ *
+ * @return true / false
+ */
+static bool
+vm_inline_cache_is_object_cacheable (ecma_object_t *obj_p, /**< object */
+                                     bool is_put) /**< is the access a property setter */
+{
+  switch (ecma_get_object_type (obj_p))
+  {
+    case ECMA_OBJECT_TYPE_GENERAL:
+    case ECMA_OBJECT_TYPE_FUNCTION:
+    case ECMA_OBJECT_TYPE_BOUND_FUNCTION:
+    case ECMA_OBJECT_TYPE_EXTERNAL_FUNCTION:
+    case ECMA_OBJECT_TYPE_BUILT_IN_FUNCTION:
+    {
+      return true;
+    }
+
+    case ECMA_OBJECT_TYPE_ARRAY:
+    {
+      /* [[DefineOwnProperty]] of array objects handles 'length' and array index properties specially */
+      return !is_put;
+    }
+
+    case ECMA_OBJECT_TYPE_STRING:
+    case ECMA_OBJECT_TYPE_ARGUMENTS:
+    {
+      return false;
+    }
+  }
+
+  JERRY_UNREACHABLE ();
+} /* vm_inline_cache_is_object_cacheable */
+
+/**
+ * Lookup entry of the inline caches' table, describing named data property, accessed by 'prop_getter' /
+ * 'prop_setter' instruction, and update the entry upon miss
+ *
+ * @return pointer to the entry, describing the object's own named data property (writable one, if is_put is true),
+ *         that can be read / assigned directly instead of performing [[Get]] / [[Put]] operation,
+ *         NULL - otherwise (the access should be performed through the generic path).
+ */
+static vm_inline_cache_entry_t*
+vm_inline_cache_lookup (const opcode_t *opcodes_p, /**< byte-code array */
+                        opcode_counter_t oc, /**< opcode counter of the instruction */
+                        ecma_object_t *obj_p, /**< base object of the access */
+                        ecma_string_t *prop_name_p, /**< property name */
+                        bool is_put) /**< is the access a property setter */
+{
+  JERRY_ASSERT (obj_p != NULL && !ecma_is_lexical_environment (obj_p));
+
+  vm_inline_cache_entry_t *entry_p = &vm_inline_cache_table[oc & (VM_INLINE_CACHE_ENTRIES_NUMBER - 1)];
+
+  const bool is_shaped = ecma_get_object_is_shaped (obj_p);
+
+  mem_cpointer_t object_cp, opcodes_cp;
+  MEM_CP_SET_NON_NULL_POINTER (opcodes_cp, opcodes_p);
+
+  if (is_shaped)
+  {
+    ecma_shaped_values_t *shaped_values_p = ecma_get_object_shaped_values (obj_p);
+
+    if (shaped_values_p == NULL)
+    {
+      /* the object has no properties */
+      VM_INLINE_CACHE_STAT_COUNT_LOOKUP (is_put, false);
+
+      return NULL;
+    }
+
+    object_cp = shaped_values_p->shape_cp;
+  }
+  else
+  {
+    ECMA_SET_NON_NULL_POINTER (object_cp, obj_p);
+  }
+
+  if (entry_p->object_cp == object_cp
+      && entry_p->is_shape == is_shaped
+      && entry_p->oc == oc
+      && entry_p->opcodes_cp == opcodes_cp)
+  {
+    ecma_string_t *entry_prop_name_p;
+    bool is_writable;
+
+    if (is_shaped)
+    {
+      /* properties, stored in slots, are always writable */
+      entry_prop_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t,
+                                                     ECMA_GET_NON_NULL_POINTER (ecma_shape_t,
+                                                                                entry_p->prop_cp)->name_cp);
+      is_writable = true;
+    }
+    else
+    {
+      ecma_property_t *prop_p = ECMA_GET_NON_NULL_POINTER (ecma_property_t, entry_p->prop_cp);
+
+      JERRY_ASSERT (prop_p->type == ECMA_PROPERTY_NAMEDDATA && ecma_is_property_inline_cached (prop_p));
+
+      entry_prop_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, prop_p->u.named_data_property.name_p);
+      is_writable = ecma_is_property_writable (prop_p);
+    }
+
+    if (ecma_compare_ecma_strings (entry_prop_name_p, prop_name_p)
+        && (!is_put || is_writable))
+    {
+      VM_INLINE_CACHE_STAT_COUNT_LOOKUP (is_put, true);
+
+      return entry_p;
+    }
+  }
+
+  VM_INLINE_CACHE_STAT_COUNT_LOOKUP (is_put, false);
+
+  if (!vm_inline_cache_is_object_cacheable (obj_p, is_put))
+  {
+    return NULL;
+  }
+
+  mem_cpointer_t prop_cp;
+
+  if (is_shaped)
+  {
+    /* [[GetOwnProperty]] would convert the object to property list form, so the shape is looked up instead */
+    ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, object_cp);
+    ecma_shape_t *prop_shape_p = ecma_shape_find_property (shape_p, prop_name_p);
+
+    if (prop_shape_p == NULL)
+    {
+      return NULL;
+    }
+
+    if (entry_p->object_cp != ECMA_NULL_POINTER)
+    {
+      vm_inline_cache_invalidate_entry (entry_p);
+    }
+
+    ecma_ref_shape (shape_p);
+
+    ECMA_SET_NON_NULL_POINTER (prop_cp, prop_shape_p);
+  }
+  else
+  {
+    uint32_t index;
+
+    if (ecma_get_object_fast_elements (obj_p) != NULL
+        && ecma_string_get_array_index (prop_name_p, &index))
+    {
+      /* [[GetOwnProperty]] would convert the array to property list form, and the elements are accessed fast anyway */
+      return NULL;
+    }
+
+    ecma_property_t *prop_p = ecma_op_object_get_own_property (obj_p, prop_name_p);
+
+    if (prop_p == NULL
+        || prop_p->type != ECMA_PROPERTY_NAMEDDATA
+        || (is_put && !ecma_is_property_writable (prop_p)))
+    {
+      return NULL;
+    }
+
+    if (entry_p->object_cp != ECMA_NULL_POINTER)
+    {
+      vm_inline_cache_invalidate_entry (entry_p);
+    }
+
+    ecma_ref_object (obj_p);
+    ecma_set_property_inline_cached (prop_p, true);
+
+    ECMA_SET_NON_NULL_POINTER (prop_cp, prop_p);
+  }
+
+  entry_p->object_cp = object_cp;
+  entry_p->prop_cp = prop_cp;
+  entry_p->opcodes_cp = opcodes_cp;
+  entry_p->oc = oc;
+  entry_p->is_shape = is_shaped;
+
+  return entry_p;
+} /* vm_inline_cache_lookup */
+#endif /* !CONFIG_VM_INLINE_CACHE_DISABLE */
+
+/**
+ * Get value of named data property, accessed by 'prop_getter' instruction, through the instruction's
+ * inline cache, updating the cache upon miss
+ *
+ * @return true - if the value is got from the object's own named data property (out_value_p is set
+ *                to the value, that is not copied),
+ *         false - otherwise (the access should be performed through generic [[Get]]).
+ */
+bool
+vm_inline_cache_get (const opcode_t *opcodes_p, /**< byte-code array */
+                     opcode_counter_t oc, /**< opcode counter of the instruction */
+                     ecma_object_t *obj_p, /**< base object of the access */
+                     ecma_string_t *prop_name_p, /**< property name */
+                     ecma_value_t *out_value_p) /**< out: value of the property */
+{
+#ifndef CONFIG_VM_INLINE_CACHE_DISABLE
+  vm_inline_cache_entry_t *entry_p = vm_inline_cache_lookup (opcodes_p, oc, obj_p, prop_name_p, false);
+
+  if (entry_p == NULL)
+  {
+    return false;
+  }
+
+  if (entry_p->is_shape)
+  {
+    const ecma_length_t slot = ecma_shape_get_slot (ECMA_GET_NON_NULL_POINTER (ecma_shape_t, entry_p->prop_cp));
+
+    *out_value_p = ecma_shaped_object_get_value (obj_p, slot);
+  }
+  else
+  {
+    *out_value_p = ecma_get_named_data_property_value (ECMA_GET_NON_NULL_POINTER (ecma_property_t,
+                                                                                  entry_p->prop_cp));
+  }
+
+  return true;
+#else /* CONFIG_VM_INLINE_CACHE_DISABLE */
+  (void) opcodes_p;
+  (void) oc;
+  (void) obj_p;
+  (void) prop_name_p;
+  (void) out_value_p;
+
+  return false;
+#endif /* CONFIG_VM_INLINE_CACHE_DISABLE */
+} /* vm_inline_cache_get */
+
+/**
+ * Assign value to named data property, accessed by 'prop_setter' instruction, through the instruction's
+ * inline cache, updating the cache upon miss
+ *
+ * @return true - if the value is assigned to the object's own writable named data property,
+ *         false - otherwise (the access should be performed through generic [[Put]]).
+ */
+bool
+vm_inline_cache_put (const opcode_t *opcodes_p, /**< byte-code array */
+                     opcode_counter_t oc, /**< opcode counter of the instruction */
+                     ecma_object_t *obj_p, /**< base object of the access */
+                     ecma_string_t *prop_name_p, /**< property name */
+                     ecma_value_t value) /**< value to assign */
+{
+#ifndef CONFIG_VM_INLINE_CACHE_DISABLE
+  vm_inline_cache_entry_t *entry_p = vm_inline_cache_lookup (opcodes_p, oc, obj_p, prop_name_p, true);
+
+  if (entry_p == NULL)
+  {
+    return false;
+  }
+
+  /* the property is own writable named data property, so [[Put]] is reduced to assignment of the value */
+  if (entry_p->is_shape)
+  {
+    const ecma_length_t slot = ecma_shape_get_slot (ECMA_GET_NON_NULL_POINTER (ecma_shape_t, entry_p->prop_cp));
+
+    ecma_shaped_object_assign_value (obj_p, slot, value);
+  }
+  else
+  {
+    ecma_named_data_property_assign_value (obj_p,
+                                           ECMA_GET_NON_NULL_POINTER (ecma_property_t, entry_p->prop_cp),
+                                           value);
+  }
+
+  return true;
+#else /* CONFIG_VM_INLINE_CACHE_DISABLE */
+  (void) opcodes_p;
+  (void) oc;
+  (void) obj_p;
+  (void) prop_name_p;
+  (void) value;
+
+  return false;
+#endif /* CONFIG_VM_INLINE_CACHE_DISABLE */
+} /* vm_inline_cache_put */
+
+/**
+ * Invalidate entries of inline caches, that refer to the specified property
+ *
+ * Note:
+ *      should be invoked before the property is deleted
+ */
+void
+vm_inline_cache_invalidate_property (ecma_property_t *prop_p) /**< named data property */
+{
+  JERRY_ASSERT (ecma_is_property_inline_cached (prop_p));
+
+#ifndef CONFIG_VM_INLINE_CACHE_DISABLE
+  mem_cpointer_t prop_cp;
+  ECMA_SET_NON_NULL_POINTER (prop_cp, prop_p);
+
+  for (uint32_t i = 0; i < VM_INLINE_CACHE_ENTRIES_NUMBER; i++)
+  {
+    if (vm_inline_cache_table[i].object_cp != ECMA_NULL_POINTER
+        && !vm_inline_cache_table[i].is_shape
+        && vm_inline_cache_table[i].prop_cp == prop_cp)
+    {
+      vm_inline_cache_invalidate_entry (&vm_inline_cache_table[i]);
+
+      VM_INLINE_CACHE_STAT_COUNT (invalidations);
+    }
+  }
+#endif /* !CONFIG_VM_INLINE_CACHE_DISABLE */
+
+  ecma_set_property_inline_cached (prop_p, false);
+} /* vm_inline_cache_invalidate_property */
+
+/**
+ * Invalidate all entries of inline caches
+ */
+void
+vm_inline_cache_invalidate_all (void)
+{
+#ifndef CONFIG_VM_INLINE_CACHE_DISABLE
+  for (uint32_t i = 0; i < VM_INLINE_CACHE_ENTRIES_NUMBER; i++)
+  {
+    if (vm_inline_cache_table[i].object_cp != ECMA_NULL_POINTER)
+    {
+      if (!vm_inline_cache_table[i].is_shape)
+      {
+        ecma_set_property_inline_cached (ECMA_GET_NON_NULL_POINTER (ecma_property_t,
+                                                                    vm_inline_cache_table[i].prop_cp),
+                                         false);
+      }
+
+      vm_inline_cache_invalidate_entry (&vm_inline_cache_table[i]);
+    }
+  }
+#endif /* !CONFIG_VM_INLINE_CACHE_DISABLE */
+} /* vm_inline_cache_invalidate_all */
+
+#ifdef MEM_STATS
+/**
+ * Account lookup in the inline caches' statistics
+ */
+static void
+vm_inline_cache_stat_count_lookup (bool is_put, /**< is the access a property setter */
+                                   bool is_hit) /**< is the lookup satisfied by the cache */
+{
+  if (is_put)
+  {
+    if (is_hit)
+    {
+      vm_inline_cache_stats.put_hits++;
+    }
+    else
+    {
+      vm_inline_cache_stats.put_misses++;
+    }
+  }
+  else
+  {
+    if (is_hit)
+    {
+      vm_inline_cache_stats.get_hits++;
+    }
+    else
+    {
+      vm_inline_cache_stats.get_misses++;
+    }
+  }
+} /* vm_inline_cache_stat_count_lookup */
+
+/**
+ * Print inline caches' statistics
+ */
+void
+vm_inline_cache_stats_print (void)
+{
+  if (!vm_inline_cache_stats_enabled)
+  {
+    return;
+  }
+
+  printf ("Inline cache stats:\n");
+  printf ("  Property getter hits = %zu\n"
+          "  Property getter misses = %zu\n"
+          "  Property setter hits = %zu\n"
+          "  Property setter misses = %zu\n"
+          "  Entries invalidated upon property deletion = %zu\n",
+          vm_inline_cache_stats.get_hits,
+          vm_inline_cache_stats.get_misses,
+          vm_inline_cache_stats.put_hits,
+          vm_inline_cache_stats.put_misses,
+          vm_inline_cache_stats.invalidations);
+} /* vm_inline_cache_stats_print */
+#endif /* MEM_STATS */
+
+/**
+ * @}
+ * @}
+ */
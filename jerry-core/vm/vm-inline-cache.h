@@ -0,0 +1,40 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VM_INLINE_CACHE_H
+#define VM_INLINE_CACHE_H
+
+#include "ecma-globals.h"
+#include "opcodes.h"
+
+extern void vm_inline_cache_init (bool dump_stats);
+extern bool vm_inline_cache_get (const opcode_t *opcodes_p,
+                                 opcode_counter_t oc,
+                                 ecma_object_t *obj_p,
+                                 ecma_string_t *prop_name_p,
+                                 ecma_value_t *out_value_p);
+extern bool vm_inline_cache_put (const opcode_t *opcodes_p,
+                                 opcode_counter_t oc,
+                                 ecma_object_t *obj_p,
+                                 ecma_string_t *prop_name_p,
+                                 ecma_value_t value);
+extern void vm_inline_cache_invalidate_property (ecma_property_t *prop_p);
+extern void vm_inline_cache_invalidate_all (void);
+
+#ifdef MEM_STATS
+extern void vm_inline_cache_stats_print (void);
+#endif /* MEM_STATS */
+
+#endif /* VM_INLINE_CACHE_H */
@@ -22,8 +22,10 @@
 #include "ecma-stack.h"
 #include "jrt.h"
 #include "vm.h"
+#include "vm-inline-cache.h"
 #include "jrt-libc-includes.h"
 #include "mem-allocator.h"
+#include "serializer.h"
 
 /**
  * Top (current) interpreter context
@@ -39,6 +41,16 @@ static const opfunc __opfuncs[LAST_OP] =
 
 JERRY_STATIC_ASSERT (sizeof (opcode_t) <= 4);
 
+/**
+ * Threaded dispatch is used, unless it is disabled, or actions should be performed around each opcode
+ * (in the case, the table dispatch is used)
+ */
+#if !defined (CONFIG_VM_COMPUTED_GOTO_DISABLE) \
+    && !defined (MEM_STATS) \
+    && !defined (CONFIG_VM_RUN_GC_AFTER_EACH_OPCODE)
+# define VM_COMPUTED_GOTO_DISPATCH
+#endif /* !CONFIG_VM_COMPUTED_GOTO_DISABLE && !MEM_STATS && !CONFIG_VM_RUN_GC_AFTER_EACH_OPCODE */
+
 const opcode_t *__program = NULL;
 
 #ifdef MEM_STATS
@@ -54,6 +66,23 @@ static const char *__op_names[LAST_OP] =
 static uint32_t interp_mem_stats_print_indentation = 0;
 static bool interp_mem_stats_enabled = false;
 
+/**
+ * Number of the most frequent opcode pairs, printed in the opcode pair statistics
+ */
+#define INTERP_OPCODE_PAIR_STATS_PRINT_MAX (32)
+
+static bool interp_opcode_pair_stats_enabled = false;
+
+/**
+ * Counters of pairs of consecutively executed opcodes, indexed by indices of the first and the second opcodes
+ */
+static uint32_t interp_opcode_pair_counters[LAST_OP][LAST_OP];
+
+/**
+ * Index of previously executed opcode, or LAST_OP - if no opcode was executed yet
+ */
+static uint32_t interp_opcode_pair_prev_op_idx = LAST_OP;
+
 static void
 interp_mem_stats_print_legend (void)
 {
@@ -331,6 +360,92 @@ interp_mem_stats_opcode_exit (int_data_t *int_data_p,
   printf ("%s-- End of execution of opcode %s (position %u) --\n\n",
           indent_prefix, __op_names[opcode.op_idx], opcode_position);
 }
+
+/**
+ * Account pair of previously executed opcode and the opcode, which execution is started
+ */
+static void
+interp_opcode_pair_stats_count (idx_t op_idx) /**< index of the opcode */
+{
+  if (likely (!interp_opcode_pair_stats_enabled))
+  {
+    return;
+  }
+
+  JERRY_ASSERT (op_idx < LAST_OP);
+
+  if (interp_opcode_pair_prev_op_idx != LAST_OP)
+  {
+    interp_opcode_pair_counters[interp_opcode_pair_prev_op_idx][op_idx]++;
+  }
+
+  interp_opcode_pair_prev_op_idx = op_idx;
+} /* interp_opcode_pair_stats_count */
+
+/**
+ * Print the most frequent pairs of consecutively executed opcodes
+ */
+static void
+interp_opcode_pair_stats_print (void)
+{
+  if (likely (!interp_opcode_pair_stats_enabled))
+  {
+    return;
+  }
+
+  uint64_t total_pairs = 0;
+
+  for (uint32_t first_idx = 0; first_idx < LAST_OP; first_idx++)
+  {
+    for (uint32_t second_idx = 0; second_idx < LAST_OP; second_idx++)
+    {
+      total_pairs += interp_opcode_pair_counters[first_idx][second_idx];
+    }
+  }
+
+  printf ("----- Most frequent opcode pairs (count, percentage of %llu executed pairs) -----\n",
+          (unsigned long long) total_pairs);
+
+  for (uint32_t i = 0; i < INTERP_OPCODE_PAIR_STATS_PRINT_MAX; i++)
+  {
+    uint32_t max_first_idx = 0, max_second_idx = 0;
+
+    for (uint32_t first_idx = 0; first_idx < LAST_OP; first_idx++)
+    {
+      for (uint32_t second_idx = 0; second_idx < LAST_OP; second_idx++)
+      {
+        if (interp_opcode_pair_counters[first_idx][second_idx]
+            > interp_opcode_pair_counters[max_first_idx][max_second_idx])
+        {
+          max_first_idx = first_idx;
+          max_second_idx = second_idx;
+        }
+      }
+    }
+
+    const uint32_t count = interp_opcode_pair_counters[max_first_idx][max_second_idx];
+
+    if (count == 0)
+    {
+      break;
+    }
+
+    /* hundredths of percent */
+    const uint32_t share = (uint32_t) (count * 10000ull / total_pairs);
+
+    printf ("%10u  %3u.%02u%%  %s -> %s\n",
+            count,
+            share / 100u,
+            share % 100u,
+            __op_names[max_first_idx],
+            __op_names[max_second_idx]);
+
+    /* the pair is printed, so it is excluded from further search */
+    interp_opcode_pair_counters[max_first_idx][max_second_idx] = 0;
+  }
+
+  printf ("\n");
+} /* interp_opcode_pair_stats_print */
 #endif /* MEM_STATS */
 
 /**
@@ -338,14 +453,23 @@ interp_mem_stats_opcode_exit (int_data_t *int_data_p,
  */
 void
 vm_init (const opcode_t *program_p, /**< pointer to byte-code program */
-         bool dump_mem_stats) /** dump per-opcode memory usage change statistics */
+         bool dump_mem_stats, /**< dump per-opcode memory usage change statistics */
+         bool dump_opcode_pair_stats, /**< dump histogram of pairs of consecutively executed opcodes */
+         bool dump_inline_cache_stats) /**< dump statistics of inline caches' hits and misses */
 {
 #ifdef MEM_STATS
   interp_mem_stats_enabled = dump_mem_stats;
+  interp_opcode_pair_stats_enabled = dump_opcode_pair_stats;
+
+  memset (interp_opcode_pair_counters, 0, sizeof (interp_opcode_pair_counters));
+  interp_opcode_pair_prev_op_idx = LAST_OP;
 #else /* MEM_STATS */
   JERRY_ASSERT (!dump_mem_stats);
+  JERRY_ASSERT (!dump_opcode_pair_stats);
 #endif /* !MEM_STATS */
 
+  vm_inline_cache_init (dump_inline_cache_stats);
+
   JERRY_ASSERT (__program == NULL);
 
   __program = program_p;
@@ -357,6 +481,11 @@ vm_init (const opcode_t *program_p, /**< pointer to byte-code program */
 void
 vm_finalize (void)
 {
+#ifdef MEM_STATS
+  interp_opcode_pair_stats_print ();
+  vm_inline_cache_stats_print ();
+#endif /* MEM_STATS */
+
   __program = NULL;
 } /* vm_finalize */
 
@@ -425,6 +554,11 @@ vm_run_global (void)
  * Note:
  *      The interpreter loop stops upon receiving completion value that is normal completion value.
  *
+ *      With threaded dispatch (VM_COMPUTED_GOTO_DISPATCH), handler of each opcode is followed
+ *      by its own dispatch of the next opcode, which is performed if the handler returned
+ *      normal empty completion value, and only other completion values are processed
+ *      at end of the loop's iteration.
+ *
  * @return If the received completion value is not meta completion value (ECMA_COMPLETION_TYPE_META), then
  *          the completion value is returned as is;
  *         Otherwise - the completion value is discarded and normal empty completion value is returned.
@@ -444,8 +578,42 @@ vm_loop (int_data_t *int_data_p, /**< interpreter context */
   memset (&pools_stats_before, 0, sizeof (pools_stats_before));
 #endif /* MEM_STATS */
 
+#ifdef VM_COMPUTED_GOTO_DISPATCH
+#define __OP_HANDLER_LABEL_ADDRESS(name, arg1, arg2, arg3) __extension__ &&opcode_handler_##name,
+  static const void * const opcode_handlers_labels[LAST_OP] =
+  {
+    OP_LIST (OP_HANDLER_LABEL_ADDRESS)
+  };
+#undef __OP_HANDLER_LABEL_ADDRESS
+
+  const ecma_completion_value_t empty_completion = ecma_make_empty_completion_value ();
+
+#define VM_DISPATCH() \
+  JERRY_ASSERT (run_scope_p == NULL \
+                || (run_scope_p->start_oc <= int_data_p->pos \
+                    && int_data_p->pos <= run_scope_p->end_oc)); \
+  __extension__ ({ goto *opcode_handlers_labels[int_data_p->opcodes_p[int_data_p->pos].op_idx]; })
+
+#define __OP_HANDLER(name, arg1, arg2, arg3) \
+opcode_handler_##name: \
+  completion = opfunc_##name (int_data_p->opcodes_p[int_data_p->pos], int_data_p); \
+  if (likely (completion == empty_completion)) \
+  { \
+    VM_DISPATCH (); \
+  } \
+  goto opcode_completion;
+#endif /* VM_COMPUTED_GOTO_DISPATCH */
+
   while (true)
   {
+#ifdef VM_COMPUTED_GOTO_DISPATCH
+    VM_DISPATCH ();
+
+    OP_LIST (OP_HANDLER)
+
+opcode_completion:
+    JERRY_ASSERT (!ecma_is_completion_value_normal (completion));
+#else /* VM_COMPUTED_GOTO_DISPATCH */
     do
     {
       JERRY_ASSERT (run_scope_p == NULL
@@ -461,6 +629,7 @@ vm_loop (int_data_t *int_data_p, /**< interpreter context */
                                      opcode_pos,
                                      &heap_stats_before,
                                      &pools_stats_before);
+      interp_opcode_pair_stats_count (curr->op_idx);
 #endif /* MEM_STATS */
 
       completion = __opfuncs[curr->op_idx] (*curr, int_data_p);
@@ -480,6 +649,7 @@ vm_loop (int_data_t *int_data_p, /**< interpreter context */
                     || ecma_is_completion_value_empty (completion));
     }
     while (ecma_is_completion_value_normal (completion));
+#endif /* !VM_COMPUTED_GOTO_DISPATCH */
 
     if (ecma_is_completion_value_jump (completion))
     {
@@ -507,6 +677,11 @@ vm_loop (int_data_t *int_data_p, /**< interpreter context */
 
     return completion;
   }
+
+#ifdef VM_COMPUTED_GOTO_DISPATCH
+#undef __OP_HANDLER
+#undef VM_DISPATCH
+#endif /* VM_COMPUTED_GOTO_DISPATCH */
 } /* vm_loop */
 
 /**
@@ -531,8 +706,6 @@ vm_run_from_pos (const opcode_t *opcodes_p, /**< byte-code array */
 
   const int32_t regs_num = max_reg_num - min_reg_num + 1;
 
-  MEM_DEFINE_LOCAL_ARRAY (regs, regs_num, ecma_value_t);
-
   int_data_t int_data;
   int_data.opcodes_p = opcodes_p;
   int_data.pos = (opcode_counter_t) (start_pos + 1);
@@ -544,7 +717,7 @@ vm_run_from_pos (const opcode_t *opcodes_p, /**< byte-code array */
   int_data.min_reg_num = min_reg_num;
   int_data.max_reg_num = max_reg_num;
   int_data.tmp_num_p = ecma_alloc_number ();
-  ecma_stack_add_frame (&int_data.stack_frame, regs, regs_num);
+  ecma_stack_add_frame (&int_data.stack_frame, regs_num);
 
   int_data_t *prev_context_p = vm_top_context_p;
   vm_top_context_p = &int_data;
@@ -568,8 +741,6 @@ vm_run_from_pos (const opcode_t *opcodes_p, /**< byte-code array */
   interp_mem_stats_context_exit (&int_data, start_pos);
 #endif /* MEM_STATS */
 
-  MEM_FINALIZE_LOCAL_ARRAY (regs);
-
   return completion;
 } /* vm_run_from_pos */
 
@@ -598,6 +769,48 @@ vm_get_scope_flags (const opcode_t *opcodes_p, /**< byte-code array */
   return (opcode_scope_code_flags_t) flags_opcode.data.meta.data_1;
 } /* vm_get_scope_flags */
 
+/**
+ * Get name of next variable or function, declared at beginning of a function's code
+ *
+ * Note:
+ *      'var_decl' instructions, followed by 'func_decl_n' instructions of the function's
+ *      nested function declarations, are placed right after the function's 'reg_var_decl' instruction.
+ *
+ * @return compressed pointer to literal with the name - if there is a declaration at the position,
+ *         null compressed pointer - otherwise.
+ */
+lit_cpointer_t
+vm_get_next_declared_name (const opcode_t *opcodes_p, /**< byte-code array */
+                           opcode_counter_t *oc_p) /**< in: position of the declaration
+                                                    *       (initially - position, following 'reg_var_decl')
+                                                    *   out: position of next declaration */
+{
+  const opcode_counter_t oc = *oc_p;
+  const opcode_t opcode = vm_get_opcode (opcodes_p, oc);
+
+  if (opcode.op_idx == __op__idx_var_decl)
+  {
+    *oc_p = (opcode_counter_t) (oc + 1);
+
+    return serializer_get_literal_cp_by_uid (opcode.data.var_decl.variable_name, opcodes_p, oc);
+  }
+  else if (opcode.op_idx == __op__idx_func_decl_n)
+  {
+    const opcode_counter_t function_end_meta_oc = (opcode_counter_t) (oc + 1 + opcode.data.func_decl_n.arg_list);
+    const opcode_t function_end_meta = vm_get_opcode (opcodes_p, function_end_meta_oc);
+    JERRY_ASSERT (function_end_meta.op_idx == __op__idx_meta
+                  && function_end_meta.data.meta.type == OPCODE_META_TYPE_FUNCTION_END);
+
+    *oc_p = (opcode_counter_t) (function_end_meta_oc
+                                + calc_opcode_counter_from_idx_idx (function_end_meta.data.meta.data_1,
+                                                                    function_end_meta.data.meta.data_2));
+
+    return serializer_get_literal_cp_by_uid (opcode.data.func_decl_n.name_lit_idx, opcodes_p, oc);
+  }
+
+  return lit_cpointer_t::null_cp ();
+} /* vm_get_next_declared_name */
+
 /**
  * Check whether currently executed code is strict mode code
  *
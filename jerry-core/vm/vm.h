@@ -20,7 +20,10 @@
 #include "jrt.h"
 #include "opcodes.h"
 
-extern void vm_init (const opcode_t* program_p, bool dump_mem_stats);
+extern void vm_init (const opcode_t* program_p,
+                     bool dump_mem_stats,
+                     bool dump_opcode_pair_stats,
+                     bool dump_inline_cache_stats);
 extern void vm_finalize (void);
 extern jerry_completion_code_t vm_run_global (void);
 extern ecma_completion_value_t vm_loop (int_data_t *int_data, vm_run_scope_t *run_scope_p);
@@ -33,6 +36,7 @@ extern ecma_completion_value_t vm_run_from_pos (const opcode_t *opcodes_p,
 
 extern opcode_t vm_get_opcode (const opcode_t*, opcode_counter_t counter);
 extern opcode_scope_code_flags_t vm_get_scope_flags (const opcode_t*, opcode_counter_t counter);
+extern lit_cpointer_t vm_get_next_declared_name (const opcode_t *opcodes_p, opcode_counter_t *oc_p);
 
 extern bool vm_is_strict_mode (void);
 extern bool vm_is_direct_eval_form_call (void);
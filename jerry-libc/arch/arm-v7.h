@@ -80,6 +80,31 @@
   \
   pop {r4-r12, pc};
 
+/*
+ * mov syscall_no (%r0) -> %r7
+ * mov arg1 (%r1) -> %r0
+ * mov arg2 (%r2) -> %r1
+ * mov arg3 (%r3) -> %r2
+ * ldr arg4 ([sp + 0x28]) -> %r3
+ * ldr arg5 ([sp + 0x2c]) -> %r4
+ * ldr arg6 ([sp + 0x30]) -> %r5
+ * svc #0
+ */
+#define SYSCALL_6 \
+  push {r4-r12, lr}; \
+  \
+  mov r7, r0; \
+  mov r0, r1; \
+  mov r1, r2; \
+  mov r2, r3; \
+  ldr r3, [sp, #0x28]; \
+  ldr r4, [sp, #0x2c]; \
+  ldr r5, [sp, #0x30]; \
+  \
+  svc #0; \
+  \
+  pop {r4-r12, pc};
+
 /*
  * ldr argc ([sp + 0x0]) -> r0
  * add argv (sp + 0x4) -> r1
@@ -92,6 +92,36 @@
   pop %edi;               \
   ret;
 
+/*
+ * mov syscall_no -> %eax
+ * mov arg1 -> %ebx
+ * mov arg2 -> %ecx
+ * mov arg3 -> %edx
+ * mov arg4 -> %esi
+ * mov arg5 -> %edi
+ * mov arg6 -> %ebp
+ * int $0x80
+ * mov %eax -> ret
+ */
+#define SYSCALL_6 \
+  push %ebp;               \
+  push %edi;               \
+  push %esi;               \
+  push %ebx;               \
+  mov 0x14 (%esp), %eax;   \
+  mov 0x18 (%esp), %ebx;   \
+  mov 0x1c (%esp), %ecx;   \
+  mov 0x20 (%esp), %edx;   \
+  mov 0x24 (%esp), %esi;   \
+  mov 0x28 (%esp), %edi;   \
+  mov 0x2c (%esp), %ebp;   \
+  int $0x80;               \
+  pop %ebx;                \
+  pop %esi;                \
+  pop %edi;                \
+  pop %ebp;                \
+  ret;
+
 /*
  * push argv (%esp + 4)
  * push argc ([%esp + 0x4])
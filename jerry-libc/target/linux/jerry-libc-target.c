@@ -25,7 +25,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <syscall.h>
+#include <sys/mman.h>
 #include <sys/resource.h>
+#include <sys/time.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 
@@ -51,6 +53,8 @@ extern long int syscall_0_asm (long int syscall_no);
 extern long int syscall_1_asm (long int syscall_no, long int arg1);
 extern long int syscall_2_asm (long int syscall_no, long int arg1, long int arg2);
 extern long int syscall_3_asm (long int syscall_no, long int arg1, long int arg2, long int arg3);
+extern long int syscall_6_asm (long int syscall_no, long int arg1, long int arg2, long int arg3,
+                               long int arg4, long int arg5, long int arg6);
 
 /**
  * System call with no argument.
@@ -384,6 +388,74 @@ fwrite (const void *ptr, /**< data to write */
   return bytes_written / size;
 } /* fwrite */
 
+/**
+ * Get current time of day
+ *
+ * @return 0 - upon successful completion
+ */
+int
+gettimeofday (struct timeval *tp, /**< out: current time */
+              void *tzp) /**< out: timezone information (obsolete, should be NULL) */
+{
+  return (int) syscall_2 (__NR_gettimeofday, (long int) tp, (long int) tzp);
+} /* gettimeofday */
+
+/**
+ * Map pages of memory
+ *
+ * Note:
+ *      mmap's return value is an address, so, unlike other system calls,
+ *      it is checked for error codes range, instead of being checked for sign.
+ *
+ * @return address of the mapped area - upon successful completion,
+ *         MAP_FAILED - otherwise.
+ */
+void *
+mmap (void *addr, /**< hint for address of the mapping */
+      size_t length, /**< length of the mapping */
+      int prot, /**< memory protection of the mapping */
+      int flags, /**< mapping flags */
+      int fd, /**< file descriptor */
+      off_t offset) /**< offset in the file */
+{
+#ifdef __NR_mmap2
+  long int ret = syscall_6_asm (__NR_mmap2,
+                                (long int) addr,
+                                (long int) length,
+                                prot,
+                                flags,
+                                fd,
+                                (long int) (offset / 4096));
+#else /* !__NR_mmap2 */
+  long int ret = syscall_6_asm (__NR_mmap,
+                                (long int) addr,
+                                (long int) length,
+                                prot,
+                                flags,
+                                fd,
+                                (long int) offset);
+#endif /* !__NR_mmap2 */
+
+  if ((unsigned long int) ret > (unsigned long int) -4096)
+  {
+    return MAP_FAILED;
+  }
+
+  return (void *) ret;
+} /* mmap */
+
+/**
+ * Unmap pages of memory
+ *
+ * @return 0 - upon successful completion
+ */
+int
+munmap (void *addr, /**< address of the mapping */
+        size_t length) /**< length of the mapping */
+{
+  return (int) syscall_2 (__NR_munmap, (long int) addr, (long int) length);
+} /* munmap */
+
 // FIXME
 #if 0
 /**
@@ -220,6 +220,26 @@ main (int argc,
     {
       flags |= JERRY_FLAG_ABORT_ON_FAIL;
     }
+    else if (!strcmp ("--gc-incremental", argv[i]))
+    {
+      flags |= JERRY_FLAG_GC_INCREMENTAL;
+    }
+    else if (!strcmp ("--gc-proactive", argv[i]))
+    {
+      flags |= JERRY_FLAG_GC_PROACTIVE;
+    }
+    else if (!strcmp ("--gc-generational", argv[i]))
+    {
+      flags |= JERRY_FLAG_GC_GENERATIONAL;
+    }
+    else if (!strcmp ("--opcode-pair-stats", argv[i]))
+    {
+      flags |= JERRY_FLAG_OPCODE_PAIR_STATS;
+    }
+    else if (!strcmp ("--inline-cache-stats", argv[i]))
+    {
+      flags |= JERRY_FLAG_INLINE_CACHE_STATS;
+    }
     else
     {
       file_names[files_counter++] = argv[i];
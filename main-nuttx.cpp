@@ -171,6 +171,18 @@ int jerry_main (int argc, char *argv[])
     {
       flags |= JERRY_FLAG_ABORT_ON_FAIL;
     }
+    else if (!strcmp ("--gc-incremental", argv[i]))
+    {
+      flags |= JERRY_FLAG_GC_INCREMENTAL;
+    }
+    else if (!strcmp ("--gc-proactive", argv[i]))
+    {
+      flags |= JERRY_FLAG_GC_PROACTIVE;
+    }
+    else if (!strcmp ("--gc-generational", argv[i]))
+    {
+      flags |= JERRY_FLAG_GC_GENERATIONAL;
+    }
     else
     {
       file_names[files_counter++] = argv[i];
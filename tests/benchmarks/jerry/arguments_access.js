@@ -0,0 +1,43 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Variadic functions read and update their arguments through the Arguments object on every call.
+
+function sum ()
+{
+  var s = 0;
+  for (var i = 0; i < arguments.length; i++)
+  {
+    s += arguments[i];
+  }
+  return s;
+}
+
+function swap (a, b)
+{
+  var t = arguments[0];
+  arguments[0] = arguments[1];
+  arguments[1] = t;
+  return a - b;
+}
+
+var total = 0;
+
+for (var i = 0; i < 100000; i++)
+{
+  total += sum (i, 1, 2, 3);
+  total += swap (1, 2);
+}
+
+assert (total === 100000 * (6 + 1) + 99999 * 100000 / 2);
@@ -0,0 +1,52 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+// Dense arrays are filled with push, indexed in loops, searched with indexOf and drained with pop.
+
+var size = 2000;
+var arr = [];
+
+for (var i = 0; i < size; i++)
+{
+  arr.push (i);
+}
+
+var sum = 0;
+
+for (var round = 0; round < 50; round++)
+{
+  for (var i = 0; i < size; i++)
+  {
+    arr[i] = arr[i] + 1;
+    sum += arr[i];
+  }
+}
+
+assert (sum === 50 * size * (size - 1) / 2 + size * 50 * 51 / 2);
+
+var found = 0;
+
+for (var i = 0; i < 100; i++)
+{
+  found += arr.indexOf (i * 20 + 50);
+}
+
+assert (found === 100 * 99 / 2 * 20);
+
+while (arr.length > 0)
+{
+  arr.pop ();
+}
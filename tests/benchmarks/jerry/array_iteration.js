@@ -0,0 +1,42 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Dense arrays are traversed with the iteration routines of Array.prototype.
+
+var size = 2000;
+var arr = [];
+
+for (var i = 0; i < size; i++)
+{
+  arr.push (i);
+}
+
+var sum = 0;
+
+for (var round = 0; round < 10; round++)
+{
+  arr.forEach (function (value) { sum += value; });
+
+  var doubled = arr.map (function (value) { return value * 2; });
+  var even = doubled.filter (function (value) { return value % 4 === 0; });
+
+  assert (arr.every (function (value) { return value < size; }));
+  assert (!arr.some (function (value) { return value < 0; }));
+
+  sum += even.reduce (function (acc, value) { return acc + value; }, 0);
+  sum -= doubled.reduceRight (function (acc, value) { return acc + value; }, 0);
+}
+
+assert (sum === 10 * (size * (size - 1) / 2 + size * (size - 2) / 2 - size * (size - 1)));
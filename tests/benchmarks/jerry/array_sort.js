@@ -0,0 +1,55 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+// Arrays of numbers and strings are sorted with the default comparison and with a compare function.
+// The arrays are smaller than in similar benchmarks for larger engines, so that they fit in the heap.
+
+var size = 2000;
+var numbers = [];
+var strings = [];
+
+for (var i = 0; i < size; i++)
+{
+  var value = (i * 7919) % size;
+
+  numbers.push (value);
+  strings.push ('item' + value);
+}
+
+function compare_numbers (a, b)
+{
+  return a - b;
+}
+
+function compare_strings_reversed (a, b)
+{
+  return (a < b) ? 1 : ((a > b) ? -1 : 0);
+}
+
+for (var round = 0; round < 3; round++)
+{
+  var sorted = numbers.sort (compare_numbers);
+  assert (sorted[0] === 0 && sorted[size - 1] === size - 1);
+
+  sorted = numbers.sort ();
+  assert (sorted[0] === 0 && sorted[1] === 1 && sorted[2] === 10);
+
+  sorted = strings.sort ();
+  assert (sorted[0] === 'item0' && sorted[size - 1] === 'item999');
+
+  sorted = strings.sort (compare_strings_reversed);
+  assert (sorted[0] === 'item999' && sorted[size - 1] === 'item0');
+}
@@ -0,0 +1,49 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function make_accumulator (a, b, c)
+{
+  var total = 0, min = a, max = a, calls = 0, last = 0, span = 0;
+
+  return function (v)
+  {
+    calls++;
+    total += v * b + c;
+
+    if (v < min)
+    {
+      min = v;
+    }
+
+    if (v > max)
+    {
+      max = v;
+    }
+
+    last = v;
+    span = max - min;
+    return total + span + calls;
+  };
+}
+
+var sum = 0;
+for (var i = 0; i < 5000; i++)
+{
+  var acc = make_accumulator (i % 5, 2, 1);
+  for (var j = 0; j < 40; j++)
+  {
+    sum += acc (j % 11);
+  }
+}
+assert (sum === 46805000);
@@ -0,0 +1,41 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function sum_down (n)
+{
+  if (n === 0)
+  {
+    return 0;
+  }
+
+  var half = n / 2;
+  var rest = sum_down (n - 1);
+
+  return rest + half * 2;
+}
+
+function tree_depth (n)
+{
+  return (n < 2) ? n : 1 + Math.max (tree_depth (n - 1), tree_depth (n - 2));
+}
+
+var total = 0;
+
+for (var i = 0; i < 300; i++)
+{
+  total += sum_down (800);
+}
+
+assert (total === 300 * 800 * 801 / 2);
+assert (tree_depth (22) === 22);
@@ -0,0 +1,77 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Floating-point heavy computation: simple n-body style integration of particles,
+// and running mean / variance of the particles' positions.
+
+var count = 64;
+var steps = 400;
+var dt = 0.01;
+
+var px = [], py = [], vx = [], vy = [];
+
+for (var k = 0; k < count; k++)
+{
+  px[k] = Math.cos (k * 0.7) * 10.5;
+  py[k] = Math.sin (k * 0.3) * 7.25;
+  vx[k] = 0.1 * k - 3.2;
+  vy[k] = 1.5 - 0.05 * k;
+}
+
+function step ()
+{
+  var cx = 0.0, cy = 0.0;
+
+  for (var i = 0; i < count; i++)
+  {
+    cx += px[i];
+    cy += py[i];
+  }
+
+  cx /= count;
+  cy /= count;
+
+  for (var i = 0; i < count; i++)
+  {
+    var dx = cx - px[i];
+    var dy = cy - py[i];
+    var dist2 = dx * dx + dy * dy + 0.125;
+    var f = dt / dist2;
+
+    vx[i] = vx[i] * 0.999 + dx * f;
+    vy[i] = vy[i] * 0.999 + dy * f;
+    px[i] += vx[i] * dt;
+    py[i] += vy[i] * dt;
+  }
+}
+
+var mean = 0.0, m2 = 0.0, n = 0;
+
+for (var s = 0; s < steps; s++)
+{
+  step ();
+
+  for (var i = 0; i < count; i++)
+  {
+    n++;
+    var delta = px[i] - mean;
+    mean += delta / n;
+    m2 += delta * (px[i] - mean);
+  }
+}
+
+var variance = m2 / (n - 1);
+
+assert (variance === variance && variance >= 0.0);
+assert (mean === mean);
@@ -0,0 +1,36 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Long chain of objects that remains alive while garbage is produced,
+// so every garbage collection has to traverse the whole chain.
+
+var head = {}, tail = head;
+
+for (var k = 0; k < 3000; k++)
+{
+  tail.next = {};
+  tail = tail.next;
+}
+
+for (var i = 0; i < 200; i++)
+{
+  var garbage = {};
+
+  for (var j = 0; j < 100; j++)
+  {
+    garbage = { prev: garbage };
+  }
+}
+
+assert (tail.next === undefined);
@@ -0,0 +1,61 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Many short-lived temporary objects (object literals, arguments objects, intermediate results)
+// are created, while a set of long-lived objects remains alive and is occasionally updated.
+
+var table = [];
+
+for (var k = 0; k < 1000; k++)
+{
+  table[k] = { key: k, value: { count: 0 } };
+}
+
+function point (x, y)
+{
+  return { x: x, y: y };
+}
+
+function add (a, b)
+{
+  return point (a.x + b.x, a.y + b.y);
+}
+
+function sum ()
+{
+  var res = point (0, 0);
+
+  for (var i = 0; i < arguments.length; i++)
+  {
+    res = add (res, arguments[i]);
+  }
+
+  return res;
+}
+
+var total = 0;
+
+for (var i = 0; i < 20000; i++)
+{
+  var p = sum (point (i, 1), point (1, i), point (2, 2));
+  total += p.x - p.y;
+
+  if (i % 100 == 0)
+  {
+    table[i % 1000].value = { count: i };
+  }
+}
+
+assert (total === 0);
+assert (table[900].value.count === 19900);
@@ -0,0 +1,44 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// A document of several kilobytes is repeatedly parsed and serialized back.
+
+var records = [];
+
+for (var i = 0; i < 100; i++)
+{
+  records.push ({
+    id: i,
+    name: "record_" + i,
+    score: i * 1.5,
+    active: (i % 2 === 0),
+    tags: ["alpha", "beta\n", "gamma"],
+    position: { x: i, y: -i, label: null }
+  });
+}
+
+var text = JSON.stringify ({ records: records, count: records.length });
+var total = 0;
+
+for (var round = 0; round < 20; round++)
+{
+  var doc = JSON.parse (text);
+  total += doc.records[round].id + doc.count;
+
+  var serialized = JSON.stringify (doc);
+  assert (serialized.length === text.length);
+}
+
+assert (total === 20 * 100 + 190);
@@ -0,0 +1,49 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// An object is used as a dictionary with thousands of keys, that are looked up, updated and deleted.
+
+var keys = [];
+var size = 2000;
+
+for (var i = 0; i < size; i++)
+{
+  keys.push ('item' + i);
+}
+
+var dict = {};
+
+for (var i = 0; i < size; i++)
+{
+  dict[keys[i]] = i;
+}
+
+var sum = 0;
+
+for (var round = 0; round < 20; round++)
+{
+  for (var i = 0; i < size; i++)
+  {
+    sum += dict[keys[i]];
+  }
+
+  for (var i = round; i < size; i += 20)
+  {
+    delete dict[keys[i]];
+    dict[keys[i]] = i;
+  }
+}
+
+assert (sum === 20 * size * (size - 1) / 2);
@@ -0,0 +1,40 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Many short-lived records with the same layout are created by a constructor and by object literals,
+// and their properties are read and updated at the same places of code.
+
+function Particle (x, y, vx, vy)
+{
+  this.x = x;
+  this.y = y;
+  this.vx = vx;
+  this.vy = vy;
+}
+
+var sum = 0;
+
+for (var i = 0; i < 100000; i++)
+{
+  var p = new Particle (i, 1, 2, 3);
+  var q = { x: p.y, y: p.x, vx: p.vy, vy: p.vx };
+
+  p.x = p.x + p.vx;
+  q.y = q.y + q.vy;
+
+  sum += p.x - q.y + q.vx - p.vy;
+}
+
+assert (sum === 0);
@@ -0,0 +1,37 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Properties of a few long-lived objects are repeatedly read and updated at the same places of code.
+
+var counter = { value: 0, step: 1 };
+var config = { limit: 1000000 };
+
+function Vector (x, y)
+{
+  this.x = x;
+  this.y = y;
+}
+
+var v = new Vector (3, 4);
+var sum = 0;
+
+for (var i = 0; i < config.limit; i++)
+{
+  counter.value = counter.value + counter.step;
+  sum += v.x + v.y;
+}
+
+assert (counter.value === config.limit);
+assert (sum === 7 * config.limit);
@@ -0,0 +1,54 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Properties with names, that differ only in some of their characters, are accessed in several objects.
+
+var names = [];
+
+for (var i = 0; i < 64; i++)
+{
+  names.push ("item" + i);
+}
+
+var objects = [];
+
+for (var i = 0; i < 8; i++)
+{
+  var obj = {};
+
+  for (var j = 0; j < names.length; j++)
+  {
+    obj[names[j]] = i + j;
+  }
+
+  objects.push (obj);
+}
+
+var sum = 0;
+
+for (var round = 0; round < 300; round++)
+{
+  for (var i = 0; i < objects.length; i++)
+  {
+    var obj = objects[i];
+
+    for (var j = 0; j < names.length; j++)
+    {
+      sum += obj[names[j]];
+    }
+  }
+}
+
+assert (sum === 300 * (64 * (0 + 1 + 2 + 3 + 4 + 5 + 6 + 7) + 8 * (63 * 64 / 2)));
@@ -0,0 +1,190 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function sum ()
+{
+  var s = 0;
+  for (var i = 0; i < arguments.length; i++)
+  {
+    s += arguments[i];
+  }
+  return s;
+}
+assert (sum () === 0);
+assert (sum (1, 2, 3) === 6);
+
+// Mapped arguments alias formal parameters
+function mapped (a, b)
+{
+  a = 10;
+  assert (arguments[0] === 10);
+  arguments[1] = 20;
+  assert (b === 20);
+  arguments[2] = 30;
+  return arguments;
+}
+var args = mapped (1, 2, 3);
+assert (args.length === 3);
+assert (args[0] === 10 && args[1] === 20 && args[2] === 30);
+
+// Fewer arguments than formal parameters
+function fewer (a, b)
+{
+  a = 2;
+  assert (arguments[0] === 2);
+  assert (!arguments.hasOwnProperty ('1'));
+  return arguments.length;
+}
+assert (fewer (1) === 1);
+
+// Duplicate formal parameters: the last one is mapped
+function duplicate (a, a)
+{
+  a = 'x';
+  return arguments[0] === 1 && arguments[1] === 'x';
+}
+assert (duplicate (1, 2));
+
+// Strict mode arguments are not mapped
+function strict (a)
+{
+  'use strict';
+  a = 2;
+  assert (arguments[0] === 1);
+  try
+  {
+    arguments.callee;
+    assert (false);
+  }
+  catch (e)
+  {
+    assert (e instanceof TypeError);
+  }
+  return arguments;
+}
+var strict_args = strict (1);
+assert (strict_args[0] === 1);
+assert (Object.prototype.toString.call (strict_args) === '[object Arguments]');
+
+function callee ()
+{
+  return arguments.callee;
+}
+assert (callee () === callee);
+
+// Reconfiguration of the properties
+function reconfigure (a)
+{
+  delete arguments[0];
+  assert (arguments[0] === undefined);
+  arguments[0] = 5;
+  assert (a === 1);
+
+  Object.defineProperty (arguments, 'length', { value: 7 });
+  assert (arguments.length === 7);
+  return a;
+}
+assert (reconfigure (1) === 1);
+
+function define (a)
+{
+  Object.defineProperty (arguments, '0', { value: 2 });
+  assert (a === 2);
+  Object.defineProperty (arguments, '0', { writable: false });
+  a = 3;
+  return arguments[0];
+}
+assert (define (1) === 2);
+
+function freeze (a)
+{
+  Object.freeze (arguments);
+  arguments[0] = 2;
+  return arguments[0] === 1 && Object.isFrozen (arguments);
+}
+assert (freeze (1));
+
+function prevent_extensions (a)
+{
+  Object.preventExtensions (arguments);
+  arguments[0] = 2;
+  arguments[1] = 3;
+  return a === 2 && arguments[1] === undefined && arguments.length === 1;
+}
+assert (prevent_extensions (1));
+
+function descriptor (a)
+{
+  a = 'v';
+  var desc = Object.getOwnPropertyDescriptor (arguments, '0');
+  assert (desc.value === 'v' && desc.writable && desc.enumerable && desc.configurable);
+  a = 'w';
+  return arguments[0];
+}
+assert (descriptor (1) === 'w');
+
+// Enumeration
+function keys ()
+{
+  return Object.keys (arguments).sort ();
+}
+assert (keys ('a', 'b').join () === '0,1');
+
+function enumerate (a, b)
+{
+  var names = [];
+  for (var name in arguments)
+  {
+    names.push (name);
+  }
+  return names.sort ().join ();
+}
+assert (enumerate (1, 2, 3) === '0,1,2');
+
+function own_names ()
+{
+  return Object.getOwnPropertyNames (arguments).sort ().join ();
+}
+assert (own_names (1) === '0,callee,length');
+
+// Arguments passed to other functions
+function apply ()
+{
+  return sum.apply (undefined, arguments);
+}
+assert (apply (1, 2, 3, 4) === 10);
+
+// Properties, other than the arguments
+function other (a)
+{
+  arguments.x = a;
+  arguments[5] = 'y';
+  return arguments.x === a && arguments[5] === 'y' && arguments.length === 1 && arguments.hasOwnProperty ('x');
+}
+assert (other ({}));
+
+function has_own (a)
+{
+  return arguments.hasOwnProperty ('0') && !arguments.hasOwnProperty ('1') && ('length' in arguments);
+}
+assert (has_own (1));
+
+// Arguments object, escaping the function, keeps the bindings alive
+function escape (a)
+{
+  return function () { return arguments; } (a, function () { a++; return arguments; });
+}
+var escaped = escape (1);
+assert (escaped[0] === 1);
+assert (escaped[1] () [0] === undefined);
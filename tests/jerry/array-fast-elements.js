@@ -0,0 +1,190 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Dense arrays keep their elements in a vector, and are converted to the usual form
+// when a hole, an element with non-default attributes, or a non-writable length appears.
+
+function check_elements (arr, expected)
+{
+  assert (arr.length === expected.length);
+
+  for (var i = 0; i < expected.length; i++)
+  {
+    assert (i in arr);
+    assert (arr[i] === expected[i]);
+  }
+}
+
+var a = [1, 'two', 3.5];
+check_elements (a, [1, 'two', 3.5]);
+
+assert (a.push (4, 5) === 5);
+var obj = {};
+a[5] = obj;
+a[6] = obj;
+assert (a.length === 7 && a[5] === obj && a[6] === obj);
+assert (a.indexOf (obj) === 5 && a.indexOf (4) === 3 && a.indexOf (4, 4) === -1);
+assert (a.pop () === obj);
+assert (a.pop () === obj);
+check_elements (a, [1, 'two', 3.5, 4, 5]);
+
+/* numeric and string names address the same elements */
+a['1'] = 2;
+a[2.0] = 3;
+check_elements (a, [1, 2, 3, 4, 5]);
+assert (a[1.5] === undefined && a['01'] === undefined && a[-1] === undefined);
+
+/* non-index names don't affect the elements */
+a[1.5] = 'x';
+a[-1] = 'y';
+a[4294967295] = 'z';
+assert (a.length === 5 && a[1.5] === 'x' && a[-1] === 'y' && a[4294967295] === 'z');
+
+/* truncation */
+a.length = 2;
+check_elements (a, [1, 2]);
+assert (a[2] === undefined && !(2 in a));
+
+/* holes */
+var b = [1, 2, 3];
+b[5] = 6;
+assert (b.length === 6 && !(3 in b) && !(4 in b) && b[5] === 6);
+
+var c = [1, 2, 3];
+delete c[1];
+assert (c.length === 3 && !(1 in c) && c[2] === 3);
+
+var d = [1, 2];
+d.length = 4;
+assert (d.length === 4 && !(2 in d));
+d[2] = 3;
+d[3] = 4;
+check_elements (d, [1, 2, 3, 4]);
+
+var e = new Array (3);
+assert (e.length === 3 && !(0 in e));
+e = new Array (1, 2, 3);
+check_elements (e, [1, 2, 3]);
+
+/* elements with non-default attributes */
+var f = [1, 2, 3];
+Object.defineProperty (f, '1', { writable: false });
+f[1] = 5;
+check_elements (f, [1, 2, 3]);
+f[0] = 7;
+check_elements (f, [7, 2, 3]);
+
+var g = [1, 2];
+Object.defineProperty (g, '2', { get: function () { return 'getter'; }, configurable: true });
+assert (g.length === 3 && g[2] === 'getter');
+
+var h = [1, 2];
+Object.defineProperty (h, '0', { value: 5 });
+Object.defineProperty (h, '2', { value: 3, writable: true, enumerable: true, configurable: true });
+check_elements (h, [5, 2, 3]);
+var desc = Object.getOwnPropertyDescriptor (h, '1');
+assert (desc.value === 2 && desc.writable && desc.enumerable && desc.configurable);
+
+/* non-writable length */
+var k = [1, 2, 3];
+Object.defineProperty (k, 'length', { writable: false });
+k[3] = 4;
+assert (k.length === 3 && k[3] === undefined);
+k[0] = 0;
+check_elements (k, [0, 2, 3]);
+
+try
+{
+  k.push (4);
+  assert (false);
+}
+catch (err)
+{
+  assert (err instanceof TypeError);
+}
+
+/* non-extensible arrays */
+var l = [1, 2];
+Object.preventExtensions (l);
+l[2] = 3;
+l[0] = 0;
+check_elements (l, [0, 2]);
+
+var m = [1, 2];
+Object.freeze (m);
+m[0] = 5;
+m.length = 0;
+check_elements (m, [1, 2]);
+assert (Object.isFrozen (m));
+
+/* index properties in the prototype chain */
+Object.prototype[2] = 'proto';
+var n = [0, 1];
+assert (n[2] === 'proto' && (2 in n));
+n[2] = 2;
+assert (n[2] === 2 && Object.prototype[2] === 'proto');
+n.length = 1;
+assert (n[2] === 'proto');
+delete Object.prototype[2];
+assert (n[2] === undefined);
+
+var setter_value;
+Object.defineProperty (Array.prototype, '1', { set: function (v) { setter_value = v; }, configurable: true });
+var o = [0];
+o[1] = 'set';
+assert (setter_value === 'set' && o.length === 1);
+o.push ('pushed');
+assert (setter_value === 'pushed' && o.length === 2);
+delete Array.prototype[1];
+
+/* enumeration */
+var p = [3, 4, 5];
+p.name = 'p';
+var names = [];
+for (var name in p)
+{
+  names.push (name);
+}
+assert (names.sort ().join () === '0,1,2,name');
+assert (Object.keys (p).sort ().join () === '0,1,2,name');
+check_elements (p, [3, 4, 5]);
+
+/* elements of a fast array are listed before its named properties, regardless of insertion order */
+var r = [];
+r.x = 'x';
+r[0] = 'a';
+r.y = 'y';
+r[1] = 'b';
+names = [];
+for (var name in r)
+{
+  names.push (name);
+}
+assert (names.join () === '1,0,y,x');
+assert (Object.keys (r).join () === '1,0,y,x');
+assert (Object.getOwnPropertyNames (r).join () === '1,0,y,x,length');
+
+/* elements referencing objects survive garbage collection */
+var q = [];
+for (var i = 0; i < 100; i++)
+{
+  q[i] = { value: i };
+  q[i + 1] = [i];
+}
+for (var i = 0; i < 100; i++)
+{
+  assert (q[i].value === i);
+}
+assert (q[100][0] === 99);
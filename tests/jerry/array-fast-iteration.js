@@ -0,0 +1,160 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Iteration routines read elements of arrays in fast form directly. The callbacks can modify
+// the array being iterated, so presence of the elements is checked before each call.
+
+var arr = [1, 2, 3, 4, 5];
+var visited = [];
+
+arr.forEach (function (value, index, array) {
+  visited.push (value);
+  if (index === 1)
+  {
+    array.pop ();
+    array[10] = 11;
+  }
+});
+
+assert (visited.length === 4);
+assert (visited[0] === 1 && visited[1] === 2 && visited[2] === 3 && visited[3] === 4);
+assert (arr.length === 11);
+
+// Holes are skipped, elements appended during iteration are not visited
+arr = [1, 2, 3];
+delete arr[1];
+visited = [];
+
+arr.forEach (function (value, index, array) {
+  visited.push (index);
+  array.push (index);
+});
+
+assert (visited.length === 2);
+assert (visited[0] === 0 && visited[1] === 2);
+assert (arr.length === 5);
+
+// Elements inherited from the prototype are visited
+arr = [1, 2, 3];
+delete arr[1];
+Array.prototype[1] = 'proto';
+
+var mapped = arr.map (function (value) { return value + '!'; });
+
+assert (mapped.length === 3);
+assert (mapped[1] === 'proto!');
+
+delete Array.prototype[1];
+
+mapped = arr.map (function (value) { return value * 2; });
+
+assert (mapped.length === 3);
+assert (mapped[0] === 2 && mapped[2] === 6);
+assert (!(1 in mapped));
+
+// Array switching from fast form during iteration
+arr = [];
+
+for (var i = 0; i < 20; i++)
+{
+  arr.push (i);
+}
+
+var filtered = arr.filter (function (value, index, array) {
+  if (index === 5)
+  {
+    array.foo = 'bar';
+    Object.defineProperty (array, '15', { get: function () { return 100; } });
+  }
+  return value % 5 === 0;
+});
+
+assert (filtered.length === 4);
+assert (filtered[0] === 0 && filtered[1] === 5 && filtered[2] === 10 && filtered[3] === 100);
+
+assert (arr.every (function (value) { return typeof value === 'number'; }));
+assert (arr.some (function (value) { return value === 100; }));
+assert (!arr.some (function (value) { return value === 15; }));
+
+// Reduce with holes at the start and at the end
+arr = new Array (6);
+arr[2] = 1;
+arr[3] = 2;
+arr[4] = 3;
+
+assert (arr.reduce (function (acc, value) { return acc + value; }) === 6);
+assert (arr.reduceRight (function (acc, value) { return acc + '' + value; }) === '321');
+assert (arr.reduce (function (acc, value, index) { return acc + index; }, 0) === 9);
+
+arr = [1, 2, 3, 4];
+
+assert (arr.reduceRight (function (acc, value, index, array) {
+  array.length = 2;
+  return acc + value;
+}, 0) === 7);
+
+// Exceptions thrown by the callbacks
+var count = 0;
+
+try
+{
+  [1, 2, 3].forEach (function (value) {
+    count++;
+    if (value === 2)
+    {
+      throw value;
+    }
+  });
+  assert (false);
+}
+catch (e)
+{
+  assert (e === 2);
+  assert (count === 2);
+}
+
+// Exceptions thrown by getters of the elements
+var obj = { length: 3, 0: 'a', 2: 'c' };
+Object.defineProperty (obj, '1', { get: function () { throw 'getter'; } });
+
+try
+{
+  Array.prototype.reduce.call (obj, function (acc, value) { return acc + value; });
+  assert (false);
+}
+catch (e)
+{
+  assert (e === 'getter');
+}
+
+try
+{
+  Array.prototype.map.call ({ length: 1, get 0 () { throw 'first'; } }, function (value) { return value; });
+  assert (false);
+}
+catch (e)
+{
+  assert (e === 'first');
+}
+
+try
+{
+  new Array (2).reduce (function (acc, value) { return acc + value; });
+  assert (false);
+}
+catch (e)
+{
+  assert (e instanceof TypeError);
+}
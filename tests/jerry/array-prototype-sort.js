@@ -81,3 +81,88 @@ try {
 	assert(e.message === "foo");
 	assert(e instanceof ReferenceError);
 }
+
+// Checking that the sort is stable
+var records = [];
+for (var i = 0; i < 200; i++) {
+	records.push({ key : (i * 37) % 11, index : i });
+}
+
+var sorted = records.sort(function (a, b) { return a.key - b.key; });
+for (i = 1; i < sorted.length; i++) {
+	assert(sorted[i - 1].key < sorted[i].key
+	       || (sorted[i - 1].key === sorted[i].key && sorted[i - 1].index < sorted[i].index));
+}
+
+// Checking default comparison of numbers, that compares their string representations
+var sorted = [10, 9, 1, 100, -5, -10, 0, -1, 1000000, 99, 2.5, -2.5].sort();
+assert(sorted.join() === "-1,-10,-2.5,-5,0,1,10,100,1000000,2.5,9,99");
+
+var numbers = [];
+for (i = 0; i < 300; i++) {
+	numbers.push((i * 7919) % 1000 - 500);
+}
+
+var sorted = numbers.sort();
+for (i = 1; i < sorted.length; i++) {
+	assert(String(sorted[i - 1]) <= String(sorted[i]));
+}
+
+var sorted = numbers.sort(function (a, b) { return a - b; });
+for (i = 1; i < sorted.length; i++) {
+	assert(sorted[i - 1] <= sorted[i]);
+}
+
+// Checking arrays with already ordered and reversely ordered parts
+var runs = [];
+for (i = 0; i < 100; i++) {
+	runs.push(i);
+}
+for (i = 200; i > 100; i--) {
+	runs.push(i);
+}
+for (i = 0; i < 100; i++) {
+	runs.push(i + 0.5);
+}
+
+var sorted = runs.sort(function (a, b) { return a - b; });
+assert(sorted.length === 300);
+for (i = 1; i < sorted.length; i++) {
+	assert(sorted[i - 1] < sorted[i]);
+}
+
+// Checking that undefined values and holes are placed at the end, and are not passed to comparefn
+var sparse = [3, undefined, 1];
+sparse[5] = 2;
+var sorted = sparse.sort(function (a, b) {
+	assert(a !== undefined && b !== undefined);
+	return a - b;
+});
+assert(sorted.length === 6);
+assert(sorted[0] === 1 && sorted[1] === 2 && sorted[2] === 3);
+assert(sorted[3] === undefined && sorted[4] === undefined && sorted[5] === undefined);
+
+// Checking mixed values, that are compared by their string values
+var sorted = ["b", 10, true, null, "a", 9, { toString : function () { return "c"; } }].sort();
+assert(sorted.join() === "10,9,a,b,c,,true");
+
+// Checking that toString is called once per element
+var calls = 0;
+var counted = [];
+for (i = 0; i < 50; i++) {
+	counted.push({ value : 49 - i, toString : function () { calls++; return String(this.value + 100); } });
+}
+var sorted = counted.sort();
+assert(calls === 50);
+for (i = 0; i < sorted.length; i++) {
+	assert(sorted[i].value === i);
+}
+
+// Checking behavior when comparefn throws
+try {
+	numbers.sort(function (a, b) { if (a === b) { return 0; } throw new ReferenceError ("foo"); });
+	assert(false);
+} catch (e) {
+	assert(e.message === "foo");
+	assert(e instanceof ReferenceError);
+}
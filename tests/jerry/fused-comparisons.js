@@ -0,0 +1,117 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Comparisons, followed by conditional jumps on their results, are executed as fused opcodes
+
+function count_loop (n)
+{
+  var iterations = 0;
+  for (var i = 0; i < n; i++)
+  {
+    iterations++;
+  }
+  for (var i = n; i > 0; i--)
+  {
+    iterations++;
+  }
+  for (var i = 0; i <= n; i++)
+  {
+    iterations++;
+  }
+  for (var i = n; i >= 0; i--)
+  {
+    iterations++;
+  }
+  var j = 0;
+  while (j !== n)
+  {
+    j++;
+    iterations++;
+  }
+  do
+  {
+    j--;
+    iterations++;
+  }
+  while (j != 0);
+  return iterations;
+}
+
+assert (count_loop (10) === 10 + 10 + 11 + 11 + 10 + 10);
+
+function check (a, b)
+{
+  var res = '';
+  if (a == b) res += '=';
+  if (a != b) res += '!';
+  if (a === b) res += 'S';
+  if (a !== b) res += 'N';
+  if (a < b) res += '<';
+  if (a > b) res += '>';
+  if (a <= b) res += 'l';
+  if (a >= b) res += 'g';
+  return res;
+}
+
+assert (check (1, 2) === '!N<l');
+assert (check (2, 1) === '!N>g');
+assert (check (1, 1) === '=Slg');
+assert (check (1, '1') === '=Nlg');
+assert (check (NaN, NaN) === '!N');
+assert (check (undefined, null) === '=N');
+assert (check ('a', 'b') === '!N<l');
+
+// result of the comparison is used after the jump
+var x = 1, y = 2;
+assert ((x < y && 'yes') === 'yes');
+assert ((x > y && 'yes') === false);
+assert ((x > y || 'no') === 'no');
+assert ((x < y || 'no') === true);
+assert ((x === y ? 'eq' : 'ne') === 'ne');
+assert ((x < y) === true && (x >= y) === false);
+
+// conditional jump is also a target of the jump from the first branch of the conditional expression
+var branches = '';
+for (var k = 0; k < 4; k++)
+{
+  if (k < 2 ? k === 0 : k !== 3)
+  {
+    branches += k;
+  }
+}
+assert (branches === '02');
+
+// comparisons with NaN are false, and their negations are true
+var nan_checks = '';
+if (!(NaN < 1)) nan_checks += 'a';
+if (!(NaN <= 1)) nan_checks += 'b';
+if (!(NaN > 1)) nan_checks += 'c';
+if (!(NaN >= 1)) nan_checks += 'd';
+assert (nan_checks === 'abcd');
+
+// exceptions, thrown during comparison, are propagated
+var obj = { valueOf: function () { throw 'valueOf'; } };
+try
+{
+  if (obj < 1)
+  {
+    assert (false);
+  }
+  assert (false);
+}
+catch (e)
+{
+  assert (e === 'valueOf');
+}
@@ -0,0 +1,171 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var counter = 0;
+
+function get_counter ()
+{
+  return counter;
+}
+
+function inc_counter ()
+{
+  counter = counter + 1;
+}
+
+function get_g ()
+{
+  return g;
+}
+
+function set_g (v)
+{
+  g = v;
+}
+
+function set_g_strict (v)
+{
+  'use strict';
+  g = v;
+}
+
+// Repeated accesses to the same global variable
+for (var i = 0; i < 10; i++)
+{
+  inc_counter ();
+}
+assert (get_counter () === 10);
+assert (counter === 10);
+assert (this.counter === 10);
+
+this.counter = 20;
+assert (get_counter () === 20);
+
+// Deletion of global property
+this.g = 1;
+assert (get_g () === 1);
+set_g (2);
+assert (get_g () === 2);
+assert (delete g);
+
+try
+{
+  get_g ();
+  assert (false);
+}
+catch (e)
+{
+  assert (e instanceof ReferenceError);
+}
+
+set_g (3);
+assert (get_g () === 3);
+assert (this.g === 3);
+
+// Data property is replaced with accessor
+var stored;
+Object.defineProperty (this, 'g', { get: function () { return 'getter'; },
+                                    set: function (v) { stored = v; },
+                                    configurable: true });
+assert (get_g () === 'getter');
+set_g (4);
+assert (stored === 4);
+assert (get_g () === 'getter');
+
+// Attributes change
+Object.defineProperty (this, 'g', { value: 5, writable: true, configurable: true });
+assert (get_g () === 5);
+set_g (6);
+assert (get_g () === 6);
+
+Object.defineProperty (this, 'g', { writable: false });
+set_g (7);
+assert (get_g () === 6);
+
+try
+{
+  set_g_strict (8);
+  assert (false);
+}
+catch (e)
+{
+  assert (e instanceof TypeError);
+}
+assert (get_g () === 6);
+
+// Built-in properties of the Global object
+function get_nan ()
+{
+  return NaN;
+}
+
+function set_nan ()
+{
+  NaN = 1;
+}
+
+assert (isNaN (get_nan ()));
+set_nan ();
+assert (isNaN (get_nan ()));
+assert (Math.PI === Math.PI);
+assert (typeof Math.PI === 'number');
+
+// Variables, declared in eval code
+eval ('var ev = 1');
+function get_ev ()
+{
+  return ev;
+}
+
+assert (get_ev () === 1);
+eval ('ev = 2');
+assert (get_ev () === 2);
+assert (delete ev);
+assert (typeof ev === 'undefined');
+
+try
+{
+  get_ev ();
+  assert (false);
+}
+catch (e)
+{
+  assert (e instanceof ReferenceError);
+}
+
+// Global variables, shadowed by local ones
+function shadow ()
+{
+  assert (counter === 20);
+  eval ('var counter = 100');
+  assert (counter === 100);
+  counter = 101;
+  return counter;
+}
+
+assert (shadow () === 101);
+assert (get_counter () === 20);
+
+function shadow_with ()
+{
+  var o = { counter: 'with' };
+  with (o)
+  {
+    counter = 'with2';
+  }
+  return o.counter;
+}
+
+assert (shadow_with () === 'with2');
+assert (get_counter () === 20);
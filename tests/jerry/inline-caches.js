@@ -0,0 +1,126 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function get_x (o)
+{
+  return o.x;
+}
+
+function set_x (o, v)
+{
+  o.x = v;
+}
+
+function get_by_name (o, name)
+{
+  return o[name];
+}
+
+// Repeated accesses through the same instructions
+var obj = { x: 1, y: 2 };
+for (var i = 0; i < 10; i++)
+{
+  set_x (obj, get_x (obj) + 1);
+}
+assert (obj.x === 11);
+
+// Different objects at the same instruction
+var objs = [ { x: 'a' }, { x: 'b' }, { y: 'c' } ];
+for (var i = 0; i < 9; i++)
+{
+  var expected = (i % 3 == 0) ? 'a' : ((i % 3 == 1) ? 'b' : undefined);
+  assert (get_x (objs[i % 3]) === expected);
+}
+
+// Different names at the same instruction
+for (var i = 0; i < 4; i++)
+{
+  assert (get_by_name (obj, 'x') === 11);
+  assert (get_by_name (obj, 'y') === 2);
+  assert (get_by_name (obj, 'z') === undefined);
+}
+
+// Deletion of cached property
+assert (get_x (obj) === 11);
+delete obj.x;
+assert (get_x (obj) === undefined);
+set_x (obj, 5);
+assert (get_x (obj) === 5);
+
+// Property of prototype is shadowed by own property
+function Point () {}
+Point.prototype.x = 'proto';
+var p = new Point ();
+assert (get_x (p) === 'proto');
+assert (get_x (p) === 'proto');
+set_x (p, 'own');
+assert (get_x (p) === 'own');
+assert (Point.prototype.x === 'proto');
+delete p.x;
+assert (get_x (p) === 'proto');
+
+// Attributes change
+var frozen = { x: 1 };
+set_x (frozen, 2);
+set_x (frozen, 3);
+Object.freeze (frozen);
+set_x (frozen, 4);
+assert (get_x (frozen) === 3);
+
+// Data property is replaced with accessor
+var accessor = { x: 1 };
+assert (get_x (accessor) === 1);
+set_x (accessor, 2);
+var stored = 0;
+Object.defineProperty (accessor, 'x', { get: function () { return 'getter'; },
+                                        set: function (v) { stored = v; } });
+assert (get_x (accessor) === 'getter');
+set_x (accessor, 7);
+assert (stored === 7);
+
+// Arrays, functions and built-in objects
+var arr = [1, 2, 3];
+assert (get_by_name (arr, 'length') === 3);
+arr.length = 1;
+assert (get_by_name (arr, 'length') === 1);
+set_x (arr, 'x');
+assert (get_x (arr) === 'x');
+
+set_x (get_x, 'function');
+assert (get_x (get_x) === 'function');
+
+assert (get_by_name (Math, 'PI') === Math.PI);
+assert (get_by_name (Number, 'MAX_VALUE') === Number.MAX_VALUE);
+
+// Arguments object
+function args_x ()
+{
+  return get_by_name (arguments, '0');
+}
+assert (args_x (1) === 1);
+assert (args_x (2) === 2);
+
+// Accesses from eval code
+for (var i = 0; i < 3; i++)
+{
+  eval ('obj.x = obj.x + 1');
+}
+assert (obj.x === 8);
+
+// Objects, referenced from caches, are released upon replacement
+for (var i = 0; i < 100; i++)
+{
+  var temp = { x: i, garbage: new Array (100) };
+  assert (get_x (temp) === i);
+}
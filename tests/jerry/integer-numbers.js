@@ -0,0 +1,118 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Small integer numbers are stored directly in values, check the boundaries of the representation
+
+function is_negative_zero (x)
+{
+  return x === 0 && 1 / x === -Infinity;
+}
+
+var limits = [ 2097152, 16777216, 2147483648 ];
+
+for (var i = 0; i < limits.length; i++)
+{
+  var max = limits[i] - 1;
+  var min = -limits[i];
+
+  var a = max;
+  a++;
+  assert (a === limits[i]);
+  assert (a - 1 === max);
+  a--;
+  assert (a === max);
+
+  var b = min;
+  b--;
+  assert (b === min - 1);
+  assert (b + 1 === min);
+
+  assert (max + 1 === limits[i]);
+  assert (min - 1 === -limits[i] - 1);
+  assert (max * 2 === limits[i] * 2 - 2);
+  assert (min * -1 === limits[i]);
+  assert (min / -1 === limits[i]);
+  assert (-min === limits[i]);
+  assert (max < max + 1);
+  assert (min - 1 < min);
+  assert ((max | 0) === (limits[i] === 2147483648 ? 2147483647 : max));
+
+  var obj = { value: max };
+  obj.value++;
+  assert (obj.value === limits[i]);
+  obj.value = min;
+  obj.value--;
+  assert (obj.value === min - 1);
+}
+
+// -0 is not an integer value
+assert (is_negative_zero (-1 * 0));
+assert (is_negative_zero (0 * -5));
+assert (is_negative_zero (0 / -3));
+assert (!is_negative_zero (4 % -2));
+assert (is_negative_zero (-0));
+var z = -0;
+var z_copy = z;
+assert (is_negative_zero (z_copy));
+var z_obj = { value: 1 };
+z_obj.value = z;
+assert (is_negative_zero (z_obj.value));
+
+// results, that are not integers
+assert (7 / 2 === 3.5);
+assert (1 / 0 === Infinity);
+assert (-1 / 0 === -Infinity);
+assert (isNaN (0 / 0));
+assert (isNaN (5 % 0));
+assert (5 % 3 === 2);
+assert (-5 % 3 === -2);
+assert (5 % -3 === 2);
+
+// mixing integer and non-integer numbers
+var f = 0.5;
+f += 2;
+assert (f === 2.5);
+f += 0.5;
+assert (f === 3);
+assert (f - 3 === 0 && !is_negative_zero (f - 3));
+
+var prop_holder = { x: 1.25 };
+prop_holder.x = 3;
+assert (prop_holder.x === 3);
+prop_holder.x = 0.75;
+assert (prop_holder.x === 0.75);
+
+// bitwise operations
+assert ((-1 >>> 0) === 4294967295);
+assert ((1 << 30) === 1073741824);
+assert ((1 << 31) === -2147483648);
+assert ((-8 >> 1) === -4);
+assert ((~5) === -6);
+assert ((5 & 3) === 1);
+assert ((5 | 3) === 7);
+assert ((5 ^ 3) === 6);
+
+// relational operations
+assert (-3 < 2);
+assert (!(2 < 2));
+assert (2 <= 2);
+assert (3 >= -3);
+assert (!(-3 > 2));
+assert (1 < 1.5);
+assert (!(NaN < 1));
+
+// number to string conversions
+assert (String (-2097153) === "-2097153");
+assert (String (123) === "123");
+assert ((2097151).toString () === "2097151");
@@ -0,0 +1,206 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+function keys_of (obj)
+{
+  var keys = [];
+
+  for (var key in obj)
+  {
+    keys.push (key);
+  }
+
+  return keys.sort ().join (",");
+}
+
+assert (Object.prototype.toString.call (JSON) === "[object JSON]");
+assert (typeof JSON.parse === "function" && JSON.parse.length === 2);
+assert (typeof JSON.stringify === "function" && JSON.stringify.length === 3);
+
+// JSON.parse
+assert (JSON.parse ("1") === 1);
+assert (JSON.parse (" -12.5e1 ") === -125);
+assert (1 / JSON.parse ("-0") === -Infinity);
+assert (JSON.parse ("123456789012") === 123456789012);
+assert (JSON.parse ("true") === true && JSON.parse ("false") === false && JSON.parse ("null") === null);
+assert (JSON.parse ('"a\\"\\\\\\/\\b\\f\\n\\r\\t\\u0041\\u00e9"') === "a\"\\/\b\f\n\r\tA\u00e9");
+
+// Escaped pairs of surrogates are decoded to one code point
+var surrogate_pair = JSON.parse ('"\\ud83d\\ude00"');
+assert (surrogate_pair.length === 2);
+assert (JSON.parse ('"\ud83d\ude00"') === surrogate_pair);
+assert (JSON.parse ('"\ud83d\\ude00"') === surrogate_pair);
+assert (JSON.parse ('{"\\ud83d\\ude00": 1}')[surrogate_pair] === 1);
+assert (JSON.parse ('"\\ud83d\\ud83d\\ude00"').length === 3);
+assert (JSON.parse ('"\\ude00\\ud83d"').length === 2);
+assert (JSON.parse ('"a\\ud83db\\ude00c"').length === 5);
+
+var obj = JSON.parse ('{ "a" : 1, "b" : [1, "x", {"c": null}], "d" : {} , "" : [] }');
+assert (keys_of (obj) === ",a,b,d");
+assert (obj.a === 1);
+assert (obj.b.length === 3 && obj.b[1] === "x" && obj.b[2].c === null);
+assert (keys_of (obj.d) === "");
+assert (Array.isArray (obj[""]) && obj[""].length === 0);
+
+// Objects with same keys
+var list = JSON.parse ('[{"id": 1, "name": "a"}, {"id": 2, "name": "b"}, {"name": "c", "id": 3}]');
+assert (list.length === 3);
+assert (list[2].id === 3 && list[2].name === "c");
+
+// Duplicate keys - the last value is used
+assert (JSON.parse ('{"a": 1, "a": 2}').a === 2);
+
+var invalid = ["", "{", "}", "[1,]", "{\"a\":1,}", "{a:1}", "'a'", "01", "1.", ".5", "-", "+1", "1e", "tru", "nul",
+               "\"a", "\"\\x\"", "\"\\u12\"", "\"\t\"", "[1] 2", "NaN", "undefined"];
+
+for (var i = 0; i < invalid.length; i++)
+{
+  try
+  {
+    JSON.parse (invalid[i]);
+    assert (false);
+  }
+  catch (e)
+  {
+    assert (e instanceof SyntaxError);
+  }
+}
+
+// Reviver
+var revived = JSON.parse ('{"a": [1, 2], "b": {"c": 3}, "d": 4}', function (key, value) {
+  if (key === "d")
+  {
+    return undefined;
+  }
+
+  return (typeof value === "number") ? value * 10 : value;
+});
+
+assert (keys_of (revived) === "a,b");
+assert (revived.a[0] === 10 && revived.a[1] === 20 && revived.b.c === 30);
+
+var holder_key;
+JSON.parse ("5", function (key, value) {
+  holder_key = key;
+  assert (this[""] === 5);
+  return value;
+});
+assert (holder_key === "");
+
+// JSON.stringify
+assert (JSON.stringify (1) === "1");
+assert (JSON.stringify (-1.5) === "-1.5");
+assert (JSON.stringify (NaN) === "null" && JSON.stringify (-Infinity) === "null");
+assert (JSON.stringify ("a\"\\\b\f\n\r\t\u0001\u001f") === '"a\\"\\\\\\b\\f\\n\\r\\t\\u0001\\u001f"');
+assert (JSON.stringify (null) === "null" && JSON.stringify (true) === "true");
+assert (JSON.stringify (undefined) === undefined);
+assert (JSON.stringify (function () {}) === undefined);
+assert (JSON.stringify (new Number (3)) === "3");
+assert (JSON.stringify (new String ("s")) === '"s"');
+assert (JSON.stringify (new Boolean (false)) === "false");
+assert (JSON.stringify ([undefined, function () {}, 1]) === "[null,null,1]");
+assert (JSON.stringify ({ a: undefined, b: function () {} }) === "{}");
+assert (JSON.stringify ({ a: [] , b: {} }).length === 15);
+
+var sparse = new Array (3);
+sparse[1] = "x";
+assert (JSON.stringify (sparse) === '[null,"x",null]');
+
+// Round trip
+var text = '{"list":[1,2.5,"str",true,false,null,{"nested":[[],{}]}],"key":"value"}';
+var round_trip = JSON.parse (JSON.stringify (JSON.parse (text)));
+assert (round_trip.key === "value");
+assert (round_trip.list.length === 7 && round_trip.list[2] === "str" && round_trip.list[6].nested.length === 2);
+
+// toJSON
+assert (JSON.stringify ({ toJSON: function (key) { return "key:" + key; } }) === '"key:"');
+assert (JSON.stringify ({ a: { toJSON: function (key) { return key; } } }) === '{"a":"a"}');
+assert (JSON.stringify ([{ toJSON: function (key) { return key; } }]) === '["0"]');
+
+// Replacer function
+var replaced = JSON.stringify ({ a: 1, b: "x", c: [1, 2] }, function (key, value) {
+  if (key === "")
+  {
+    assert (this[""] === value);
+    return value;
+  }
+
+  return (typeof value === "number") ? value + 1 : (key === "b" ? undefined : value);
+});
+assert (JSON.parse (replaced).a === 2 && JSON.parse (replaced).b === undefined);
+assert (JSON.parse (replaced).c[0] === 2 && JSON.parse (replaced).c[1] === 3);
+
+// Replacer array
+var replacer_list = ["c", "a", "c", 1, new String ("b"), {}];
+assert (JSON.stringify ({ a: 1, b: 2, c: 3, 1: 4 }, replacer_list) === '{"c":3,"a":1,"1":4,"b":2}');
+assert (JSON.stringify ({ a: 1 }, []) === "{}");
+
+// Space
+assert (JSON.stringify ([1, { a: 2 }], null, 2) === '[\n  1,\n  {\n    "a": 2\n  }\n]');
+assert (JSON.stringify ({ a: 1 }, null, "--") === '{\n--"a": 1\n}');
+assert (JSON.stringify ({ a: 1 }, null, 20) === '{\n          "a": 1\n}');
+assert (JSON.stringify ({ a: 1 }, null, "12345678901234") === '{\n1234567890"a": 1\n}');
+assert (JSON.stringify ({ a: 1 }, null, new Number (1)) === '{\n "a": 1\n}');
+assert (JSON.stringify ({ a: [], b: {} }, null, 2) === '{\n  "a": [],\n  "b": {}\n}'
+        || JSON.stringify ({ a: [], b: {} }, null, 2) === '{\n  "b": {},\n  "a": []\n}');
+assert (JSON.stringify ({ a: 1 }, null, 0) === '{"a":1}');
+
+// Cyclical structures
+var cyclic = { a: {} };
+cyclic.a.b = cyclic;
+
+try
+{
+  JSON.stringify (cyclic);
+  assert (false);
+}
+catch (e)
+{
+  assert (e instanceof TypeError);
+}
+
+var cyclic_array = [1];
+cyclic_array.push (cyclic_array);
+
+try
+{
+  JSON.stringify (cyclic_array);
+  assert (false);
+}
+catch (e)
+{
+  assert (e instanceof TypeError);
+}
+
+// Same object, referenced twice, is not cyclical
+var shared = { x: 1 };
+assert (JSON.stringify ([shared, shared]) === '[{"x":1},{"x":1}]');
+
+// Exceptions are propagated
+try
+{
+  JSON.stringify ({ toJSON: function () { throw "thrown"; } });
+  assert (false);
+}
+catch (e)
+{
+  assert (e === "thrown");
+}
+
+// Pairs of surrogates are serialized as one code point
+assert (JSON.stringify ("\ud83d\ude00") === '"' + surrogate_pair + '"');
+assert (JSON.stringify ({"\ud83d\ude00": 1}) === '{"' + surrogate_pair + '":1}');
+assert (JSON.parse (JSON.stringify (surrogate_pair)) === surrogate_pair);
+assert (JSON.stringify ([[1]], null, "\ude00\ud83d").length === 17);
@@ -0,0 +1,45 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Objects that are only accessed through property lookups should not be kept alive by the lookup cache
+
+for (var i = 0; i < 20000; i++)
+{
+  var o = [1];
+  o.push (2);
+  o.x = i;
+  assert (o.length === 2 && o.x === i);
+}
+
+for (var i = 0; i < 3000; i++)
+{
+  var arr = JSON.parse ("[1, {\"a\": [2, 3]}]");
+  assert (arr.length === 2 && arr[1].a[1] === 3);
+}
+
+var records = [];
+for (var i = 0; i < 100; i++)
+{
+  records.push ({ id: i, name: "record_" + i, tags: ["alpha", "beta", "gamma"], position: { x: i, y: -i } });
+}
+
+var text = JSON.stringify ({ records: records, count: records.length });
+
+for (var round = 0; round < 30; round++)
+{
+  var doc = JSON.parse (text);
+  assert (doc.count === 100 && doc.records[round].id === round);
+  assert (JSON.stringify (doc).length === text.length);
+}
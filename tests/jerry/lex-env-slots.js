@@ -0,0 +1,137 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Captured parameters, variables and function declarations
+function counter (step)
+{
+  var count = 0;
+
+  function get ()
+  {
+    return count;
+  }
+
+  return function ()
+  {
+    count += step;
+    return get ();
+  };
+}
+
+var c1 = counter (1);
+var c2 = counter (10);
+c1 ();
+c2 ();
+assert (c1 () === 2);
+assert (c2 () === 20);
+
+// Duplicate parameters, variables with names of parameters
+function dup (a, b, a)
+{
+  var b;
+  var c = a + b;
+
+  return function ()
+  {
+    return a + ' ' + b + ' ' + c;
+  };
+}
+assert (dup (1, 2, 3) () === '3 2 5');
+assert (dup (1, 2) () === 'undefined 2 NaN');
+
+// Arguments object, mapped to the parameters
+function mapped (a, b)
+{
+  arguments[0] = 'x';
+  b = 'y';
+
+  return function ()
+  {
+    return a + b + arguments.length + arguments[1];
+  };
+}
+assert (mapped (1, 2) () === 'xy0undefined');
+
+function strict_args (a)
+{
+  'use strict';
+
+  arguments[0] = 'x';
+  a = 'y';
+
+  return arguments[0] + a;
+}
+assert (strict_args (1) === 'xy');
+
+// Bindings, named 'arguments'
+function var_arguments (a)
+{
+  var arguments;
+  return arguments[0];
+}
+assert (var_arguments ('a') === 'a');
+
+function func_arguments ()
+{
+  function arguments ()
+  {
+    return 'f';
+  }
+
+  return arguments ();
+}
+assert (func_arguments () === 'f');
+
+function param_arguments (arguments)
+{
+  return arguments;
+}
+assert (param_arguments ('p') === 'p');
+
+// Deletion of declared bindings fails
+function del ()
+{
+  var v = 1;
+  return (delete v) + ' ' + v;
+}
+assert (del () === 'false 1');
+
+// Functions with direct calls to eval and functions, created through Function constructor
+function with_eval (a)
+{
+  eval ('var e = a * 2');
+
+  return function ()
+  {
+    return e + a;
+  };
+}
+assert (with_eval (3) () === 9);
+
+var created = new Function ('a', 'b', 'var c = a * b; return function () { return c; };');
+assert (created (2, 3) () === 6);
+
+// Recursion, every call has its own environment
+function fact (n)
+{
+  var r = n;
+
+  function next ()
+  {
+    return fact (n - 1);
+  }
+
+  return (n <= 1) ? 1 : r * next ();
+}
+assert (fact (10) === 3628800);
@@ -0,0 +1,69 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Non-integer numbers are shared between copies of a value,
+// so updating one of the copies should not change the other ones.
+
+var a = 1.5;
+var b = a;
+a += 1;
+assert (a === 2.5);
+assert (b === 1.5);
+
+function locals (x)
+{
+  var y = x;
+  var z = y;
+  y *= 2;
+  z -= 0.25;
+  x++;
+  assert (x === 1.75 + 1);
+  assert (y === 3.5);
+  assert (z === 1.5);
+  return x;
+}
+
+var c = 1.75;
+assert (locals (c) === 2.75);
+assert (c === 1.75);
+
+var obj = { p: 0.5 };
+var arr = [obj.p, obj.p];
+obj.p /= 4;
+arr[0] += 10;
+assert (obj.p === 0.125);
+assert (arr[0] === 10.5);
+assert (arr[1] === 0.5);
+
+var shared = 3.25;
+var copies = [];
+for (var i = 0; i < 1000; i++)
+{
+  copies[i] = shared;
+}
+shared = -shared;
+for (var i = 0; i < 1000; i++)
+{
+  assert (copies[i] === 3.25);
+}
+
+var big = 4294967296.5;
+var big_copy = big;
+for (var i = 0; i < 10; i++)
+{
+  big += 0.25;
+}
+assert (big === 4294967299);
+assert (big_copy === 4294967296.5);
@@ -0,0 +1,129 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Objects with many properties get hashed index of the properties
+
+var dict = {};
+var n = 1000;
+
+for (var i = 0; i < n; i++)
+{
+  dict['key' + i] = i;
+}
+
+for (var i = 0; i < n; i++)
+{
+  assert (dict['key' + i] === i);
+  assert (dict.hasOwnProperty ('key' + i));
+}
+
+assert (dict['key' + n] === undefined);
+assert (!dict.hasOwnProperty ('key' + n));
+assert (Object.keys (dict).length === n);
+
+// Deletion and re-creation
+for (var i = 0; i < n; i += 3)
+{
+  assert (delete dict['key' + i]);
+}
+
+for (var i = 0; i < n; i++)
+{
+  if (i % 3 === 0)
+  {
+    assert (dict['key' + i] === undefined);
+    assert (!('key' + i in dict));
+  }
+  else
+  {
+    assert (dict['key' + i] === i);
+  }
+}
+
+for (var i = 0; i < n; i += 6)
+{
+  dict['key' + i] = -i;
+}
+
+for (var i = 0; i < n; i++)
+{
+  if (i % 6 === 0)
+  {
+    assert (dict['key' + i] === -i);
+  }
+  else if (i % 3 === 0)
+  {
+    assert (dict['key' + i] === undefined);
+  }
+  else
+  {
+    assert (dict['key' + i] === i);
+  }
+}
+
+// Enumeration visits every property once
+var seen = {};
+var count = 0;
+for (var name in dict)
+{
+  assert (seen[name] === undefined);
+  seen[name] = true;
+  count++;
+}
+assert (count === Object.keys (dict).length);
+
+// Enumeration order doesn't depend on number of properties
+function makeObject (size)
+{
+  var obj = {};
+  for (var i = 0; i < size; i++)
+  {
+    Object.defineProperty (obj, 'p' + i, { value: i, enumerable: true, configurable: true });
+  }
+  return obj;
+}
+
+var small = Object.keys (makeObject (4));
+var large = Object.keys (makeObject (40));
+assert (small.indexOf ('p0') - small.indexOf ('p3') === large.indexOf ('p0') - large.indexOf ('p3'));
+
+// Accessors and non-default attributes
+var obj = makeObject (50);
+Object.defineProperty (obj, 'acc', { get: function () { return this.p10 * 2; }, configurable: true });
+assert (obj.acc === 20);
+assert (obj.p49 === 49);
+obj.p49 = 0;
+assert (obj.p49 === 49);
+assert (delete obj.acc);
+assert (obj.acc === undefined);
+
+// Numeric keys, that have same last characters
+var nums = {};
+for (var i = 0; i < 500; i++)
+{
+  nums[i * 100] = i;
+}
+for (var i = 0; i < 500; i++)
+{
+  assert (nums[i * 100] === i);
+  assert (nums[i * 100 + 1] === undefined);
+}
+
+// Many global variables
+for (var i = 0; i < 100; i++)
+{
+  this['global' + i] = i;
+}
+assert (global0 === 0 && global99 === 99);
+assert (Math.PI > 3 && typeof Array.isArray === 'function');
@@ -0,0 +1,162 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function Point (x, y)
+{
+  this.x = x;
+  this.y = y;
+}
+
+Point.prototype.length2 = function ()
+{
+  return this.x * this.x + this.y * this.y;
+};
+
+// Objects, created by same constructor, share layout, but keep own values
+var points = [];
+for (var i = 0; i < 10; i++)
+{
+  points.push (new Point (i, 2 * i));
+}
+
+for (var i = 0; i < 10; i++)
+{
+  assert (points[i].x === i);
+  assert (points[i].y === 2 * i);
+  assert (points[i].length2 () === 5 * i * i);
+  points[i].x = 'x' + i;
+}
+
+for (var i = 0; i < 10; i++)
+{
+  assert (points[i].x === 'x' + i);
+}
+
+// Same properties, added in different order
+var a = { p: 1, q: 2 };
+var b = { q: 3, p: 4 };
+assert (a.p === 1 && a.q === 2);
+assert (b.p === 4 && b.q === 3);
+assert (Object.keys (a).sort ().join () === 'p,q');
+assert (Object.keys (b).sort ().join () === 'p,q');
+
+// Enumeration
+var o = {};
+o.c = 1;
+o.a = 2;
+o.b = 3;
+var names = [];
+for (var name in o)
+{
+  names.push (name);
+}
+assert (names.sort ().join () === 'a,b,c');
+assert (o.a === 2 && o.b === 3 && o.c === 1);
+
+// Properties with non-default attributes
+var d = new Point (1, 2);
+Object.defineProperty (d, 'z', { value: 3, writable: false });
+assert (d.x === 1 && d.y === 2 && d.z === 3);
+d.z = 4;
+assert (d.z === 3);
+d.x = 5;
+assert (d.x === 5);
+assert (Object.keys (d).sort ().join () === 'x,y');
+
+// Deletion
+var e = new Point (1, 2);
+assert (delete e.x);
+assert (e.x === undefined);
+assert (e.y === 2);
+assert (!e.hasOwnProperty ('x'));
+e.x = 3;
+assert (Object.keys (e).sort ().join () === 'x,y');
+
+// Descriptors
+var f = new Point (1, 2);
+var desc = Object.getOwnPropertyDescriptor (f, 'y');
+assert (desc.value === 2 && desc.writable && desc.enumerable && desc.configurable);
+assert (f.hasOwnProperty ('x'));
+assert (!f.hasOwnProperty ('length2'));
+
+// Frozen and non-extensible objects
+var g = new Point (1, 2);
+Object.freeze (g);
+g.x = 10;
+assert (g.x === 1);
+assert (Object.isFrozen (g));
+
+var h = new Point (1, 2);
+Object.preventExtensions (h);
+h.x = 10;
+h.z = 3;
+assert (h.x === 10);
+assert (h.z === undefined);
+
+// Accessors and read-only properties on the prototype chain
+var proto = {};
+Object.defineProperty (proto, 'r', { value: 1, writable: false });
+Object.defineProperty (proto, 's', { get: function () { return this.t * 2; }, set: function (v) { this.t = v; } });
+var k = Object.create (proto);
+k.t = 5;
+assert (k.s === 10);
+k.s = 7;
+assert (k.t === 7 && k.s === 14);
+k.r = 2;
+assert (k.r === 1);
+assert (!k.hasOwnProperty ('r'));
+
+// Objects, inherited from objects with slots
+var base = { u: 1 };
+var derived = Object.create (base);
+assert (derived.u === 1);
+derived.u = 2;
+assert (derived.u === 2 && base.u === 1);
+
+// Many properties
+var many = {};
+for (var i = 0; i < 100; i++)
+{
+  many['p' + i] = i;
+}
+for (var i = 0; i < 100; i++)
+{
+  assert (many['p' + i] === i);
+}
+assert (Object.keys (many).length === 100);
+assert (Object.keys (many).indexOf ('p70') !== -1);
+
+// Object values in slots survive garbage collection
+function Node (next)
+{
+  this.next = next;
+  this.data = [next === null ? 0 : next.data[0] + 1];
+}
+var list = null;
+for (var i = 0; i < 1000; i++)
+{
+  list = new Node (list);
+}
+for (var i = 999; i >= 0; i--)
+{
+  assert (list.data[0] === i);
+  list = list.next;
+}
+assert (list === null);
+
+// Built-in objects instantiate their properties lazily
+assert (Math.PI > 3.14 && Math.PI < 3.15);
+assert (Number.POSITIVE_INFINITY === Infinity);
+var m = Object.create (Math);
+assert (m.PI === Math.PI);
@@ -0,0 +1,162 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var v = 'global';
+
+// Variables of enclosing functions and global variables
+function outer (a)
+{
+  var b = 'outer';
+
+  function middle ()
+  {
+    var c = 'middle';
+
+    function inner ()
+    {
+      return a + b + c + v;
+    }
+
+    return inner ();
+  }
+
+  return middle ();
+}
+assert (outer ('arg') === 'argoutermiddleglobal');
+
+// Shadowing by parameters, variables and function declarations
+function shadow (v)
+{
+  function by_param ()
+  {
+    return v;
+  }
+
+  function by_var ()
+  {
+    var v = 'var';
+    return (function () { return v; }) ();
+  }
+
+  function by_func_decl ()
+  {
+    function v () {}
+    return (function () { return typeof v; }) ();
+  }
+
+  return by_param () + by_var () + by_func_decl ();
+}
+assert (shadow ('param') === 'paramvarfunction');
+
+// Names of named function expressions
+var fact = function f (n)
+{
+  return (n <= 1) ? 1 : n * (function () { return f; }) () (n - 1);
+};
+assert (fact (5) === 120);
+
+// Identifiers of catch blocks
+function catcher ()
+{
+  var e = 'outer';
+  var getter;
+
+  try
+  {
+    throw 'caught';
+  }
+  catch (e)
+  {
+    getter = function () { return e; };
+    assert (e === 'caught');
+  }
+
+  assert (e === 'outer');
+  return getter ();
+}
+assert (catcher () === 'caught');
+
+// Bindings, introduced by 'with' and eval at run-time
+function with_block (o)
+{
+  var x = 'local';
+
+  with (o)
+  {
+    return function () { return x; };
+  }
+}
+assert (with_block ({ x: 'property' }) () === 'property');
+assert (with_block ({}) () === 'local');
+
+function eval_introduced ()
+{
+  function get () { return v; }
+
+  assert (get () === 'global');
+  eval ('var v = "eval"');
+
+  return get ();
+}
+assert (eval_introduced () === 'eval');
+assert (v === 'global');
+
+function eval_nested ()
+{
+  var w = 'outer';
+
+  return (function () { return eval ('w'); }) ();
+}
+assert (eval_nested () === 'outer');
+
+// Arguments objects
+function args ()
+{
+  return (function () { return arguments.length; }) (1, 2, 3) + arguments.length;
+}
+assert (args (1) === 4);
+
+// Assignments to resolved variables
+function counter ()
+{
+  var count = 0;
+
+  return {
+    get value () { return count; },
+    increment: function () { count++; total = total + 1; }
+  };
+}
+var total = 0;
+var c = counter ();
+c.increment ();
+c.increment ();
+assert (c.value === 2);
+assert (total === 2);
+
+// Unresolvable references
+function unresolvable ()
+{
+  return (function () { return typeof not_defined_variable; }) ();
+}
+assert (unresolvable () === 'undefined');
+
+try
+{
+  (function () { return not_defined_variable; }) ();
+  assert (false);
+}
+catch (e)
+{
+  assert (e instanceof ReferenceError);
+}
@@ -0,0 +1,77 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Unit test for generational garbage collection (minor collections and the remembered set).
+ */
+
+#include "jerry.h"
+
+#include "test-common.h"
+
+/**
+ * References to new objects are stored to old objects (properties, accessors, variables of an outer function),
+ * while garbage is produced, so the new objects are kept alive only due to the remembered set.
+ */
+const char *test_source = (
+                           "function assert (arg) { "
+                           "  if (!arg) { "
+                           "    throw Error ('Assert failed'); "
+                           "  } "
+                           "} "
+                           "function make_garbage (n) { "
+                           "  var g = null; "
+                           "  for (var i = 0; i < n; i++) { "
+                           "    g = { prev: g, value: [ i ] }; "
+                           "  } "
+                           "} "
+                           "var holders = []; "
+                           "for (var i = 0; i < 32; i++) { "
+                           "  holders[i] = { inner: null }; "
+                           "} "
+                           "var closure_value = null; "
+                           "function get_closure_value () { return closure_value; } "
+                           "make_garbage (2048); "
+                           "for (var round = 0; round < 8; round++) { "
+                           "  for (var i = 0; i < 32; i++) { "
+                           "    holders[i].inner = { value: round * 32 + i, chain: { value: i } }; "
+                           "    Object.defineProperty (holders[i], 'getter', { get: function () { return i; }, "
+                           "                                                   configurable: true }); "
+                           "    make_garbage (16); "
+                           "  } "
+                           "  closure_value = { value: round }; "
+                           "  make_garbage (1024); "
+                           "  for (var i = 0; i < 32; i++) { "
+                           "    assert (holders[i].inner.value === round * 32 + i); "
+                           "    assert (holders[i].inner.chain.value === i); "
+                           "    assert (Object.getOwnPropertyDescriptor (holders[i], 'getter').get !== undefined); "
+                           "  } "
+                           "  assert (get_closure_value ().value === round); "
+                           "} "
+                           );
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_completion_code_t ret_code = jerry_run_simple ((jerry_api_char_t *) test_source,
+                                                       strlen (test_source),
+                                                       JERRY_FLAG_GC_GENERATIONAL);
+
+  JERRY_ASSERT (ret_code == JERRY_COMPLETION_CODE_OK);
+
+  return 0;
+} /* main */
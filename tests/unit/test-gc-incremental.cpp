@@ -0,0 +1,184 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Unit test for incremental garbage collection steps, interleaved with script execution.
+ */
+
+#include "jerry.h"
+#include "jerry-api.h"
+
+#include "test-common.h"
+
+/**
+ * References to old objects are moved between objects, while incremental garbage collection
+ * cycle is in progress, so the objects are kept alive only due to the garbage collector's barriers.
+ */
+const char *test_source = (
+                           "function assert (arg) { "
+                           "  if (!arg) { "
+                           "    throw Error ('Assert failed'); "
+                           "  } "
+                           "} "
+                           "var holder = {}; "
+                           "var sources = []; "
+                           "for (var i = 0; i < 64; i++) { "
+                           "  sources[i] = { inner: { value: i } }; "
+                           "} "
+                           "for (var round = 0; round < 16; round++) { "
+                           "  for (var i = 0; i < 64; i++) { "
+                           "    holder['p' + i] = sources[i].inner; "
+                           "    sources[i].inner = null; "
+                           "    gc_step (); "
+                           "  } "
+                           "  for (var i = 0; i < 64; i++) { "
+                           "    assert (holder['p' + i].value === i); "
+                           "    sources[i].inner = holder['p' + i]; "
+                           "    holder['p' + i] = null; "
+                           "    gc_step (); "
+                           "  } "
+                           "} "
+                           "function drop_native () { "
+                           "  new native_object (); "
+                           "} "
+                           );
+
+/**
+ * Number of completed garbage collection cycles
+ */
+static uint32_t test_gc_cycles = 0;
+
+/**
+ * Flag indicating that free callback of native object was invoked
+ */
+static bool test_is_free_callback_called = false;
+
+/**
+ * Perform a small step of incremental garbage collection
+ */
+static bool
+handler_gc_step (const jerry_api_object_t *function_obj_p __attr_unused___,
+                 const jerry_api_value_t *this_p __attr_unused___,
+                 jerry_api_value_t *ret_val_p __attr_unused___,
+                 const jerry_api_value_t args_p[] __attr_unused___,
+                 const jerry_api_length_t args_cnt __attr_unused___)
+{
+  if (jerry_gc_step (8))
+  {
+    test_gc_cycles++;
+  }
+
+  return true;
+} /* handler_gc_step */
+
+/**
+ * Free callback of native object
+ */
+static void
+handler_native_object_freecb (uintptr_t native_p)
+{
+  JERRY_ASSERT (native_p == (uintptr_t) 0x1234u);
+
+  test_is_free_callback_called = true;
+} /* handler_native_object_freecb */
+
+/**
+ * Construct native object
+ */
+static bool
+handler_native_object (const jerry_api_object_t *function_obj_p __attr_unused___,
+                       const jerry_api_value_t *this_p,
+                       jerry_api_value_t *ret_val_p __attr_unused___,
+                       const jerry_api_value_t args_p[] __attr_unused___,
+                       const jerry_api_length_t args_cnt __attr_unused___)
+{
+  JERRY_ASSERT (this_p != NULL
+                && this_p->type == JERRY_API_DATA_TYPE_OBJECT);
+
+  jerry_api_set_object_native_handle (this_p->v_object,
+                                      (uintptr_t) 0x1234u,
+                                      handler_native_object_freecb);
+
+  return true;
+} /* handler_native_object */
+
+/**
+ * Register native function as property of the global object
+ */
+static void
+test_register_function (jerry_api_object_t *global_obj_p, /**< global object */
+                        const char *name_p, /**< property name */
+                        jerry_external_handler_t handler_p) /**< native handler */
+{
+  jerry_api_object_t *func_obj_p = jerry_api_create_external_function (handler_p);
+  JERRY_ASSERT (func_obj_p != NULL);
+
+  jerry_api_value_t func_val;
+  func_val.type = JERRY_API_DATA_TYPE_OBJECT;
+  func_val.v_object = func_obj_p;
+
+  bool is_ok = jerry_api_set_object_field_value (global_obj_p, (jerry_api_char_t *) name_p, &func_val);
+  JERRY_ASSERT (is_ok);
+
+  jerry_api_release_object (func_obj_p);
+} /* test_register_function */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_FLAG_EMPTY);
+
+  jerry_api_object_t *global_obj_p = jerry_api_get_global ();
+  test_register_function (global_obj_p, "gc_step", handler_gc_step);
+  test_register_function (global_obj_p, "native_object", handler_native_object);
+
+  bool is_ok = jerry_parse ((jerry_api_char_t *) test_source, strlen (test_source));
+  JERRY_ASSERT (is_ok);
+
+  is_ok = (jerry_run () == JERRY_COMPLETION_CODE_OK);
+  JERRY_ASSERT (is_ok);
+  JERRY_ASSERT (test_gc_cycles > 0);
+
+  // Create an unreachable native object, and check that it is freed by incremental steps
+  jerry_api_value_t drop_native_val, res;
+  is_ok = jerry_api_get_object_field_value (global_obj_p, (jerry_api_char_t *) "drop_native", &drop_native_val);
+  JERRY_ASSERT (is_ok
+                && drop_native_val.type == JERRY_API_DATA_TYPE_OBJECT);
+
+  is_ok = jerry_api_call_function (drop_native_val.v_object, global_obj_p, &res, NULL, 0);
+  JERRY_ASSERT (is_ok);
+  jerry_api_release_value (&res);
+  jerry_api_release_value (&drop_native_val);
+
+  JERRY_ASSERT (!test_is_free_callback_called);
+
+  /* the object could be allocated during a cycle that was in progress, so it is freed in the next one */
+  for (uint32_t cycles = 0; cycles < 2; cycles++)
+  {
+    while (!jerry_gc_step (16))
+    {
+    }
+  }
+
+  JERRY_ASSERT (test_is_free_callback_called);
+
+  jerry_api_release_object (global_obj_p);
+
+  jerry_cleanup ();
+
+  return 0;
+} /* main */
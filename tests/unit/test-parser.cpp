@@ -103,12 +103,41 @@ main (int __attr_unused___ argc,
   serializer_free ();
 
   // #2
-  char program2[] = "var var;";
+  char program2[] = "var a, b; if (a < b) a = b;";
 
   serializer_init ();
   parser_set_show_opcodes (true);
   is_syntax_correct = parser_parse_script ((jerry_api_char_t *) program2, strlen (program2), &opcodes_p);
 
+  JERRY_ASSERT (is_syntax_correct && opcodes_p != NULL);
+
+  opcode_t opcodes2[] =
+  {
+    getop_meta (OPCODE_META_TYPE_SCOPE_CODE_FLAGS, // [ ]
+                OPCODE_SCOPE_CODE_FLAGS_NOT_REF_ARGUMENTS_IDENTIFIER
+                | OPCODE_SCOPE_CODE_FLAGS_NOT_REF_EVAL_IDENTIFIER,
+                INVALID_VALUE),
+    getop_reg_var_decl (OPCODE_REG_FIRST, OPCODE_REG_GENERAL_FIRST + 1),
+    getop_var_decl (0),                     // var a;
+    getop_var_decl (1),                     // var b;
+    getop_assignment (130, 6, 0),           // $tmp0 = a;
+    getop_less_than_and_jmp (131, 130, 1),  // $tmp0 < b; (fused with the following jump)
+    getop_is_false_jmp_down (131, 0, 2),    // if ($tmp1 == false) goto +2;
+    getop_assignment (0, 6, 1),             // a = b;
+    getop_ret ()                            // return;
+  };
+
+  JERRY_ASSERT (opcodes_equal (opcodes_p, opcodes2, 9));
+
+  serializer_free ();
+
+  // #3
+  char program3[] = "var var;";
+
+  serializer_init ();
+  parser_set_show_opcodes (true);
+  is_syntax_correct = parser_parse_script ((jerry_api_char_t *) program3, strlen (program3), &opcodes_p);
+
   JERRY_ASSERT (!is_syntax_correct && opcodes_p == NULL);
 
   serializer_free ();
@@ -42,10 +42,12 @@ main (int __attr_unused___ argc,
   for (uint32_t i = 0; i < test_iters; i++)
   {
     mem_pool_state_t* pool_p = (mem_pool_state_t*) test_pool;
+    const mem_pool_size_class_t size_class = (mem_pool_size_class_t) (i % MEM_POOL_SIZE_CLASSES_NUMBER);
+    const size_t chunk_size = MEM_POOL_CLASS_CHUNK_SIZE (size_class);
 
     JERRY_ASSERT (MEM_POOL_SIZE <= TEST_POOL_SPACE_SIZE);
 
-    mem_pool_init (pool_p, MEM_POOL_SIZE);
+    mem_pool_init (pool_p, MEM_POOL_SIZE, size_class);
 
     const size_t subiters = ((size_t) rand () % test_max_sub_iters) + 1;
 
@@ -55,11 +57,11 @@ main (int __attr_unused___ argc,
       {
         ptrs[j] = mem_pool_alloc_chunk (pool_p);
 
-        memset (ptrs[j], 0, MEM_POOL_CHUNK_SIZE);
+        memset (ptrs[j], 0, chunk_size);
       }
       else
       {
-        JERRY_ASSERT (j >= MEM_POOL_CHUNKS_NUMBER);
+        JERRY_ASSERT (j >= MEM_POOL_CLASS_CHUNKS_NUMBER (size_class));
 
         ptrs[j] = NULL;
       }
@@ -71,7 +73,7 @@ main (int __attr_unused___ argc,
     {
       if (ptrs[j] != NULL)
       {
-        for (size_t k = 0; k < MEM_POOL_CHUNK_SIZE; k++)
+        for (size_t k = 0; k < chunk_size; k++)
         {
           JERRY_ASSERT (((uint8_t*)ptrs[j])[k] == 0);
         }
@@ -0,0 +1,131 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Benchmark of chunk freeing in pool manager, depending on number of pools.
+ *
+ * Cost of mem_pools_free should not depend on number of allocated pools.
+ */
+
+#define JERRY_MEM_POOL_INTERNAL
+
+#include "mem-allocator.h"
+#include "mem-pool.h"
+#include "mem-poolman.h"
+
+#include "test-common.h"
+
+// Numbers of pools to measure free cost with
+const size_t test_pools_numbers[] = { 4, 16, 64, 256 };
+
+// Number of measurement rounds for each number of pools
+const uint32_t test_rounds = 8;
+
+// Upper estimation of number of chunks that are allocated simultaneously
+#define test_max_chunks (MEM_HEAP_AREA_SIZE / MEM_POOL_CHUNK_SIZE)
+
+uint8_t *ptrs[test_max_chunks];
+
+/**
+ * Get current time in microseconds
+ */
+static uint64_t
+test_get_time_us (void)
+{
+  struct timeval tv;
+
+  gettimeofday (&tv, NULL);
+
+  return (uint64_t) tv.tv_sec * 1000000ull + (uint64_t) tv.tv_usec;
+} /* test_get_time_us */
+
+/**
+ * Shuffle first 'count' elements of ptrs array
+ */
+static void
+test_shuffle (size_t count) /**< number of elements to shuffle */
+{
+  for (size_t i = count; i > 1; i--)
+  {
+    size_t j = (size_t) rand () % i;
+
+    uint8_t *tmp_p = ptrs[i - 1];
+    ptrs[i - 1] = ptrs[j];
+    ptrs[j] = tmp_p;
+  }
+} /* test_shuffle */
+
+int
+main (int __attr_unused___ argc,
+      char __attr_unused___ **argv)
+{
+  TEST_INIT ();
+
+  mem_init ();
+
+  printf ("Pools | Frees | Time (us) | Time per free (ns)\n");
+
+  for (size_t k = 0; k < sizeof (test_pools_numbers) / sizeof (test_pools_numbers[0]); k++)
+  {
+    const size_t pools_number = test_pools_numbers[k];
+    const size_t chunks_number = pools_number * MEM_POOL_CHUNKS_NUMBER;
+
+    JERRY_ASSERT (chunks_number <= test_max_chunks);
+
+    uint64_t total_time_us = 0;
+    size_t total_frees = 0;
+
+    for (uint32_t round = 0; round < test_rounds; round++)
+    {
+      for (size_t i = 0; i < chunks_number; i++)
+      {
+        ptrs[i] = mem_pools_alloc ();
+        JERRY_ASSERT (ptrs[i] != NULL);
+      }
+
+      test_shuffle (chunks_number);
+
+      /*
+       * Free a half of the chunks in random order, so that pools remain allocated during measurement
+       */
+      const size_t measured_frees = chunks_number / 2;
+
+      uint64_t start_us = test_get_time_us ();
+
+      for (size_t i = 0; i < measured_frees; i++)
+      {
+        mem_pools_free (ptrs[i]);
+      }
+
+      total_time_us += test_get_time_us () - start_us;
+      total_frees += measured_frees;
+
+      for (size_t i = measured_frees; i < chunks_number; i++)
+      {
+        mem_pools_free (ptrs[i]);
+      }
+    }
+
+    printf ("%5lu | %5lu | %9lu | %lu\n",
+            (unsigned long) pools_number,
+            (unsigned long) total_frees,
+            (unsigned long) total_time_us,
+            (unsigned long) (total_time_us * 1000u / total_frees));
+  }
+
+  mem_finalize (false);
+
+  return 0;
+} /* main */
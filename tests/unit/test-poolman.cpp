@@ -32,6 +32,7 @@ const uint32_t test_iters = 16384;
 const uint32_t test_max_sub_iters = 32;
 
 uint8_t *ptrs[test_max_sub_iters];
+size_t sizes[test_max_sub_iters];
 
 int
 main (int __attr_unused___ argc,
@@ -47,12 +48,21 @@ main (int __attr_unused___ argc,
 
     for (size_t j = 0; j < subiters; j++)
     {
-      ptrs[j] = mem_pools_alloc ();
+      if (rand () % 2)
+      {
+        sizes[j] = MEM_POOL_CHUNK_SIZE;
+        ptrs[j] = mem_pools_alloc ();
+      }
+      else
+      {
+        sizes[j] = ((size_t) rand () % MEM_POOL_MAX_CHUNK_SIZE) + 1;
+        ptrs[j] = mem_pools_alloc_sized (sizes[j]);
+      }
       // JERRY_ASSERT (ptrs[j] != NULL);
 
       if (ptrs[j] != NULL)
       {
-        memset (ptrs[j], 0, MEM_POOL_CHUNK_SIZE);
+        memset (ptrs[j], (int) j, sizes[j]);
       }
     }
 
@@ -62,9 +72,9 @@ main (int __attr_unused___ argc,
     {
       if (ptrs[j] != NULL)
       {
-        for (size_t k = 0; k < MEM_POOL_CHUNK_SIZE; k++)
+        for (size_t k = 0; k < sizes[j]; k++)
         {
-          JERRY_ASSERT (((uint8_t*) ptrs[j])[k] == 0);
+          JERRY_ASSERT (((uint8_t*) ptrs[j])[k] == (uint8_t) j);
         }
 
         mem_pools_free (ptrs[j]);
@@ -201,6 +201,18 @@ main (int __attr_unused___ argc,
   lit_utf8_byte_t valid_utf8_string_2[] = {0xF1, 0x90, 0x9F, 0xB0};
   JERRY_ASSERT (lit_is_utf8_string_valid (valid_utf8_string_2, sizeof (valid_utf8_string_2)));
 
+  /* Isolated high surrogate 0xD901, followed by 'a' and isolated low surrogate 0xDFF0 */
+  lit_utf8_byte_t valid_utf8_string_3[] = {0xED, 0xA4, 0x81, 0x61, 0xED, 0xBF, 0xB0};
+  JERRY_ASSERT (lit_is_utf8_string_valid (valid_utf8_string_3, sizeof (valid_utf8_string_3)));
+
+  /* Pair of surrogates is replaced with 4-byte long utf-8 character, isolated surrogates are kept */
+  lit_utf8_byte_t surrogates_string[] = {0x61, 0xED, 0xA4, 0x81, 0xED, 0xBF, 0xB0, 0xED, 0xA4, 0x81, 0x62};
+  lit_utf8_byte_t combined_string[] = {0x61, 0xF1, 0x90, 0x9F, 0xB0, 0xED, 0xA4, 0x81, 0x62};
+  lit_utf8_size_t combined_size = lit_utf8_string_combine_surrogates (surrogates_string, sizeof (surrogates_string));
+  JERRY_ASSERT (combined_size == sizeof (combined_string));
+  JERRY_ASSERT (memcmp (surrogates_string, combined_string, combined_size) == 0);
+  JERRY_ASSERT (lit_is_utf8_string_valid (surrogates_string, combined_size));
+
   lit_utf8_byte_t buf[] = {0xF0, 0x90, 0x8D, 0x88};
   lit_code_point_t code_point;
   lit_utf8_size_t bytes_count = lit_read_code_point_from_utf8 (buf, sizeof (buf), &code_point);